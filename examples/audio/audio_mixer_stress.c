@@ -0,0 +1,204 @@
+/*******************************************************************************************
+*
+*   raylib [audio] example - Mixer stress test (headless)
+*
+*   Example originally created with raylib 5.5, last time updated with raylib 5.5
+*
+*   Plays 64 sounds with volume/pitch/pan updates every frame, one audio stream restarted
+*   several times and sounds, aliases and stream processors loaded/unloaded while mixing,
+*   then reports audio device callback timing and stream chunks order
+*
+*   NOTE: No window is created, to run it on a system without audio output build raylib
+*   with miniaudio null backend: -DMA_ENABLE_ONLY_SPECIFIC_BACKENDS -DMA_ENABLE_NULL
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>                  // Required for: printf()
+#include <math.h>                   // Required for: sinf(), roundf()
+
+#if defined(_WIN32)
+    // NOTE: We declare Sleep() function symbol to avoid including windows.h
+    void __stdcall Sleep(unsigned long msTimeout);
+    #define WaitMilliseconds(ms) Sleep(ms)
+#else
+    #include <time.h>               // Required for: nanosleep()
+    #define WaitMilliseconds(ms) nanosleep(&(struct timespec){ 0, (ms)*1000000L }, NULL)
+#endif
+
+#define MAX_SOUNDS          64      // Sounds playing at the same time
+#define STREAM_CHUNK_FRAMES 1024    // Audio stream chunk size (frames)
+#define STREAM_SESSIONS     12      // Audio stream stop/play sessions
+#define SESSION_CHUNKS      40      // Chunks played on every session (less than 64)
+#define FRAME_TIME_MS       4       // Program frame time (milliseconds)
+
+// Stream chunks are filled with a constant sample value encoding session and chunk:
+// value = (session*64 + chunk)/1024, chunks are numbered from 1 on every session
+// NOTE: Resampling to device sample rate smooths chunks boundaries, a chunk is received
+// once its value is kept for some consecutive samples
+static int lastChunkCode = 0;       // Last chunk code received by stream processor
+static int candidateCode = 0;       // Chunk code being received
+static int candidateSamples = 0;    // Consecutive samples received with candidate code
+static int chunkOrderErrors = 0;    // Chunks received out of order (reordered, skipped or stale)
+static int sessionStarts = 0;       // Sessions started with chunk 1
+
+//------------------------------------------------------------------------------------
+// Stream processor, checks chunks order (runs on audio thread)
+//------------------------------------------------------------------------------------
+static void CheckStreamChunks(void *buffer, unsigned int frames)
+{
+    float *samples = (float *)buffer;
+
+    for (unsigned int i = 0; i < frames; i++)
+    {
+        int code = (int)roundf(samples[i]*1024.0f);
+
+        if (code != candidateCode)
+        {
+            candidateCode = code;
+            candidateSamples = 0;
+        }
+
+        candidateSamples++;
+
+        // Stream underrun (silence), same chunk or chunk not received yet
+        if ((code == 0) || (code == lastChunkCode) || (candidateSamples < 32)) continue;
+
+        if ((code%64 == 1) && ((code/64) > (lastChunkCode/64))) sessionStarts++;
+        else if (code != (lastChunkCode + 1)) chunkOrderErrors++;
+
+        lastChunkCode = code;
+    }
+}
+
+// Stream processor attached and detached while mixing
+static void EmptyProcessor(void *buffer, unsigned int frames) { (void)buffer; (void)frames; }
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    RaylibInitAudioDevice();
+
+    if (!RaylibIsAudioDeviceReady())
+    {
+        printf("Audio device could not be initialized\n");
+        return 1;
+    }
+
+    // Generate a 0.25 seconds sine wave, 44100 Hz, 16 bit, mono
+    RaylibWave wave = { 0 };
+    wave.frameCount = 11025;
+    wave.sampleRate = 44100;
+    wave.sampleSize = 16;
+    wave.channels = 1;
+    wave.data = RaylibMemAlloc(wave.frameCount*sizeof(short));
+
+    for (unsigned int i = 0; i < wave.frameCount; i++) ((short *)wave.data)[i] = (short)(sinf(2.0f*RAYLIB_PI*440.0f*i/44100.0f)*8000.0f);
+
+    RaylibSound sounds[MAX_SOUNDS] = { 0 };
+    for (int i = 0; i < MAX_SOUNDS; i++) sounds[i] = RaylibLoadSoundFromWave(wave);
+
+    // Sound update data, using sound buffer format (converted to device format on loading)
+    unsigned int soundSamples = sounds[0].frameCount*sounds[0].stream.channels;
+    float *soundData = (float *)RaylibMemAlloc(soundSamples*sizeof(float));
+    for (unsigned int i = 0; i < soundSamples; i++) soundData[i] = sinf(2.0f*RAYLIB_PI*i/64.0f)*0.25f;
+
+    RaylibSetAudioStreamBufferSizeDefault(STREAM_CHUNK_FRAMES);
+    RaylibAudioStream stream = RaylibLoadAudioStream(44100, 32, 1);
+    RaylibAttachAudioStreamProcessor(stream, CheckStreamChunks);
+
+    float chunk[STREAM_CHUNK_FRAMES] = { 0 };
+    int session = 0;
+    int sessionChunk = 0;
+    int frame = 0;
+
+    RaylibResetAudioMixerStats();
+    //--------------------------------------------------------------------------------------
+
+    // Main loop
+    while (session < STREAM_SESSIONS)
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        // Sounds are retriggered and their parameters updated every frame
+        for (int i = 0; i < MAX_SOUNDS; i++)
+        {
+            if (!RaylibIsSoundPlaying(sounds[i])) RaylibPlaySound(sounds[i]);
+
+            RaylibSetSoundVolume(sounds[i], 0.2f + 0.2f*((frame + i)%4));
+            RaylibSetSoundPitch(sounds[i], 0.75f + 0.05f*((frame + i)%10));
+            RaylibSetSoundPan(sounds[i], 0.1f*((frame + i)%11));
+        }
+
+        // Sound unloaded while playing and loaded again, alias and processor churn
+        if ((frame%25) == 0)
+        {
+            int index = frame%MAX_SOUNDS;
+            RaylibUnloadSound(sounds[index]);
+            sounds[index] = RaylibLoadSoundFromWave(wave);
+
+            RaylibSound alias = RaylibLoadSoundAlias(sounds[index]);
+            RaylibPlaySound(alias);
+            RaylibUnloadSoundAlias(alias);
+
+            RaylibAttachAudioStreamProcessor(stream, EmptyProcessor);
+        }
+        else if ((frame%25) == 12) RaylibDetachAudioStreamProcessor(stream, EmptyProcessor);
+
+        // Sound data updated while playing
+        if ((frame%50) == 30) RaylibUpdateSound(sounds[1], soundData, sounds[1].frameCount);
+
+        // Stream chunks are queued in order, stream is stopped and restarted after every session
+        while ((sessionChunk < SESSION_CHUNKS) && ((sessionChunk == 0) || RaylibIsAudioStreamProcessed(stream)))
+        {
+            sessionChunk++;
+            for (int i = 0; i < STREAM_CHUNK_FRAMES; i++) chunk[i] = (float)((session + 1)*64 + sessionChunk)/1024.0f;
+
+            RaylibUpdateAudioStream(stream, chunk, STREAM_CHUNK_FRAMES);
+            if (sessionChunk == 1) RaylibPlayAudioStream(stream);
+        }
+
+        if ((sessionChunk == SESSION_CHUNKS) && RaylibIsAudioStreamProcessed(stream))
+        {
+            RaylibStopAudioStream(stream);
+            sessionChunk = 0;
+            session++;
+        }
+
+        frame++;
+        WaitMilliseconds(FRAME_TIME_MS);
+        //----------------------------------------------------------------------------------
+    }
+
+    RaylibAudioMixerStats stats = RaylibGetAudioMixerStats();
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    RaylibDetachAudioStreamProcessor(stream, EmptyProcessor);
+    RaylibDetachAudioStreamProcessor(stream, CheckStreamChunks);
+    RaylibUnloadAudioStream(stream);
+
+    for (int i = 0; i < MAX_SOUNDS; i++) RaylibUnloadSound(sounds[i]);
+    RaylibUnloadWave(wave);
+    RaylibMemFree(soundData);
+
+    RaylibCloseAudioDevice();
+    //--------------------------------------------------------------------------------------
+
+    // NOTE: Stream processor counters are read once audio device is closed
+    printf("Frames: %i | Stream sessions started: %i/%i | Chunks out of order: %i\n", frame, sessionStarts, STREAM_SESSIONS, chunkOrderErrors);
+    printf("Callbacks: %u | Commands applied: %u | Last callback: %.3f ms | Worst callback: %.3f ms\n",
+        stats.callbackCount, stats.commandCount, stats.lastCallbackTime*1000.0f, stats.maxCallbackTime*1000.0f);
+
+    return ((sessionStarts == STREAM_SESSIONS) && (chunkOrderErrors == 0))? 0 : 1;
+}
@@ -0,0 +1,158 @@
+/*******************************************************************************************
+*
+*   raylib [core] example - Hash functions test vectors (headless)
+*
+*   Example originally created with raylib 5.5, last time updated with raylib 5.5
+*
+*   Checks RaylibComputeCRC32(), RaylibComputeMD5(), RaylibComputeSHA1() and RaylibComputeXXH64()
+*   against published test vectors, incremental hashing against one-shot hashing
+*   with random split points and measures hashing throughput
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>                  // Required for: printf(), sprintf()
+#include <string.h>                 // Required for: strlen(), strcmp(), memcpy(), memcmp()
+#include <time.h>                   // Required for: clock()
+
+#define STREAM_TESTS        200     // Random data incremental hashing tests
+#define STREAM_MAX_SIZE     200000  // Random data maximum size (bytes)
+#define BENCHMARK_SIZE      (64*1024*1024)  // Hashing throughput buffer size (bytes)
+
+// Test vector, expected hash codes as hexadecimal strings (xxHash64 with seed 0)
+typedef struct HashVector {
+    const char *text;
+    int repeat;                     // Text repetitions in hashed data
+    const char *crc32;
+    const char *md5;
+    const char *sha1;
+    const char *xxh64;
+} HashVector;
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const HashVector vectors[] = {
+        { "", 1, "00000000", "d41d8cd98f00b204e9800998ecf8427e", "da39a3ee5e6b4b0d3255bfef95601890afd80709", "ef46db3751d8e999" },
+        { "a", 1, "e8b7be43", "0cc175b9c0f1b6a831c399e269772661", "86f7e437faa5a7fce15d1ddcb9eaeaea377667b8", "d24ec4f1a98c6e5b" },
+        { "abc", 1, "352441c2", "900150983cd24fb0d6963f7d28e17f72", "a9993e364706816aba3e25717850c26c9cd0d89d", "44bc2cf5ad770999" },
+        { "123456789", 1, "cbf43926", "25f9e794323b453885f5181f1b624d0b", "f7c3bc1d808e04732adf679965ccc34ca7ae3441", "8cb841db40e6ae83" },
+        { "message digest", 1, "20159d7f", "f96b697d7cb7938d525a2f31aaf161d0", "c12252ceda8be8994d5fa0290a47231c1d16aae3", "066ed728fceeb3be" },
+        { "The quick brown fox jumps over the lazy dog", 1, "414fa339", "9e107d9d372bb6826bd81d3542a419d6", "2fd4e1c67a2d28fced849ee1bb76e7391b93eb12", "0b242d361fda71bc" },
+        { "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 1, "171a3f5f", "8215ef0796a20bcaaae116d3876c664a", "84983e441c3bd26ebaae4aa1f95129e5e54670f1", "f06103773e8585df" },
+        { "1234567890", 8, "7ca94a72", "57edf4a22be3c955ac49da2e2107b67a", "50abf5706a150990a08b2c5ea40fa0e585554732", "e04a477f19ee145d" },
+        { "a", 1000000, "dc25bfbc", "7707d6ae4e027c70eea2a935c2296f21", "34aa973cd4c4daa4f61eeb2bdbad27316534016f", "dc483aaa9b4fdc40" },
+    };
+
+    const int vectorCount = sizeof(vectors)/sizeof(HashVector);
+    int failures = 0;
+
+    unsigned char *data = (unsigned char *)RaylibMemAlloc(BENCHMARK_SIZE);
+    char hex[41] = { 0 };
+    //--------------------------------------------------------------------------------------
+
+    // Test vectors
+    //--------------------------------------------------------------------------------------
+    for (int v = 0; v < vectorCount; v++)
+    {
+        int textLength = (int)strlen(vectors[v].text);
+        int dataSize = textLength*vectors[v].repeat;
+        for (int i = 0; i < vectors[v].repeat; i++) memcpy(data + i*textLength, vectors[v].text, textLength);
+
+        sprintf(hex, "%08x", RaylibComputeCRC32(data, dataSize));
+        if (strcmp(hex, vectors[v].crc32) != 0) { printf("CRC32 failed: vector %i -> %s\n", v, hex); failures++; }
+
+        // NOTE: MD5 hash words are stored as little-endian bytes, SHA1 hash words as big-endian bytes
+        unsigned int *md5 = RaylibComputeMD5(data, dataSize);
+        for (int i = 0; i < 16; i++) sprintf(hex + i*2, "%02x", (md5[i/4] >> (8*(i%4))) & 0xff);
+        if (strcmp(hex, vectors[v].md5) != 0) { printf("MD5 failed: vector %i -> %s\n", v, hex); failures++; }
+
+        unsigned int *sha1 = RaylibComputeSHA1(data, dataSize);
+        for (int i = 0; i < 5; i++) sprintf(hex + i*8, "%08x", sha1[i]);
+        if (strcmp(hex, vectors[v].sha1) != 0) { printf("SHA1 failed: vector %i -> %s\n", v, hex); failures++; }
+
+        sprintf(hex, "%016llx", RaylibComputeXXH64(data, dataSize, 0));
+        if (strcmp(hex, vectors[v].xxh64) != 0) { printf("XXH64 failed: vector %i -> %s\n", v, hex); failures++; }
+    }
+
+    printf("Test vectors: %i checked, %i failed\n", vectorCount*4, failures);
+    //--------------------------------------------------------------------------------------
+
+    // Incremental hashing with random split points must match one-shot hashing
+    //--------------------------------------------------------------------------------------
+    RaylibSetRandomSeed(1234);
+    int streamFailures = 0;
+
+    for (int t = 0; t < STREAM_TESTS; t++)
+    {
+        int dataSize = RaylibGetRandomValue(0, STREAM_MAX_SIZE);
+        for (int i = 0; i < dataSize; i++) data[i] = (unsigned char)RaylibGetRandomValue(0, 255);
+
+        unsigned int crc = 0;
+        unsigned int md5[4] = { 0 };
+        unsigned int sha1[5] = { 0 };
+        RaylibHashState md5State = { 0 };
+        RaylibHashState sha1State = { 0 };
+        RaylibInitHashMD5(&md5State);
+        RaylibInitHashSHA1(&sha1State);
+
+        for (int offset = 0; offset < dataSize; )
+        {
+            int size = RaylibGetRandomValue(0, (RaylibGetRandomValue(0, 1) == 0)? 70 : 5000);
+            if (size > (dataSize - offset)) size = dataSize - offset;
+
+            crc = RaylibUpdateCRC32(crc, data + offset, size);
+            RaylibUpdateHashMD5(&md5State, data + offset, size);
+            RaylibUpdateHashSHA1(&sha1State, data + offset, size);
+            offset += size;
+        }
+
+        RaylibFinishHashMD5(&md5State, md5);
+        RaylibFinishHashSHA1(&sha1State, sha1);
+
+        if ((crc != RaylibComputeCRC32(data, dataSize)) ||
+            (memcmp(md5, RaylibComputeMD5(data, dataSize), sizeof(md5)) != 0) ||
+            (memcmp(sha1, RaylibComputeSHA1(data, dataSize), sizeof(sha1)) != 0)) streamFailures++;
+    }
+
+    printf("Incremental hashing: %i random sizes (0-%i bytes) checked, %i failed\n", STREAM_TESTS, STREAM_MAX_SIZE, streamFailures);
+    //--------------------------------------------------------------------------------------
+
+    // Hashing throughput
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < BENCHMARK_SIZE; i++) data[i] = (unsigned char)(i*2654435761u >> 24);
+
+    volatile unsigned long long sink = 0;
+    const char *names[4] = { "CRC32", "MD5", "SHA1", "XXH64" };
+
+    for (int h = 0; h < 4; h++)
+    {
+        clock_t start = clock();
+
+        if (h == 0) sink += RaylibComputeCRC32(data, BENCHMARK_SIZE);
+        else if (h == 1) sink += RaylibComputeMD5(data, BENCHMARK_SIZE)[0];
+        else if (h == 2) sink += RaylibComputeSHA1(data, BENCHMARK_SIZE)[0];
+        else sink += RaylibComputeXXH64(data, BENCHMARK_SIZE, 0);
+
+        double seconds = (double)(clock() - start)/CLOCKS_PER_SEC;
+        printf("%-6s %8.1f MB/s\n", names[h], (seconds > 0.0)? (BENCHMARK_SIZE/(1024.0*1024.0))/seconds : 0.0);
+    }
+    //--------------------------------------------------------------------------------------
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    RaylibMemFree(data);
+    //--------------------------------------------------------------------------------------
+
+    return ((failures == 0) && (streamFailures == 0))? 0 : 1;
+}
@@ -0,0 +1,157 @@
+/*******************************************************************************************
+*
+*   raylib [models] example - Mesh BVH ray collision check (headless)
+*
+*   Example originally created with raylib 5.5, last time updated with raylib 5.5
+*
+*   Checks RaylibGetRayCollisionMeshBVH() and RaylibGetRayCollisionMeshBVHBatch() results against
+*   brute force RaylibGetRayCollisionMesh() on a bumpy sphere mesh, with a regular and a mirrored
+*   (negative scale) transform, and measures BVH building and ray queries time
+*
+*   NOTE: Mesh is generated on CPU only, no window or GPU upload is required
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "raymath.h"
+
+#include <stdio.h>                  // Required for: printf()
+#include <math.h>                   // Required for: sinf(), cosf(), fabsf()
+#include <time.h>                   // Required for: clock()
+
+#define SPHERE_RINGS        500     // Sphere rings, triangles: 2*rings*slices
+#define SPHERE_SLICES       500     // Sphere slices
+#define RAY_COUNT           200     // Random rays checked
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    // Bumpy sphere mesh, non-indexed triangles
+    RaylibMesh mesh = { 0 };
+    mesh.triangleCount = 2*SPHERE_RINGS*SPHERE_SLICES;
+    mesh.vertexCount = mesh.triangleCount*3;
+    mesh.vertices = (float *)RaylibMemAlloc(mesh.vertexCount*3*sizeof(float));
+
+    RaylibVector3 *vertices = (RaylibVector3 *)mesh.vertices;
+    int vertex = 0;
+
+    for (int ring = 0; ring < SPHERE_RINGS; ring++)
+    {
+        for (int slice = 0; slice < SPHERE_SLICES; slice++)
+        {
+            RaylibVector3 corners[4] = { 0 };
+
+            for (int k = 0; k < 4; k++)
+            {
+                float theta = RAYLIB_PI*(float)(ring + k/2)/SPHERE_RINGS;
+                float phi = 2.0f*RAYLIB_PI*(float)(slice + k%2)/SPHERE_SLICES;
+                float radius = 1.0f + 0.05f*sinf(8.0f*theta)*sinf(8.0f*phi);
+
+                corners[k] = (RaylibVector3){ radius*sinf(theta)*cosf(phi), radius*cosf(theta), radius*sinf(theta)*sinf(phi) };
+            }
+
+            vertices[vertex++] = corners[0]; vertices[vertex++] = corners[2]; vertices[vertex++] = corners[1];
+            vertices[vertex++] = corners[1]; vertices[vertex++] = corners[2]; vertices[vertex++] = corners[3];
+        }
+    }
+
+    // Random rays from a sphere around the mesh, aimed near its center (some miss it)
+    RaylibSetRandomSeed(1234);
+    RaylibRay rays[RAY_COUNT] = { 0 };
+
+    for (int i = 0; i < RAY_COUNT; i++)
+    {
+        RaylibVector3 origin = { (float)RaylibGetRandomValue(-1000, 1000), (float)RaylibGetRandomValue(-1000, 1000), (float)RaylibGetRandomValue(-1000, 1000) };
+        RaylibVector3 target = { (float)RaylibGetRandomValue(-1000, 1000), (float)RaylibGetRandomValue(-1000, 1000), (float)RaylibGetRandomValue(-1000, 1000) };
+
+        rays[i].position = RaylibVector3Add(RaylibVector3Scale(RaylibVector3Normalize(origin), 6.0f), (RaylibVector3){ 0.0f, 1.0f, 0.0f });
+        rays[i].direction = RaylibVector3Normalize(RaylibVector3Subtract(RaylibVector3Add(RaylibVector3Scale(target, 0.002f), (RaylibVector3){ 0.0f, 1.0f, 0.0f }), rays[i].position));
+    }
+
+    RaylibMatrix transforms[2] = {
+        RaylibMatrixMultiply(RaylibMatrixMultiply(RaylibMatrixScale(1.5f, 1.2f, 1.5f), RaylibMatrixRotateXYZ((RaylibVector3){ 0.4f, 1.1f, -0.3f })), RaylibMatrixTranslate(0.0f, 1.0f, 0.0f)),
+        RaylibMatrixMultiply(RaylibMatrixMultiply(RaylibMatrixScale(-1.5f, 1.2f, 1.5f), RaylibMatrixRotateXYZ((RaylibVector3){ 0.4f, 1.1f, -0.3f })), RaylibMatrixTranslate(0.0f, 1.0f, 0.0f))
+    };
+
+    RaylibRayCollision expected[RAY_COUNT] = { 0 };
+    RaylibRayCollision collisions[RAY_COUNT] = { 0 };
+    RaylibRayCollision batchCollisions[RAY_COUNT] = { 0 };
+    //--------------------------------------------------------------------------------------
+
+    // BVH building
+    //--------------------------------------------------------------------------------------
+    clock_t start = clock();
+    RaylibMeshBVH bvh = RaylibLoadMeshBVH(mesh);
+    double buildTime = (double)(clock() - start)/CLOCKS_PER_SEC;
+
+    printf("Mesh: %i triangles | BVH build: %.2f s, %i nodes\n", mesh.triangleCount, buildTime, bvh.nodeCount);
+    //--------------------------------------------------------------------------------------
+
+    // Ray queries, BVH results must match brute force results
+    //--------------------------------------------------------------------------------------
+    int mismatches = 0;
+
+    for (int t = 0; t < 2; t++)
+    {
+        start = clock();
+        for (int i = 0; i < RAY_COUNT; i++) expected[i] = RaylibGetRayCollisionMesh(rays[i], mesh, transforms[t]);
+        double bruteTime = (double)(clock() - start)/CLOCKS_PER_SEC;
+
+        start = clock();
+        for (int i = 0; i < RAY_COUNT; i++) collisions[i] = RaylibGetRayCollisionMeshBVH(rays[i], bvh, transforms[t]);
+        double bvhTime = (double)(clock() - start)/CLOCKS_PER_SEC;
+
+        // NOTE: Batch time is CPU time of all worker threads
+        start = clock();
+        RaylibGetRayCollisionMeshBVHBatch(rays, RAY_COUNT, bvh, transforms[t], batchCollisions);
+        double batchTime = (double)(clock() - start)/CLOCKS_PER_SEC;
+
+        int hits = 0;
+        float maxDistanceDiff = 0.0f;
+        float maxNormalDiff = 0.0f;
+
+        for (int i = 0; i < RAY_COUNT; i++)
+        {
+            if ((collisions[i].hit != expected[i].hit) || (batchCollisions[i].hit != expected[i].hit) ||
+                (collisions[i].distance != batchCollisions[i].distance))
+            {
+                mismatches++;
+                continue;
+            }
+
+            if (!expected[i].hit) continue;
+
+            hits++;
+            maxDistanceDiff = fmaxf(maxDistanceDiff, fabsf(collisions[i].distance - expected[i].distance));
+            maxNormalDiff = fmaxf(maxNormalDiff, RaylibVector3Distance(collisions[i].normal, expected[i].normal));
+        }
+
+        // Distances and normals are computed in mesh space by BVH queries, small precision differences are expected
+        if ((maxDistanceDiff > 1e-3f) || (maxNormalDiff > 1e-3f)) mismatches++;
+
+        printf("%s transform: %i/%i rays hit | brute force: %.1f ms/ray | BVH: %.1f us/ray | batch: %.1f us/ray\n",
+            (t == 0)? "Regular" : "Mirrored", hits, RAY_COUNT, bruteTime*1000.0/RAY_COUNT, bvhTime*1000000.0/RAY_COUNT, batchTime*1000000.0/RAY_COUNT);
+        printf("    max difference: distance %.1e, normal %.1e\n", maxDistanceDiff, maxNormalDiff);
+    }
+
+    printf("Results mismatches: %i\n", mismatches);
+    //--------------------------------------------------------------------------------------
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    RaylibUnloadMeshBVH(bvh);
+    RaylibMemFree(mesh.vertices);
+    //--------------------------------------------------------------------------------------
+
+    return (mismatches == 0)? 0 : 1;
+}
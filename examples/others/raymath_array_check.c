@@ -0,0 +1,235 @@
+/*******************************************************************************************
+*
+*   raylib [others] example - raymath array functions check (headless)
+*
+*   Example originally created with raylib 5.5, last time updated with raylib 5.5
+*
+*   Checks raymath array functions results bitwise against the scalar functions, for arrays
+*   of 0 to 40 elements and 100000 elements (also in-place), and measures both versions time
+*
+*   NOTE: Define RAYMATH_DISABLE_SIMD on compilation to check the array functions scalar path
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "raymath.h"
+
+#include <stdio.h>                  // Required for: printf()
+#include <string.h>                 // Required for: memcmp(), memcpy()
+#include <math.h>                   // Required for: fminf(), fmaxf()
+#include <time.h>                   // Required for: clock()
+
+#define MAX_ELEMENTS        100000  // Biggest array checked and measured
+#define BENCHMARK_RUNS      20      // Runs measured per function (average time reported)
+
+// Functions checked
+typedef enum {
+    CHECK_TRANSFORM = 0,            // RaylibVector3TransformArray()
+    CHECK_TRANSFORM_NORMAL,         // RaylibVector3TransformNormalArray()
+    CHECK_MINMAX,                   // RaylibVector3MinMaxArray()
+    CHECK_MATRIX_MULTIPLY,          // RaylibMatrixMultiplyArray()
+    CHECK_QUATERNION_NORMALIZE,     // RaylibQuaternionNormalizeArray()
+    CHECK_QUATERNION_SLERP,         // RaylibQuaternionSlerpArray()
+    CHECK_COUNT
+} CheckFunction;
+
+static const char *checkNames[CHECK_COUNT] = { "Vector3Transform", "Vector3TransformNormal", "Vector3MinMax", "MatrixMultiply", "QuaternionNormalize", "QuaternionSlerp" };
+
+// Input data
+static RaylibVector3 *points = NULL;
+static Quaternion *quats1 = NULL;
+static Quaternion *quats2 = NULL;
+static RaylibMatrix *matsLeft = NULL;
+static RaylibMatrix *matsRight = NULL;
+static RaylibMatrix transform = { 0 };
+
+// Get a random float in range [-range, range]
+static float GetRandomFloat(float range)
+{
+    return ((float)RaylibGetRandomValue(-100000, 100000)/100000.0f)*range;
+}
+
+// Compute function results for count elements, scalar or array version, into result buffer
+// NOTE: In-place array version copies inputs to result buffer first
+static void ComputeResults(CheckFunction function, int count, bool array, bool inPlace, void *result)
+{
+    switch (function)
+    {
+        case CHECK_TRANSFORM:
+        {
+            RaylibVector3 *r = (RaylibVector3 *)result;
+            if (!array) for (int i = 0; i < count; i++) r[i] = RaylibVector3Transform(points[i], transform);
+            else if (inPlace) { memcpy(r, points, count*sizeof(RaylibVector3)); RaylibVector3TransformArray(r, r, count, transform); }
+            else RaylibVector3TransformArray(r, points, count, transform);
+        } break;
+        case CHECK_TRANSFORM_NORMAL:
+        {
+            RaylibVector3 *r = (RaylibVector3 *)result;
+            if (!array)
+            {
+                for (int i = 0; i < count; i++)
+                {
+                    r[i].x = transform.m0*points[i].x + transform.m4*points[i].y + transform.m8*points[i].z;
+                    r[i].y = transform.m1*points[i].x + transform.m5*points[i].y + transform.m9*points[i].z;
+                    r[i].z = transform.m2*points[i].x + transform.m6*points[i].y + transform.m10*points[i].z;
+                }
+            }
+            else if (inPlace) { memcpy(r, points, count*sizeof(RaylibVector3)); RaylibVector3TransformNormalArray(r, r, count, transform); }
+            else RaylibVector3TransformNormalArray(r, points, count, transform);
+        } break;
+        case CHECK_MINMAX:
+        {
+            RaylibVector3 *r = (RaylibVector3 *)result;
+            if (!array)
+            {
+                r[0] = (count > 0)? points[0] : (RaylibVector3){ 0 };
+                r[1] = r[0];
+
+                for (int i = 1; i < count; i++)
+                {
+                    r[0] = (RaylibVector3){ fminf(r[0].x, points[i].x), fminf(r[0].y, points[i].y), fminf(r[0].z, points[i].z) };
+                    r[1] = (RaylibVector3){ fmaxf(r[1].x, points[i].x), fmaxf(r[1].y, points[i].y), fmaxf(r[1].z, points[i].z) };
+                }
+            }
+            else RaylibVector3MinMaxArray(&r[0], &r[1], points, count);
+        } break;
+        case CHECK_MATRIX_MULTIPLY:
+        {
+            RaylibMatrix *r = (RaylibMatrix *)result;
+            if (!array) for (int i = 0; i < count; i++) r[i] = RaylibMatrixMultiply(matsLeft[i], matsRight[i]);
+            else if (inPlace) { memcpy(r, matsLeft, count*sizeof(RaylibMatrix)); RaylibMatrixMultiplyArray(r, r, matsRight, count); }
+            else RaylibMatrixMultiplyArray(r, matsLeft, matsRight, count);
+        } break;
+        case CHECK_QUATERNION_NORMALIZE:
+        {
+            Quaternion *r = (Quaternion *)result;
+            if (!array) for (int i = 0; i < count; i++) r[i] = RaylibQuaternionNormalize(quats1[i]);
+            else if (inPlace) { memcpy(r, quats1, count*sizeof(Quaternion)); RaylibQuaternionNormalizeArray(r, r, count); }
+            else RaylibQuaternionNormalizeArray(r, quats1, count);
+        } break;
+        case CHECK_QUATERNION_SLERP:
+        {
+            Quaternion *r = (Quaternion *)result;
+            if (!array) for (int i = 0; i < count; i++) r[i] = RaylibQuaternionSlerp(quats1[i], quats2[i], 0.3f);
+            else if (inPlace) { memcpy(r, quats1, count*sizeof(Quaternion)); RaylibQuaternionSlerpArray(r, r, quats2, count, 0.3f); }
+            else RaylibQuaternionSlerpArray(r, quats1, quats2, count, 0.3f);
+        } break;
+        default: break;
+    }
+}
+
+// Get function results size in bytes for count elements
+static int GetResultsSize(CheckFunction function, int count)
+{
+    if (function == CHECK_MINMAX) return 2*sizeof(RaylibVector3);
+    else if (function == CHECK_MATRIX_MULTIPLY) return count*sizeof(RaylibMatrix);
+    else if ((function == CHECK_QUATERNION_NORMALIZE) || (function == CHECK_QUATERNION_SLERP)) return count*sizeof(Quaternion);
+    else return count*sizeof(RaylibVector3);
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    RaylibSetRandomSeed(1234);
+
+    points = (RaylibVector3 *)RaylibMemAlloc(MAX_ELEMENTS*sizeof(RaylibVector3));
+    quats1 = (Quaternion *)RaylibMemAlloc(MAX_ELEMENTS*sizeof(Quaternion));
+    quats2 = (Quaternion *)RaylibMemAlloc(MAX_ELEMENTS*sizeof(Quaternion));
+    matsLeft = (RaylibMatrix *)RaylibMemAlloc(MAX_ELEMENTS*sizeof(RaylibMatrix));
+    matsRight = (RaylibMatrix *)RaylibMemAlloc(MAX_ELEMENTS*sizeof(RaylibMatrix));
+
+    for (int i = 0; i < MAX_ELEMENTS; i++)
+    {
+        points[i] = (RaylibVector3){ GetRandomFloat(100.0f), GetRandomFloat(100.0f), GetRandomFloat(100.0f) };
+        quats1[i] = (Quaternion){ GetRandomFloat(1.0f), GetRandomFloat(1.0f), GetRandomFloat(1.0f), GetRandomFloat(1.0f) };
+
+        // Half of the quaternion pairs are close (nlerp path), half are random (slerp path)
+        if ((i%2) == 0) quats2[i] = (Quaternion){ quats1[i].x + 0.0005f, quats1[i].y, quats1[i].z - 0.0005f, quats1[i].w };
+        else quats2[i] = (Quaternion){ GetRandomFloat(1.0f), GetRandomFloat(1.0f), GetRandomFloat(1.0f), GetRandomFloat(1.0f) };
+
+        float *left = (float *)&matsLeft[i];
+        float *right = (float *)&matsRight[i];
+        for (int k = 0; k < 16; k++) { left[k] = GetRandomFloat(10.0f); right[k] = GetRandomFloat(10.0f); }
+    }
+
+    transform = RaylibMatrixMultiply(RaylibMatrixRotateXYZ((RaylibVector3){ 0.3f, -1.2f, 2.1f }), RaylibMatrixTranslate(1.5f, -2.0f, 30.0f));
+    transform.m0 *= 1.7f;
+
+    unsigned char *expected = (unsigned char *)RaylibMemAlloc(MAX_ELEMENTS*sizeof(RaylibMatrix));
+    unsigned char *result = (unsigned char *)RaylibMemAlloc(MAX_ELEMENTS*sizeof(RaylibMatrix));
+    int failures = 0;
+    //--------------------------------------------------------------------------------------
+
+    // Bitwise results check
+    //--------------------------------------------------------------------------------------
+    for (int f = 0; f < CHECK_COUNT; f++)
+    {
+        for (int c = 0; c <= 41; c++)
+        {
+            int count = (c <= 40)? c : MAX_ELEMENTS;
+
+            ComputeResults(f, count, false, false, expected);
+
+            for (int inPlace = 0; inPlace < 2; inPlace++)
+            {
+                // NOTE: MinMax results are not written over inputs
+                if (inPlace && (f == CHECK_MINMAX)) continue;
+
+                ComputeResults(f, count, true, inPlace, result);
+
+                if (memcmp(expected, result, GetResultsSize(f, count)) != 0)
+                {
+                    printf("%s: results differ for %i elements%s\n", checkNames[f], count, inPlace? " (in-place)" : "");
+                    failures++;
+                }
+            }
+        }
+    }
+
+#if defined(RAYMATH_DISABLE_SIMD)
+    printf("Array functions (scalar path) checked: %i failed\n", failures);
+#else
+    printf("Array functions (SIMD path) checked: %i failed\n", failures);
+#endif
+    //--------------------------------------------------------------------------------------
+
+    // Average time for MAX_ELEMENTS elements
+    //--------------------------------------------------------------------------------------
+    for (int f = 0; f < CHECK_COUNT; f++)
+    {
+        double times[2] = { 0 };
+
+        for (int array = 0; array < 2; array++)
+        {
+            clock_t start = clock();
+            for (int run = 0; run < BENCHMARK_RUNS; run++) ComputeResults(f, MAX_ELEMENTS, array, false, result);
+            times[array] = (double)(clock() - start)*1000.0/CLOCKS_PER_SEC/BENCHMARK_RUNS;
+        }
+
+        printf("%-24s scalar: %7.3f ms | array: %7.3f ms\n", checkNames[f], times[0], times[1]);
+    }
+    //--------------------------------------------------------------------------------------
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    RaylibMemFree(points);
+    RaylibMemFree(quats1);
+    RaylibMemFree(quats2);
+    RaylibMemFree(matsLeft);
+    RaylibMemFree(matsRight);
+    RaylibMemFree(expected);
+    RaylibMemFree(result);
+    //--------------------------------------------------------------------------------------
+
+    return (failures == 0)? 0 : 1;
+}
@@ -58,6 +58,11 @@
 //#define RAYLIB_SUPPORT_BUSY_WAIT_LOOP          1
 // Use a partial-busy wait loop, in this case frame sleeps for most of the time, but then runs a busy loop at the end for accuracy
 #define RAYLIB_SUPPORT_PARTIALBUSY_WAIT_LOOP    1
+// Use frame pacer for timing sync on Linux, frame sleeps until absolute deadlines with clock_nanosleep() and
+// runs a busy loop only for an adaptive window, sized to the measured wake-up error
+// NOTE: When enabled (Linux only), busy and partial-busy wait loops are disabled and RaylibWaitTime() also uses the pacer,
+// target FPS is kept on average over frames (deadlines do not drift) and a missed frame restarts deadlines from current time
+//#define RAYLIB_SUPPORT_FRAME_PACER             1
 // Allow automatic screen capture of current screen pressing F12, defined in KeyCallback()
 #define RAYLIB_SUPPORT_SCREEN_CAPTURE          1
 // Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
@@ -74,7 +79,6 @@
 
 // rcore: Configuration values
 //------------------------------------------------------------------------------------
-#define RAYLIB_MAX_FILEPATH_CAPACITY        8192       // Maximum file paths capacity
 #define RAYLIB_MAX_FILEPATH_LENGTH          4096       // Maximum length for filepaths (Linux PATH_MAX default value)
 
 #define RAYLIB_MAX_KEYBOARD_KEYS             512       // Maximum number of keyboard keys supported
@@ -84,10 +88,11 @@
 #define RAYLIB_MAX_GAMEPAD_BUTTONS            32       // Maximum number of buttons supported (per gamepad)
 #define RAYLIB_MAX_GAMEPAD_VIBRATION_TIME      2.0f    // Maximum vibration time in seconds
 #define RAYLIB_MAX_TOUCH_POINTS                8       // Maximum number of touch points supported
-#define RAYLIB_MAX_KEY_PRESSED_QUEUE          16       // Maximum number of keys in the key input queue
-#define RAYLIB_MAX_CHAR_PRESSED_QUEUE         16       // Maximum number of characters in the char input queue
+#define RAYLIB_INPUT_EVENT_QUEUE_CAPACITY    256       // Initial input events queue capacity (grows if required)
+#define RAYLIB_MAX_MOUSE_BUTTON_EVENTS      1024       // Maximum mouse button events kept from previous frames: RaylibHasMouseButtonBeenDown()
 
 #define RAYLIB_MAX_DECOMPRESSION_SIZE         64       // Max size allocated for decompression in MB
+#define RAYLIB_COMPRESSION_CHUNK_SIZE     262144       // Default uncompressed chunk size: RaylibCompressDataChunked(), RaylibLoadCompressionStream()
 
 #define RAYLIB_MAX_AUTOMATION_EVENTS       16384       // Maximum number of automation events to record
 
@@ -101,12 +106,16 @@
 // Show OpenGL extensions and capabilities detailed logs on init
 //#define RLGL_SHOW_GL_DETAILS_INFO              1
 
+// Stream render batch vertex data over multiple buffers: persistent mapped (OpenGL 4.3) or orphaned buffers
+//#define RLGL_ENABLE_BATCH_STREAMING            1
+
 #define RL_SUPPORT_MESH_GPU_SKINNING           1      // GPU skinning, comment if your GPU does not support more than 8 VBOs
 
 //#define RL_DEFAULT_BATCH_BUFFER_ELEMENTS    4096    // Default internal render batch elements limits
 #define RL_DEFAULT_BATCH_BUFFERS               1      // Default number of batch buffers (multi-buffering)
 #define RL_DEFAULT_BATCH_DRAWCALLS           256      // Default number of batch draw calls (by state changes: mode, texture)
 #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS     4      // Maximum number of textures units that can be activated on batch drawing (RaylibSetShaderValueTexture())
+#define RL_DEFAULT_BATCH_STREAM_BUFFERS        3      // Minimum number of batch buffers when streaming (RLGL_ENABLE_BATCH_STREAMING)
 
 #define RL_MAX_MATRIX_STACK_SIZE              32      // Maximum size of internal RaylibMatrix stack
 
@@ -187,6 +196,10 @@
 // If not defined, still some functions are supported: RaylibImageFormat(), RaylibImageCrop(), RaylibImageToPOT()
 #define RAYLIB_SUPPORT_IMAGE_MANIPULATION      1
 
+// rtextures: Configuration values
+//------------------------------------------------------------------------------------
+#define RAYLIB_IMAGE_RESIZE_BATCH_PIXELS   65536       // Minimum output pixels per worker thread on image resizing: RaylibImageResize*(), RaylibImageMipmaps()
+#define RAYLIB_IMAGE_FILTER_BATCH_PIXELS   16384       // Minimum pixels per worker thread on image filtering: RaylibImageBlurGaussian(), RaylibImageKernelConvolution()
 
 //------------------------------------------------------------------------------------
 // Module: rtext - Configuration Flags
@@ -213,6 +226,9 @@
 #define RAYLIB_MAX_TEXT_BUFFER_LENGTH       1024       // Size of internal static buffers used on some functions:
                                                 // RaylibTextFormat(), RaylibTextSubtext(), RaylibTextToUpper(), RaylibTextToLower(), RaylibTextToPascal(), RaylibTextSplit()
 #define RAYLIB_MAX_TEXTSPLIT_COUNT           128       // Maximum number of substrings to split: RaylibTextSplit()
+#define RAYLIB_GLYPH_LOOKUP_DENSE_SIZE       592       // Codepoints directly indexed by font glyph lookup table: RaylibGetGlyphIndex()
+#define RAYLIB_FONT_LOADING_BATCH_GLYPHS      16       // Minimum glyphs rasterized per worker thread on font loading: RaylibLoadFontData()
+#define RAYLIB_FONT_DYNAMIC_ATLAS_SIZE      1024       // Default atlas texture size for dynamic fonts: RaylibLoadFontDynamic()
 
 
 //------------------------------------------------------------------------------------
@@ -232,6 +248,9 @@
 // rmodels: Configuration values
 //------------------------------------------------------------------------------------
 #define RAYLIB_MAX_MATERIAL_MAPS              12       // Maximum number of shader maps supported
+#define RAYLIB_SKINNING_BATCH_VERTICES      4096       // Minimum vertices per worker thread on CPU skinning: RaylibUpdateModelAnimation()
+#define RAYLIB_ANIMATION_KEY_TOLERANCE   0.0001f       // Keyframes reduction tolerance on animation clips loading: RaylibLoadModelAnimationClips()
+#define RAYLIB_COLLISION_BATCH_RAYS             64       // Minimum rays per worker thread on batched ray queries: RaylibGetRayCollisionMeshBVHBatch()
 
 #ifdef RL_SUPPORT_MESH_GPU_SKINNING
 #define RAYLIB_MAX_MESH_VERTEX_BUFFERS         9       // Maximum vertex buffers (VBO) per mesh
@@ -250,6 +269,8 @@
 //#define SUPPORT_FILEFORMAT_FLAC         1
 #define RAYLIB_SUPPORT_FILEFORMAT_XM           1
 #define RAYLIB_SUPPORT_FILEFORMAT_MOD          1
+// Audio device callback never locks: program-side changes are sent to the mixer through a command queue
+#define RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER    1
 
 // raudio: Configuration values
 //------------------------------------------------------------------------------------
@@ -258,6 +279,9 @@
 #define RAYLIB_AUDIO_DEVICE_SAMPLE_RATE           0    // Device sample rate (device default)
 
 #define RAYLIB_MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Maximum number of audio pool channels
+#define RAYLIB_AUDIO_MIXER_GAIN_RAMP_FRAMES     256    // Frames to reach a new volume/pan gain, avoids clicks
+#define RAYLIB_AUDIO_MIXER_COMMAND_QUEUE_SIZE  1024    // Maximum pending mixer commands (power of two)
+#define RAYLIB_AUDIO_MIXER_COMMAND_TIMEOUT      100    // Maximum wait for the mixer to apply commands (in milliseconds)
 
 //------------------------------------------------------------------------------------
 // Module: utils - Configuration Flags
@@ -268,10 +292,13 @@
 // NOTE: By default RAYLIB_LOG_DEBUG traces not shown
 #define RAYLIB_SUPPORT_TRACELOG                1
 //#define SUPPORT_TRACELOG_DEBUG          1
+// Use a pool of worker threads to split heavy loops (skinning, image processing...)
+#define RAYLIB_SUPPORT_WORKER_THREADS          1
 
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define RAYLIB_MAX_TRACELOG_MSG_LENGTH       256       // Max length of one trace-log message
+#define RAYLIB_MAX_WORKER_THREADS              8       // Max number of threads used by worker pool, including calling thread
 
 
 // Enable partial support for clipboard image, only working on SDL3 or
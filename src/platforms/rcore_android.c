@@ -649,9 +649,8 @@ void RaylibPollInputEvents(void)
     UpdateGestures();
 #endif
 
-    // Reset keys/chars pressed registered
-    CORE.Input.Keyboard.keyPressedQueueCount = 0;
-    CORE.Input.Keyboard.charPressedQueueCount = 0;
+    // Reset input events registered (keys/chars pressed, mouse, touch)
+    ResetInputEvents();
     // Reset key repeats
     for (int i = 0; i < RAYLIB_MAX_KEYBOARD_KEYS; i++) CORE.Input.Keyboard.keyRepeatInFrame[i] = 0;
 
@@ -1225,11 +1224,15 @@ static int32_t AndroidInputCallback(struct android_app *app, AInputEvent *event)
             {
                 CORE.Input.Keyboard.currentKeyState[key] = 1;   // Key down
 
-                CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount] = key;
-                CORE.Input.Keyboard.keyPressedQueueCount++;
+                RegisterInputEvent(RAYLIB_INPUT_EVENT_KEY, key, 1, (RaylibVector2){ 0.0f, 0.0f });
             }
             else if (AKeyEvent_getAction(event) == AKEY_EVENT_ACTION_MULTIPLE) CORE.Input.Keyboard.keyRepeatInFrame[key] = 1;
-            else CORE.Input.Keyboard.currentKeyState[key] = 0;  // Key up
+            else
+            {
+                CORE.Input.Keyboard.currentKeyState[key] = 0;  // Key up
+
+                RegisterInputEvent(RAYLIB_INPUT_EVENT_KEY, key, 0, (RaylibVector2){ 0.0f, 0.0f });
+            }
         }
 
         if (keycode == AKEYCODE_POWER)
@@ -1275,6 +1278,18 @@ static int32_t AndroidInputCallback(struct android_app *app, AInputEvent *event)
 
     int32_t action = AMotionEvent_getAction(event);
     unsigned int flags = action & AMOTION_EVENT_ACTION_MASK;
+    int32_t pointerIndex = (action & AMOTION_EVENT_ACTION_POINTER_INDEX_MASK) >> AMOTION_EVENT_ACTION_POINTER_INDEX_SHIFT;
+
+    // Add touch events to the events queue, all points on move, changed point on down/up
+    for (int i = 0; (i < CORE.Input.Touch.pointCount) && (i < RAYLIB_MAX_TOUCH_POINTS); i++)
+    {
+        if (flags == AMOTION_EVENT_ACTION_MOVE) RegisterInputEvent(RAYLIB_INPUT_EVENT_TOUCH, CORE.Input.Touch.pointId[i], 2, CORE.Input.Touch.position[i]);
+        else if (i == pointerIndex)
+        {
+            int touchAction = ((flags == AMOTION_EVENT_ACTION_DOWN) || (flags == AMOTION_EVENT_ACTION_POINTER_DOWN))? 1 : 0;
+            RegisterInputEvent(RAYLIB_INPUT_EVENT_TOUCH, CORE.Input.Touch.pointId[i], touchAction, CORE.Input.Touch.position[i]);
+        }
+    }
 
 #if defined(RAYLIB_SUPPORT_GESTURES_SYSTEM)
     GestureEvent gestureEvent = { 0 };
@@ -1299,8 +1314,6 @@ static int32_t AndroidInputCallback(struct android_app *app, AInputEvent *event)
     ProcessGestureEvent(gestureEvent);
 #endif
 
-    int32_t pointerIndex = (action & AMOTION_EVENT_ACTION_POINTER_INDEX_MASK) >> AMOTION_EVENT_ACTION_POINTER_INDEX_SHIFT;
-
     if (flags == AMOTION_EVENT_ACTION_POINTER_UP || flags == AMOTION_EVENT_ACTION_UP)
     {
         // One of the touchpoints is released, remove it from touch point arrays
@@ -1141,9 +1141,8 @@ void RaylibPollInputEvents(void)
     UpdateGestures();
 #endif
 
-    // Reset keys/chars pressed registered
-    CORE.Input.Keyboard.keyPressedQueueCount = 0;
-    CORE.Input.Keyboard.charPressedQueueCount = 0;
+    // Reset input events registered (keys/chars pressed, mouse, touch)
+    ResetInputEvents();
 
     // Reset last gamepad button/axis registered state
     CORE.Input.Gamepad.lastButtonPressed = 0;       // RAYLIB_GAMEPAD_BUTTON_UNKNOWN
@@ -1816,13 +1815,8 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
     if (((key == RAYLIB_KEY_CAPS_LOCK) && ((mods & GLFW_MOD_CAPS_LOCK) > 0)) ||
         ((key == RAYLIB_KEY_NUM_LOCK) && ((mods & GLFW_MOD_NUM_LOCK) > 0))) CORE.Input.Keyboard.currentKeyState[key] = 1;
 
-    // Check if there is space available in the key queue
-    if ((CORE.Input.Keyboard.keyPressedQueueCount < RAYLIB_MAX_KEY_PRESSED_QUEUE) && (action == GLFW_PRESS))
-    {
-        // Add character to the queue
-        CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount] = key;
-        CORE.Input.Keyboard.keyPressedQueueCount++;
-    }
+    // Add key event to the events queue, GLFW actions match event actions (release, press, repeat)
+    RegisterInputEvent(RAYLIB_INPUT_EVENT_KEY, key, action, (RaylibVector2){ 0.0f, 0.0f });
 
     // Check the exit key to set close window
     if ((key == CORE.Input.Keyboard.exitKey) && (action == GLFW_PRESS)) glfwSetWindowShouldClose(platform.handle, GLFW_TRUE);
@@ -1838,50 +1832,22 @@ static void CharCallback(GLFWwindow *window, unsigned int codepoint)
     // Ref: https://github.com/glfw/glfw/issues/668#issuecomment-166794907
     // Ref: https://www.glfw.org/docs/latest/input_guide.html#input_char
 
-    // Check if there is space available in the queue
-    if (CORE.Input.Keyboard.charPressedQueueCount < RAYLIB_MAX_CHAR_PRESSED_QUEUE)
-    {
-        // Add character to the queue
-        CORE.Input.Keyboard.charPressedQueue[CORE.Input.Keyboard.charPressedQueueCount] = codepoint;
-        CORE.Input.Keyboard.charPressedQueueCount++;
-    }
-}
-
-static void pushMouseEvent(GLFWwindow *window, int button, int action, int mods)
-{
-    int nextTail = (CORE.Input.Mouse.eventQueue.tail + 1) % MAX_EVENT_QUEUE;
-    if (nextTail == CORE.Input.Mouse.eventQueue.head)
-        return;  // Queue full, discard event (rare)
-
-    CORE.Input.Mouse.eventQueue.events[CORE.Input.Mouse.eventQueue.tail].button = button;
-    CORE.Input.Mouse.eventQueue.events[CORE.Input.Mouse.eventQueue.tail].action = action;
-    CORE.Input.Mouse.eventQueue.events[CORE.Input.Mouse.eventQueue.tail].mods = mods;
-    CORE.Input.Mouse.eventQueue.tail = nextTail;
-}
-
-static int popMouseEvent(GLFWwindow *window, int* button, int* action, int* mods)
-{
-    if (CORE.Input.Mouse.eventQueue.head == CORE.Input.Mouse.eventQueue.tail)
-        return 0;  // Queue empty
-
-    *button = CORE.Input.Mouse.eventQueue.events[CORE.Input.Mouse.eventQueue.head].button;
-    *action = CORE.Input.Mouse.eventQueue.events[CORE.Input.Mouse.eventQueue.head].action;
-    *mods = CORE.Input.Mouse.eventQueue.events[CORE.Input.Mouse.eventQueue.head].mods;
-
-    CORE.Input.Mouse.eventQueue.head = (CORE.Input.Mouse.eventQueue.head + 1) % MAX_EVENT_QUEUE;
-    return 1;
+    // Add character to the events queue
+    RegisterInputEvent(RAYLIB_INPUT_EVENT_CHAR, (int)codepoint, 1, (RaylibVector2){ 0.0f, 0.0f });
 }
 
-
 // GLFW3 Mouse Button Callback, runs on mouse button pressed
 static void MouseButtonCallback(GLFWwindow *window, int button, int action, int mods)
 {
+    (void)mods;     // Modifier keys state is not registered with the event
+
     // WARNING: GLFW could only return GLFW_PRESS (1) or GLFW_RELEASE (0) for now,
     // but future releases may add more actions (i.e. GLFW_REPEAT)
     CORE.Input.Mouse.currentButtonState[button] = action;
     CORE.Input.Touch.currentTouchState[button] = action;
-    
-    pushMouseEvent(window, button, action, mods);
+
+    // Add mouse button event to the events queue, it keeps presses and releases within a frame
+    RegisterInputEvent(RAYLIB_INPUT_EVENT_MOUSE_BUTTON, button, action, CORE.Input.Mouse.currentPosition);
 
 #if defined(RAYLIB_SUPPORT_GESTURES_SYSTEM) && defined(RAYLIB_SUPPORT_MOUSE_GESTURES)
     // Process mouse events as touches to be able to use mouse-gestures
@@ -1918,6 +1884,8 @@ static void MouseCursorPosCallback(GLFWwindow *window, double x, double y)
     CORE.Input.Mouse.currentPosition.y = (float)y;
     CORE.Input.Touch.position[0] = CORE.Input.Mouse.currentPosition;
 
+    RegisterInputEvent(RAYLIB_INPUT_EVENT_MOUSE_MOVE, 0, 2, CORE.Input.Mouse.currentPosition);
+
 #if defined(RAYLIB_SUPPORT_GESTURES_SYSTEM) && defined(RAYLIB_SUPPORT_MOUSE_GESTURES)
     // Process mouse events as touches to be able to use mouse-gestures
     GestureEvent gestureEvent = { 0 };
@@ -1946,6 +1914,8 @@ static void MouseCursorPosCallback(GLFWwindow *window, double x, double y)
 static void MouseScrollCallback(GLFWwindow *window, double xoffset, double yoffset)
 {
     CORE.Input.Mouse.currentWheelMove = (RaylibVector2){ (float)xoffset, (float)yoffset };
+
+    RegisterInputEvent(RAYLIB_INPUT_EVENT_MOUSE_WHEEL, 0, 2, CORE.Input.Mouse.currentWheelMove);
 }
 
 // GLFW3 CursorEnter Callback, when cursor enters the window
@@ -867,9 +867,8 @@ void RaylibPollInputEvents(void)
     UpdateGestures();
 #endif
 
-    // Reset keys/chars pressed registered
-    CORE.Input.Keyboard.keyPressedQueueCount = 0;
-    CORE.Input.Keyboard.charPressedQueueCount = 0;
+    // Reset input events registered (keys/chars pressed, mouse, touch)
+    ResetInputEvents();
 
     // Reset mouse wheel
     CORE.Input.Mouse.currentWheelMove.x = 0;
@@ -998,12 +997,8 @@ void RaylibPollInputEvents(void)
 
                 if (key != RAYLIB_KEY_NULL)
                 {
-                    // If key was up, add it to the key pressed queue
-                    if ((CORE.Input.Keyboard.currentKeyState[key] == 0) && (CORE.Input.Keyboard.keyPressedQueueCount < RAYLIB_MAX_KEY_PRESSED_QUEUE))
-                    {
-                        CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount] = key;
-                        CORE.Input.Keyboard.keyPressedQueueCount++;
-                    }
+                    // If key was up, add it to the events queue as pressed, otherwise as repeat
+                    RegisterInputEvent(RAYLIB_INPUT_EVENT_KEY, key, (CORE.Input.Keyboard.currentKeyState[key] == 0)? 1 : 2, (RaylibVector2){ 0.0f, 0.0f });
 
                     CORE.Input.Keyboard.currentKeyState[key] = 1;
                 }
@@ -1015,18 +1010,17 @@ void RaylibPollInputEvents(void)
                 }
 
                 // NOTE: event.text.text data comes an UTF-8 text sequence but we register codepoints (int)
-                // Check if there is space available in the queue
-                if (CORE.Input.Keyboard.charPressedQueueCount < RAYLIB_MAX_CHAR_PRESSED_QUEUE)
-                {
-                    // Add character (codepoint) to the queue
-                    CORE.Input.Keyboard.charPressedQueue[CORE.Input.Keyboard.charPressedQueueCount] = RSGL_keystrToChar(event->keyName);
-                    CORE.Input.Keyboard.charPressedQueueCount++;
-                }
+                // Add character (codepoint) to the events queue
+                RegisterInputEvent(RAYLIB_INPUT_EVENT_CHAR, RSGL_keystrToChar(event->keyName), 1, (RaylibVector2){ 0.0f, 0.0f });
             } break;
             case RGFW_keyReleased:
             {
                 RaylibKeyboardKey key = ConvertScancodeToKey(event->keyCode);
-                if (key != RAYLIB_KEY_NULL) CORE.Input.Keyboard.currentKeyState[key] = 0;
+                if (key != RAYLIB_KEY_NULL)
+                {
+                    CORE.Input.Keyboard.currentKeyState[key] = 0;
+                    RegisterInputEvent(RAYLIB_INPUT_EVENT_KEY, key, 0, (RaylibVector2){ 0.0f, 0.0f });
+                }
             } break;
 
             // Check mouse events
@@ -1035,6 +1029,7 @@ void RaylibPollInputEvents(void)
                 if ((event->button == RGFW_mouseScrollUp) || (event->button == RGFW_mouseScrollDown))
                 {
                     CORE.Input.Mouse.currentWheelMove.y = event->scroll;
+                    RegisterInputEvent(RAYLIB_INPUT_EVENT_MOUSE_WHEEL, 0, 2, CORE.Input.Mouse.currentWheelMove);
                     break;
                 }
 
@@ -1045,6 +1040,7 @@ void RaylibPollInputEvents(void)
 
                 CORE.Input.Mouse.currentButtonState[btn - 1] = 1;
                 CORE.Input.Touch.currentTouchState[btn - 1] = 1;
+                RegisterInputEvent(RAYLIB_INPUT_EVENT_MOUSE_BUTTON, btn - 1, 1, CORE.Input.Mouse.currentPosition);
 
                 touchAction = 1;
             } break;
@@ -1054,6 +1050,7 @@ void RaylibPollInputEvents(void)
                 if ((event->button == RGFW_mouseScrollUp) || (event->button == RGFW_mouseScrollDown))
                 {
                     CORE.Input.Mouse.currentWheelMove.y = event->scroll;
+                    RegisterInputEvent(RAYLIB_INPUT_EVENT_MOUSE_WHEEL, 0, 2, CORE.Input.Mouse.currentWheelMove);
                     break;
                 }
 
@@ -1064,6 +1061,7 @@ void RaylibPollInputEvents(void)
 
                 CORE.Input.Mouse.currentButtonState[btn - 1] = 0;
                 CORE.Input.Touch.currentTouchState[btn - 1] = 0;
+                RegisterInputEvent(RAYLIB_INPUT_EVENT_MOUSE_BUTTON, btn - 1, 0, CORE.Input.Mouse.currentPosition);
 
                 touchAction = 0;
             } break;
@@ -1082,6 +1080,7 @@ void RaylibPollInputEvents(void)
                 }
 
                 CORE.Input.Touch.position[0] = CORE.Input.Mouse.currentPosition;
+                RegisterInputEvent(RAYLIB_INPUT_EVENT_MOUSE_MOVE, 0, 2, CORE.Input.Mouse.currentPosition);
                 touchAction = 2;
             } break;
             case RGFW_jsButtonPressed:
@@ -1315,9 +1315,8 @@ void RaylibPollInputEvents(void)
     UpdateGestures();
 #endif
 
-    // Reset keys/chars pressed registered
-    CORE.Input.Keyboard.keyPressedQueueCount = 0;
-    CORE.Input.Keyboard.charPressedQueueCount = 0;
+    // Reset input events registered (keys/chars pressed, mouse, touch)
+    ResetInputEvents();
 
     // Reset mouse wheel
     CORE.Input.Mouse.currentWheelMove.x = 0;
@@ -1480,12 +1479,8 @@ void RaylibPollInputEvents(void)
 
                 if (key != RAYLIB_KEY_NULL)
                 {
-                    // If key was up, add it to the key pressed queue
-                    if ((CORE.Input.Keyboard.currentKeyState[key] == 0) && (CORE.Input.Keyboard.keyPressedQueueCount < RAYLIB_MAX_KEY_PRESSED_QUEUE))
-                    {
-                        CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount] = key;
-                        CORE.Input.Keyboard.keyPressedQueueCount++;
-                    }
+                    // If key was up, add it to the events queue as pressed, otherwise as repeat
+                    RegisterInputEvent(RAYLIB_INPUT_EVENT_KEY, key, (CORE.Input.Keyboard.currentKeyState[key] == 0)? 1 : 2, (RaylibVector2){ 0.0f, 0.0f });
 
                     CORE.Input.Keyboard.currentKeyState[key] = 1;
                 }
@@ -1507,7 +1502,11 @@ void RaylibPollInputEvents(void)
             #else
                 RaylibKeyboardKey key = ConvertScancodeToKey(event.key.keysym.scancode);
             #endif
-                if (key != RAYLIB_KEY_NULL) CORE.Input.Keyboard.currentKeyState[key] = 0;
+                if (key != RAYLIB_KEY_NULL)
+                {
+                    CORE.Input.Keyboard.currentKeyState[key] = 0;
+                    RegisterInputEvent(RAYLIB_INPUT_EVENT_KEY, key, 0, (RaylibVector2){ 0.0f, 0.0f });
+                }
             } break;
 
             case SDL_TEXTINPUT:
@@ -1516,13 +1515,8 @@ void RaylibPollInputEvents(void)
 
                 int codepointSize = 0;
 
-                // Check if there is space available in the queue
-                if (CORE.Input.Keyboard.charPressedQueueCount < RAYLIB_MAX_CHAR_PRESSED_QUEUE)
-                {
-                    // Add character (codepoint) to the queue
-                    CORE.Input.Keyboard.charPressedQueue[CORE.Input.Keyboard.charPressedQueueCount] = RaylibGetCodepointNext(event.text.text, &codepointSize);
-                    CORE.Input.Keyboard.charPressedQueueCount++;
-                }
+                // Add character (codepoint) to the events queue
+                RegisterInputEvent(RAYLIB_INPUT_EVENT_CHAR, RaylibGetCodepointNext(event.text.text, &codepointSize), 1, (RaylibVector2){ 0.0f, 0.0f });
             } break;
 
             // Check mouse events
@@ -1536,6 +1530,7 @@ void RaylibPollInputEvents(void)
 
                 CORE.Input.Mouse.currentButtonState[btn] = 1;
                 CORE.Input.Touch.currentTouchState[btn] = 1;
+                RegisterInputEvent(RAYLIB_INPUT_EVENT_MOUSE_BUTTON, btn, 1, CORE.Input.Mouse.currentPosition);
 
                 touchAction = 1;
             } break;
@@ -1549,6 +1544,7 @@ void RaylibPollInputEvents(void)
 
                 CORE.Input.Mouse.currentButtonState[btn] = 0;
                 CORE.Input.Touch.currentTouchState[btn] = 0;
+                RegisterInputEvent(RAYLIB_INPUT_EVENT_MOUSE_BUTTON, btn, 0, CORE.Input.Mouse.currentPosition);
 
                 touchAction = 0;
             } break;
@@ -1556,6 +1552,7 @@ void RaylibPollInputEvents(void)
             {
                 CORE.Input.Mouse.currentWheelMove.x = (float)event.wheel.x;
                 CORE.Input.Mouse.currentWheelMove.y = (float)event.wheel.y;
+                RegisterInputEvent(RAYLIB_INPUT_EVENT_MOUSE_WHEEL, 0, 2, CORE.Input.Mouse.currentWheelMove);
             } break;
             case SDL_MOUSEMOTION:
             {
@@ -1572,6 +1569,7 @@ void RaylibPollInputEvents(void)
                 }
 
                 CORE.Input.Touch.position[0] = CORE.Input.Mouse.currentPosition;
+                RegisterInputEvent(RAYLIB_INPUT_EVENT_MOUSE_MOVE, 0, 2, CORE.Input.Mouse.currentPosition);
                 touchAction = 2;
             } break;
 
@@ -644,9 +644,8 @@ void RaylibPollInputEvents(void)
     UpdateGestures();
 #endif
 
-    // Reset keys/chars pressed registered
-    CORE.Input.Keyboard.keyPressedQueueCount = 0;
-    CORE.Input.Keyboard.charPressedQueueCount = 0;
+    // Reset input events registered (keys/chars pressed, mouse, touch)
+    ResetInputEvents();
 
     // Reset last gamepad button/axis registered state
     CORE.Input.Gamepad.lastButtonPressed = 0;       // RAYLIB_GAMEPAD_BUTTON_UNKNOWN
@@ -1299,15 +1298,13 @@ static void ProcessKeyboard(void)
         {
             CORE.Input.Keyboard.currentKeyState[257] = 1;
 
-            CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount] = 257;     // Add keys pressed into queue
-            CORE.Input.Keyboard.keyPressedQueueCount++;
+            RegisterInputEvent(RAYLIB_INPUT_EVENT_KEY, 257, 1, (RaylibVector2){ 0.0f, 0.0f });     // Add keys pressed into queue
         }
         else if (keysBuffer[i] == 0x7f)     // raylib RAYLIB_KEY_BACKSPACE
         {
             CORE.Input.Keyboard.currentKeyState[259] = 1;
 
-            CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount] = 257;     // Add keys pressed into queue
-            CORE.Input.Keyboard.keyPressedQueueCount++;
+            RegisterInputEvent(RAYLIB_INPUT_EVENT_KEY, 257, 1, (RaylibVector2){ 0.0f, 0.0f });     // Add keys pressed into queue
         }
         else
         {
@@ -1318,8 +1315,7 @@ static void ProcessKeyboard(void)
             }
             else CORE.Input.Keyboard.currentKeyState[(int)keysBuffer[i]] = 1;
 
-            CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount] = keysBuffer[i];     // Add keys pressed into queue
-            CORE.Input.Keyboard.keyPressedQueueCount++;
+            RegisterInputEvent(RAYLIB_INPUT_EVENT_KEY, keysBuffer[i], 1, (RaylibVector2){ 0.0f, 0.0f });     // Add keys pressed into queue
         }
     }
 }
@@ -1605,22 +1601,11 @@ static void PollKeyboardEvents(void)
                 CORE.Input.Keyboard.currentKeyState[keycode] = (event.value >= 1);
                 CORE.Input.Keyboard.keyRepeatInFrame[keycode] = (event.value == 2);
 
-                // If the key is pressed add it to the queues
-                if (event.value == 1)
-                {
-                    if (CORE.Input.Keyboard.keyPressedQueueCount < RAYLIB_MAX_CHAR_PRESSED_QUEUE)
-                    {
-                        CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount] = keycode;
-                        CORE.Input.Keyboard.keyPressedQueueCount++;
-                    }
+                // Add key event to the events queue, evdev values match event actions (release, press, repeat)
+                RegisterInputEvent(RAYLIB_INPUT_EVENT_KEY, keycode, event.value, (RaylibVector2){ 0.0f, 0.0f });
 
-                    if (CORE.Input.Keyboard.charPressedQueueCount < RAYLIB_MAX_CHAR_PRESSED_QUEUE)
-                    {
-                        // TODO/FIXME: This is not actually converting to unicode properly because it's not taking things like shift into account
-                        CORE.Input.Keyboard.charPressedQueue[CORE.Input.Keyboard.charPressedQueueCount] = evkeyToUnicodeLUT[event.code];
-                        CORE.Input.Keyboard.charPressedQueueCount++;
-                    }
-                }
+                // TODO/FIXME: This is not actually converting to unicode properly because it's not taking things like shift into account
+                if (event.value == 1) RegisterInputEvent(RAYLIB_INPUT_EVENT_CHAR, evkeyToUnicodeLUT[event.code], 1, (RaylibVector2){ 0.0f, 0.0f });
 
                 RAYLIB_TRACELOG(RAYLIB_LOG_DEBUG, "INPUT: KEY_%s Keycode(linux): %4i KeyCode(raylib): %4i", (event.value == 0)? "UP  " : "DOWN", event.code, keycode);
             }
@@ -1691,6 +1676,13 @@ static void PollMouseEvents(void)
     struct input_event event = { 0 };
     int touchAction = -1;           // 0-RAYLIB_TOUCH_ACTION_UP, 1-RAYLIB_TOUCH_ACTION_DOWN, 2-RAYLIB_TOUCH_ACTION_MOVE
 
+    // Mouse move and touch points events are registered once per device report (SYN_REPORT),
+    // when all axis of the report have been updated, touch up events keep last point position
+    bool mouseMoved = false;
+    int touchActions[RAYLIB_MAX_TOUCH_POINTS] = { 0 };
+    RaylibVector2 touchUpPositions[RAYLIB_MAX_TOUCH_POINTS] = { 0 };
+    for (int i = 0; i < RAYLIB_MAX_TOUCH_POINTS; i++) touchActions[i] = -1;
+
     // Try to read data from the mouse/touch/gesture and only continue if successful
     while (read(fd, &event, sizeof(event)) == (int)sizeof(event))
     {
@@ -1708,6 +1700,7 @@ static void PollMouseEvents(void)
 
                 CORE.Input.Touch.position[0].x = CORE.Input.Mouse.currentPosition.x;
                 touchAction = 2;    // RAYLIB_TOUCH_ACTION_MOVE
+                mouseMoved = true;
             }
 
             if (event.code == REL_Y)
@@ -1721,9 +1714,14 @@ static void PollMouseEvents(void)
 
                 CORE.Input.Touch.position[0].y = CORE.Input.Mouse.currentPosition.y;
                 touchAction = 2;    // RAYLIB_TOUCH_ACTION_MOVE
+                mouseMoved = true;
             }
 
-            if (event.code == REL_WHEEL) platform.eventWheelMove.y += event.value;
+            if (event.code == REL_WHEEL)
+            {
+                platform.eventWheelMove.y += event.value;
+                RegisterInputEvent(RAYLIB_INPUT_EVENT_MOUSE_WHEEL, 0, 2, (RaylibVector2){ 0.0f, (float)event.value });
+            }
         }
 
         // Absolute movement parsing
@@ -1736,6 +1734,8 @@ static void PollMouseEvents(void)
                 CORE.Input.Touch.position[0].x = (event.value - platform.absRange.x)*CORE.Window.screen.width/platform.absRange.width;        // Scale according to absRange
 
                 touchAction = 2;    // RAYLIB_TOUCH_ACTION_MOVE
+                mouseMoved = true;
+                if (touchActions[0] == -1) touchActions[0] = 2;
             }
 
             if (event.code == ABS_Y)
@@ -1744,29 +1744,37 @@ static void PollMouseEvents(void)
                 CORE.Input.Touch.position[0].y = (event.value - platform.absRange.y)*CORE.Window.screen.height/platform.absRange.height;      // Scale according to absRange
 
                 touchAction = 2;    // RAYLIB_TOUCH_ACTION_MOVE
+                mouseMoved = true;
+                if (touchActions[0] == -1) touchActions[0] = 2;
             }
 
             // Multitouch movement
             if (event.code == ABS_MT_SLOT) platform.touchSlot = event.value;   // Remember the slot number for the folowing events
 
-            if (event.code == ABS_MT_POSITION_X)
+            if ((event.code == ABS_MT_POSITION_X) && (platform.touchSlot < RAYLIB_MAX_TOUCH_POINTS))
             {
-                if (platform.touchSlot < RAYLIB_MAX_TOUCH_POINTS) CORE.Input.Touch.position[platform.touchSlot].x = (event.value - platform.absRange.x)*CORE.Window.screen.width/platform.absRange.width;    // Scale according to absRange
+                CORE.Input.Touch.position[platform.touchSlot].x = (event.value - platform.absRange.x)*CORE.Window.screen.width/platform.absRange.width;    // Scale according to absRange
+                if (touchActions[platform.touchSlot] == -1) touchActions[platform.touchSlot] = 2;
             }
 
-            if (event.code == ABS_MT_POSITION_Y)
+            if ((event.code == ABS_MT_POSITION_Y) && (platform.touchSlot < RAYLIB_MAX_TOUCH_POINTS))
             {
-                if (platform.touchSlot < RAYLIB_MAX_TOUCH_POINTS) CORE.Input.Touch.position[platform.touchSlot].y = (event.value - platform.absRange.y)*CORE.Window.screen.height/platform.absRange.height;  // Scale according to absRange
+                CORE.Input.Touch.position[platform.touchSlot].y = (event.value - platform.absRange.y)*CORE.Window.screen.height/platform.absRange.height;  // Scale according to absRange
+                if (touchActions[platform.touchSlot] == -1) touchActions[platform.touchSlot] = 2;
             }
 
-            if (event.code == ABS_MT_TRACKING_ID)
+            if ((event.code == ABS_MT_TRACKING_ID) && (platform.touchSlot < RAYLIB_MAX_TOUCH_POINTS))
             {
-                if ((event.value < 0) && (platform.touchSlot < RAYLIB_MAX_TOUCH_POINTS))
+                if (event.value < 0)
                 {
                     // Touch has ended for this point
+                    touchUpPositions[platform.touchSlot] = CORE.Input.Touch.position[platform.touchSlot];
+                    touchActions[platform.touchSlot] = 0;
+
                     CORE.Input.Touch.position[platform.touchSlot].x = -1;
                     CORE.Input.Touch.position[platform.touchSlot].y = -1;
                 }
+                else touchActions[platform.touchSlot] = 1;
             }
 
             // Touchscreen tap
@@ -1778,12 +1786,22 @@ static void PollMouseEvents(void)
                 {
                     platform.currentButtonStateEvdev[RAYLIB_MOUSE_BUTTON_LEFT] = 0;
                     touchAction = 0;    // RAYLIB_TOUCH_ACTION_UP
+                    RegisterInputEvent(RAYLIB_INPUT_EVENT_MOUSE_BUTTON, RAYLIB_MOUSE_BUTTON_LEFT, 0, CORE.Input.Mouse.currentPosition);
+
+                    if (touchActions[0] != 0)
+                    {
+                        touchUpPositions[0] = CORE.Input.Touch.position[0];
+                        touchActions[0] = 0;
+                    }
                 }
 
                 if (event.value && !previousMouseLeftButtonState)
                 {
                     platform.currentButtonStateEvdev[RAYLIB_MOUSE_BUTTON_LEFT] = 1;
                     touchAction = 1;    // RAYLIB_TOUCH_ACTION_DOWN
+                    RegisterInputEvent(RAYLIB_INPUT_EVENT_MOUSE_BUTTON, RAYLIB_MOUSE_BUTTON_LEFT, 1, CORE.Input.Mouse.currentPosition);
+
+                    touchActions[0] = 1;
                 }
             }
 
@@ -1792,21 +1810,42 @@ static void PollMouseEvents(void)
         // Button parsing
         if (event.type == EV_KEY)
         {
+            int button = -1;
+
             // Mouse button parsing
             if ((event.code == BTN_TOUCH) || (event.code == BTN_LEFT))
             {
-                platform.currentButtonStateEvdev[RAYLIB_MOUSE_BUTTON_LEFT] = event.value;
+                button = RAYLIB_MOUSE_BUTTON_LEFT;
 
                 if (event.value > 0) touchAction = 1;   // RAYLIB_TOUCH_ACTION_DOWN
                 else touchAction = 0;       // RAYLIB_TOUCH_ACTION_UP
+
+                // Only touch devices report touch point events, mouse left button does not
+                if (event.code == BTN_TOUCH)
+                {
+                    if (event.value > 0) touchActions[0] = 1;
+                    else if (touchActions[0] != 0)
+                    {
+                        touchUpPositions[0] = CORE.Input.Touch.position[0];
+                        touchActions[0] = 0;
+                    }
+                }
             }
 
-            if (event.code == BTN_RIGHT) platform.currentButtonStateEvdev[RAYLIB_MOUSE_BUTTON_RIGHT] = event.value;
-            if (event.code == BTN_MIDDLE) platform.currentButtonStateEvdev[RAYLIB_MOUSE_BUTTON_MIDDLE] = event.value;
-            if (event.code == BTN_SIDE) platform.currentButtonStateEvdev[RAYLIB_MOUSE_BUTTON_SIDE] = event.value;
-            if (event.code == BTN_EXTRA) platform.currentButtonStateEvdev[RAYLIB_MOUSE_BUTTON_EXTRA] = event.value;
-            if (event.code == BTN_FORWARD) platform.currentButtonStateEvdev[RAYLIB_MOUSE_BUTTON_FORWARD] = event.value;
-            if (event.code == BTN_BACK) platform.currentButtonStateEvdev[RAYLIB_MOUSE_BUTTON_BACK] = event.value;
+            if (event.code == BTN_RIGHT) button = RAYLIB_MOUSE_BUTTON_RIGHT;
+            if (event.code == BTN_MIDDLE) button = RAYLIB_MOUSE_BUTTON_MIDDLE;
+            if (event.code == BTN_SIDE) button = RAYLIB_MOUSE_BUTTON_SIDE;
+            if (event.code == BTN_EXTRA) button = RAYLIB_MOUSE_BUTTON_EXTRA;
+            if (event.code == BTN_FORWARD) button = RAYLIB_MOUSE_BUTTON_FORWARD;
+            if (event.code == BTN_BACK) button = RAYLIB_MOUSE_BUTTON_BACK;
+
+            if (button >= 0)
+            {
+                // NOTE: Left button state could already be changed by touchscreen pressure
+                if ((platform.currentButtonStateEvdev[button] > 0) != (event.value > 0)) RegisterInputEvent(RAYLIB_INPUT_EVENT_MOUSE_BUTTON, button, (event.value > 0)? 1 : 0, CORE.Input.Mouse.currentPosition);
+
+                platform.currentButtonStateEvdev[button] = event.value;
+            }
         }
 
         // Screen confinement
@@ -1819,6 +1858,19 @@ static void PollMouseEvents(void)
             if (CORE.Input.Mouse.currentPosition.y > CORE.Window.screen.height/CORE.Input.Mouse.scale.y) CORE.Input.Mouse.currentPosition.y = CORE.Window.screen.height/CORE.Input.Mouse.scale.y;
         }
 
+        // Register mouse move and touch points events, once device report is complete
+        if ((event.type == EV_SYN) && (event.code == SYN_REPORT))
+        {
+            if (mouseMoved) RegisterInputEvent(RAYLIB_INPUT_EVENT_MOUSE_MOVE, 0, 2, CORE.Input.Mouse.currentPosition);
+            mouseMoved = false;
+
+            for (int i = 0; i < RAYLIB_MAX_TOUCH_POINTS; i++)
+            {
+                if (touchActions[i] > -1) RegisterInputEvent(RAYLIB_INPUT_EVENT_TOUCH, i, touchActions[i], (touchActions[i] == 0)? touchUpPositions[i] : CORE.Input.Touch.position[i]);
+                touchActions[i] = -1;
+            }
+        }
+
         // Update touch point count
         CORE.Input.Touch.pointCount = 0;
         for (int i = 0; i < RAYLIB_MAX_TOUCH_POINTS; i++)
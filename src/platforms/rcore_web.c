@@ -961,9 +961,8 @@ void RaylibPollInputEvents(void)
     UpdateGestures();
 #endif
 
-    // Reset keys/chars pressed registered
-    CORE.Input.Keyboard.keyPressedQueueCount = 0;
-    CORE.Input.Keyboard.charPressedQueueCount = 0;
+    // Reset input events registered (keys/chars pressed, mouse, touch)
+    ResetInputEvents();
 
     // Reset last gamepad button/axis registered state
     CORE.Input.Gamepad.lastButtonPressed = 0;       // RAYLIB_GAMEPAD_BUTTON_UNKNOWN
@@ -1482,13 +1481,8 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
     else if(action == GLFW_PRESS) CORE.Input.Keyboard.currentKeyState[key] = 1;
     else if(action == GLFW_REPEAT) CORE.Input.Keyboard.keyRepeatInFrame[key] = 1;
 
-    // Check if there is space available in the key queue
-    if ((CORE.Input.Keyboard.keyPressedQueueCount < RAYLIB_MAX_KEY_PRESSED_QUEUE) && (action == GLFW_PRESS))
-    {
-        // Add character to the queue
-        CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount] = key;
-        CORE.Input.Keyboard.keyPressedQueueCount++;
-    }
+    // Add key event to the events queue, GLFW actions match event actions (release, press, repeat)
+    RegisterInputEvent(RAYLIB_INPUT_EVENT_KEY, key, action, (RaylibVector2){ 0.0f, 0.0f });
 
     // Check the exit key to set close window
     if ((key == CORE.Input.Keyboard.exitKey) && (action == GLFW_PRESS)) glfwSetWindowShouldClose(platform.handle, GLFW_TRUE);
@@ -1504,13 +1498,8 @@ static void CharCallback(GLFWwindow *window, unsigned int key)
     // Ref: https://github.com/glfw/glfw/issues/668#issuecomment-166794907
     // Ref: https://www.glfw.org/docs/latest/input_guide.html#input_char
 
-    // Check if there is space available in the queue
-    if (CORE.Input.Keyboard.charPressedQueueCount < RAYLIB_MAX_CHAR_PRESSED_QUEUE)
-    {
-        // Add character to the queue
-        CORE.Input.Keyboard.charPressedQueue[CORE.Input.Keyboard.charPressedQueueCount] = key;
-        CORE.Input.Keyboard.charPressedQueueCount++;
-    }
+    // Add character to the events queue
+    RegisterInputEvent(RAYLIB_INPUT_EVENT_CHAR, (int)key, 1, (RaylibVector2){ 0.0f, 0.0f });
 }
 
 // GLFW3 Mouse Button Callback, runs on mouse button pressed
@@ -1521,6 +1510,9 @@ static void MouseButtonCallback(GLFWwindow *window, int button, int action, int
     CORE.Input.Mouse.currentButtonState[button] = action;
     CORE.Input.Touch.currentTouchState[button] = action;
 
+    // Add mouse button event to the events queue, it keeps presses and releases within a frame
+    RegisterInputEvent(RAYLIB_INPUT_EVENT_MOUSE_BUTTON, button, action, CORE.Input.Mouse.currentPosition);
+
 #if defined(RAYLIB_SUPPORT_GESTURES_SYSTEM) && defined(RAYLIB_SUPPORT_MOUSE_GESTURES)
     // Process mouse events as touches to be able to use mouse-gestures
     GestureEvent gestureEvent = { 0 };
@@ -1560,6 +1552,8 @@ static void MouseCursorPosCallback(GLFWwindow *window, double x, double y)
         CORE.Input.Mouse.currentPosition.x = (float)x;
         CORE.Input.Mouse.currentPosition.y = (float)y;
         CORE.Input.Touch.position[0] = CORE.Input.Mouse.currentPosition;
+
+        RegisterInputEvent(RAYLIB_INPUT_EVENT_MOUSE_MOVE, 0, 2, CORE.Input.Mouse.currentPosition);
     }
 
 #if defined(RAYLIB_SUPPORT_GESTURES_SYSTEM) && defined(RAYLIB_SUPPORT_MOUSE_GESTURES)
@@ -1602,6 +1596,8 @@ static EM_BOOL EmscriptenMouseMoveCallback(int eventType, const EmscriptenMouseE
 static void MouseScrollCallback(GLFWwindow *window, double xoffset, double yoffset)
 {
     CORE.Input.Mouse.currentWheelMove = (RaylibVector2){ (float)xoffset, (float)yoffset };
+
+    RegisterInputEvent(RAYLIB_INPUT_EVENT_MOUSE_WHEEL, 0, 2, CORE.Input.Mouse.currentWheelMove);
 }
 
 // GLFW3 CursorEnter Callback, when cursor enters the window
@@ -1746,6 +1742,8 @@ static EM_BOOL EmscriptenTouchCallback(int eventType, const EmscriptenTouchEvent
 
         if (eventType == EMSCRIPTEN_EVENT_TOUCHSTART) CORE.Input.Touch.currentTouchState[i] = 1;
         else if (eventType == EMSCRIPTEN_EVENT_TOUCHEND) CORE.Input.Touch.currentTouchState[i] = 0;
+
+        RegisterInputEvent(RAYLIB_INPUT_EVENT_TOUCH, CORE.Input.Touch.pointId[i], (eventType == EMSCRIPTEN_EVENT_TOUCHSTART)? 1 : (eventType == EMSCRIPTEN_EVENT_TOUCHMOVE)? 2 : 0, CORE.Input.Touch.position[i]);
     }
 
     // Update mouse position if we detect a single touch.
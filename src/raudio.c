@@ -28,6 +28,11 @@
 *           Selected desired fileformats to be supported for loading. Some of those formats are
 *           supported by default, to remove support, just comment unrequired #define in this module
 *
+*       #define RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER
+*           The audio device callback never takes the audio system mutex: play/stop/volume/pitch/pan
+*           changes and buffer (un)tracking are sent through a single-consumer command queue and
+*           applied by the callback, that owns the list of playing buffers. Not used on web platform
+*
 *   DEPENDENCIES:
 *       miniaudio.h  - Audio device management lib (https://github.com/mackron/miniaudio)
 *       stb_vorbis.h - Ogg audio files loading (http://www.nothings.org/stb_vorbis/)
@@ -184,6 +189,14 @@ typedef struct tagBITMAPINFOHEADER {
 #include <stdio.h>                      // Required for: FILE, fopen(), fclose(), fread()
 #include <string.h>                     // Required for: strcmp() [Used in RaylibIsFileExtension(), RaylibLoadWaveFromMemory(), RaylibLoadMusicStreamFromMemory()]
 
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #include <xmmintrin.h>                  // Required for: __m128, _mm_loadu_ps(), _mm_mul_ps(), _mm_add_ps() [Used in MixAudioFrames()]
+    #define AUDIO_MIXING_SIMD_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>                   // Required for: float32x4_t, vld1q_f32(), vmlaq_f32() [Used in MixAudioFrames()]
+    #define AUDIO_MIXING_SIMD_NEON
+#endif
+
 #if defined(RAUDIO_STANDALONE)
     #ifndef RAYLIB_TRACELOG
         #define RAYLIB_TRACELOG(level, ...)    printf(__VA_ARGS__)
@@ -299,6 +312,21 @@ typedef struct tagBITMAPINFOHEADER {
     #define RAYLIB_MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Audio pool channels
 #endif
 
+#ifndef RAYLIB_AUDIO_MIXER_GAIN_RAMP_FRAMES
+    #define RAYLIB_AUDIO_MIXER_GAIN_RAMP_FRAMES     256    // Frames to reach a new volume/pan gain, avoids clicks
+#endif
+#ifndef RAYLIB_AUDIO_MIXER_COMMAND_QUEUE_SIZE
+    #define RAYLIB_AUDIO_MIXER_COMMAND_QUEUE_SIZE  1024    // Maximum pending mixer commands (power of two)
+#endif
+#ifndef RAYLIB_AUDIO_MIXER_COMMAND_TIMEOUT
+    #define RAYLIB_AUDIO_MIXER_COMMAND_TIMEOUT      100    // Maximum wait for the mixer to apply commands (in milliseconds)
+#endif
+
+// Web audio callback runs on the main thread, waiting on it would never return
+#if defined(RAYLIB_PLATFORM_WEB) || defined(__EMSCRIPTEN__)
+    #undef RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -349,18 +377,31 @@ struct RaylibrAudioBuffer {
     float pitch;                    // Audio buffer pitch
     float pan;                      // Audio buffer pan (0.0f to 1.0f)
 
-    bool playing;                   // Audio buffer state: AUDIO_PLAYING
-    bool paused;                    // Audio buffer state: AUDIO_PAUSED
+    ma_bool32 playing;              // Audio buffer state: AUDIO_PLAYING
+    ma_bool32 paused;               // Audio buffer state: AUDIO_PAUSED
     bool looping;                   // Audio buffer looping, default to true for AudioStreams
     int usage;                      // Audio buffer usage mode: STATIC or STREAM
 
-    bool isSubBufferProcessed[2];   // SubBuffer processed (virtual double buffer)
+    ma_bool32 isSubBufferProcessed[2]; // SubBuffer processed (virtual double buffer)
     unsigned int sizeInFrames;      // Total buffer size in frames
     unsigned int frameCursorPos;    // Frame cursor position
     unsigned int framesProcessed;   // Total frames processed in this buffer (required for play timing)
 
     unsigned char *data;            // Data buffer, on music stream keeps filling
 
+    float mixGain[2];               // Mixer: current left/right gains (volume and pan)
+    float mixTarget[2];             // Mixer: gains being ramped to
+    unsigned int mixRampFrames;     // Mixer: frames left to reach target gains
+    bool mixGainReady;              // Mixer: gains initialized, reset on play to start without ramp
+
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+    ma_uint32 commandSerial;        // Last state command queued for this buffer (program side)
+    ma_uint32 appliedSerial;        // Last state command applied to this buffer (device callback side)
+    ma_uint32 stopSerial;           // Last stop command queued, sub-buffers are not refilled until applied (program side)
+    bool requestedPlaying;          // Playing state once queued commands are applied (program side)
+    bool requestedPaused;           // Paused state once queued commands are applied (program side)
+#endif
+
     RaylibrAudioBuffer *next;             // Next audio buffer on the list
     RaylibrAudioBuffer *prev;             // Previous audio buffer on the list
 };
@@ -375,6 +416,48 @@ struct RaylibrAudioProcessor {
 
 #define AudioBuffer RaylibrAudioBuffer    // HACK: To avoid CoreAudio (macOS) symbol collision
 
+// Audio buffer state shared by program and mixer: playing, paused, isSubBufferProcessed and frameCursorPos
+// NOTE: With the lock-free mixer, the mixer writes playing, paused and frameCursorPos, the program writes framesProcessed,
+// sub-buffers processed state is written by the side handing them over (see UpdateAudioStreamInLockedState())
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+    #define AUDIO_SHARED_LOAD(value) ma_atomic_load_explicit_32(&(value), ma_atomic_memory_order_acquire)
+    #define AUDIO_SHARED_STORE(value, x) ma_atomic_store_explicit_32(&(value), (x), ma_atomic_memory_order_release)
+#else
+    #define AUDIO_SHARED_LOAD(value) (value)
+    #define AUDIO_SHARED_STORE(value, x) ((value) = (x))
+#endif
+
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+// Mixer command type
+// NOTE: Commands are queued by the program and applied by the device callback before mixing
+typedef enum {
+    AUDIO_COMMAND_TRACK = 0,        // Add buffer to the mixing list
+    AUDIO_COMMAND_UNTRACK,          // Remove buffer from the mixing list
+    AUDIO_COMMAND_PLAY,             // Play buffer from the start
+    AUDIO_COMMAND_STOP,             // Stop buffer
+    AUDIO_COMMAND_PAUSE,            // Pause buffer
+    AUDIO_COMMAND_RESUME,           // Resume buffer
+    AUDIO_COMMAND_VOLUME,           // Set buffer volume
+    AUDIO_COMMAND_PITCH,            // Set buffer pitch
+    AUDIO_COMMAND_PAN,              // Set buffer pan
+    AUDIO_COMMAND_CALLBACK,         // Set buffer filling callback
+    AUDIO_COMMAND_ATTACH_PROCESSOR, // Append processor to buffer (or mixed output if no buffer)
+    AUDIO_COMMAND_DETACH_PROCESSOR  // Remove processors from buffer (or mixed output if no buffer)
+} AudioCommandType;
+
+// Mixer command
+typedef struct AudioCommand {
+    int type;                       // Command type (AudioCommandType)
+    AudioBuffer *buffer;            // Target audio buffer, NULL for mixed output processors
+    RaylibrAudioProcessor *processor;     // Processor to attach
+    RaylibAudioCallback callback;         // Buffer filling callback or processor function to detach
+    float value;                    // Volume, pitch or pan value
+    ma_uint32 serial;               // Buffer command serial, see AudioBuffer.appliedSerial
+    bool release;                   // Untrack: free buffer once the mixer has applied the command
+    bool releaseData;               // Untrack: free buffer data too (not shared with a sound alias)
+} AudioCommand;
+#endif
+
 // Audio data context
 typedef struct AudioData {
     struct {
@@ -390,6 +473,22 @@ typedef struct AudioData {
         AudioBuffer *last;          // Pointer to last AudioBuffer in the list
         int defaultSize;            // Default audio buffer size for audio streams
     } Buffer;
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+    struct {
+        AudioCommand queue[RAYLIB_AUDIO_MIXER_COMMAND_QUEUE_SIZE]; // Commands ring buffer
+        ma_uint32 writeIndex;       // Commands queued, only written by program (under audio system mutex)
+        ma_uint32 readIndex;        // Commands applied, only written by mixer
+        ma_uint32 retireIndex;      // Commands applied and retired, only written by program, see RetireAudioCommands()
+    } Command;
+#endif
+    struct {
+        ma_timer timer;             // Timer used to measure device callback time
+        ma_uint32 callbackCount;    // Device callbacks processed
+        ma_uint32 commandCount;     // Mixer commands applied
+        ma_uint32 lastTime;         // Last device callback time (in microseconds)
+        ma_uint32 maxTime;          // Worst-case device callback time (in microseconds)
+        ma_uint32 resetRequested;   // Stats reset requested by program, applied by device callback
+    } Stats;
     RaylibrAudioProcessor *mixedProcessor;
 } AudioData;
 
@@ -417,11 +516,25 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
 
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);
+static void MixAudioSamples(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, const float *gains);
+static void MixAudioSamplesStereoRamp(float *framesOut, const float *framesIn, ma_uint32 frameCount, const float *gains, const float *step);
 
 static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer);
 static void StopAudioBufferInLockedState(AudioBuffer *buffer);
+static bool IsAudioSubBufferProcessed(AudioBuffer *buffer, int index);
 static void UpdateAudioStreamInLockedState(RaylibAudioStream stream, const void *data, int frameCount);
 
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+static bool IsAudioMixerRunning(void);                          // Check if device callback is consuming commands
+static bool PushAudioCommand(AudioCommand command);             // Queue command for the mixer, assuming the audio system mutex has been locked, returns false on timeout
+static bool PushAudioBufferCommand(AudioBuffer *buffer, int type, float value); // Queue buffer state command, assuming the audio system mutex has been locked, returns false on timeout
+static bool WaitAudioBufferCommands(AudioBuffer *buffer);       // Wait for the mixer to apply buffer state commands, assuming the audio system mutex has been locked
+static void RetireAudioCommands(void);                          // Free buffers and processors released by applied commands, assuming the audio system mutex has been locked
+static void ProcessAudioCommands(void);                         // Apply queued commands (mixer side)
+static void ReleaseAudioBuffer(AudioBuffer *buffer, bool freeData); // Untrack buffer through the mixer and free it once released
+static void DetachAudioProcessors(AudioBuffer *buffer, RaylibAudioCallback process); // Detach processors through the mixer, assuming the audio system mutex has been locked
+#endif
+
 #if defined(RAUDIO_STANDALONE)
 static bool RaylibIsFileExtension(const char *fileName, const char *ext); // Check file extension
 static const char *RaylibGetFileExtension(const char *fileName);          // Get pointer to extension for a filename string (includes the dot: .png)
@@ -500,6 +613,8 @@ void RaylibInitAudioDevice(void)
         return;
     }
 
+    ma_timer_init(&AUDIO.Stats.timer);
+
     // Keep the device running the whole time. May want to consider doing something a bit smarter and only have the device running
     // while there's at least one sound being played
     result = ma_device_start(&AUDIO.System.device);
@@ -530,6 +645,12 @@ void RaylibCloseAudioDevice(void)
         ma_device_uninit(&AUDIO.System.device);
         ma_context_uninit(&AUDIO.System.context);
 
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+        // Device callback is not running anymore, free buffers and processors still waiting to be released
+        ProcessAudioCommands();
+        RetireAudioCommands();
+#endif
+
         AUDIO.System.isReady = false;
         RL_FREE(AUDIO.System.pcmBuffer);
         AUDIO.System.pcmBuffer = NULL;
@@ -560,6 +681,26 @@ float RaylibGetMasterVolume(void)
     return volume;
 }
 
+// Get audio device callback timing stats
+RaylibAudioMixerStats RaylibGetAudioMixerStats(void)
+{
+    RaylibAudioMixerStats stats = { 0 };
+
+    stats.callbackCount = ma_atomic_load_32(&AUDIO.Stats.callbackCount);
+    stats.commandCount = ma_atomic_load_32(&AUDIO.Stats.commandCount);
+    stats.lastCallbackTime = (float)ma_atomic_load_32(&AUDIO.Stats.lastTime)/1000000.0f;
+    stats.maxCallbackTime = (float)ma_atomic_load_32(&AUDIO.Stats.maxTime)/1000000.0f;
+
+    return stats;
+}
+
+// Reset audio device callback timing stats
+// NOTE: Stats are only written by the device callback, reset is applied on next callback
+void RaylibResetAudioMixerStats(void)
+{
+    ma_atomic_store_32(&AUDIO.Stats.resetRequested, 1);
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Audio Buffer management
 //----------------------------------------------------------------------------------
@@ -622,10 +763,15 @@ void UnloadAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+        // Mixer may still be reading the buffer, it is freed once the untrack command has been applied
+        ReleaseAudioBuffer(buffer, true);
+#else
         UntrackAudioBuffer(buffer);
         ma_data_converter_uninit(&buffer->converter, NULL);
         RL_FREE(buffer->data);
         RL_FREE(buffer);
+#endif
     }
 }
 
@@ -634,7 +780,16 @@ bool IsAudioBufferPlaying(AudioBuffer *buffer)
 {
     bool result = false;
     ma_mutex_lock(&AUDIO.System.lock);
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+    // While state commands are still queued, report the state they will set
+    if ((buffer != NULL) && (ma_atomic_load_explicit_32(&buffer->appliedSerial, ma_atomic_memory_order_acquire) != buffer->commandSerial))
+    {
+        result = (buffer->requestedPlaying && !buffer->requestedPaused);
+    }
+    else result = IsAudioBufferPlayingInLockedState(buffer);
+#else
     result = IsAudioBufferPlayingInLockedState(buffer);
+#endif
     ma_mutex_unlock(&AUDIO.System.lock);
     return result;
 }
@@ -647,9 +802,14 @@ void PlayAudioBuffer(AudioBuffer *buffer)
     if (buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+        PushAudioBufferCommand(buffer, AUDIO_COMMAND_PLAY, 0.0f);
+#else
         buffer->playing = true;
         buffer->paused = false;
         buffer->frameCursorPos = 0;
+        buffer->mixGainReady = false;
+#endif
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -658,7 +818,11 @@ void PlayAudioBuffer(AudioBuffer *buffer)
 void StopAudioBuffer(AudioBuffer *buffer)
 {
     ma_mutex_lock(&AUDIO.System.lock);
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+    if (buffer != NULL) PushAudioBufferCommand(buffer, AUDIO_COMMAND_STOP, 0.0f);
+#else
     StopAudioBufferInLockedState(buffer);
+#endif
     ma_mutex_unlock(&AUDIO.System.lock);
 }
 
@@ -668,7 +832,11 @@ void PauseAudioBuffer(AudioBuffer *buffer)
     if (buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+        PushAudioBufferCommand(buffer, AUDIO_COMMAND_PAUSE, 0.0f);
+#else
         buffer->paused = true;
+#endif
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -679,7 +847,11 @@ void ResumeAudioBuffer(AudioBuffer *buffer)
     if (buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+        PushAudioBufferCommand(buffer, AUDIO_COMMAND_RESUME, 0.0f);
+#else
         buffer->paused = false;
+#endif
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -690,7 +862,11 @@ void SetAudioBufferVolume(AudioBuffer *buffer, float volume)
     if (buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+        PushAudioBufferCommand(buffer, AUDIO_COMMAND_VOLUME, volume);
+#else
         buffer->volume = volume;
+#endif
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -701,6 +877,9 @@ void SetAudioBufferPitch(AudioBuffer *buffer, float pitch)
     if ((buffer != NULL) && (pitch > 0.0f))
     {
         ma_mutex_lock(&AUDIO.System.lock);
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+        PushAudioBufferCommand(buffer, AUDIO_COMMAND_PITCH, pitch);
+#else
         // Pitching is just an adjustment of the sample rate
         // Note that this changes the duration of the sound:
         //  - higher pitches will make the sound faster
@@ -709,6 +888,7 @@ void SetAudioBufferPitch(AudioBuffer *buffer, float pitch)
         ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
 
         buffer->pitch = pitch;
+#endif
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -722,7 +902,11 @@ void SetAudioBufferPan(AudioBuffer *buffer, float pan)
     if (buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+        PushAudioBufferCommand(buffer, AUDIO_COMMAND_PAN, pan);
+#else
         buffer->pan = pan;
+#endif
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -731,6 +915,12 @@ void SetAudioBufferPan(AudioBuffer *buffer, float pan)
 void TrackAudioBuffer(AudioBuffer *buffer)
 {
     ma_mutex_lock(&AUDIO.System.lock);
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+    AudioCommand command = { 0 };
+    command.type = AUDIO_COMMAND_TRACK;
+    command.buffer = buffer;
+    PushAudioCommand(command);
+#else
     {
         if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
         else
@@ -741,13 +931,22 @@ void TrackAudioBuffer(AudioBuffer *buffer)
 
         AUDIO.Buffer.last = buffer;
     }
+#endif
     ma_mutex_unlock(&AUDIO.System.lock);
 }
 
 // Untrack audio buffer from linked list
+// NOTE: With the lock-free mixer, the buffer is still referenced until the mixer applies
+// the command, use UnloadAudioBuffer() to free it once released
 void UntrackAudioBuffer(AudioBuffer *buffer)
 {
     ma_mutex_lock(&AUDIO.System.lock);
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+    AudioCommand command = { 0 };
+    command.type = AUDIO_COMMAND_UNTRACK;
+    command.buffer = buffer;
+    PushAudioCommand(command);
+#else
     {
         if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
         else buffer->prev->next = buffer->next;
@@ -758,6 +957,7 @@ void UntrackAudioBuffer(AudioBuffer *buffer)
         buffer->prev = NULL;
         buffer->next = NULL;
     }
+#endif
     ma_mutex_unlock(&AUDIO.System.lock);
 }
 
@@ -1026,9 +1226,13 @@ void RaylibUnloadSoundAlias(RaylibSound alias)
     // Untrack and unload just the sound buffer, not the sample data, it is shared with the source for the alias
     if (alias.stream.buffer != NULL)
     {
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+        ReleaseAudioBuffer(alias.stream.buffer, false);
+#else
         UntrackAudioBuffer(alias.stream.buffer);
         ma_data_converter_uninit(&alias.stream.buffer->converter, NULL);
         RL_FREE(alias.stream.buffer);
+#endif
     }
 }
 
@@ -1037,9 +1241,22 @@ void RaylibUpdateSound(RaylibSound sound, const void *data, int frameCount)
 {
     if (sound.stream.buffer != NULL)
     {
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+        // Mixer could still be reading sound data until the stop command is applied
+        ma_mutex_lock(&AUDIO.System.lock);
+
+        if (PushAudioBufferCommand(sound.stream.buffer, AUDIO_COMMAND_STOP, 0.0f) && WaitAudioBufferCommands(sound.stream.buffer))
+        {
+            memcpy(sound.stream.buffer->data, data, frameCount*ma_get_bytes_per_frame(sound.stream.buffer->converter.formatIn, sound.stream.buffer->converter.channelsIn));
+        }
+        else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "SOUND: Failed to stop sound for updating, data not updated");
+
+        ma_mutex_unlock(&AUDIO.System.lock);
+#else
         StopAudioBuffer(sound.stream.buffer);
 
         memcpy(sound.stream.buffer->data, data, frameCount*ma_get_bytes_per_frame(sound.stream.buffer->converter.formatIn, sound.stream.buffer->converter.channelsIn));
+#endif
     }
 }
 
@@ -1881,7 +2098,7 @@ void RaylibUpdateMusicStream(RaylibMusic music)
     // Check both sub-buffers to check if they require refilling
     for (int i = 0; i < 2; i++)
     {
-        if (!music.stream.buffer->isSubBufferProcessed[i]) continue; // No refilling required, move to next sub-buffer
+        if (!IsAudioSubBufferProcessed(music.stream.buffer, i)) continue; // No refilling required, move to next sub-buffer
 
         unsigned int framesLeft = music.frameCount - music.stream.buffer->framesProcessed;  // Frames left to be processed
         unsigned int framesToStream = 0;                 // Total frames to be streamed
@@ -2074,9 +2291,9 @@ float RaylibGetMusicTimePlayed(RaylibMusic music)
             //ma_uint32 frameSizeInBytes = ma_get_bytes_per_sample(music.stream.buffer->dsp.formatConverterIn.config.formatIn)*music.stream.buffer->dsp.formatConverterIn.config.channels;
             int framesProcessed = (int)music.stream.buffer->framesProcessed;
             int subBufferSize = (int)music.stream.buffer->sizeInFrames/2;
-            int framesInFirstBuffer = music.stream.buffer->isSubBufferProcessed[0]? 0 : subBufferSize;
-            int framesInSecondBuffer = music.stream.buffer->isSubBufferProcessed[1]? 0 : subBufferSize;
-            int framesSentToMix = music.stream.buffer->frameCursorPos%subBufferSize;
+            int framesInFirstBuffer = IsAudioSubBufferProcessed(music.stream.buffer, 0)? 0 : subBufferSize;
+            int framesInSecondBuffer = IsAudioSubBufferProcessed(music.stream.buffer, 1)? 0 : subBufferSize;
+            int framesSentToMix = AUDIO_SHARED_LOAD(music.stream.buffer->frameCursorPos)%subBufferSize;
             int framesPlayed = (framesProcessed - framesInFirstBuffer - framesInSecondBuffer + framesSentToMix)%(int)music.frameCount;
             if (framesPlayed < 0) framesPlayed += music.frameCount;
             secondsPlayed = (float)framesPlayed/music.stream.sampleRate;
@@ -2153,7 +2370,7 @@ bool RaylibIsAudioStreamProcessed(RaylibAudioStream stream)
 
     bool result = false;
     ma_mutex_lock(&AUDIO.System.lock);
-    result = stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1];
+    result = IsAudioSubBufferProcessed(stream.buffer, 0) || IsAudioSubBufferProcessed(stream.buffer, 1);
     ma_mutex_unlock(&AUDIO.System.lock);
     return result;
 }
@@ -2218,7 +2435,15 @@ void RaylibSetAudioStreamCallback(RaylibAudioStream stream, RaylibAudioCallback
     if (stream.buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+        AudioCommand command = { 0 };
+        command.type = AUDIO_COMMAND_CALLBACK;
+        command.buffer = stream.buffer;
+        command.callback = callback;
+        PushAudioCommand(command);
+#else
         stream.buffer->callback = callback;
+#endif
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -2233,6 +2458,13 @@ void RaylibAttachAudioStreamProcessor(RaylibAudioStream stream, RaylibAudioCallb
     RaylibrAudioProcessor *processor = (RaylibrAudioProcessor *)RL_CALLOC(1, sizeof(RaylibrAudioProcessor));
     processor->process = process;
 
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+    AudioCommand command = { 0 };
+    command.type = AUDIO_COMMAND_ATTACH_PROCESSOR;
+    command.buffer = stream.buffer;
+    command.processor = processor;
+    if (!PushAudioCommand(command)) RL_FREE(processor);
+#else
     RaylibrAudioProcessor *last = stream.buffer->processor;
 
     while (last && last->next)
@@ -2245,6 +2477,7 @@ void RaylibAttachAudioStreamProcessor(RaylibAudioStream stream, RaylibAudioCallb
         last->next = processor;
     }
     else stream.buffer->processor = processor;
+#endif
 
     ma_mutex_unlock(&AUDIO.System.lock);
 }
@@ -2254,6 +2487,9 @@ void RaylibDetachAudioStreamProcessor(RaylibAudioStream stream, RaylibAudioCallb
 {
     ma_mutex_lock(&AUDIO.System.lock);
 
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+    DetachAudioProcessors(stream.buffer, process);
+#else
     RaylibrAudioProcessor *processor = stream.buffer->processor;
 
     while (processor)
@@ -2272,6 +2508,7 @@ void RaylibDetachAudioStreamProcessor(RaylibAudioStream stream, RaylibAudioCallb
 
         processor = next;
     }
+#endif
 
     ma_mutex_unlock(&AUDIO.System.lock);
 }
@@ -2286,6 +2523,12 @@ void RaylibAttachAudioMixedProcessor(RaylibAudioCallback process)
     RaylibrAudioProcessor *processor = (RaylibrAudioProcessor *)RL_CALLOC(1, sizeof(RaylibrAudioProcessor));
     processor->process = process;
 
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+    AudioCommand command = { 0 };
+    command.type = AUDIO_COMMAND_ATTACH_PROCESSOR;
+    command.processor = processor;
+    if (!PushAudioCommand(command)) RL_FREE(processor);
+#else
     RaylibrAudioProcessor *last = AUDIO.mixedProcessor;
 
     while (last && last->next)
@@ -2298,6 +2541,7 @@ void RaylibAttachAudioMixedProcessor(RaylibAudioCallback process)
         last->next = processor;
     }
     else AUDIO.mixedProcessor = processor;
+#endif
 
     ma_mutex_unlock(&AUDIO.System.lock);
 }
@@ -2307,6 +2551,9 @@ void RaylibDetachAudioMixedProcessor(RaylibAudioCallback process)
 {
     ma_mutex_lock(&AUDIO.System.lock);
 
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+    DetachAudioProcessors(NULL, process);
+#else
     RaylibrAudioProcessor *processor = AUDIO.mixedProcessor;
 
     while (processor)
@@ -2325,6 +2572,7 @@ void RaylibDetachAudioMixedProcessor(RaylibAudioCallback process)
 
         processor = next;
     }
+#endif
 
     ma_mutex_unlock(&AUDIO.System.lock);
 }
@@ -2347,7 +2595,9 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
     if (audioBuffer->callback)
     {
         audioBuffer->callback(framesOut, frameCount);
-        audioBuffer->framesProcessed += frameCount;
+#if !defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+        audioBuffer->framesProcessed += frameCount;     // NOTE: Program owned with the lock-free mixer, not tracked for callbacks
+#endif
 
         return frameCount;
     }
@@ -2359,9 +2609,10 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
 
     // Another thread can update the processed state of buffers, so
     // we just take a copy here to try and avoid potential synchronization problems
+    // NOTE: With the lock-free mixer, sub-buffer data written by program is visible once loaded as not processed
     bool isSubBufferProcessed[2] = { 0 };
-    isSubBufferProcessed[0] = audioBuffer->isSubBufferProcessed[0];
-    isSubBufferProcessed[1] = audioBuffer->isSubBufferProcessed[1];
+    isSubBufferProcessed[0] = AUDIO_SHARED_LOAD(audioBuffer->isSubBufferProcessed[0]);
+    isSubBufferProcessed[1] = AUDIO_SHARED_LOAD(audioBuffer->isSubBufferProcessed[1]);
 
     ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
 
@@ -2400,13 +2651,14 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
         if (framesToRead > framesRemainingInOutputBuffer) framesToRead = framesRemainingInOutputBuffer;
 
         memcpy((unsigned char *)framesOut + (framesRead*frameSizeInBytes), audioBuffer->data + (audioBuffer->frameCursorPos*frameSizeInBytes), framesToRead*frameSizeInBytes);
-        audioBuffer->frameCursorPos = (audioBuffer->frameCursorPos + framesToRead)%audioBuffer->sizeInFrames;
+        AUDIO_SHARED_STORE(audioBuffer->frameCursorPos, (audioBuffer->frameCursorPos + framesToRead)%audioBuffer->sizeInFrames);
         framesRead += framesToRead;
 
         // If we've read to the end of the buffer, mark it as processed
         if (framesToRead == framesRemainingInOutputBuffer)
         {
-            audioBuffer->isSubBufferProcessed[currentSubBufferIndex] = true;
+            // NOTE: With the lock-free mixer, sub-buffer data has been read before program can refill it
+            AUDIO_SHARED_STORE(audioBuffer->isSubBufferProcessed[currentSubBufferIndex], true);
             isSubBufferProcessed[currentSubBufferIndex] = true;
 
             currentSubBufferIndex = (currentSubBufferIndex + 1)%2;
@@ -2488,12 +2740,20 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
 {
     (void)pDevice;
 
+    double startTime = ma_timer_get_time_in_seconds(&AUDIO.Stats.timer);
+
     // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
     memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
 
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+    // The mixer owns the buffers list and their playing state, program changes
+    // are applied here first, so no lock nor allocation is required to mix
+    ProcessAudioCommands();
+#else
     // Using a mutex here for thread-safety which makes things not real-time
     // This is unlikely to be necessary for this project, but may want to consider how you might want to avoid this
     ma_mutex_lock(&AUDIO.System.lock);
+#endif
     {
         for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
         {
@@ -2557,7 +2817,7 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
                         {
                             // Should never get here, but just for safety,
                             // move the cursor position back to the start and continue the loop
-                            audioBuffer->frameCursorPos = 0;
+                            AUDIO_SHARED_STORE(audioBuffer->frameCursorPos, 0);
                             continue;
                         }
                     }
@@ -2577,15 +2837,33 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
         processor = processor->next;
     }
 
+#if !defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
     ma_mutex_unlock(&AUDIO.System.lock);
+#endif
+
+    // Update callback timing stats, only written here
+    ma_uint32 elapsedTime = (ma_uint32)((ma_timer_get_time_in_seconds(&AUDIO.Stats.timer) - startTime)*1000000.0);
+
+    if (ma_atomic_exchange_32(&AUDIO.Stats.resetRequested, 0) != 0)
+    {
+        ma_atomic_store_32(&AUDIO.Stats.callbackCount, 0);
+        ma_atomic_store_32(&AUDIO.Stats.commandCount, 0);
+        ma_atomic_store_32(&AUDIO.Stats.maxTime, 0);
+    }
+
+    ma_atomic_store_32(&AUDIO.Stats.lastTime, elapsedTime);
+    if (elapsedTime > AUDIO.Stats.maxTime) ma_atomic_store_32(&AUDIO.Stats.maxTime, elapsedTime);
+    ma_atomic_store_32(&AUDIO.Stats.callbackCount, AUDIO.Stats.callbackCount + 1);
 }
 
 // Main mixing function, pretty simple in this project, just an accumulation
 // NOTE: framesOut is both an input and an output, it is initially filled with zeros outside of this function
+// Volume and pan changes are linearly ramped over RAYLIB_AUDIO_MIXER_GAIN_RAMP_FRAMES to avoid clicks
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer)
 {
     const float localVolume = buffer->volume;
     const ma_uint32 channels = AUDIO.System.device.playback.channels;
+    float target[2] = { localVolume, localVolume };
 
     if (channels == 2)  // We consider panning
     {
@@ -2593,33 +2871,132 @@ static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 fr
         const float right = 1.0f - left;
 
         // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
-        const float levels[2] = { localVolume*0.5f*left*(3.0f - left*left), localVolume*0.5f*right*(3.0f - right*right) };
+        target[0] = localVolume*0.5f*left*(3.0f - left*left);
+        target[1] = localVolume*0.5f*right*(3.0f - right*right);
+    }
 
-        float *frameOut = framesOut;
-        const float *frameIn = framesIn;
+    if (!buffer->mixGainReady)
+    {
+        // Starting playback, no previous gain to ramp from
+        buffer->mixGain[0] = buffer->mixTarget[0] = target[0];
+        buffer->mixGain[1] = buffer->mixTarget[1] = target[1];
+        buffer->mixRampFrames = 0;
+        buffer->mixGainReady = true;
+    }
+    else if ((target[0] != buffer->mixTarget[0]) || (target[1] != buffer->mixTarget[1]))
+    {
+        // New gain requested, ramp to it from the current one
+        buffer->mixTarget[0] = target[0];
+        buffer->mixTarget[1] = target[1];
+        buffer->mixRampFrames = RAYLIB_AUDIO_MIXER_GAIN_RAMP_FRAMES;
+    }
 
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            frameOut[0] += (frameIn[0]*levels[0]);
-            frameOut[1] += (frameIn[1]*levels[1]);
+    // Ramp part, gain changes on every frame
+    ma_uint32 rampFrames = (frameCount < buffer->mixRampFrames)? frameCount : buffer->mixRampFrames;
 
-            frameOut += 2;
-            frameIn += 2;
-        }
-    }
-    else  // We do not consider panning
+    if (rampFrames > 0)
     {
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
+        const float step[2] = {
+            (buffer->mixTarget[0] - buffer->mixGain[0])/(float)buffer->mixRampFrames,
+            (buffer->mixTarget[1] - buffer->mixGain[1])/(float)buffer->mixRampFrames
+        };
+
+        if (channels == 2) MixAudioSamplesStereoRamp(framesOut, framesIn, rampFrames, buffer->mixGain, step);
+        else
         {
-            for (ma_uint32 c = 0; c < channels; c++)
-            {
-                float *frameOut = framesOut + (frame*channels);
-                const float *frameIn = framesIn + (frame*channels);
+            float gain = buffer->mixGain[0];
 
-                // Output accumulates input multiplied by volume to provided output (usually 0)
-                frameOut[c] += (frameIn[c]*localVolume);
+            for (ma_uint32 frame = 0; frame < rampFrames; frame++, gain += step[0])
+            {
+                for (ma_uint32 c = 0; c < channels; c++) framesOut[frame*channels + c] += (framesIn[frame*channels + c]*gain);
             }
         }
+
+        buffer->mixRampFrames -= rampFrames;
+
+        if (buffer->mixRampFrames == 0)
+        {
+            buffer->mixGain[0] = buffer->mixTarget[0];
+            buffer->mixGain[1] = buffer->mixTarget[1];
+        }
+        else
+        {
+            buffer->mixGain[0] += step[0]*rampFrames;
+            buffer->mixGain[1] += step[1]*rampFrames;
+        }
+
+        framesOut += rampFrames*channels;
+        framesIn += rampFrames*channels;
+        frameCount -= rampFrames;
+    }
+
+    // Constant part, output accumulates input multiplied by gain to provided output (usually 0)
+    // NOTE: Without panning (channels != 2), both gains are the same
+    if (frameCount > 0) MixAudioSamples(framesOut, framesIn, frameCount*channels, buffer->mixGain);
+}
+
+// Accumulate interleaved samples scaled by alternating gains (left/right for stereo)
+// NOTE: sampleCount is the number of floats, gains apply on even/odd samples
+static void MixAudioSamples(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, const float *gains)
+{
+    ma_uint32 i = 0;
+
+#if defined(AUDIO_MIXING_SIMD_SSE)
+    const __m128 gain = _mm_setr_ps(gains[0], gains[1], gains[0], gains[1]);
+
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        __m128 out0 = _mm_add_ps(_mm_loadu_ps(samplesOut + i), _mm_mul_ps(_mm_loadu_ps(samplesIn + i), gain));
+        __m128 out1 = _mm_add_ps(_mm_loadu_ps(samplesOut + i + 4), _mm_mul_ps(_mm_loadu_ps(samplesIn + i + 4), gain));
+        _mm_storeu_ps(samplesOut + i, out0);
+        _mm_storeu_ps(samplesOut + i + 4, out1);
+    }
+#elif defined(AUDIO_MIXING_SIMD_NEON)
+    const float gainPattern[4] = { gains[0], gains[1], gains[0], gains[1] };
+    const float32x4_t gain = vld1q_f32(gainPattern);
+
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        vst1q_f32(samplesOut + i, vmlaq_f32(vld1q_f32(samplesOut + i), vld1q_f32(samplesIn + i), gain));
+        vst1q_f32(samplesOut + i + 4, vmlaq_f32(vld1q_f32(samplesOut + i + 4), vld1q_f32(samplesIn + i + 4), gain));
+    }
+#endif
+
+    for (; i < sampleCount; i++) samplesOut[i] += (samplesIn[i]*gains[i & 1]);
+}
+
+// Accumulate stereo frames with left/right gains increased by step on every frame
+static void MixAudioSamplesStereoRamp(float *framesOut, const float *framesIn, ma_uint32 frameCount, const float *gains, const float *step)
+{
+    ma_uint32 frame = 0;
+
+#if defined(AUDIO_MIXING_SIMD_SSE)
+    // Two frames per vector: gains for frame n and n + 1
+    __m128 gain = _mm_setr_ps(gains[0], gains[1], gains[0] + step[0], gains[1] + step[1]);
+    const __m128 gainStep = _mm_setr_ps(2.0f*step[0], 2.0f*step[1], 2.0f*step[0], 2.0f*step[1]);
+
+    for (; (frame + 2) <= frameCount; frame += 2)
+    {
+        _mm_storeu_ps(framesOut + frame*2, _mm_add_ps(_mm_loadu_ps(framesOut + frame*2), _mm_mul_ps(_mm_loadu_ps(framesIn + frame*2), gain)));
+        gain = _mm_add_ps(gain, gainStep);
+    }
+#elif defined(AUDIO_MIXING_SIMD_NEON)
+    const float gainStart[4] = { gains[0], gains[1], gains[0] + step[0], gains[1] + step[1] };
+    const float gainSteps[4] = { 2.0f*step[0], 2.0f*step[1], 2.0f*step[0], 2.0f*step[1] };
+    float32x4_t gain = vld1q_f32(gainStart);
+    const float32x4_t gainStep = vld1q_f32(gainSteps);
+
+    for (; (frame + 2) <= frameCount; frame += 2)
+    {
+        vst1q_f32(framesOut + frame*2, vmlaq_f32(vld1q_f32(framesOut + frame*2), vld1q_f32(framesIn + frame*2), gain));
+        gain = vaddq_f32(gain, gainStep);
+    }
+#endif
+
+    for (; frame < frameCount; frame++)
+    {
+        framesOut[frame*2] += (framesIn[frame*2]*(gains[0] + step[0]*frame));
+        framesOut[frame*2 + 1] += (framesIn[frame*2 + 1]*(gains[1] + step[1]*frame));
     }
 }
 
@@ -2628,7 +3005,7 @@ static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer)
 {
     bool result = false;
 
-    if (buffer != NULL) result = (buffer->playing && !buffer->paused);
+    if (buffer != NULL) result = (AUDIO_SHARED_LOAD(buffer->playing) && !AUDIO_SHARED_LOAD(buffer->paused));
 
     return result;
 }
@@ -2640,36 +3017,67 @@ static void StopAudioBufferInLockedState(AudioBuffer *buffer)
     {
         if (IsAudioBufferPlayingInLockedState(buffer))
         {
-            buffer->playing = false;
-            buffer->paused = false;
-            buffer->frameCursorPos = 0;
-            buffer->framesProcessed = 0;
-            buffer->isSubBufferProcessed[0] = true;
-            buffer->isSubBufferProcessed[1] = true;
+            AUDIO_SHARED_STORE(buffer->playing, false);
+            AUDIO_SHARED_STORE(buffer->paused, false);
+            AUDIO_SHARED_STORE(buffer->frameCursorPos, 0);
+#if !defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+            buffer->framesProcessed = 0;    // NOTE: Reset by program with the lock-free mixer, see PushAudioBufferCommand()
+#endif
+            // Mixer is not reading sub-buffers anymore, hand them back to the program
+            // NOTE: Program does not refill them while a stop command is pending, see IsAudioSubBufferProcessed()
+            AUDIO_SHARED_STORE(buffer->isSubBufferProcessed[0], true);
+            AUDIO_SHARED_STORE(buffer->isSubBufferProcessed[1], true);
         }
     }
 }
 
+// Check if a sub-buffer has been processed and can be refilled, assuming the audio system mutex has been locked
+static bool IsAudioSubBufferProcessed(AudioBuffer *buffer, int index)
+{
+    bool result = AUDIO_SHARED_LOAD(buffer->isSubBufferProcessed[index]);
+
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+    // A queued stop hands back both sub-buffers once applied, refilling before would lose the new data
+    if ((ma_int32)(ma_atomic_load_explicit_32(&buffer->appliedSerial, ma_atomic_memory_order_acquire) - buffer->stopSerial) < 0) result = false;
+#endif
+
+    return result;
+}
+
 // Update audio stream, assuming the audio system mutex has been locked
 static void UpdateAudioStreamInLockedState(RaylibAudioStream stream, const void *data, int frameCount)
 {
     if (stream.buffer != NULL)
     {
-        if (stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1])
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+        // Stream updated right after being stopped, wait for the mixer to hand back sub-buffers
+        if ((ma_int32)(ma_atomic_load_explicit_32(&stream.buffer->appliedSerial, ma_atomic_memory_order_acquire) - stream.buffer->stopSerial) < 0) WaitAudioBufferCommands(stream.buffer);
+#endif
+        bool isSubBufferProcessed[2] = { 0 };
+        isSubBufferProcessed[0] = IsAudioSubBufferProcessed(stream.buffer, 0);
+        isSubBufferProcessed[1] = IsAudioSubBufferProcessed(stream.buffer, 1);
+
+        if (isSubBufferProcessed[0] || isSubBufferProcessed[1])
         {
             ma_uint32 subBufferToUpdate = 0;
 
-            if (stream.buffer->isSubBufferProcessed[0] && stream.buffer->isSubBufferProcessed[1])
+            if (isSubBufferProcessed[0] && isSubBufferProcessed[1])
             {
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+                // Both buffers are available for updating, cursor is owned by the mixer but it
+                // does not move on processed sub-buffers, update the one it is waiting on
+                subBufferToUpdate = (AUDIO_SHARED_LOAD(stream.buffer->frameCursorPos) < stream.buffer->sizeInFrames/2)? 0 : 1;
+#else
                 // Both buffers are available for updating
                 // Update the first one and make sure the cursor is moved back to the front
                 subBufferToUpdate = 0;
                 stream.buffer->frameCursorPos = 0;
+#endif
             }
             else
             {
                 // Just update whichever sub-buffer is processed
-                subBufferToUpdate = (stream.buffer->isSubBufferProcessed[0])? 0 : 1;
+                subBufferToUpdate = (isSubBufferProcessed[0])? 0 : 1;
             }
 
             ma_uint32 subBufferSizeInFrames = stream.buffer->sizeInFrames/2;
@@ -2692,7 +3100,8 @@ static void UpdateAudioStreamInLockedState(RaylibAudioStream stream, const void
 
                 if (leftoverFrameCount > 0) memset(subBuffer + bytesToWrite, 0, leftoverFrameCount*stream.channels*(stream.sampleSize/8));
 
-                stream.buffer->isSubBufferProcessed[subBufferToUpdate] = false;
+                // NOTE: With the lock-free mixer, sub-buffer data is visible to the mixer once marked as not processed
+                AUDIO_SHARED_STORE(stream.buffer->isSubBufferProcessed[subBufferToUpdate], false);
             }
             else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "STREAM: Attempting to write too many frames to buffer");
         }
@@ -2700,6 +3109,302 @@ static void UpdateAudioStreamInLockedState(RaylibAudioStream stream, const void
     }
 }
 
+#if defined(RAYLIB_SUPPORT_AUDIO_LOCKFREE_MIXER)
+// Check if device callback is consuming commands
+// NOTE: When it is not, the program applies the queued commands itself
+static bool IsAudioMixerRunning(void)
+{
+    return (AUDIO.System.isReady && ma_device_is_started(&AUDIO.System.device));
+}
+
+// Queue command for the mixer, assuming the audio system mutex has been locked
+// NOTE: The mutex only serializes program threads, the device callback never takes it,
+// if queue is full the mixer is waited up to RAYLIB_AUDIO_MIXER_COMMAND_TIMEOUT and command is not queued on timeout
+static bool PushAudioCommand(AudioCommand command)
+{
+    ma_uint32 writeIndex = AUDIO.Command.writeIndex;
+    int waitTime = 0;
+
+    // Queue full, wait for the mixer to apply some commands
+    // NOTE: Command slots are reused once retired, released buffers and processors are freed at that point
+    while ((writeIndex - AUDIO.Command.retireIndex) >= RAYLIB_AUDIO_MIXER_COMMAND_QUEUE_SIZE)
+    {
+        if (!IsAudioMixerRunning()) ProcessAudioCommands();
+        else if (waitTime < RAYLIB_AUDIO_MIXER_COMMAND_TIMEOUT)
+        {
+            ma_sleep(1);
+            waitTime++;
+        }
+        else
+        {
+            RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "AUDIO: Mixer commands queue is full, command discarded");
+            return false;
+        }
+
+        RetireAudioCommands();
+    }
+
+    AUDIO.Command.queue[writeIndex & (RAYLIB_AUDIO_MIXER_COMMAND_QUEUE_SIZE - 1)] = command;
+    ma_atomic_store_explicit_32(&AUDIO.Command.writeIndex, writeIndex + 1, ma_atomic_memory_order_release);
+
+    if (!IsAudioMixerRunning()) ProcessAudioCommands();
+
+    RetireAudioCommands();
+
+    return true;
+}
+
+// Queue buffer state command, assuming the audio system mutex has been locked
+// NOTE: The requested playing state is kept on program side, so IsAudioBufferPlaying()
+// reports the expected state before the mixer has applied the command, it is restored if command is not queued
+static bool PushAudioBufferCommand(AudioBuffer *buffer, int type, float value)
+{
+    if (ma_atomic_load_explicit_32(&buffer->appliedSerial, ma_atomic_memory_order_acquire) == buffer->commandSerial)
+    {
+        // No pending command, start from the state set by the mixer
+        buffer->requestedPlaying = AUDIO_SHARED_LOAD(buffer->playing);
+        buffer->requestedPaused = AUDIO_SHARED_LOAD(buffer->paused);
+    }
+
+    bool requestedPlaying = buffer->requestedPlaying;
+    bool requestedPaused = buffer->requestedPaused;
+    ma_uint32 stopSerial = buffer->stopSerial;
+    unsigned int framesProcessed = buffer->framesProcessed;
+
+    switch (type)
+    {
+        case AUDIO_COMMAND_PLAY: buffer->requestedPlaying = true; buffer->requestedPaused = false; break;
+        case AUDIO_COMMAND_STOP:
+        {
+            // Frames processed are owned by program, mixer only resets cursor and sub-buffers
+            if (buffer->requestedPlaying && !buffer->requestedPaused) buffer->framesProcessed = 0;
+
+            buffer->requestedPlaying = false;
+            buffer->requestedPaused = false;
+            buffer->stopSerial = buffer->commandSerial + 1;
+        } break;
+        case AUDIO_COMMAND_PAUSE: buffer->requestedPaused = true; break;
+        case AUDIO_COMMAND_RESUME: buffer->requestedPaused = false; break;
+        default: break;
+    }
+
+    buffer->commandSerial++;
+
+    AudioCommand command = { 0 };
+    command.type = type;
+    command.buffer = buffer;
+    command.value = value;
+    command.serial = buffer->commandSerial;
+
+    if (!PushAudioCommand(command))
+    {
+        buffer->commandSerial--;
+        buffer->requestedPlaying = requestedPlaying;
+        buffer->requestedPaused = requestedPaused;
+        buffer->stopSerial = stopSerial;
+        buffer->framesProcessed = framesProcessed;
+
+        return false;
+    }
+
+    return true;
+}
+
+// Wait for the mixer to apply buffer state commands, assuming the audio system mutex has been locked
+// NOTE: Once applied, the mixer reads buffer data only as the applied state requires, returns false on timeout
+static bool WaitAudioBufferCommands(AudioBuffer *buffer)
+{
+    int waitTime = 0;
+
+    while (ma_atomic_load_explicit_32(&buffer->appliedSerial, ma_atomic_memory_order_acquire) != buffer->commandSerial)
+    {
+        if (!IsAudioMixerRunning()) ProcessAudioCommands();
+        else if (waitTime < RAYLIB_AUDIO_MIXER_COMMAND_TIMEOUT)
+        {
+            ma_sleep(1);
+            waitTime++;
+        }
+        else return false;
+    }
+
+    RetireAudioCommands();
+
+    return true;
+}
+
+// Free buffers and processors released by applied commands, assuming the audio system mutex has been locked
+// NOTE: Mixer does not reference them anymore once the command has been applied, no need to wait for it
+static void RetireAudioCommands(void)
+{
+    ma_uint32 readIndex = ma_atomic_load_explicit_32(&AUDIO.Command.readIndex, ma_atomic_memory_order_acquire);
+
+    for (; AUDIO.Command.retireIndex != readIndex; AUDIO.Command.retireIndex++)
+    {
+        AudioCommand *command = &AUDIO.Command.queue[AUDIO.Command.retireIndex & (RAYLIB_AUDIO_MIXER_COMMAND_QUEUE_SIZE - 1)];
+
+        if ((command->type == AUDIO_COMMAND_UNTRACK) && command->release)
+        {
+            ma_data_converter_uninit(&command->buffer->converter, NULL);
+            if (command->releaseData) RL_FREE(command->buffer->data);
+            RL_FREE(command->buffer);
+        }
+        else if (command->type == AUDIO_COMMAND_DETACH_PROCESSOR)
+        {
+            // Processors removed from the chain by the mixer
+            RaylibrAudioProcessor *processor = command->processor;
+
+            while (processor)
+            {
+                RaylibrAudioProcessor *next = processor->next;
+                RL_FREE(processor);
+                processor = next;
+            }
+        }
+    }
+}
+
+// Apply queued commands (mixer side)
+// NOTE: Called by the device callback before mixing or by the program when the device is not running
+static void ProcessAudioCommands(void)
+{
+    ma_uint32 readIndex = AUDIO.Command.readIndex;
+    ma_uint32 writeIndex = ma_atomic_load_explicit_32(&AUDIO.Command.writeIndex, ma_atomic_memory_order_acquire);
+    ma_uint32 commandCount = writeIndex - readIndex;
+
+    for (; readIndex != writeIndex; readIndex++)
+    {
+        AudioCommand *command = &AUDIO.Command.queue[readIndex & (RAYLIB_AUDIO_MIXER_COMMAND_QUEUE_SIZE - 1)];
+        AudioBuffer *buffer = command->buffer;
+
+        switch (command->type)
+        {
+            case AUDIO_COMMAND_TRACK:
+            {
+                if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
+                else
+                {
+                    AUDIO.Buffer.last->next = buffer;
+                    buffer->prev = AUDIO.Buffer.last;
+                }
+
+                AUDIO.Buffer.last = buffer;
+            } break;
+            case AUDIO_COMMAND_UNTRACK:
+            {
+                if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
+                else buffer->prev->next = buffer->next;
+
+                if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
+                else buffer->next->prev = buffer->prev;
+
+                buffer->prev = NULL;
+                buffer->next = NULL;
+            } break;
+            case AUDIO_COMMAND_PLAY:
+            {
+                AUDIO_SHARED_STORE(buffer->playing, true);
+                AUDIO_SHARED_STORE(buffer->paused, false);
+                AUDIO_SHARED_STORE(buffer->frameCursorPos, 0);
+                buffer->mixGainReady = false;
+            } break;
+            case AUDIO_COMMAND_STOP: StopAudioBufferInLockedState(buffer); break;
+            case AUDIO_COMMAND_PAUSE: AUDIO_SHARED_STORE(buffer->paused, true); break;
+            case AUDIO_COMMAND_RESUME: AUDIO_SHARED_STORE(buffer->paused, false); break;
+            case AUDIO_COMMAND_VOLUME: buffer->volume = command->value; break;
+            case AUDIO_COMMAND_PITCH:
+            {
+                // Pitching is just an adjustment of the sample rate
+                // Note that this changes the duration of the sound:
+                //  - higher pitches will make the sound faster
+                //  - lower pitches make it slower
+                ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/command->value);
+                ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
+
+                buffer->pitch = command->value;
+            } break;
+            case AUDIO_COMMAND_PAN: buffer->pan = command->value; break;
+            case AUDIO_COMMAND_CALLBACK: buffer->callback = command->callback; break;
+            case AUDIO_COMMAND_ATTACH_PROCESSOR:
+            {
+                RaylibrAudioProcessor **first = (buffer != NULL)? &buffer->processor : &AUDIO.mixedProcessor;
+                RaylibrAudioProcessor *last = *first;
+
+                while (last && last->next) last = last->next;
+
+                if (last)
+                {
+                    command->processor->prev = last;
+                    last->next = command->processor;
+                }
+                else *first = command->processor;
+            } break;
+            case AUDIO_COMMAND_DETACH_PROCESSOR:
+            {
+                RaylibrAudioProcessor **first = (buffer != NULL)? &buffer->processor : &AUDIO.mixedProcessor;
+                RaylibrAudioProcessor *processor = *first;
+
+                while (processor)
+                {
+                    RaylibrAudioProcessor *next = processor->next;
+                    RaylibrAudioProcessor *prev = processor->prev;
+
+                    if (processor->process == command->callback)
+                    {
+                        if (*first == processor) *first = next;
+                        if (prev) prev->next = next;
+                        if (next) next->prev = prev;
+
+                        // Handed back in the command to be freed by the program, see RetireAudioCommands()
+                        processor->prev = NULL;
+                        processor->next = command->processor;
+                        command->processor = processor;
+                    }
+
+                    processor = next;
+                }
+            } break;
+            default: break;
+        }
+
+        // Buffer state commands are tracked, see IsAudioBufferPlaying()
+        if ((command->type >= AUDIO_COMMAND_PLAY) && (command->type <= AUDIO_COMMAND_PAN))
+        {
+            ma_atomic_store_explicit_32(&buffer->appliedSerial, command->serial, ma_atomic_memory_order_release);
+        }
+    }
+
+    ma_atomic_store_explicit_32(&AUDIO.Command.readIndex, readIndex, ma_atomic_memory_order_release);
+    if (commandCount > 0) ma_atomic_store_32(&AUDIO.Stats.commandCount, AUDIO.Stats.commandCount + commandCount);
+}
+
+// Detach processors through the mixer, assuming the audio system mutex has been locked
+// NOTE: Processors are freed once the mixer has applied the command, see RetireAudioCommands()
+static void DetachAudioProcessors(AudioBuffer *buffer, RaylibAudioCallback process)
+{
+    AudioCommand command = { 0 };
+    command.type = AUDIO_COMMAND_DETACH_PROCESSOR;
+    command.buffer = buffer;
+    command.callback = process;
+    PushAudioCommand(command);
+}
+
+// Untrack buffer through the mixer and free it once released
+// NOTE: Sample data is kept when shared with a sound alias
+static void ReleaseAudioBuffer(AudioBuffer *buffer, bool freeData)
+{
+    ma_mutex_lock(&AUDIO.System.lock);
+    AudioCommand command = { 0 };
+    command.type = AUDIO_COMMAND_UNTRACK;
+    command.buffer = buffer;
+    command.release = true;
+    command.releaseData = freeData;
+
+    // NOTE: If command can not be queued, mixer could still reference the buffer, it is not freed (leaked)
+    PushAudioCommand(command);
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
+#endif
+
 // Some required functions for audio standalone module version
 #if defined(RAUDIO_STANDALONE)
 // Check file extension
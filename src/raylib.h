@@ -312,7 +312,14 @@ typedef struct RaylibGlyphInfo {
     RaylibImage image;            // Character image data
 } RaylibGlyphInfo;
 
+// Opaque struct declaration
+// NOTE: Actual struct is defined internally in rtext module
+typedef struct RaylibGlyphLookup RaylibGlyphLookup;
+
 // RaylibFont, font texture and RaylibGlyphInfo array data
+// NOTE: glyphLookup field breaks ABI with previous versions (struct size changed), fonts initialized by user
+// code must set it to NULL (linear glyph search). Lookup table is generated on loading, in case font.glyphs
+// codepoints are modified after loading it must be rebuilt with RaylibUpdateFontGlyphLookup()
 typedef struct RaylibFont {
     int baseSize;           // Base size (default chars height)
     int glyphCount;         // Number of glyph characters
@@ -320,8 +327,27 @@ typedef struct RaylibFont {
     Texture2D texture;      // RaylibTexture atlas containing the glyphs
     RaylibRectangle *recs;        // Rectangles in texture for the glyphs
     RaylibGlyphInfo *glyphs;      // Glyphs info data
+    RaylibGlyphLookup *glyphLookup; // Codepoint to glyph index lookup table (generated on font loading, NULL for linear search)
 } RaylibFont;
 
+// RaylibFontCacheInfo, dynamic font glyphs cache usage and counters
+typedef struct RaylibFontCacheInfo {
+    int glyphCount;         // Number of glyphs cached in atlas (first font.glyphs filled)
+    int glyphCapacity;      // Maximum number of glyphs cached (font.glyphCount)
+    unsigned int hits;      // Glyph lookups found in cache
+    unsigned int misses;    // Glyph lookups rasterized on demand
+    unsigned int evictions; // Glyphs evicted from cache (least recently used)
+} RaylibFontCacheInfo;
+
+// RaylibTextLayout, text glyphs positioned once for fast measuring and drawing
+typedef struct RaylibTextLayout {
+    RaylibFont font;              // RaylibFont used by layout
+    int glyphCount;         // Number of glyph quads (visible characters)
+    float *quads;           // Glyph quads, 8 floats each: rectangle (x, y, width, height) relative to layout origin and texcoords (u1, v1, u2, v2)
+    int *codepoints;        // Glyph quads codepoints (required to update texcoords on dynamic fonts)
+    RaylibVector2 size;           // Layout size, same as RaylibMeasureTextEx()
+} RaylibTextLayout;
+
 // Camera, defines position/orientation in 3d space
 typedef struct RaylibCamera3D {
     RaylibVector3 position;       // Camera position
@@ -388,6 +414,17 @@ typedef struct RaylibMaterial {
     float params[4];        // RaylibMaterial generic parameters (if required)
 } RaylibMaterial;
 
+// RaylibInstanceBuffer, per-instance data retained in GPU memory for instanced drawing
+typedef struct RaylibInstanceBuffer {
+    int capacity;           // Maximum number of instances stored
+    int attribCount;        // Number of custom per-instance attributes (besides transforms)
+    int *attribSizes;       // Custom attributes components count (1 to 4 floats)
+    int *attribLocs;        // Custom attributes shader locations (-1 if not used)
+
+    // OpenGL identifiers
+    unsigned int *vboId;    // OpenGL Vertex Buffer Objects id (transforms + custom attributes)
+} RaylibInstanceBuffer;
+
 // RaylibTransform, vertex transformation data
 typedef struct RaylibTransform {
     RaylibVector3 translation;    // Translation
@@ -426,6 +463,25 @@ typedef struct RaylibModelAnimation {
     char name[32];          // Animation name
 } RaylibModelAnimation;
 
+// RaylibAnimationTrack, keyframes of one bone transform component (translation, rotation or scale)
+typedef struct RaylibAnimationTrack {
+    int keyCount;           // Number of keyframes
+    int interpolation;      // Keyframes interpolation (RaylibAnimationInterpolation)
+    int components;         // Number of components per value (3: translation/scale, 4: rotation)
+    float *times;           // Keyframes time in seconds
+    float *values;          // Keyframes values (cubic spline: in-tangent, value, out-tangent per keyframe)
+    int cursor;             // Last sampled keyframe, speeds up sampling at increasing times
+} RaylibAnimationTrack;
+
+// RaylibModelAnimationClip, keyframe tracks sampled at any time
+typedef struct RaylibModelAnimationClip {
+    int boneCount;          // Number of bones
+    float duration;         // Clip duration in seconds
+    RaylibBoneInfo *bones;        // Bones information (skeleton)
+    RaylibAnimationTrack *tracks; // Bones tracks, 3 per bone (translation, rotation, scale)
+    char name[32];          // Animation name
+} RaylibModelAnimationClip;
+
 // RaylibRay, ray for raycasting
 typedef struct RaylibRay {
     RaylibVector3 position;       // RaylibRay position (origin)
@@ -446,6 +502,22 @@ typedef struct RaylibBoundingBox {
     RaylibVector3 max;            // Maximum vertex box-corner
 } RaylibBoundingBox;
 
+// RaylibMeshBVHNode, mesh bounding volume hierarchy node
+typedef struct RaylibMeshBVHNode {
+    RaylibVector3 min;            // Node bounds minimum corner
+    int first;              // Leaf: first triangle, inner node: first child node (second child is next one)
+    RaylibVector3 max;            // Node bounds maximum corner
+    int count;              // Leaf: number of triangles, inner node: 0
+} RaylibMeshBVHNode;
+
+// RaylibMeshBVH, mesh bounding volume hierarchy for ray queries
+typedef struct RaylibMeshBVH {
+    int nodeCount;          // Number of nodes
+    int triangleCount;      // Number of triangles
+    RaylibMeshBVHNode *nodes;     // Nodes array, root node first
+    RaylibVector3 *vertices;      // Triangles vertex positions sorted by leaf (3 per triangle, mesh space)
+} RaylibMeshBVH;
+
 // RaylibWave, audio wave data
 typedef struct RaylibWave {
     unsigned int frameCount;    // Total number of frames (considering channels)
@@ -486,6 +558,40 @@ typedef struct RaylibMusic {
     void *ctxData;              // Audio context data, depends on type
 } RaylibMusic;
 
+// RaylibAudioMixerStats, audio device callback timing
+typedef struct RaylibAudioMixerStats {
+    unsigned int callbackCount; // Number of device callbacks processed
+    unsigned int commandCount;  // Number of mixer commands applied by the device callback
+    float lastCallbackTime;     // Time spent in last device callback (in seconds)
+    float maxCallbackTime;      // Worst-case time spent in a device callback (in seconds)
+} RaylibAudioMixerStats;
+
+// RaylibFrameStats, frame timing and pacing
+typedef struct RaylibFrameStats {
+    unsigned int frameCount;        // Number of frames measured
+    unsigned int missedCount;       // Number of frames exceeding target time (no wait)
+    float workTime;                 // Time spent in last frame update and draw (in seconds)
+    float waitTime;                 // Time spent in last frame wait, sleep and busy wait (in seconds)
+    float spinTime;                 // Time spent in last frame busy wait (in seconds)
+    float overshootTime;            // Last frame wake-up delay after target time (in seconds)
+    float maxOvershootTime;         // Worst-case wake-up delay after target time (in seconds)
+    float wakeupError;              // Estimated sleep wake-up error, sizes busy wait window (in seconds)
+    unsigned int overshootHistogram[16]; // Frames count by wake-up delay, bucket i: delay < 2^i microseconds (last: any)
+} RaylibFrameStats;
+
+// RaylibScreenCaptureStats, screen capture (screenshots and GIF recording) cost
+typedef struct RaylibScreenCaptureStats {
+    unsigned int frameCount;        // Number of frames captured (screenshots and GIF frames)
+    unsigned int droppedCount;      // Number of GIF frames not captured, all capture buffers busy (encoding behind)
+    unsigned int pendingCount;      // Number of frames captured, not read back or encoded yet
+    bool async;                     // Pixels read back asynchronously (pixel pack buffers), else read on capture
+    float captureTime;              // Main thread time spent capturing on last frame with capture work (in seconds)
+    float maxCaptureTime;           // Worst-case main thread time spent capturing on a frame (in seconds)
+    float totalCaptureTime;         // Main thread time spent capturing since stats reset (in seconds)
+    float encodeTime;               // Background thread time spent encoding last frame (in seconds)
+    float maxEncodeTime;            // Worst-case background thread time spent encoding a frame (in seconds)
+} RaylibScreenCaptureStats;
+
 // RaylibVrDeviceInfo, Head-Mounted-Display device parameters
 typedef struct RaylibVrDeviceInfo {
     int hResolution;                // Horizontal resolution in pixels
@@ -518,6 +624,27 @@ typedef struct RaylibFilePathList {
     char **paths;                   // Filepaths entries
 } RaylibFilePathList;
 
+// Hash state, used for incremental hash code computation (MD5, SHA-1)
+typedef struct RaylibHashState {
+    unsigned int hash[5];           // Hash code computed so far (MD5 uses 4 words)
+    unsigned int blockSize;         // Pending data block size
+    unsigned long long dataSize;    // Total data size processed (bytes)
+    unsigned char block[64];        // Pending data block (512 bits)
+} RaylibHashState;
+
+// Compression stream, chunked DEFLATE data compression/decompression
+// NOTE: Actual struct is defined internally in rcore module
+typedef struct RaylibCompressionStream RaylibCompressionStream;
+
+// Input event, registered by platform input callbacks in order of arrival
+typedef struct RaylibInputEvent {
+    double time;                    // Event time in seconds, same time base as RaylibGetTime()
+    int type;                       // Event type (RaylibInputEventType)
+    int code;                       // Event code: key, codepoint, mouse button or touch point id
+    int action;                     // Event action: 0 = release/up, 1 = press/down, 2 = repeat/move
+    RaylibVector2 value;            // Event value: mouse/touch position or wheel move
+} RaylibInputEvent;
+
 // Automation event
 typedef struct RaylibAutomationEvent {
     unsigned int frame;             // Event frame
@@ -721,6 +848,16 @@ typedef enum {
     RAYLIB_MOUSE_CURSOR_NOT_ALLOWED   = 10     // The operation-not-allowed shape
 } RaylibMouseCursor;
 
+// Input event types
+typedef enum {
+    RAYLIB_INPUT_EVENT_KEY = 0,            // Keyboard key (code: key, action: release/press/repeat)
+    RAYLIB_INPUT_EVENT_CHAR,               // Character input (code: unicode codepoint)
+    RAYLIB_INPUT_EVENT_MOUSE_BUTTON,       // Mouse button (code: button, action: release/press)
+    RAYLIB_INPUT_EVENT_MOUSE_WHEEL,        // Mouse wheel (value: wheel move)
+    RAYLIB_INPUT_EVENT_MOUSE_MOVE,         // Mouse move (value: mouse position)
+    RAYLIB_INPUT_EVENT_TOUCH               // Touch point (code: point id, action: up/down/move, value: touch position)
+} RaylibInputEventType;
+
 // Gamepad buttons
 typedef enum {
     RAYLIB_GAMEPAD_BUTTON_UNKNOWN = 0,         // Unknown button, just for error checking
@@ -936,6 +1073,13 @@ typedef enum {
     RAYLIB_CAMERA_ORTHOGRAPHIC             // Orthographic projection
 } RaylibCameraProjection;
 
+// Animation track keyframes interpolation
+typedef enum {
+    RAYLIB_ANIMATION_INTERPOLATION_STEP = 0,   // Keyframe value kept until next keyframe
+    RAYLIB_ANIMATION_INTERPOLATION_LINEAR,     // Linear interpolation (spherical for rotations)
+    RAYLIB_ANIMATION_INTERPOLATION_CUBIC       // Cubic hermite spline interpolation
+} RaylibAnimationInterpolation;
+
 // N-patch layout
 typedef enum {
     RAYLIB_NPATCH_NINE_PATCH = 0,          // Npatch layout: 3x3 tiles
@@ -950,6 +1094,7 @@ typedef unsigned char *(*RaylibLoadFileDataCallback)(const char *fileName, int *
 typedef bool (*RaylibSaveFileDataCallback)(const char *fileName, void *data, int dataSize);   // FileIO: Save binary data
 typedef char *(*RaylibLoadFileTextCallback)(const char *fileName);            // FileIO: Load text data
 typedef bool (*RaylibSaveFileTextCallback)(const char *fileName, char *text); // FileIO: Save text data
+typedef bool (*RaylibScanDirectoryCallback)(const char *filePath, bool isDirectory, void *userData); // FileIO: Scanned directory path, return false to stop scan
 
 //------------------------------------------------------------------------------------
 // Global Variables Definition
@@ -1075,6 +1220,8 @@ RAYLIB_RLAPI void RaylibSetTargetFPS(int fps);                                 /
 RAYLIB_RLAPI float RaylibGetFrameTime(void);                                   // Get time in seconds for last frame drawn (delta time)
 RAYLIB_RLAPI double RaylibGetTime(void);                                       // Get elapsed time in seconds since RaylibInitWindow()
 RAYLIB_RLAPI int RaylibGetFPS(void);                                           // Get current FPS
+RAYLIB_RLAPI RaylibFrameStats RaylibGetFrameStats(void);                       // Get frame timing and pacing stats
+RAYLIB_RLAPI void RaylibResetFrameStats(void);                                 // Reset frame timing and pacing stats
 
 // Custom frame control functions
 // NOTE: Those functions are intended for advanced users that want full control over the frame processing
@@ -1091,7 +1238,9 @@ RAYLIB_RLAPI int *RaylibLoadRandomSequence(unsigned int count, int min, int max)
 RAYLIB_RLAPI void RaylibUnloadRandomSequence(int *sequence);                   // Unload random values sequence
 
 // Misc. functions
-RAYLIB_RLAPI void RaylibTakeScreenshot(const char *fileName);                  // Takes a screenshot of current screen (filename extension defines format)
+RAYLIB_RLAPI void RaylibTakeScreenshot(const char *fileName);                  // Takes a screenshot of current screen (filename extension defines format), saved asynchronously (background thread)
+RAYLIB_RLAPI RaylibScreenCaptureStats RaylibGetScreenCaptureStats(void);       // Get screen capture (screenshots and GIF recording) cost stats
+RAYLIB_RLAPI void RaylibResetScreenCaptureStats(void);                         // Reset screen capture cost stats
 RAYLIB_RLAPI void RaylibSetConfigFlags(unsigned int flags);                    // Setup init configuration flags (view FLAGS)
 RAYLIB_RLAPI void RaylibOpenURL(const char *url);                              // Open URL with default system browser (if available)
 
@@ -1105,9 +1254,9 @@ RAYLIB_RLAPI void RaylibMemFree(void *ptr);                                    /
 
 // Set custom callbacks
 // WARNING: Callbacks setup is intended for advanced users
-RAYLIB_RLAPI void RaylibSetTraceLogCallback(RaylibTraceLogCallback callback);         // Set custom trace log
+RAYLIB_RLAPI void RaylibSetTraceLogCallback(RaylibTraceLogCallback callback);         // Set custom trace log (could be called from background thread)
 RAYLIB_RLAPI void RaylibSetLoadFileDataCallback(RaylibLoadFileDataCallback callback); // Set custom file binary data loader
-RAYLIB_RLAPI void RaylibSetSaveFileDataCallback(RaylibSaveFileDataCallback callback); // Set custom file binary data saver
+RAYLIB_RLAPI void RaylibSetSaveFileDataCallback(RaylibSaveFileDataCallback callback); // Set custom file binary data saver (could be called from background thread)
 RAYLIB_RLAPI void RaylibSetLoadFileTextCallback(RaylibLoadFileTextCallback callback); // Set custom file text data loader
 RAYLIB_RLAPI void RaylibSetSaveFileTextCallback(RaylibSaveFileTextCallback callback); // Set custom file text data saver
 
@@ -1140,6 +1289,7 @@ RAYLIB_RLAPI bool RaylibIsFileNameValid(const char *fileName);                 /
 RAYLIB_RLAPI RaylibFilePathList RaylibLoadDirectoryFiles(const char *dirPath);       // Load directory filepaths
 RAYLIB_RLAPI RaylibFilePathList RaylibLoadDirectoryFilesEx(const char *basePath, const char *filter, bool scanSubdirs); // Load directory filepaths with extension filtering and recursive directory scan. Use 'DIR' in the filter string to include directories in the result
 RAYLIB_RLAPI void RaylibUnloadDirectoryFiles(RaylibFilePathList files);              // Unload filepaths
+RAYLIB_RLAPI unsigned int RaylibScanDirectoryFiles(const char *basePath, const char *filter, bool scanSubdirs, RaylibScanDirectoryCallback callback, void *userData); // Scan directory filepaths (same filtering as RaylibLoadDirectoryFilesEx()), providing every path to callback, no list allocated
 RAYLIB_RLAPI bool RaylibIsFileDropped(void);                                   // Check if a file has been dropped into window
 RAYLIB_RLAPI RaylibFilePathList RaylibLoadDroppedFiles(void);                        // Load dropped filepaths
 RAYLIB_RLAPI void RaylibUnloadDroppedFiles(RaylibFilePathList files);                // Unload dropped filepaths
@@ -1148,11 +1298,26 @@ RAYLIB_RLAPI long RaylibGetFileModTime(const char *fileName);                  /
 // Compression/Encoding functionality
 RAYLIB_RLAPI unsigned char *RaylibCompressData(const unsigned char *data, int dataSize, int *compDataSize);        // Compress data (DEFLATE algorithm), memory must be RaylibMemFree()
 RAYLIB_RLAPI unsigned char *RaylibDecompressData(const unsigned char *compData, int compDataSize, int *dataSize);  // Decompress data (DEFLATE algorithm), memory must be RaylibMemFree()
+RAYLIB_RLAPI unsigned char *RaylibCompressDataChunked(const unsigned char *data, int dataSize, int chunkSize, int *compDataSize); // Compress data into independent chunks in parallel (DEFLATE algorithm), memory must be RaylibMemFree()
+RAYLIB_RLAPI unsigned char *RaylibDecompressDataChunked(const unsigned char *compData, int compDataSize, int *dataSize);  // Decompress chunked data in parallel (DEFLATE algorithm), memory must be RaylibMemFree()
+RAYLIB_RLAPI RaylibCompressionStream *RaylibLoadCompressionStream(int chunkSize);                          // Load compression stream, data compressed incrementally into chunks (0 for default chunk size)
+RAYLIB_RLAPI RaylibCompressionStream *RaylibLoadDecompressionStream(void);                                 // Load decompression stream, chunked data decompressed incrementally
+RAYLIB_RLAPI void RaylibUnloadCompressionStream(RaylibCompressionStream *stream);                          // Unload compression/decompression stream
+RAYLIB_RLAPI const unsigned char *RaylibUpdateCompressionStream(RaylibCompressionStream *stream, const unsigned char *data, int dataSize, int *outputSize); // Update stream with new data, returns output available (valid until next update)
+RAYLIB_RLAPI const unsigned char *RaylibFinishCompressionStream(RaylibCompressionStream *stream, int *outputSize); // Finish stream, returns last output available (NULL if decompression data is truncated)
 RAYLIB_RLAPI char *RaylibEncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize);               // Encode data to Base64 string, memory must be RaylibMemFree()
 RAYLIB_RLAPI unsigned char *RaylibDecodeDataBase64(const unsigned char *data, int *outputSize);                    // Decode Base64 string data, memory must be RaylibMemFree()
 RAYLIB_RLAPI unsigned int RaylibComputeCRC32(unsigned char *data, int dataSize);     // Compute CRC32 hash code
 RAYLIB_RLAPI unsigned int *RaylibComputeMD5(unsigned char *data, int dataSize);      // Compute MD5 hash code, returns static int[4] (16 bytes)
 RAYLIB_RLAPI unsigned int *RaylibComputeSHA1(unsigned char *data, int dataSize);      // Compute SHA1 hash code, returns static int[5] (20 bytes)
+RAYLIB_RLAPI unsigned int RaylibUpdateCRC32(unsigned int crc, const unsigned char *data, int dataSize); // Update CRC32 hash code with new data (start with crc = 0), returns CRC32 of all data so far
+RAYLIB_RLAPI void RaylibInitHashMD5(RaylibHashState *state);                                        // Init hash state for incremental MD5 hash code computation
+RAYLIB_RLAPI void RaylibUpdateHashMD5(RaylibHashState *state, const unsigned char *data, int dataSize); // Update MD5 hash state with new data
+RAYLIB_RLAPI void RaylibFinishHashMD5(RaylibHashState *state, unsigned int *hash);                  // Finish MD5 hash code computation, written to int[4] (16 bytes)
+RAYLIB_RLAPI void RaylibInitHashSHA1(RaylibHashState *state);                                       // Init hash state for incremental SHA1 hash code computation
+RAYLIB_RLAPI void RaylibUpdateHashSHA1(RaylibHashState *state, const unsigned char *data, int dataSize); // Update SHA1 hash state with new data
+RAYLIB_RLAPI void RaylibFinishHashSHA1(RaylibHashState *state, unsigned int *hash);                 // Finish SHA1 hash code computation, written to int[5] (20 bytes)
+RAYLIB_RLAPI unsigned long long RaylibComputeXXH64(const unsigned char *data, int dataSize, unsigned long long seed); // Compute 64bit non-cryptographic hash code (xxHash64 algorithm), for content identification
 
 
 // Automation events functionality
@@ -1217,6 +1382,10 @@ RAYLIB_RLAPI RaylibVector2 RaylibGetTouchPosition(int index);
 RAYLIB_RLAPI int RaylibGetTouchPointId(int index);                         // Get touch point identifier for given index
 RAYLIB_RLAPI int RaylibGetTouchPointCount(void);                           // Get number of touch points
 
+// Input-related functions: events
+RAYLIB_RLAPI int RaylibGetInputEventCount(void);                           // Get number of input events registered in current frame (all types)
+RAYLIB_RLAPI RaylibInputEvent RaylibGetInputEvent(int index);              // Get input event registered in current frame, in order of arrival
+
 //------------------------------------------------------------------------------------
 // Gestures and Touch Handling Functions (Module: rgestures)
 //------------------------------------------------------------------------------------
@@ -1363,9 +1532,12 @@ RAYLIB_RLAPI void RaylibImageBlurGaussian(RaylibImage *image, int blurSize);
 RAYLIB_RLAPI void RaylibImageKernelConvolution(RaylibImage *image, const float *kernel, int kernelSize);                    // Apply custom square convolution kernel to image
 RAYLIB_RLAPI void RaylibImageResize(RaylibImage *image, int newWidth, int newHeight);                                       // Resize image (Bicubic scaling algorithm)
 RAYLIB_RLAPI void RaylibImageResizeNN(RaylibImage *image, int newWidth,int newHeight);                                      // Resize image (Nearest-Neighbor scaling algorithm)
+RAYLIB_RLAPI void RaylibImageResizeInto(RaylibImage image, void *output, int newWidth, int newHeight);                      // Resize image into provided buffer (Bicubic scaling algorithm), output format is image format
+RAYLIB_RLAPI void RaylibImageResizeNNInto(RaylibImage image, void *output, int newWidth, int newHeight);                    // Resize image into provided buffer (Nearest-Neighbor scaling algorithm), output format is image format
 RAYLIB_RLAPI void RaylibImageResizeCanvas(RaylibImage *image, int newWidth, int newHeight, int offsetX, int offsetY, RaylibColor fill); // Resize canvas and fill with color
 RAYLIB_RLAPI void RaylibImageMipmaps(RaylibImage *image);                                                                   // Compute all mipmap levels for a provided image
 RAYLIB_RLAPI void RaylibImageDither(RaylibImage *image, int rBpp, int gBpp, int bBpp, int aBpp);                            // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
+RAYLIB_RLAPI void RaylibImageDitherPalette(RaylibImage *image, const RaylibColor *palette, int colorCount);                 // Dither image data to palette colors, up to 256 colors (Floyd-Steinberg dithering), converted to RGBA8
 RAYLIB_RLAPI void RaylibImageFlipVertical(RaylibImage *image);                                                              // Flip image vertically
 RAYLIB_RLAPI void RaylibImageFlipHorizontal(RaylibImage *image);                                                            // Flip image horizontally
 RAYLIB_RLAPI void RaylibImageRotate(RaylibImage *image, int degrees);                                                       // Rotate image by input angle in degrees (-359 to 359)
@@ -1379,8 +1551,11 @@ RAYLIB_RLAPI void RaylibImageColorBrightness(RaylibImage *image, int brightness)
 RAYLIB_RLAPI void RaylibImageColorReplace(RaylibImage *image, RaylibColor color, RaylibColor replace);                                  // Modify image color: replace color
 RAYLIB_RLAPI RaylibColor *RaylibLoadImageColors(RaylibImage image);                                                               // Load color data from image as a RaylibColor array (RGBA - 32bit)
 RAYLIB_RLAPI RaylibColor *RaylibLoadImagePalette(RaylibImage image, int maxPaletteSize, int *colorCount);                         // Load colors palette from image as a RaylibColor array (RGBA - 32bit)
+RAYLIB_RLAPI RaylibColor *RaylibLoadImagePaletteQuantized(RaylibImage image, int paletteSize, int *colorCount);                  // Load quantized colors palette from image (median-cut), up to paletteSize colors
+RAYLIB_RLAPI unsigned char *RaylibLoadImagePaletteIndices(RaylibImage image, const RaylibColor *palette, int colorCount, bool dither); // Load palette indices for image pixels (nearest color, up to 256 colors), optionally dithered (Floyd-Steinberg)
 RAYLIB_RLAPI void RaylibUnloadImageColors(RaylibColor *colors);                                                             // Unload color data loaded with RaylibLoadImageColors()
 RAYLIB_RLAPI void RaylibUnloadImagePalette(RaylibColor *colors);                                                            // Unload colors palette loaded with RaylibLoadImagePalette()
+RAYLIB_RLAPI void RaylibUnloadImagePaletteIndices(unsigned char *indices);                                                 // Unload palette indices loaded with RaylibLoadImagePaletteIndices()
 RAYLIB_RLAPI RaylibRectangle RaylibGetImageAlphaBorder(RaylibImage image, float threshold);                                       // Get image alpha border rectangle
 RAYLIB_RLAPI RaylibColor RaylibGetImageColor(RaylibImage image, int x, int y);                                                    // Get image pixel color at (x, y) position
 
@@ -1464,7 +1639,12 @@ RAYLIB_RLAPI RaylibFont RaylibLoadFont(const char *fileName);
 RAYLIB_RLAPI RaylibFont RaylibLoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount); // Load font from file with extended parameters, use NULL for codepoints and 0 for codepointCount to load the default character set, font size is provided in pixels height
 RAYLIB_RLAPI RaylibFont RaylibLoadFontFromImage(RaylibImage image, RaylibColor key, int firstChar);                        // Load font from RaylibImage (XNA style)
 RAYLIB_RLAPI RaylibFont RaylibLoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
+RAYLIB_RLAPI RaylibFont RaylibLoadFontDynamic(const char *fileName, int fontSize, int atlasSize);                  // Load dynamic font from TTF/OTF file, glyphs rasterized on first use into atlas (use 0 for default atlas size)
+RAYLIB_RLAPI RaylibFont RaylibLoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int atlasSize); // Load dynamic font from memory buffer, fileType refers to extension: i.e. '.ttf'
 RAYLIB_RLAPI bool RaylibIsFontValid(RaylibFont font);                                                          // Check if a font is valid (font data loaded, WARNING: GPU texture not checked)
+RAYLIB_RLAPI bool RaylibIsFontDynamic(RaylibFont font);                                                        // Check if a font is dynamic (glyphs rasterized on demand)
+RAYLIB_RLAPI RaylibFontCacheInfo RaylibGetFontCacheInfo(RaylibFont font);                                      // Get dynamic font glyphs cache info (usage and hit/miss/eviction counters)
+RAYLIB_RLAPI void RaylibUpdateFontGlyphLookup(RaylibFont *font);                                               // Update font glyph lookup table, required if font.glyphs codepoints are modified after loading
 RAYLIB_RLAPI RaylibGlyphInfo *RaylibLoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type); // Load font data for further use
 RAYLIB_RLAPI RaylibImage RaylibGenImageFontAtlas(const RaylibGlyphInfo *glyphs, RaylibRectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
 RAYLIB_RLAPI void RaylibUnloadFontData(RaylibGlyphInfo *glyphs, int glyphCount);                               // Unload font chars info data (RAM)
@@ -1479,6 +1659,11 @@ RAYLIB_RLAPI void RaylibDrawTextPro(RaylibFont font, const char *text, RaylibVec
 RAYLIB_RLAPI void RaylibDrawTextCodepoint(RaylibFont font, int codepoint, RaylibVector2 position, float fontSize, RaylibColor tint); // Draw one character (codepoint)
 RAYLIB_RLAPI void RaylibDrawTextCodepoints(RaylibFont font, const int *codepoints, int codepointCount, RaylibVector2 position, float fontSize, float spacing, RaylibColor tint); // Draw multiple character (codepoint)
 
+// Text layout functions
+RAYLIB_RLAPI RaylibTextLayout RaylibLoadTextLayout(RaylibFont font, const char *text, float fontSize, float spacing, int lineSpacing); // Load text layout, glyphs positioned once for fast measuring and drawing
+RAYLIB_RLAPI void RaylibUnloadTextLayout(RaylibTextLayout layout);                                             // Unload text layout data
+RAYLIB_RLAPI void RaylibDrawTextLayout(RaylibTextLayout layout, RaylibVector2 position, RaylibColor tint);            // Draw text layout (single batch, no glyphs lookup on static fonts)
+
 // Text font info functions
 RAYLIB_RLAPI void RaylibSetTextLineSpacing(int spacing);                                                 // Set vertical line spacing when drawing with line-breaks
 RAYLIB_RLAPI int RaylibMeasureText(const char *text, int fontSize);                                      // Measure string width for default font
@@ -1517,6 +1702,15 @@ RAYLIB_RLAPI const char *RaylibTextToPascal(const char *text);
 RAYLIB_RLAPI const char *RaylibTextToSnake(const char *text);                      // Get Snake case notation version of provided string
 RAYLIB_RLAPI const char *RaylibTextToCamel(const char *text);                      // Get Camel case notation version of provided string
 
+// Text strings management functions writing into caller provided buffers (thread-safe, no internal static buffers)
+// NOTE: Output is always '\0' ended and truncated to bufferSize, bytes written are returned (not counting '\0')
+RAYLIB_RLAPI int RaylibTextFormatBuffer(char *buffer, int bufferSize, const char *text, ...);           // Text formatting with variables into buffer (snprintf() style, "..." marks truncation)
+RAYLIB_RLAPI int RaylibTextSubtextBuffer(char *buffer, int bufferSize, const char *text, int position, int length); // Get a piece of a text string into buffer
+RAYLIB_RLAPI int RaylibTextJoinBuffer(char *buffer, int bufferSize, const char **textList, int count, const char *delimiter); // Join text strings with delimiter into buffer
+RAYLIB_RLAPI int RaylibTextSplitBuffer(char *buffer, int bufferSize, const char **result, int maxCount, const char *text, char delimiter); // Split text into buffer, substrings pointers into result, returns substrings count
+RAYLIB_RLAPI int RaylibTextToUpperBuffer(char *buffer, int bufferSize, const char *text);               // Get upper case version of provided string into buffer
+RAYLIB_RLAPI int RaylibTextToLowerBuffer(char *buffer, int bufferSize, const char *text);               // Get lower case version of provided string into buffer
+
 RAYLIB_RLAPI int RaylibTextToInteger(const char *text);                            // Get integer value from text (negative values not supported)
 RAYLIB_RLAPI float RaylibTextToFloat(const char *text);                            // Get float value from text (negative values not supported)
 
@@ -1576,6 +1770,12 @@ RAYLIB_RLAPI void RaylibUpdateMeshBuffer(RaylibMesh mesh, int index, const void
 RAYLIB_RLAPI void RaylibUnloadMesh(RaylibMesh mesh);                                                           // Unload mesh data from CPU and GPU
 RAYLIB_RLAPI void RaylibDrawMesh(RaylibMesh mesh, RaylibMaterial material, RaylibMatrix transform);                        // Draw a 3d mesh with material and transform
 RAYLIB_RLAPI void RaylibDrawMeshInstanced(RaylibMesh mesh, RaylibMaterial material, const RaylibMatrix *transforms, int instances); // Draw multiple mesh instances with material and different transforms
+RAYLIB_RLAPI RaylibInstanceBuffer RaylibLoadInstanceBuffer(int capacity, const int *attribSizes, int attribCount); // Load instance buffer in GPU for capacity instances, with optional custom attributes (1 to 4 floats each)
+RAYLIB_RLAPI bool RaylibIsInstanceBufferValid(RaylibInstanceBuffer buffer);                         // Check if an instance buffer is valid (loaded in GPU)
+RAYLIB_RLAPI void RaylibUpdateInstanceBufferTransforms(RaylibInstanceBuffer buffer, const RaylibMatrix *transforms, int offset, int count); // Update instance buffer transforms for instances range [offset, offset + count)
+RAYLIB_RLAPI void RaylibUpdateInstanceBufferAttribute(RaylibInstanceBuffer buffer, int attrib, const float *data, int offset, int count); // Update instance buffer custom attribute data for instances range [offset, offset + count)
+RAYLIB_RLAPI void RaylibUnloadInstanceBuffer(RaylibInstanceBuffer buffer);                          // Unload instance buffer from GPU memory (VRAM)
+RAYLIB_RLAPI void RaylibDrawMeshInstanceBuffer(RaylibMesh mesh, RaylibMaterial material, RaylibInstanceBuffer buffer, int instances); // Draw multiple mesh instances with material, using instance buffer data
 RAYLIB_RLAPI RaylibBoundingBox RaylibGetMeshBoundingBox(RaylibMesh mesh);                                            // Compute mesh bounding box limits
 RAYLIB_RLAPI void RaylibGenMeshTangents(RaylibMesh *mesh);                                                     // Compute mesh tangents
 RAYLIB_RLAPI bool RaylibExportMesh(RaylibMesh mesh, const char *fileName);                                     // Export mesh data to file, returns true on success
@@ -1609,6 +1809,11 @@ RAYLIB_RLAPI void RaylibUpdateModelAnimationBones(RaylibModel model, RaylibModel
 RAYLIB_RLAPI void RaylibUnloadModelAnimation(RaylibModelAnimation anim);                                       // Unload animation data
 RAYLIB_RLAPI void RaylibUnloadModelAnimations(RaylibModelAnimation *animations, int animCount);                // Unload animation array data
 RAYLIB_RLAPI bool RaylibIsModelAnimationValid(RaylibModel model, RaylibModelAnimation anim);                         // Check model animation skeleton match
+RAYLIB_RLAPI RaylibModelAnimationClip *RaylibLoadModelAnimationClips(const char *fileName, int *clipCount);      // Load model animations from file as keyframe clips (glTF)
+RAYLIB_RLAPI void RaylibUpdateModelAnimationClip(RaylibModel model, RaylibModelAnimationClip clip, float time);      // Update model animation pose at time in seconds (CPU)
+RAYLIB_RLAPI void RaylibUpdateModelAnimationClipBones(RaylibModel model, RaylibModelAnimationClip clip, float time); // Update model animation mesh bone matrices at time in seconds (GPU skinning)
+RAYLIB_RLAPI void RaylibUnloadModelAnimationClip(RaylibModelAnimationClip clip);                              // Unload animation clip data
+RAYLIB_RLAPI void RaylibUnloadModelAnimationClips(RaylibModelAnimationClip *clips, int clipCount);             // Unload animation clip array data
 
 // Collision detection functions
 RAYLIB_RLAPI bool RaylibCheckCollisionSpheres(RaylibVector3 center1, float radius1, RaylibVector3 center2, float radius2);   // Check collision between two spheres
@@ -1617,6 +1822,10 @@ RAYLIB_RLAPI bool RaylibCheckCollisionBoxSphere(RaylibBoundingBox box, RaylibVec
 RAYLIB_RLAPI RaylibRayCollision RaylibGetRayCollisionSphere(RaylibRay ray, RaylibVector3 center, float radius);                    // Get collision info between ray and sphere
 RAYLIB_RLAPI RaylibRayCollision RaylibGetRayCollisionBox(RaylibRay ray, RaylibBoundingBox box);                                    // Get collision info between ray and box
 RAYLIB_RLAPI RaylibRayCollision RaylibGetRayCollisionMesh(RaylibRay ray, RaylibMesh mesh, RaylibMatrix transform);                       // Get collision info between ray and mesh
+RAYLIB_RLAPI RaylibMeshBVH RaylibLoadMeshBVH(RaylibMesh mesh);                                                              // Load mesh bounding volume hierarchy for ray queries (mesh vertex data required on CPU)
+RAYLIB_RLAPI void RaylibUnloadMeshBVH(RaylibMeshBVH bvh);                                                                  // Unload mesh bounding volume hierarchy
+RAYLIB_RLAPI RaylibRayCollision RaylibGetRayCollisionMeshBVH(RaylibRay ray, RaylibMeshBVH bvh, RaylibMatrix transform);                  // Get collision info between ray and mesh using its bounding volume hierarchy
+RAYLIB_RLAPI void RaylibGetRayCollisionMeshBVHBatch(const RaylibRay *rays, int rayCount, RaylibMeshBVH bvh, RaylibMatrix transform, RaylibRayCollision *collisions); // Get collision info between multiple rays and mesh (bounding volume hierarchy)
 RAYLIB_RLAPI RaylibRayCollision RaylibGetRayCollisionTriangle(RaylibRay ray, RaylibVector3 p1, RaylibVector3 p2, RaylibVector3 p3);            // Get collision info between ray and triangle
 RAYLIB_RLAPI RaylibRayCollision RaylibGetRayCollisionQuad(RaylibRay ray, RaylibVector3 p1, RaylibVector3 p2, RaylibVector3 p3, RaylibVector3 p4);    // Get collision info between ray and quad
 
@@ -1631,6 +1840,8 @@ RAYLIB_RLAPI void RaylibCloseAudioDevice(void);
 RAYLIB_RLAPI bool RaylibIsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
 RAYLIB_RLAPI void RaylibSetMasterVolume(float volume);                             // Set master volume (listener)
 RAYLIB_RLAPI float RaylibGetMasterVolume(void);                                    // Get master volume (listener)
+RAYLIB_RLAPI RaylibAudioMixerStats RaylibGetAudioMixerStats(void);                 // Get audio device callback timing stats
+RAYLIB_RLAPI void RaylibResetAudioMixerStats(void);                                // Reset audio device callback timing stats
 
 // RaylibWave/RaylibSound loading/unloading functions
 RAYLIB_RLAPI RaylibWave RaylibLoadWave(const char *fileName);                            // Load wave data from file
@@ -10,7 +10,8 @@
 *       transpositions sometimes required by OpenGL
 *       Example: In memory order, row0 is [m0 m4 m8 m12] but in semantic math row0 is [m0 m1 m2 m3]
 *     - Functions are always self-contained, no function use another raymath function inside,
-*       required code is directly re-implemented inside
+*       required code is directly re-implemented inside (except *Array() functions, that use
+*       single value functions for elements not processed with SIMD)
 *     - Functions input parameters are always received by value (2 unavoidable exceptions)
 *     - Functions use always a "result" variable for return (except C++ operators)
 *     - Functions are always defined inline
@@ -30,6 +31,9 @@
 *       #define RAYMATH_DISABLE_CPP_OPERATORS
 *           Disables C++ operator overloads for raymath types.
 *
+*       #define RAYMATH_DISABLE_SIMD
+*           Disables SSE/NEON code paths in *Array() functions, scalar code is used instead.
+*
 *   LICENSE: zlib/libpng
 *
 *   Copyright (c) 2015-2024 Ramon Santamaria (@raysan5)
@@ -170,6 +174,18 @@ typedef struct Raylibfloat16 {
 
 #include <math.h>       // Required for: sinf(), cosf(), tan(), atan2f(), sqrtf(), floor(), fminf(), fmaxf(), fabsf()
 
+// SIMD instruction set used by array functions
+// NOTE: NEON code requires AArch64 (vdivq_f32(), vsqrtq_f32()), ARMv7 uses scalar code
+#if !defined(RAYMATH_DISABLE_SIMD)
+    #if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+        #include <xmmintrin.h>  // Required for: __m128, _mm_loadu_ps(), _mm_mul_ps(), _mm_add_ps(), _MM_TRANSPOSE4_PS()
+        #define RAYMATH_SIMD_SSE
+    #elif (defined(__ARM_NEON) || defined(__ARM_NEON__)) && (defined(__aarch64__) || defined(_M_ARM64))
+        #include <arm_neon.h>   // Required for: float32x4_t, vld3q_f32(), vld4q_f32(), vmlaq_n_f32()
+        #define RAYMATH_SIMD_NEON
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utils math
 //----------------------------------------------------------------------------------
@@ -2588,6 +2604,426 @@ RAYLIB_RMAPI void RaylibMatrixDecompose(RaylibMatrix mat, RaylibVector3 *transla
     }
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Array math
+//----------------------------------------------------------------------------------
+// NOTE: Array functions process count contiguous elements, vectors and quaternions are processed
+// in blocks of 4 with SIMD (deinterleaved into x/y/z/w registers), remaining elements use single value
+// functions, results are the same. Result array can be the same as input array but not partially overlap
+
+#if defined(RAYMATH_SIMD_SSE)
+// Load 4 RaylibVector3 (12 floats) deinterleaving components into x, y, z registers
+#define RAYMATH_SSE_LOAD_XYZ(ptr, x, y, z) { \
+    __m128 a_ = _mm_loadu_ps(ptr); \
+    __m128 b_ = _mm_loadu_ps((ptr) + 4); \
+    __m128 c_ = _mm_loadu_ps((ptr) + 8); \
+    x = _mm_shuffle_ps(_mm_shuffle_ps(a_, a_, _MM_SHUFFLE(3, 3, 0, 0)), _mm_shuffle_ps(b_, c_, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)); \
+    y = _mm_shuffle_ps(_mm_shuffle_ps(a_, b_, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b_, c_, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)); \
+    z = _mm_shuffle_ps(_mm_shuffle_ps(a_, b_, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c_, c_, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)); \
+}
+
+// Store x, y, z registers interleaving components as 4 RaylibVector3 (12 floats)
+#define RAYMATH_SSE_STORE_XYZ(ptr, x, y, z) { \
+    _mm_storeu_ps(ptr, _mm_shuffle_ps(_mm_unpacklo_ps(x, y), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0))); \
+    _mm_storeu_ps((ptr) + 4, _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_unpackhi_ps(x, y), _MM_SHUFFLE(1, 0, 2, 0))); \
+    _mm_storeu_ps((ptr) + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0))); \
+}
+
+// Select register lanes: mask? a : b
+#define RAYMATH_SSE_SELECT(mask, a, b) _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b))
+#endif
+
+// Transform an array of RaylibVector3 points by a given RaylibMatrix
+RAYLIB_RMAPI void RaylibVector3TransformArray(RaylibVector3 *result, const RaylibVector3 *v, int count, RaylibMatrix mat)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SIMD_SSE)
+    const __m128 m0 = _mm_set1_ps(mat.m0), m4 = _mm_set1_ps(mat.m4), m8 = _mm_set1_ps(mat.m8), m12 = _mm_set1_ps(mat.m12);
+    const __m128 m1 = _mm_set1_ps(mat.m1), m5 = _mm_set1_ps(mat.m5), m9 = _mm_set1_ps(mat.m9), m13 = _mm_set1_ps(mat.m13);
+    const __m128 m2 = _mm_set1_ps(mat.m2), m6 = _mm_set1_ps(mat.m6), m10 = _mm_set1_ps(mat.m10), m14 = _mm_set1_ps(mat.m14);
+
+    for (; i <= (count - 4); i += 4)
+    {
+        __m128 x, y, z;
+        RAYMATH_SSE_LOAD_XYZ((const float *)(v + i), x, y, z);
+
+        __m128 rx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, x), _mm_mul_ps(m4, y)), _mm_mul_ps(m8, z)), m12);
+        __m128 ry = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m1, x), _mm_mul_ps(m5, y)), _mm_mul_ps(m9, z)), m13);
+        __m128 rz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m2, x), _mm_mul_ps(m6, y)), _mm_mul_ps(m10, z)), m14);
+
+        RAYMATH_SSE_STORE_XYZ((float *)(result + i), rx, ry, rz);
+    }
+#elif defined(RAYMATH_SIMD_NEON)
+    for (; i <= (count - 4); i += 4)
+    {
+        float32x4x3_t p = vld3q_f32((const float *)(v + i));
+        float32x4x3_t r = { 0 };
+
+        r.val[0] = vaddq_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(p.val[0], mat.m0), p.val[1], mat.m4), p.val[2], mat.m8), vdupq_n_f32(mat.m12));
+        r.val[1] = vaddq_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(p.val[0], mat.m1), p.val[1], mat.m5), p.val[2], mat.m9), vdupq_n_f32(mat.m13));
+        r.val[2] = vaddq_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(p.val[0], mat.m2), p.val[1], mat.m6), p.val[2], mat.m10), vdupq_n_f32(mat.m14));
+
+        vst3q_f32((float *)(result + i), r);
+    }
+#endif
+
+    for (; i < count; i++) result[i] = RaylibVector3Transform(v[i], mat);
+}
+
+// Transform an array of RaylibVector3 normals (or directions) by a given RaylibMatrix, translation is ignored
+// NOTE: Normals should be transformed by the inverse transpose of the points matrix if it is not orthogonal,
+// transformed normals are not normalized
+RAYLIB_RMAPI void RaylibVector3TransformNormalArray(RaylibVector3 *result, const RaylibVector3 *v, int count, RaylibMatrix mat)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SIMD_SSE)
+    const __m128 m0 = _mm_set1_ps(mat.m0), m4 = _mm_set1_ps(mat.m4), m8 = _mm_set1_ps(mat.m8);
+    const __m128 m1 = _mm_set1_ps(mat.m1), m5 = _mm_set1_ps(mat.m5), m9 = _mm_set1_ps(mat.m9);
+    const __m128 m2 = _mm_set1_ps(mat.m2), m6 = _mm_set1_ps(mat.m6), m10 = _mm_set1_ps(mat.m10);
+
+    for (; i <= (count - 4); i += 4)
+    {
+        __m128 x, y, z;
+        RAYMATH_SSE_LOAD_XYZ((const float *)(v + i), x, y, z);
+
+        __m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, x), _mm_mul_ps(m4, y)), _mm_mul_ps(m8, z));
+        __m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m1, x), _mm_mul_ps(m5, y)), _mm_mul_ps(m9, z));
+        __m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m2, x), _mm_mul_ps(m6, y)), _mm_mul_ps(m10, z));
+
+        RAYMATH_SSE_STORE_XYZ((float *)(result + i), rx, ry, rz);
+    }
+#elif defined(RAYMATH_SIMD_NEON)
+    for (; i <= (count - 4); i += 4)
+    {
+        float32x4x3_t p = vld3q_f32((const float *)(v + i));
+        float32x4x3_t r = { 0 };
+
+        r.val[0] = vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(p.val[0], mat.m0), p.val[1], mat.m4), p.val[2], mat.m8);
+        r.val[1] = vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(p.val[0], mat.m1), p.val[1], mat.m5), p.val[2], mat.m9);
+        r.val[2] = vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(p.val[0], mat.m2), p.val[1], mat.m6), p.val[2], mat.m10);
+
+        vst3q_f32((float *)(result + i), r);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float x = v[i].x;
+        float y = v[i].y;
+        float z = v[i].z;
+
+        result[i].x = mat.m0*x + mat.m4*y + mat.m8*z;
+        result[i].y = mat.m1*x + mat.m5*y + mat.m9*z;
+        result[i].z = mat.m2*x + mat.m6*y + mat.m10*z;
+    }
+}
+
+// Get min and max components of an array of RaylibVector3 (axis-aligned bounds)
+// NOTE: Zero vectors are returned for empty arrays
+RAYLIB_RMAPI void RaylibVector3MinMaxArray(RaylibVector3 *min, RaylibVector3 *max, const RaylibVector3 *v, int count)
+{
+    RaylibVector3 resultMin = { 0 };
+    RaylibVector3 resultMax = { 0 };
+    int i = 0;
+
+    if (count > 0)
+    {
+        resultMin = v[0];
+        resultMax = v[0];
+    }
+
+#if defined(RAYMATH_SIMD_SSE) || defined(RAYMATH_SIMD_NEON)
+    if (count >= 4)
+    {
+        // Registers keep a fixed components pattern (x y z x, y z x y, z x y z)
+        // so 4 vectors are checked with no deinterleaving, lanes are reduced at the end
+        RaylibVector3 lanesMin[4] = { 0 };
+        RaylibVector3 lanesMax[4] = { 0 };
+        const float *src = (const float *)v;
+
+    #if defined(RAYMATH_SIMD_SSE)
+        __m128 minA = _mm_loadu_ps(src), minB = _mm_loadu_ps(src + 4), minC = _mm_loadu_ps(src + 8);
+        __m128 maxA = minA, maxB = minB, maxC = minC;
+
+        for (i = 4; i <= (count - 4); i += 4)
+        {
+            __m128 a = _mm_loadu_ps(src + i*3);
+            __m128 b = _mm_loadu_ps(src + i*3 + 4);
+            __m128 c = _mm_loadu_ps(src + i*3 + 8);
+
+            minA = _mm_min_ps(minA, a); minB = _mm_min_ps(minB, b); minC = _mm_min_ps(minC, c);
+            maxA = _mm_max_ps(maxA, a); maxB = _mm_max_ps(maxB, b); maxC = _mm_max_ps(maxC, c);
+        }
+
+        _mm_storeu_ps((float *)lanesMin, minA); _mm_storeu_ps((float *)lanesMin + 4, minB); _mm_storeu_ps((float *)lanesMin + 8, minC);
+        _mm_storeu_ps((float *)lanesMax, maxA); _mm_storeu_ps((float *)lanesMax + 4, maxB); _mm_storeu_ps((float *)lanesMax + 8, maxC);
+    #else
+        float32x4_t minA = vld1q_f32(src), minB = vld1q_f32(src + 4), minC = vld1q_f32(src + 8);
+        float32x4_t maxA = minA, maxB = minB, maxC = minC;
+
+        for (i = 4; i <= (count - 4); i += 4)
+        {
+            float32x4_t a = vld1q_f32(src + i*3);
+            float32x4_t b = vld1q_f32(src + i*3 + 4);
+            float32x4_t c = vld1q_f32(src + i*3 + 8);
+
+            minA = vminnmq_f32(minA, a); minB = vminnmq_f32(minB, b); minC = vminnmq_f32(minC, c);
+            maxA = vmaxnmq_f32(maxA, a); maxB = vmaxnmq_f32(maxB, b); maxC = vmaxnmq_f32(maxC, c);
+        }
+
+        vst1q_f32((float *)lanesMin, minA); vst1q_f32((float *)lanesMin + 4, minB); vst1q_f32((float *)lanesMin + 8, minC);
+        vst1q_f32((float *)lanesMax, maxA); vst1q_f32((float *)lanesMax + 4, maxB); vst1q_f32((float *)lanesMax + 8, maxC);
+    #endif
+
+        for (int k = 0; k < 4; k++)
+        {
+            resultMin.x = fminf(resultMin.x, lanesMin[k].x);
+            resultMin.y = fminf(resultMin.y, lanesMin[k].y);
+            resultMin.z = fminf(resultMin.z, lanesMin[k].z);
+            resultMax.x = fmaxf(resultMax.x, lanesMax[k].x);
+            resultMax.y = fmaxf(resultMax.y, lanesMax[k].y);
+            resultMax.z = fmaxf(resultMax.z, lanesMax[k].z);
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        resultMin.x = fminf(resultMin.x, v[i].x);
+        resultMin.y = fminf(resultMin.y, v[i].y);
+        resultMin.z = fminf(resultMin.z, v[i].z);
+        resultMax.x = fmaxf(resultMax.x, v[i].x);
+        resultMax.y = fmaxf(resultMax.y, v[i].y);
+        resultMax.z = fmaxf(resultMax.z, v[i].z);
+    }
+
+    *min = resultMin;
+    *max = resultMax;
+}
+
+// Get multiplication of an array of matrix pairs: result[i] = left[i]*right[i]
+// NOTE: Each matrix is processed as 4 registers, one per memory row
+RAYLIB_RMAPI void RaylibMatrixMultiplyArray(RaylibMatrix *result, const RaylibMatrix *left, const RaylibMatrix *right, int count)
+{
+#if defined(RAYMATH_SIMD_SSE) || defined(RAYMATH_SIMD_NEON)
+    for (int i = 0; i < count; i++)
+    {
+        // Result memory row j is left memory rows weighted by right memory row j components
+        const float *l = (const float *)(left + i);
+        const float *r = (const float *)(right + i);
+        float *dst = (float *)(result + i);
+
+    #if defined(RAYMATH_SIMD_SSE)
+        __m128 l0 = _mm_loadu_ps(l), l1 = _mm_loadu_ps(l + 4), l2 = _mm_loadu_ps(l + 8), l3 = _mm_loadu_ps(l + 12);
+        __m128 row[4];
+
+        for (int j = 0; j < 4; j++)
+        {
+            row[j] = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(l0, _mm_set1_ps(r[j*4])), _mm_mul_ps(l1, _mm_set1_ps(r[j*4 + 1]))),
+                                           _mm_mul_ps(l2, _mm_set1_ps(r[j*4 + 2]))), _mm_mul_ps(l3, _mm_set1_ps(r[j*4 + 3])));
+        }
+
+        for (int j = 0; j < 4; j++) _mm_storeu_ps(dst + j*4, row[j]);
+    #else
+        float32x4_t l0 = vld1q_f32(l), l1 = vld1q_f32(l + 4), l2 = vld1q_f32(l + 8), l3 = vld1q_f32(l + 12);
+        float32x4_t row[4];
+
+        for (int j = 0; j < 4; j++) row[j] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(l0, r[j*4]), l1, r[j*4 + 1]), l2, r[j*4 + 2]), l3, r[j*4 + 3]);
+
+        for (int j = 0; j < 4; j++) vst1q_f32(dst + j*4, row[j]);
+    #endif
+    }
+#else
+    for (int i = 0; i < count; i++) result[i] = RaylibMatrixMultiply(left[i], right[i]);
+#endif
+}
+
+// Normalize an array of quaternions
+RAYLIB_RMAPI void RaylibQuaternionNormalizeArray(Quaternion *result, const Quaternion *q, int count)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SIMD_SSE)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+
+    for (; i <= (count - 4); i += 4)
+    {
+        const float *src = (const float *)(q + i);
+        __m128 x = _mm_loadu_ps(src), y = _mm_loadu_ps(src + 4), z = _mm_loadu_ps(src + 8), w = _mm_loadu_ps(src + 12);
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+
+        __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)), _mm_mul_ps(w, w)));
+        length = RAYMATH_SSE_SELECT(_mm_cmpeq_ps(length, zero), one, length);
+        __m128 ilength = _mm_div_ps(one, length);
+
+        x = _mm_mul_ps(x, ilength); y = _mm_mul_ps(y, ilength); z = _mm_mul_ps(z, ilength); w = _mm_mul_ps(w, ilength);
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+
+        float *dst = (float *)(result + i);
+        _mm_storeu_ps(dst, x); _mm_storeu_ps(dst + 4, y); _mm_storeu_ps(dst + 8, z); _mm_storeu_ps(dst + 12, w);
+    }
+#elif defined(RAYMATH_SIMD_NEON)
+    const float32x4_t one = vdupq_n_f32(1.0f);
+
+    for (; i <= (count - 4); i += 4)
+    {
+        float32x4x4_t p = vld4q_f32((const float *)(q + i));
+
+        float32x4_t length = vsqrtq_f32(vmlaq_f32(vmlaq_f32(vmlaq_f32(vmulq_f32(p.val[0], p.val[0]), p.val[1], p.val[1]), p.val[2], p.val[2]), p.val[3], p.val[3]));
+        length = vbslq_f32(vceqq_f32(length, vdupq_n_f32(0.0f)), one, length);
+        float32x4_t ilength = vdivq_f32(one, length);
+
+        for (int c = 0; c < 4; c++) p.val[c] = vmulq_f32(p.val[c], ilength);
+
+        vst4q_f32((float *)(result + i), p);
+    }
+#endif
+
+    for (; i < count; i++) result[i] = RaylibQuaternionNormalize(q[i]);
+}
+
+// Calculate spherical linear interpolation between an array of quaternion pairs
+// NOTE: Close quaternions use normalized linear interpolation, same as RaylibQuaternionSlerp(),
+// angles (acosf(), sinf()) are only computed for the SIMD lanes that require them
+RAYLIB_RMAPI void RaylibQuaternionSlerpArray(Quaternion *result, const Quaternion *q1, const Quaternion *q2, int count, float amount)
+{
+#if !defined(RAYLIB_EPSILON)
+    #define RAYLIB_EPSILON 0.000001f
+#endif
+
+    int i = 0;
+
+#if defined(RAYMATH_SIMD_SSE) || defined(RAYMATH_SIMD_NEON)
+    for (; i <= (count - 4); i += 4)
+    {
+        float cosLanes[4] = { 0 };
+        float ratioA[4] = { 0 };
+        float ratioB[4] = { 0 };
+        int slerpLanes = 0;
+
+    #if defined(RAYMATH_SIMD_SSE)
+        const float *src1 = (const float *)(q1 + i);
+        const float *src2 = (const float *)(q2 + i);
+        __m128 x1 = _mm_loadu_ps(src1), y1 = _mm_loadu_ps(src1 + 4), z1 = _mm_loadu_ps(src1 + 8), w1 = _mm_loadu_ps(src1 + 12);
+        __m128 x2 = _mm_loadu_ps(src2), y2 = _mm_loadu_ps(src2 + 4), z2 = _mm_loadu_ps(src2 + 8), w2 = _mm_loadu_ps(src2 + 12);
+        _MM_TRANSPOSE4_PS(x1, y1, z1, w1);
+        _MM_TRANSPOSE4_PS(x2, y2, z2, w2);
+
+        __m128 cosHalfTheta = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x1, x2), _mm_mul_ps(y1, y2)), _mm_mul_ps(z1, z2)), _mm_mul_ps(w1, w2));
+
+        // Negate q2 (and cosine) for lanes with negative cosine, to take the shortest path
+        __m128 sign = _mm_and_ps(_mm_cmplt_ps(cosHalfTheta, _mm_setzero_ps()), _mm_set1_ps(-0.0f));
+        x2 = _mm_xor_ps(x2, sign); y2 = _mm_xor_ps(y2, sign); z2 = _mm_xor_ps(z2, sign); w2 = _mm_xor_ps(w2, sign);
+        cosHalfTheta = _mm_xor_ps(cosHalfTheta, sign);
+
+        __m128 sameMask = _mm_cmpge_ps(cosHalfTheta, _mm_set1_ps(1.0f));
+        __m128 nlerpMask = _mm_cmpgt_ps(cosHalfTheta, _mm_set1_ps(0.95f));
+        slerpLanes = ~_mm_movemask_ps(_mm_or_ps(sameMask, nlerpMask)) & 0xf;
+        _mm_storeu_ps(cosLanes, cosHalfTheta);
+    #else
+        float32x4x4_t p1 = vld4q_f32((const float *)(q1 + i));
+        float32x4x4_t p2 = vld4q_f32((const float *)(q2 + i));
+
+        float32x4_t cosHalfTheta = vmlaq_f32(vmlaq_f32(vmlaq_f32(vmulq_f32(p1.val[0], p2.val[0]), p1.val[1], p2.val[1]), p1.val[2], p2.val[2]), p1.val[3], p2.val[3]);
+
+        // Negate q2 (and cosine) for lanes with negative cosine, to take the shortest path
+        uint32x4_t sign = vandq_u32(vcltq_f32(cosHalfTheta, vdupq_n_f32(0.0f)), vdupq_n_u32(0x80000000));
+        for (int c = 0; c < 4; c++) p2.val[c] = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(p2.val[c]), sign));
+        cosHalfTheta = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(cosHalfTheta), sign));
+
+        uint32x4_t sameMask = vcgeq_f32(cosHalfTheta, vdupq_n_f32(1.0f));
+        uint32x4_t nlerpMask = vcgtq_f32(cosHalfTheta, vdupq_n_f32(0.95f));
+        unsigned int laneMasks[4] = { 0 };
+        vst1q_u32(laneMasks, vorrq_u32(sameMask, nlerpMask));
+        for (int k = 0; k < 4; k++) if (laneMasks[k] == 0) slerpLanes |= (1 << k);
+        vst1q_f32(cosLanes, cosHalfTheta);
+    #endif
+
+        // Spherical interpolation ratios, only for lanes not close enough for linear interpolation
+        for (int k = 0; k < 4; k++)
+        {
+            if ((slerpLanes & (1 << k)) == 0) continue;
+
+            float halfTheta = acosf(cosLanes[k]);
+            float sinHalfTheta = sqrtf(1.0f - cosLanes[k]*cosLanes[k]);
+
+            if (fabsf(sinHalfTheta) < RAYLIB_EPSILON)
+            {
+                ratioA[k] = 0.5f;
+                ratioB[k] = 0.5f;
+            }
+            else
+            {
+                ratioA[k] = sinf((1 - amount)*halfTheta)/sinHalfTheta;
+                ratioB[k] = sinf(amount*halfTheta)/sinHalfTheta;
+            }
+        }
+
+    #if defined(RAYMATH_SIMD_SSE)
+        // Normalized linear interpolation
+        const __m128 t = _mm_set1_ps(amount);
+        __m128 nx = _mm_add_ps(x1, _mm_mul_ps(t, _mm_sub_ps(x2, x1)));
+        __m128 ny = _mm_add_ps(y1, _mm_mul_ps(t, _mm_sub_ps(y2, y1)));
+        __m128 nz = _mm_add_ps(z1, _mm_mul_ps(t, _mm_sub_ps(z2, z1)));
+        __m128 nw = _mm_add_ps(w1, _mm_mul_ps(t, _mm_sub_ps(w2, w1)));
+
+        __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, nx), _mm_mul_ps(ny, ny)), _mm_mul_ps(nz, nz)), _mm_mul_ps(nw, nw)));
+        length = RAYMATH_SSE_SELECT(_mm_cmpeq_ps(length, _mm_setzero_ps()), _mm_set1_ps(1.0f), length);
+        __m128 ilength = _mm_div_ps(_mm_set1_ps(1.0f), length);
+        nx = _mm_mul_ps(nx, ilength); ny = _mm_mul_ps(ny, ilength); nz = _mm_mul_ps(nz, ilength); nw = _mm_mul_ps(nw, ilength);
+
+        if (slerpLanes != 0)
+        {
+            __m128 slerpMask = _mm_cmpeq_ps(_mm_or_ps(sameMask, nlerpMask), _mm_setzero_ps());
+            __m128 ra = _mm_loadu_ps(ratioA);
+            __m128 rb = _mm_loadu_ps(ratioB);
+
+            nx = RAYMATH_SSE_SELECT(slerpMask, _mm_add_ps(_mm_mul_ps(x1, ra), _mm_mul_ps(x2, rb)), nx);
+            ny = RAYMATH_SSE_SELECT(slerpMask, _mm_add_ps(_mm_mul_ps(y1, ra), _mm_mul_ps(y2, rb)), ny);
+            nz = RAYMATH_SSE_SELECT(slerpMask, _mm_add_ps(_mm_mul_ps(z1, ra), _mm_mul_ps(z2, rb)), nz);
+            nw = RAYMATH_SSE_SELECT(slerpMask, _mm_add_ps(_mm_mul_ps(w1, ra), _mm_mul_ps(w2, rb)), nw);
+        }
+
+        nx = RAYMATH_SSE_SELECT(sameMask, x1, nx);
+        ny = RAYMATH_SSE_SELECT(sameMask, y1, ny);
+        nz = RAYMATH_SSE_SELECT(sameMask, z1, nz);
+        nw = RAYMATH_SSE_SELECT(sameMask, w1, nw);
+        _MM_TRANSPOSE4_PS(nx, ny, nz, nw);
+
+        float *dst = (float *)(result + i);
+        _mm_storeu_ps(dst, nx); _mm_storeu_ps(dst + 4, ny); _mm_storeu_ps(dst + 8, nz); _mm_storeu_ps(dst + 12, nw);
+    #else
+        // Normalized linear interpolation
+        float32x4x4_t r = { 0 };
+        for (int c = 0; c < 4; c++) r.val[c] = vmlaq_n_f32(p1.val[c], vsubq_f32(p2.val[c], p1.val[c]), amount);
+
+        float32x4_t length = vsqrtq_f32(vmlaq_f32(vmlaq_f32(vmlaq_f32(vmulq_f32(r.val[0], r.val[0]), r.val[1], r.val[1]), r.val[2], r.val[2]), r.val[3], r.val[3]));
+        length = vbslq_f32(vceqq_f32(length, vdupq_n_f32(0.0f)), vdupq_n_f32(1.0f), length);
+        float32x4_t ilength = vdivq_f32(vdupq_n_f32(1.0f), length);
+        for (int c = 0; c < 4; c++) r.val[c] = vmulq_f32(r.val[c], ilength);
+
+        if (slerpLanes != 0)
+        {
+            uint32x4_t slerpMask = vmvnq_u32(vorrq_u32(sameMask, nlerpMask));
+            float32x4_t ra = vld1q_f32(ratioA);
+            float32x4_t rb = vld1q_f32(ratioB);
+
+            for (int c = 0; c < 4; c++) r.val[c] = vbslq_f32(slerpMask, vmlaq_f32(vmulq_f32(p1.val[c], ra), p2.val[c], rb), r.val[c]);
+        }
+
+        for (int c = 0; c < 4; c++) r.val[c] = vbslq_f32(sameMask, p1.val[c], r.val[c]);
+
+        vst4q_f32((float *)(result + i), r);
+    #endif
+    }
+#endif
+
+    for (; i < count; i++) result[i] = RaylibQuaternionSlerp(q1[i], q2[i], amount);
+}
+
 #if defined(__cplusplus) && !defined(RAYMATH_DISABLE_CPP_OPERATORS)
 
 // Optional C++ math operators
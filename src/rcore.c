@@ -41,11 +41,17 @@
 *       #define RAYLIB_SUPPORT_PARTIALBUSY_WAIT_LOOP
 *           Use a partial-busy wait loop, in this case frame sleeps for most of the time and runs a busy-wait-loop at the end
 *
+*       #define RAYLIB_SUPPORT_FRAME_PACER
+*           Use frame pacer on Linux, frame sleeps until absolute deadlines and runs a busy-wait-loop only for an
+*           adaptive window, sized to the measured sleep wake-up error, disables busy and partial-busy wait loops
+*
 *       #define RAYLIB_SUPPORT_SCREEN_CAPTURE
 *           Allow automatic screen capture of current screen pressing F12, defined in KeyCallback()
 *
 *       #define RAYLIB_SUPPORT_GIF_RECORDING
 *           Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
+*           NOTE: Screenshots and GIF frames are read back with pixel pack buffers some frames later (OpenGL 3.3)
+*           and encoded on a background thread, see RaylibGetScreenCaptureStats()
 *
 *       #define RAYLIB_SUPPORT_COMPRESSION_API
 *           Support RaylibCompressData() and RaylibDecompressData() functions, those functions use zlib implementation
@@ -90,9 +96,9 @@
     #define _XOPEN_SOURCE 500 // Required for: readlink if compiled with c99 without gnu ext.
 #endif
 
-#if (defined(__linux__) || defined(RAYLIB_PLATFORM_WEB)) && (_POSIX_C_SOURCE < 199309L)
+#if (defined(__linux__) || defined(RAYLIB_PLATFORM_WEB)) && (_POSIX_C_SOURCE < 200112L)
     #undef _POSIX_C_SOURCE
-    #define _POSIX_C_SOURCE 199309L // Required for: CLOCK_MONOTONIC if compiled with c99 without gnu ext.
+    #define _POSIX_C_SOURCE 200112L // Required for: CLOCK_MONOTONIC, clock_nanosleep() if compiled with c99 without gnu ext.
 #endif
 
 #include "raylib.h"                 // Declares module functions
@@ -155,6 +161,15 @@
     #define _GNU_SOURCE
 #endif
 
+#if defined(RAYLIB_SUPPORT_FRAME_PACER) && defined(__linux__)
+    #define FRAME_PACER_AVAILABLE
+    #include <errno.h>              // Required for: EINTR [Used in WaitDeadline()]
+
+    // Frame pacer replaces wait loops, they can not be used together
+    #undef RAYLIB_SUPPORT_BUSY_WAIT_LOOP
+    #undef RAYLIB_SUPPORT_PARTIALBUSY_WAIT_LOOP
+#endif
+
 // Platform specific defines to handle RaylibGetApplicationDirectory()
 #if (defined(_WIN32) && !defined(PLATFORM_DESKTOP_RGFW)) || (defined(_MSC_VER) && defined(PLATFORM_DESKTOP_RGFW))
     #ifndef MAX_PATH
@@ -208,9 +223,6 @@ __declspec(dllimport) unsigned int __stdcall timeEndPeriod(unsigned int uPeriod)
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-#ifndef RAYLIB_MAX_FILEPATH_CAPACITY
-    #define RAYLIB_MAX_FILEPATH_CAPACITY       8192        // Maximum capacity for filepath
-#endif
 #ifndef RAYLIB_MAX_FILEPATH_LENGTH
     #if defined(_WIN32)
         #define RAYLIB_MAX_FILEPATH_LENGTH      256        // On Win32, MAX_PATH = 260 (limits.h) but Windows 10, Version 1607 enables long paths...
@@ -240,24 +252,44 @@ __declspec(dllimport) unsigned int __stdcall timeEndPeriod(unsigned int uPeriod)
 #ifndef RAYLIB_MAX_TOUCH_POINTS
     #define RAYLIB_MAX_TOUCH_POINTS               8        // Maximum number of touch points supported
 #endif
-#ifndef RAYLIB_MAX_KEY_PRESSED_QUEUE
-    #define RAYLIB_MAX_KEY_PRESSED_QUEUE         16        // Maximum number of keys in the key input queue
+#ifndef RAYLIB_INPUT_EVENT_QUEUE_CAPACITY
+    #define RAYLIB_INPUT_EVENT_QUEUE_CAPACITY   256        // Initial input events queue capacity (grows if required), must be power of two
 #endif
-#ifndef RAYLIB_MAX_CHAR_PRESSED_QUEUE
-    #define RAYLIB_MAX_CHAR_PRESSED_QUEUE        16        // Maximum number of characters in the char input queue
+#ifndef RAYLIB_MAX_MOUSE_BUTTON_EVENTS
+    #define RAYLIB_MAX_MOUSE_BUTTON_EVENTS     1024        // Maximum mouse button events kept for RaylibHasMouseButtonBeenDown(), must be power of two
 #endif
 
 #ifndef RAYLIB_MAX_DECOMPRESSION_SIZE
     #define RAYLIB_MAX_DECOMPRESSION_SIZE        64        // Maximum size allocated for decompression in MB
 #endif
+#ifndef RAYLIB_COMPRESSION_CHUNK_SIZE
+    #define RAYLIB_COMPRESSION_CHUNK_SIZE    262144        // Default uncompressed chunk size for chunked compression (bytes)
+#endif
+
+#define COMPRESSION_QUALITY_DEFLATE           8        // Compression level 8, same as stbiw
+#define COMPRESSION_CHUNK_HEADER_SIZE        12        // Compressed chunk header: uncompressed size + compressed size + uncompressed data CRC32 (32bit little endian)
 
 #ifndef RAYLIB_MAX_AUTOMATION_EVENTS
     #define RAYLIB_MAX_AUTOMATION_EVENTS      16384        // Maximum number of automation events to record
 #endif
 
+#ifndef RAYLIB_SCREEN_CAPTURE_BUFFERS
+    #define RAYLIB_SCREEN_CAPTURE_BUFFERS        4        // Screen capture buffers, frames read back and encoded while next frames are captured
+#endif
+#ifndef GIF_RECORD_FRAMERATE
+    #define GIF_RECORD_FRAMERATE                10        // GIF recording frames per second
+#endif
+#ifndef GIF_RECORD_BITRATE
+    #define GIF_RECORD_BITRATE                  16        // GIF recording max bit depth
+#endif
+
+#define FRAME_PACER_MIN_SPIN_TIME     0.00002       // Frame pacer minimum busy wait window (in seconds)
+#define FRAME_PACER_MAX_SPIN_TIME     0.004         // Frame pacer maximum busy wait window (in seconds)
+#define FRAME_PACER_ERROR_FILTER      0.0625        // Frame pacer wake-up error moving average filter factor
+
 #ifndef DIRECTORY_FILTER_TAG
     #define DIRECTORY_FILTER_TAG       "DIR"        // Name tag used to request directory inclusion on directory scan
-#endif                                              // NOTE: Used in ScanDirectoryFiles(), ScanDirectoryFilesRecursively() and RaylibLoadDirectoryFilesEx()
+#endif                                              // NOTE: Used in ScanDirectory(), RaylibLoadDirectoryFilesEx() and RaylibScanDirectoryFiles()
 
 // Flags operation macros
 #define FLAG_SET(n, f) ((n) |= (f))
@@ -271,26 +303,83 @@ __declspec(dllimport) unsigned int __stdcall timeEndPeriod(unsigned int uPeriod)
 typedef struct { int x; int y; } Point;
 typedef struct { unsigned int width; unsigned int height; } Size;
 
-#define MAX_EVENT_QUEUE 1024
-
-struct _GLFWmouseEvent {
-    int button;
-    int action;
-    int mods;
+// File paths pool, filled on directory scan
+// NOTE: Paths are stored as offsets into a single growing string pool,
+// converted to a compact RaylibFilePathList once scan is finished
+typedef struct FilePathPool {
+    char *data;                     // Paths string data, '\0' ended paths one after another
+    unsigned int size;              // Paths string data size (bytes used)
+    unsigned int capacity;          // Paths string data capacity (bytes allocated)
+    unsigned int *offsets;          // Paths offsets into string data
+    unsigned int count;             // Paths count
+    unsigned int offsetCapacity;    // Paths offsets capacity
+} FilePathPool;
+
+// Compression stream, chunked DEFLATE data
+// NOTE: Stream data is a sequence of independent chunks, every chunk is a header (COMPRESSION_CHUNK_HEADER_SIZE)
+// followed by chunk DEFLATE data, chunks are compressed/decompressed in parallel when possible
+struct RaylibCompressionStream {
+    bool decompress;                // Stream mode: compression or decompression
+    bool failed;                    // Stream failed, invalid compressed data or memory not allocated
+    int chunkSize;                  // Uncompressed chunk size (compression)
+    unsigned char *input;           // Pending input data, not enough for a full chunk
+    int inputSize;                  // Pending input data size
+    int inputCapacity;              // Pending input data capacity
+    unsigned char *output;          // Output data, valid until next stream update
+    int outputCapacity;             // Output data capacity
 };
 
-typedef struct {
-    struct _GLFWmouseEvent events[MAX_EVENT_QUEUE];
-    int head;
-    int tail;
-    int capacity;
-} _GLFWmouseEventQueue;
-
-void InitMouseQueue(_GLFWmouseEventQueue* queue) {
-    queue->head = 0;
-    queue->tail = 0;
-    queue->capacity = MAX_EVENT_QUEUE;  // Set once, remains fixed
-}
+// Chunks compression/decompression job, processed with ParallelFor()
+typedef struct CompressionChunksJob {
+    const unsigned char *data;      // Input data, uncompressed (compression) or compressed chunks (decompression)
+    int dataSize;                   // Input data size (compression)
+    int chunkSize;                  // Uncompressed chunk size (compression)
+    int groupCount;                 // Chunks groups, compressed with one compressor state per group (compression)
+    unsigned char *output;          // Output data, chunk slots of slotSize bytes (compression) or uncompressed data (decompression)
+    int slotSize;                   // Output chunk slot size (compression)
+    int *sizes;                     // Chunks compressed sizes (compression) or decompressed sizes (decompression)
+    int *offsets;                   // Chunks input and output offsets, 2 per chunk (decompression)
+} CompressionChunksJob;
+
+// Screen capture buffer state
+typedef enum {
+    SCREEN_CAPTURE_FREE = 0,        // Buffer available for a new capture
+    SCREEN_CAPTURE_READING,         // Pixels being read into pixel pack buffer (GPU)
+    SCREEN_CAPTURE_ENCODING         // Pixels being encoded on background thread
+} ScreenCaptureState;
+
+// Screen capture buffer, one captured frame read back and encoded asynchronously
+typedef struct ScreenCaptureBuffer {
+    int state;                      // Buffer state (ScreenCaptureState)
+    unsigned int pboId;             // Pixel pack buffer id (0 if asynchronous read is not supported)
+    int pboSize;                    // Pixel pack buffer size (bytes)
+    void *fence;                    // Pixels read fence
+    unsigned int sequence;          // Capture sequence number, frames are encoded in capture order
+    unsigned int ticket;            // Background encoding task ticket
+
+    bool gifFrame;                  // Captured frame is a GIF frame, else a screenshot
+    int width;                      // Captured frame width
+    int height;                     // Captured frame height
+    unsigned char *pixels;          // Captured pixels: mapped pixel pack buffer (bottom row first) or allocated (top row first)
+    int delay;                      // GIF frame delay (centiseconds)
+    char fileName[512];             // Screenshot file path
+    double encodeTime;              // Time spent encoding (in seconds), set on background thread
+} ScreenCaptureBuffer;
+
+// Input events queue, ring buffer with all input events in order of arrival
+// NOTE: Positions are free-running counters, buffer index is (position & (capacity - 1))
+typedef struct InputEventQueue {
+    RaylibInputEvent *events;       // Events ring buffer
+    unsigned int capacity;          // Events ring buffer capacity (power of two)
+    unsigned int head;              // Oldest event stored position
+    unsigned int tail;              // Next event position
+    unsigned int frameHead;         // First event registered in current frame position
+    RaylibInputEvent mouseButtons[RAYLIB_MAX_MOUSE_BUTTON_EVENTS]; // Mouse button events, kept across frames until RaylibClearEventQueue()
+    unsigned int mouseHead;         // First mouse button event checked by RaylibHasMouseButtonBeenDown() position
+    unsigned int mouseTail;         // Next mouse button event position
+    unsigned int keyHead;           // Next event checked by RaylibGetKeyPressed() position
+    unsigned int charHead;          // Next event checked by RaylibGetCharPressed() position
+} InputEventQueue;
 
 // Core global state context data
 typedef struct CoreData {
@@ -333,12 +422,6 @@ typedef struct CoreData {
             // NOTE: Since key press logic involves comparing prev vs cur key state, we need to handle key repeats specially
             char keyRepeatInFrame[RAYLIB_MAX_KEYBOARD_KEYS];       // Registers key repeats for current frame
 
-            int keyPressedQueue[RAYLIB_MAX_KEY_PRESSED_QUEUE];     // Input keys queue
-            int keyPressedQueueCount;       // Input keys queue count
-
-            int charPressedQueue[RAYLIB_MAX_CHAR_PRESSED_QUEUE];   // Input characters queue (unicode)
-            int charPressedQueueCount;      // Input characters queue count
-
         } Keyboard;
         struct {
             RaylibVector2 offset;                 // Mouse offset
@@ -352,7 +435,6 @@ typedef struct CoreData {
 
             char currentButtonState[RAYLIB_MAX_MOUSE_BUTTONS];     // Registers current mouse button state
             char previousButtonState[RAYLIB_MAX_MOUSE_BUTTONS];    // Registers previous mouse button state
-            _GLFWmouseEventQueue eventQueue;
             RaylibVector2 currentWheelMove;       // Registers current mouse wheel variation
             RaylibVector2 previousWheelMove;      // Registers previous mouse wheel variation
 
@@ -375,6 +457,7 @@ typedef struct CoreData {
             float axisState[RAYLIB_MAX_GAMEPADS][RAYLIB_MAX_GAMEPAD_AXIS];                // Gamepad axis state
 
         } Gamepad;
+        InputEventQueue events;             // Input events queue (all input types)
     } Input;
     struct {
         double current;                     // Current time measure
@@ -386,6 +469,11 @@ typedef struct CoreData {
         unsigned long long int base;        // Base time measure for hi-res timer (RAYLIB_PLATFORM_ANDROID, RAYLIB_PLATFORM_DRM)
         unsigned int frameCounter;          // Frame counter
 
+        unsigned long long int deadline;    // Next frame deadline, monotonic time in nanoseconds (frame pacer)
+        double wakeupError;                 // Sleep wake-up error moving average (frame pacer)
+        double wakeupDeviation;             // Sleep wake-up error moving mean deviation (frame pacer)
+        RaylibFrameStats stats;             // Frame timing and pacing stats
+
     } Time;
 } CoreData;
 
@@ -396,7 +484,282 @@ RAYLIB_RLAPI const char *raylib_version = RAYLIB_VERSION;  // raylib version exp
 
 CoreData CORE = { 0 };                      // Global CORE state context
 
-
+// CRC32 lookup tables for slicing-by-8, first table is the standard byte-at-a-time table
+// NOTE: Each table is derived from previous one: crcTables[t][i] = (crcTables[t - 1][i] >> 8) ^ crcTables[0][crcTables[t - 1][i] & 0xff]
+static const unsigned int crcTables[8][256] = {
+    {
+        0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
+        0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
+        0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
+        0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
+        0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172, 0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
+        0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
+        0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
+        0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924, 0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
+        0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
+        0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
+        0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E, 0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
+        0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
+        0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
+        0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0, 0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
+        0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
+        0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
+        0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A, 0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
+        0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
+        0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
+        0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC, 0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
+        0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
+        0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
+        0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236, 0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
+        0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
+        0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
+        0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38, 0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
+        0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
+        0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
+        0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2, 0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
+        0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
+        0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
+        0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
+    },
+    {
+        0x00000000, 0x191B3141, 0x32366282, 0x2B2D53C3, 0x646CC504, 0x7D77F445, 0x565AA786, 0x4F4196C7,
+        0xC8D98A08, 0xD1C2BB49, 0xFAEFE88A, 0xE3F4D9CB, 0xACB54F0C, 0xB5AE7E4D, 0x9E832D8E, 0x87981CCF,
+        0x4AC21251, 0x53D92310, 0x78F470D3, 0x61EF4192, 0x2EAED755, 0x37B5E614, 0x1C98B5D7, 0x05838496,
+        0x821B9859, 0x9B00A918, 0xB02DFADB, 0xA936CB9A, 0xE6775D5D, 0xFF6C6C1C, 0xD4413FDF, 0xCD5A0E9E,
+        0x958424A2, 0x8C9F15E3, 0xA7B24620, 0xBEA97761, 0xF1E8E1A6, 0xE8F3D0E7, 0xC3DE8324, 0xDAC5B265,
+        0x5D5DAEAA, 0x44469FEB, 0x6F6BCC28, 0x7670FD69, 0x39316BAE, 0x202A5AEF, 0x0B07092C, 0x121C386D,
+        0xDF4636F3, 0xC65D07B2, 0xED705471, 0xF46B6530, 0xBB2AF3F7, 0xA231C2B6, 0x891C9175, 0x9007A034,
+        0x179FBCFB, 0x0E848DBA, 0x25A9DE79, 0x3CB2EF38, 0x73F379FF, 0x6AE848BE, 0x41C51B7D, 0x58DE2A3C,
+        0xF0794F05, 0xE9627E44, 0xC24F2D87, 0xDB541CC6, 0x94158A01, 0x8D0EBB40, 0xA623E883, 0xBF38D9C2,
+        0x38A0C50D, 0x21BBF44C, 0x0A96A78F, 0x138D96CE, 0x5CCC0009, 0x45D73148, 0x6EFA628B, 0x77E153CA,
+        0xBABB5D54, 0xA3A06C15, 0x888D3FD6, 0x91960E97, 0xDED79850, 0xC7CCA911, 0xECE1FAD2, 0xF5FACB93,
+        0x7262D75C, 0x6B79E61D, 0x4054B5DE, 0x594F849F, 0x160E1258, 0x0F152319, 0x243870DA, 0x3D23419B,
+        0x65FD6BA7, 0x7CE65AE6, 0x57CB0925, 0x4ED03864, 0x0191AEA3, 0x188A9FE2, 0x33A7CC21, 0x2ABCFD60,
+        0xAD24E1AF, 0xB43FD0EE, 0x9F12832D, 0x8609B26C, 0xC94824AB, 0xD05315EA, 0xFB7E4629, 0xE2657768,
+        0x2F3F79F6, 0x362448B7, 0x1D091B74, 0x04122A35, 0x4B53BCF2, 0x52488DB3, 0x7965DE70, 0x607EEF31,
+        0xE7E6F3FE, 0xFEFDC2BF, 0xD5D0917C, 0xCCCBA03D, 0x838A36FA, 0x9A9107BB, 0xB1BC5478, 0xA8A76539,
+        0x3B83984B, 0x2298A90A, 0x09B5FAC9, 0x10AECB88, 0x5FEF5D4F, 0x46F46C0E, 0x6DD93FCD, 0x74C20E8C,
+        0xF35A1243, 0xEA412302, 0xC16C70C1, 0xD8774180, 0x9736D747, 0x8E2DE606, 0xA500B5C5, 0xBC1B8484,
+        0x71418A1A, 0x685ABB5B, 0x4377E898, 0x5A6CD9D9, 0x152D4F1E, 0x0C367E5F, 0x271B2D9C, 0x3E001CDD,
+        0xB9980012, 0xA0833153, 0x8BAE6290, 0x92B553D1, 0xDDF4C516, 0xC4EFF457, 0xEFC2A794, 0xF6D996D5,
+        0xAE07BCE9, 0xB71C8DA8, 0x9C31DE6B, 0x852AEF2A, 0xCA6B79ED, 0xD37048AC, 0xF85D1B6F, 0xE1462A2E,
+        0x66DE36E1, 0x7FC507A0, 0x54E85463, 0x4DF36522, 0x02B2F3E5, 0x1BA9C2A4, 0x30849167, 0x299FA026,
+        0xE4C5AEB8, 0xFDDE9FF9, 0xD6F3CC3A, 0xCFE8FD7B, 0x80A96BBC, 0x99B25AFD, 0xB29F093E, 0xAB84387F,
+        0x2C1C24B0, 0x350715F1, 0x1E2A4632, 0x07317773, 0x4870E1B4, 0x516BD0F5, 0x7A468336, 0x635DB277,
+        0xCBFAD74E, 0xD2E1E60F, 0xF9CCB5CC, 0xE0D7848D, 0xAF96124A, 0xB68D230B, 0x9DA070C8, 0x84BB4189,
+        0x03235D46, 0x1A386C07, 0x31153FC4, 0x280E0E85, 0x674F9842, 0x7E54A903, 0x5579FAC0, 0x4C62CB81,
+        0x8138C51F, 0x9823F45E, 0xB30EA79D, 0xAA1596DC, 0xE554001B, 0xFC4F315A, 0xD7626299, 0xCE7953D8,
+        0x49E14F17, 0x50FA7E56, 0x7BD72D95, 0x62CC1CD4, 0x2D8D8A13, 0x3496BB52, 0x1FBBE891, 0x06A0D9D0,
+        0x5E7EF3EC, 0x4765C2AD, 0x6C48916E, 0x7553A02F, 0x3A1236E8, 0x230907A9, 0x0824546A, 0x113F652B,
+        0x96A779E4, 0x8FBC48A5, 0xA4911B66, 0xBD8A2A27, 0xF2CBBCE0, 0xEBD08DA1, 0xC0FDDE62, 0xD9E6EF23,
+        0x14BCE1BD, 0x0DA7D0FC, 0x268A833F, 0x3F91B27E, 0x70D024B9, 0x69CB15F8, 0x42E6463B, 0x5BFD777A,
+        0xDC656BB5, 0xC57E5AF4, 0xEE530937, 0xF7483876, 0xB809AEB1, 0xA1129FF0, 0x8A3FCC33, 0x9324FD72
+    },
+    {
+        0x00000000, 0x01C26A37, 0x0384D46E, 0x0246BE59, 0x0709A8DC, 0x06CBC2EB, 0x048D7CB2, 0x054F1685,
+        0x0E1351B8, 0x0FD13B8F, 0x0D9785D6, 0x0C55EFE1, 0x091AF964, 0x08D89353, 0x0A9E2D0A, 0x0B5C473D,
+        0x1C26A370, 0x1DE4C947, 0x1FA2771E, 0x1E601D29, 0x1B2F0BAC, 0x1AED619B, 0x18ABDFC2, 0x1969B5F5,
+        0x1235F2C8, 0x13F798FF, 0x11B126A6, 0x10734C91, 0x153C5A14, 0x14FE3023, 0x16B88E7A, 0x177AE44D,
+        0x384D46E0, 0x398F2CD7, 0x3BC9928E, 0x3A0BF8B9, 0x3F44EE3C, 0x3E86840B, 0x3CC03A52, 0x3D025065,
+        0x365E1758, 0x379C7D6F, 0x35DAC336, 0x3418A901, 0x3157BF84, 0x3095D5B3, 0x32D36BEA, 0x331101DD,
+        0x246BE590, 0x25A98FA7, 0x27EF31FE, 0x262D5BC9, 0x23624D4C, 0x22A0277B, 0x20E69922, 0x2124F315,
+        0x2A78B428, 0x2BBADE1F, 0x29FC6046, 0x283E0A71, 0x2D711CF4, 0x2CB376C3, 0x2EF5C89A, 0x2F37A2AD,
+        0x709A8DC0, 0x7158E7F7, 0x731E59AE, 0x72DC3399, 0x7793251C, 0x76514F2B, 0x7417F172, 0x75D59B45,
+        0x7E89DC78, 0x7F4BB64F, 0x7D0D0816, 0x7CCF6221, 0x798074A4, 0x78421E93, 0x7A04A0CA, 0x7BC6CAFD,
+        0x6CBC2EB0, 0x6D7E4487, 0x6F38FADE, 0x6EFA90E9, 0x6BB5866C, 0x6A77EC5B, 0x68315202, 0x69F33835,
+        0x62AF7F08, 0x636D153F, 0x612BAB66, 0x60E9C151, 0x65A6D7D4, 0x6464BDE3, 0x662203BA, 0x67E0698D,
+        0x48D7CB20, 0x4915A117, 0x4B531F4E, 0x4A917579, 0x4FDE63FC, 0x4E1C09CB, 0x4C5AB792, 0x4D98DDA5,
+        0x46C49A98, 0x4706F0AF, 0x45404EF6, 0x448224C1, 0x41CD3244, 0x400F5873, 0x4249E62A, 0x438B8C1D,
+        0x54F16850, 0x55330267, 0x5775BC3E, 0x56B7D609, 0x53F8C08C, 0x523AAABB, 0x507C14E2, 0x51BE7ED5,
+        0x5AE239E8, 0x5B2053DF, 0x5966ED86, 0x58A487B1, 0x5DEB9134, 0x5C29FB03, 0x5E6F455A, 0x5FAD2F6D,
+        0xE1351B80, 0xE0F771B7, 0xE2B1CFEE, 0xE373A5D9, 0xE63CB35C, 0xE7FED96B, 0xE5B86732, 0xE47A0D05,
+        0xEF264A38, 0xEEE4200F, 0xECA29E56, 0xED60F461, 0xE82FE2E4, 0xE9ED88D3, 0xEBAB368A, 0xEA695CBD,
+        0xFD13B8F0, 0xFCD1D2C7, 0xFE976C9E, 0xFF5506A9, 0xFA1A102C, 0xFBD87A1B, 0xF99EC442, 0xF85CAE75,
+        0xF300E948, 0xF2C2837F, 0xF0843D26, 0xF1465711, 0xF4094194, 0xF5CB2BA3, 0xF78D95FA, 0xF64FFFCD,
+        0xD9785D60, 0xD8BA3757, 0xDAFC890E, 0xDB3EE339, 0xDE71F5BC, 0xDFB39F8B, 0xDDF521D2, 0xDC374BE5,
+        0xD76B0CD8, 0xD6A966EF, 0xD4EFD8B6, 0xD52DB281, 0xD062A404, 0xD1A0CE33, 0xD3E6706A, 0xD2241A5D,
+        0xC55EFE10, 0xC49C9427, 0xC6DA2A7E, 0xC7184049, 0xC25756CC, 0xC3953CFB, 0xC1D382A2, 0xC011E895,
+        0xCB4DAFA8, 0xCA8FC59F, 0xC8C97BC6, 0xC90B11F1, 0xCC440774, 0xCD866D43, 0xCFC0D31A, 0xCE02B92D,
+        0x91AF9640, 0x906DFC77, 0x922B422E, 0x93E92819, 0x96A63E9C, 0x976454AB, 0x9522EAF2, 0x94E080C5,
+        0x9FBCC7F8, 0x9E7EADCF, 0x9C381396, 0x9DFA79A1, 0x98B56F24, 0x99770513, 0x9B31BB4A, 0x9AF3D17D,
+        0x8D893530, 0x8C4B5F07, 0x8E0DE15E, 0x8FCF8B69, 0x8A809DEC, 0x8B42F7DB, 0x89044982, 0x88C623B5,
+        0x839A6488, 0x82580EBF, 0x801EB0E6, 0x81DCDAD1, 0x8493CC54, 0x8551A663, 0x8717183A, 0x86D5720D,
+        0xA9E2D0A0, 0xA820BA97, 0xAA6604CE, 0xABA46EF9, 0xAEEB787C, 0xAF29124B, 0xAD6FAC12, 0xACADC625,
+        0xA7F18118, 0xA633EB2F, 0xA4755576, 0xA5B73F41, 0xA0F829C4, 0xA13A43F3, 0xA37CFDAA, 0xA2BE979D,
+        0xB5C473D0, 0xB40619E7, 0xB640A7BE, 0xB782CD89, 0xB2CDDB0C, 0xB30FB13B, 0xB1490F62, 0xB08B6555,
+        0xBBD72268, 0xBA15485F, 0xB853F606, 0xB9919C31, 0xBCDE8AB4, 0xBD1CE083, 0xBF5A5EDA, 0xBE9834ED
+    },
+    {
+        0x00000000, 0xB8BC6765, 0xAA09C88B, 0x12B5AFEE, 0x8F629757, 0x37DEF032, 0x256B5FDC, 0x9DD738B9,
+        0xC5B428EF, 0x7D084F8A, 0x6FBDE064, 0xD7018701, 0x4AD6BFB8, 0xF26AD8DD, 0xE0DF7733, 0x58631056,
+        0x5019579F, 0xE8A530FA, 0xFA109F14, 0x42ACF871, 0xDF7BC0C8, 0x67C7A7AD, 0x75720843, 0xCDCE6F26,
+        0x95AD7F70, 0x2D111815, 0x3FA4B7FB, 0x8718D09E, 0x1ACFE827, 0xA2738F42, 0xB0C620AC, 0x087A47C9,
+        0xA032AF3E, 0x188EC85B, 0x0A3B67B5, 0xB28700D0, 0x2F503869, 0x97EC5F0C, 0x8559F0E2, 0x3DE59787,
+        0x658687D1, 0xDD3AE0B4, 0xCF8F4F5A, 0x7733283F, 0xEAE41086, 0x525877E3, 0x40EDD80D, 0xF851BF68,
+        0xF02BF8A1, 0x48979FC4, 0x5A22302A, 0xE29E574F, 0x7F496FF6, 0xC7F50893, 0xD540A77D, 0x6DFCC018,
+        0x359FD04E, 0x8D23B72B, 0x9F9618C5, 0x272A7FA0, 0xBAFD4719, 0x0241207C, 0x10F48F92, 0xA848E8F7,
+        0x9B14583D, 0x23A83F58, 0x311D90B6, 0x89A1F7D3, 0x1476CF6A, 0xACCAA80F, 0xBE7F07E1, 0x06C36084,
+        0x5EA070D2, 0xE61C17B7, 0xF4A9B859, 0x4C15DF3C, 0xD1C2E785, 0x697E80E0, 0x7BCB2F0E, 0xC377486B,
+        0xCB0D0FA2, 0x73B168C7, 0x6104C729, 0xD9B8A04C, 0x446F98F5, 0xFCD3FF90, 0xEE66507E, 0x56DA371B,
+        0x0EB9274D, 0xB6054028, 0xA4B0EFC6, 0x1C0C88A3, 0x81DBB01A, 0x3967D77F, 0x2BD27891, 0x936E1FF4,
+        0x3B26F703, 0x839A9066, 0x912F3F88, 0x299358ED, 0xB4446054, 0x0CF80731, 0x1E4DA8DF, 0xA6F1CFBA,
+        0xFE92DFEC, 0x462EB889, 0x549B1767, 0xEC277002, 0x71F048BB, 0xC94C2FDE, 0xDBF98030, 0x6345E755,
+        0x6B3FA09C, 0xD383C7F9, 0xC1366817, 0x798A0F72, 0xE45D37CB, 0x5CE150AE, 0x4E54FF40, 0xF6E89825,
+        0xAE8B8873, 0x1637EF16, 0x048240F8, 0xBC3E279D, 0x21E91F24, 0x99557841, 0x8BE0D7AF, 0x335CB0CA,
+        0xED59B63B, 0x55E5D15E, 0x47507EB0, 0xFFEC19D5, 0x623B216C, 0xDA874609, 0xC832E9E7, 0x708E8E82,
+        0x28ED9ED4, 0x9051F9B1, 0x82E4565F, 0x3A58313A, 0xA78F0983, 0x1F336EE6, 0x0D86C108, 0xB53AA66D,
+        0xBD40E1A4, 0x05FC86C1, 0x1749292F, 0xAFF54E4A, 0x322276F3, 0x8A9E1196, 0x982BBE78, 0x2097D91D,
+        0x78F4C94B, 0xC048AE2E, 0xD2FD01C0, 0x6A4166A5, 0xF7965E1C, 0x4F2A3979, 0x5D9F9697, 0xE523F1F2,
+        0x4D6B1905, 0xF5D77E60, 0xE762D18E, 0x5FDEB6EB, 0xC2098E52, 0x7AB5E937, 0x680046D9, 0xD0BC21BC,
+        0x88DF31EA, 0x3063568F, 0x22D6F961, 0x9A6A9E04, 0x07BDA6BD, 0xBF01C1D8, 0xADB46E36, 0x15080953,
+        0x1D724E9A, 0xA5CE29FF, 0xB77B8611, 0x0FC7E174, 0x9210D9CD, 0x2AACBEA8, 0x38191146, 0x80A57623,
+        0xD8C66675, 0x607A0110, 0x72CFAEFE, 0xCA73C99B, 0x57A4F122, 0xEF189647, 0xFDAD39A9, 0x45115ECC,
+        0x764DEE06, 0xCEF18963, 0xDC44268D, 0x64F841E8, 0xF92F7951, 0x41931E34, 0x5326B1DA, 0xEB9AD6BF,
+        0xB3F9C6E9, 0x0B45A18C, 0x19F00E62, 0xA14C6907, 0x3C9B51BE, 0x842736DB, 0x96929935, 0x2E2EFE50,
+        0x2654B999, 0x9EE8DEFC, 0x8C5D7112, 0x34E11677, 0xA9362ECE, 0x118A49AB, 0x033FE645, 0xBB838120,
+        0xE3E09176, 0x5B5CF613, 0x49E959FD, 0xF1553E98, 0x6C820621, 0xD43E6144, 0xC68BCEAA, 0x7E37A9CF,
+        0xD67F4138, 0x6EC3265D, 0x7C7689B3, 0xC4CAEED6, 0x591DD66F, 0xE1A1B10A, 0xF3141EE4, 0x4BA87981,
+        0x13CB69D7, 0xAB770EB2, 0xB9C2A15C, 0x017EC639, 0x9CA9FE80, 0x241599E5, 0x36A0360B, 0x8E1C516E,
+        0x866616A7, 0x3EDA71C2, 0x2C6FDE2C, 0x94D3B949, 0x090481F0, 0xB1B8E695, 0xA30D497B, 0x1BB12E1E,
+        0x43D23E48, 0xFB6E592D, 0xE9DBF6C3, 0x516791A6, 0xCCB0A91F, 0x740CCE7A, 0x66B96194, 0xDE0506F1
+    },
+    {
+        0x00000000, 0x3D6029B0, 0x7AC05360, 0x47A07AD0, 0xF580A6C0, 0xC8E08F70, 0x8F40F5A0, 0xB220DC10,
+        0x30704BC1, 0x0D106271, 0x4AB018A1, 0x77D03111, 0xC5F0ED01, 0xF890C4B1, 0xBF30BE61, 0x825097D1,
+        0x60E09782, 0x5D80BE32, 0x1A20C4E2, 0x2740ED52, 0x95603142, 0xA80018F2, 0xEFA06222, 0xD2C04B92,
+        0x5090DC43, 0x6DF0F5F3, 0x2A508F23, 0x1730A693, 0xA5107A83, 0x98705333, 0xDFD029E3, 0xE2B00053,
+        0xC1C12F04, 0xFCA106B4, 0xBB017C64, 0x866155D4, 0x344189C4, 0x0921A074, 0x4E81DAA4, 0x73E1F314,
+        0xF1B164C5, 0xCCD14D75, 0x8B7137A5, 0xB6111E15, 0x0431C205, 0x3951EBB5, 0x7EF19165, 0x4391B8D5,
+        0xA121B886, 0x9C419136, 0xDBE1EBE6, 0xE681C256, 0x54A11E46, 0x69C137F6, 0x2E614D26, 0x13016496,
+        0x9151F347, 0xAC31DAF7, 0xEB91A027, 0xD6F18997, 0x64D15587, 0x59B17C37, 0x1E1106E7, 0x23712F57,
+        0x58F35849, 0x659371F9, 0x22330B29, 0x1F532299, 0xAD73FE89, 0x9013D739, 0xD7B3ADE9, 0xEAD38459,
+        0x68831388, 0x55E33A38, 0x124340E8, 0x2F236958, 0x9D03B548, 0xA0639CF8, 0xE7C3E628, 0xDAA3CF98,
+        0x3813CFCB, 0x0573E67B, 0x42D39CAB, 0x7FB3B51B, 0xCD93690B, 0xF0F340BB, 0xB7533A6B, 0x8A3313DB,
+        0x0863840A, 0x3503ADBA, 0x72A3D76A, 0x4FC3FEDA, 0xFDE322CA, 0xC0830B7A, 0x872371AA, 0xBA43581A,
+        0x9932774D, 0xA4525EFD, 0xE3F2242D, 0xDE920D9D, 0x6CB2D18D, 0x51D2F83D, 0x167282ED, 0x2B12AB5D,
+        0xA9423C8C, 0x9422153C, 0xD3826FEC, 0xEEE2465C, 0x5CC29A4C, 0x61A2B3FC, 0x2602C92C, 0x1B62E09C,
+        0xF9D2E0CF, 0xC4B2C97F, 0x8312B3AF, 0xBE729A1F, 0x0C52460F, 0x31326FBF, 0x7692156F, 0x4BF23CDF,
+        0xC9A2AB0E, 0xF4C282BE, 0xB362F86E, 0x8E02D1DE, 0x3C220DCE, 0x0142247E, 0x46E25EAE, 0x7B82771E,
+        0xB1E6B092, 0x8C869922, 0xCB26E3F2, 0xF646CA42, 0x44661652, 0x79063FE2, 0x3EA64532, 0x03C66C82,
+        0x8196FB53, 0xBCF6D2E3, 0xFB56A833, 0xC6368183, 0x74165D93, 0x49767423, 0x0ED60EF3, 0x33B62743,
+        0xD1062710, 0xEC660EA0, 0xABC67470, 0x96A65DC0, 0x248681D0, 0x19E6A860, 0x5E46D2B0, 0x6326FB00,
+        0xE1766CD1, 0xDC164561, 0x9BB63FB1, 0xA6D61601, 0x14F6CA11, 0x2996E3A1, 0x6E369971, 0x5356B0C1,
+        0x70279F96, 0x4D47B626, 0x0AE7CCF6, 0x3787E546, 0x85A73956, 0xB8C710E6, 0xFF676A36, 0xC2074386,
+        0x4057D457, 0x7D37FDE7, 0x3A978737, 0x07F7AE87, 0xB5D77297, 0x88B75B27, 0xCF1721F7, 0xF2770847,
+        0x10C70814, 0x2DA721A4, 0x6A075B74, 0x576772C4, 0xE547AED4, 0xD8278764, 0x9F87FDB4, 0xA2E7D404,
+        0x20B743D5, 0x1DD76A65, 0x5A7710B5, 0x67173905, 0xD537E515, 0xE857CCA5, 0xAFF7B675, 0x92979FC5,
+        0xE915E8DB, 0xD475C16B, 0x93D5BBBB, 0xAEB5920B, 0x1C954E1B, 0x21F567AB, 0x66551D7B, 0x5B3534CB,
+        0xD965A31A, 0xE4058AAA, 0xA3A5F07A, 0x9EC5D9CA, 0x2CE505DA, 0x11852C6A, 0x562556BA, 0x6B457F0A,
+        0x89F57F59, 0xB49556E9, 0xF3352C39, 0xCE550589, 0x7C75D999, 0x4115F029, 0x06B58AF9, 0x3BD5A349,
+        0xB9853498, 0x84E51D28, 0xC34567F8, 0xFE254E48, 0x4C059258, 0x7165BBE8, 0x36C5C138, 0x0BA5E888,
+        0x28D4C7DF, 0x15B4EE6F, 0x521494BF, 0x6F74BD0F, 0xDD54611F, 0xE03448AF, 0xA794327F, 0x9AF41BCF,
+        0x18A48C1E, 0x25C4A5AE, 0x6264DF7E, 0x5F04F6CE, 0xED242ADE, 0xD044036E, 0x97E479BE, 0xAA84500E,
+        0x4834505D, 0x755479ED, 0x32F4033D, 0x0F942A8D, 0xBDB4F69D, 0x80D4DF2D, 0xC774A5FD, 0xFA148C4D,
+        0x78441B9C, 0x4524322C, 0x028448FC, 0x3FE4614C, 0x8DC4BD5C, 0xB0A494EC, 0xF704EE3C, 0xCA64C78C
+    },
+    {
+        0x00000000, 0xCB5CD3A5, 0x4DC8A10B, 0x869472AE, 0x9B914216, 0x50CD91B3, 0xD659E31D, 0x1D0530B8,
+        0xEC53826D, 0x270F51C8, 0xA19B2366, 0x6AC7F0C3, 0x77C2C07B, 0xBC9E13DE, 0x3A0A6170, 0xF156B2D5,
+        0x03D6029B, 0xC88AD13E, 0x4E1EA390, 0x85427035, 0x9847408D, 0x531B9328, 0xD58FE186, 0x1ED33223,
+        0xEF8580F6, 0x24D95353, 0xA24D21FD, 0x6911F258, 0x7414C2E0, 0xBF481145, 0x39DC63EB, 0xF280B04E,
+        0x07AC0536, 0xCCF0D693, 0x4A64A43D, 0x81387798, 0x9C3D4720, 0x57619485, 0xD1F5E62B, 0x1AA9358E,
+        0xEBFF875B, 0x20A354FE, 0xA6372650, 0x6D6BF5F5, 0x706EC54D, 0xBB3216E8, 0x3DA66446, 0xF6FAB7E3,
+        0x047A07AD, 0xCF26D408, 0x49B2A6A6, 0x82EE7503, 0x9FEB45BB, 0x54B7961E, 0xD223E4B0, 0x197F3715,
+        0xE82985C0, 0x23755665, 0xA5E124CB, 0x6EBDF76E, 0x73B8C7D6, 0xB8E41473, 0x3E7066DD, 0xF52CB578,
+        0x0F580A6C, 0xC404D9C9, 0x4290AB67, 0x89CC78C2, 0x94C9487A, 0x5F959BDF, 0xD901E971, 0x125D3AD4,
+        0xE30B8801, 0x28575BA4, 0xAEC3290A, 0x659FFAAF, 0x789ACA17, 0xB3C619B2, 0x35526B1C, 0xFE0EB8B9,
+        0x0C8E08F7, 0xC7D2DB52, 0x4146A9FC, 0x8A1A7A59, 0x971F4AE1, 0x5C439944, 0xDAD7EBEA, 0x118B384F,
+        0xE0DD8A9A, 0x2B81593F, 0xAD152B91, 0x6649F834, 0x7B4CC88C, 0xB0101B29, 0x36846987, 0xFDD8BA22,
+        0x08F40F5A, 0xC3A8DCFF, 0x453CAE51, 0x8E607DF4, 0x93654D4C, 0x58399EE9, 0xDEADEC47, 0x15F13FE2,
+        0xE4A78D37, 0x2FFB5E92, 0xA96F2C3C, 0x6233FF99, 0x7F36CF21, 0xB46A1C84, 0x32FE6E2A, 0xF9A2BD8F,
+        0x0B220DC1, 0xC07EDE64, 0x46EAACCA, 0x8DB67F6F, 0x90B34FD7, 0x5BEF9C72, 0xDD7BEEDC, 0x16273D79,
+        0xE7718FAC, 0x2C2D5C09, 0xAAB92EA7, 0x61E5FD02, 0x7CE0CDBA, 0xB7BC1E1F, 0x31286CB1, 0xFA74BF14,
+        0x1EB014D8, 0xD5ECC77D, 0x5378B5D3, 0x98246676, 0x852156CE, 0x4E7D856B, 0xC8E9F7C5, 0x03B52460,
+        0xF2E396B5, 0x39BF4510, 0xBF2B37BE, 0x7477E41B, 0x6972D4A3, 0xA22E0706, 0x24BA75A8, 0xEFE6A60D,
+        0x1D661643, 0xD63AC5E6, 0x50AEB748, 0x9BF264ED, 0x86F75455, 0x4DAB87F0, 0xCB3FF55E, 0x006326FB,
+        0xF135942E, 0x3A69478B, 0xBCFD3525, 0x77A1E680, 0x6AA4D638, 0xA1F8059D, 0x276C7733, 0xEC30A496,
+        0x191C11EE, 0xD240C24B, 0x54D4B0E5, 0x9F886340, 0x828D53F8, 0x49D1805D, 0xCF45F2F3, 0x04192156,
+        0xF54F9383, 0x3E134026, 0xB8873288, 0x73DBE12D, 0x6EDED195, 0xA5820230, 0x2316709E, 0xE84AA33B,
+        0x1ACA1375, 0xD196C0D0, 0x5702B27E, 0x9C5E61DB, 0x815B5163, 0x4A0782C6, 0xCC93F068, 0x07CF23CD,
+        0xF6999118, 0x3DC542BD, 0xBB513013, 0x700DE3B6, 0x6D08D30E, 0xA65400AB, 0x20C07205, 0xEB9CA1A0,
+        0x11E81EB4, 0xDAB4CD11, 0x5C20BFBF, 0x977C6C1A, 0x8A795CA2, 0x41258F07, 0xC7B1FDA9, 0x0CED2E0C,
+        0xFDBB9CD9, 0x36E74F7C, 0xB0733DD2, 0x7B2FEE77, 0x662ADECF, 0xAD760D6A, 0x2BE27FC4, 0xE0BEAC61,
+        0x123E1C2F, 0xD962CF8A, 0x5FF6BD24, 0x94AA6E81, 0x89AF5E39, 0x42F38D9C, 0xC467FF32, 0x0F3B2C97,
+        0xFE6D9E42, 0x35314DE7, 0xB3A53F49, 0x78F9ECEC, 0x65FCDC54, 0xAEA00FF1, 0x28347D5F, 0xE368AEFA,
+        0x16441B82, 0xDD18C827, 0x5B8CBA89, 0x90D0692C, 0x8DD55994, 0x46898A31, 0xC01DF89F, 0x0B412B3A,
+        0xFA1799EF, 0x314B4A4A, 0xB7DF38E4, 0x7C83EB41, 0x6186DBF9, 0xAADA085C, 0x2C4E7AF2, 0xE712A957,
+        0x15921919, 0xDECECABC, 0x585AB812, 0x93066BB7, 0x8E035B0F, 0x455F88AA, 0xC3CBFA04, 0x089729A1,
+        0xF9C19B74, 0x329D48D1, 0xB4093A7F, 0x7F55E9DA, 0x6250D962, 0xA90C0AC7, 0x2F987869, 0xE4C4ABCC
+    },
+    {
+        0x00000000, 0xA6770BB4, 0x979F1129, 0x31E81A9D, 0xF44F2413, 0x52382FA7, 0x63D0353A, 0xC5A73E8E,
+        0x33EF4E67, 0x959845D3, 0xA4705F4E, 0x020754FA, 0xC7A06A74, 0x61D761C0, 0x503F7B5D, 0xF64870E9,
+        0x67DE9CCE, 0xC1A9977A, 0xF0418DE7, 0x56368653, 0x9391B8DD, 0x35E6B369, 0x040EA9F4, 0xA279A240,
+        0x5431D2A9, 0xF246D91D, 0xC3AEC380, 0x65D9C834, 0xA07EF6BA, 0x0609FD0E, 0x37E1E793, 0x9196EC27,
+        0xCFBD399C, 0x69CA3228, 0x582228B5, 0xFE552301, 0x3BF21D8F, 0x9D85163B, 0xAC6D0CA6, 0x0A1A0712,
+        0xFC5277FB, 0x5A257C4F, 0x6BCD66D2, 0xCDBA6D66, 0x081D53E8, 0xAE6A585C, 0x9F8242C1, 0x39F54975,
+        0xA863A552, 0x0E14AEE6, 0x3FFCB47B, 0x998BBFCF, 0x5C2C8141, 0xFA5B8AF5, 0xCBB39068, 0x6DC49BDC,
+        0x9B8CEB35, 0x3DFBE081, 0x0C13FA1C, 0xAA64F1A8, 0x6FC3CF26, 0xC9B4C492, 0xF85CDE0F, 0x5E2BD5BB,
+        0x440B7579, 0xE27C7ECD, 0xD3946450, 0x75E36FE4, 0xB044516A, 0x16335ADE, 0x27DB4043, 0x81AC4BF7,
+        0x77E43B1E, 0xD19330AA, 0xE07B2A37, 0x460C2183, 0x83AB1F0D, 0x25DC14B9, 0x14340E24, 0xB2430590,
+        0x23D5E9B7, 0x85A2E203, 0xB44AF89E, 0x123DF32A, 0xD79ACDA4, 0x71EDC610, 0x4005DC8D, 0xE672D739,
+        0x103AA7D0, 0xB64DAC64, 0x87A5B6F9, 0x21D2BD4D, 0xE47583C3, 0x42028877, 0x73EA92EA, 0xD59D995E,
+        0x8BB64CE5, 0x2DC14751, 0x1C295DCC, 0xBA5E5678, 0x7FF968F6, 0xD98E6342, 0xE86679DF, 0x4E11726B,
+        0xB8590282, 0x1E2E0936, 0x2FC613AB, 0x89B1181F, 0x4C162691, 0xEA612D25, 0xDB8937B8, 0x7DFE3C0C,
+        0xEC68D02B, 0x4A1FDB9F, 0x7BF7C102, 0xDD80CAB6, 0x1827F438, 0xBE50FF8C, 0x8FB8E511, 0x29CFEEA5,
+        0xDF879E4C, 0x79F095F8, 0x48188F65, 0xEE6F84D1, 0x2BC8BA5F, 0x8DBFB1EB, 0xBC57AB76, 0x1A20A0C2,
+        0x8816EAF2, 0x2E61E146, 0x1F89FBDB, 0xB9FEF06F, 0x7C59CEE1, 0xDA2EC555, 0xEBC6DFC8, 0x4DB1D47C,
+        0xBBF9A495, 0x1D8EAF21, 0x2C66B5BC, 0x8A11BE08, 0x4FB68086, 0xE9C18B32, 0xD82991AF, 0x7E5E9A1B,
+        0xEFC8763C, 0x49BF7D88, 0x78576715, 0xDE206CA1, 0x1B87522F, 0xBDF0599B, 0x8C184306, 0x2A6F48B2,
+        0xDC27385B, 0x7A5033EF, 0x4BB82972, 0xEDCF22C6, 0x28681C48, 0x8E1F17FC, 0xBFF70D61, 0x198006D5,
+        0x47ABD36E, 0xE1DCD8DA, 0xD034C247, 0x7643C9F3, 0xB3E4F77D, 0x1593FCC9, 0x247BE654, 0x820CEDE0,
+        0x74449D09, 0xD23396BD, 0xE3DB8C20, 0x45AC8794, 0x800BB91A, 0x267CB2AE, 0x1794A833, 0xB1E3A387,
+        0x20754FA0, 0x86024414, 0xB7EA5E89, 0x119D553D, 0xD43A6BB3, 0x724D6007, 0x43A57A9A, 0xE5D2712E,
+        0x139A01C7, 0xB5ED0A73, 0x840510EE, 0x22721B5A, 0xE7D525D4, 0x41A22E60, 0x704A34FD, 0xD63D3F49,
+        0xCC1D9F8B, 0x6A6A943F, 0x5B828EA2, 0xFDF58516, 0x3852BB98, 0x9E25B02C, 0xAFCDAAB1, 0x09BAA105,
+        0xFFF2D1EC, 0x5985DA58, 0x686DC0C5, 0xCE1ACB71, 0x0BBDF5FF, 0xADCAFE4B, 0x9C22E4D6, 0x3A55EF62,
+        0xABC30345, 0x0DB408F1, 0x3C5C126C, 0x9A2B19D8, 0x5F8C2756, 0xF9FB2CE2, 0xC813367F, 0x6E643DCB,
+        0x982C4D22, 0x3E5B4696, 0x0FB35C0B, 0xA9C457BF, 0x6C636931, 0xCA146285, 0xFBFC7818, 0x5D8B73AC,
+        0x03A0A617, 0xA5D7ADA3, 0x943FB73E, 0x3248BC8A, 0xF7EF8204, 0x519889B0, 0x6070932D, 0xC6079899,
+        0x304FE870, 0x9638E3C4, 0xA7D0F959, 0x01A7F2ED, 0xC400CC63, 0x6277C7D7, 0x539FDD4A, 0xF5E8D6FE,
+        0x647E3AD9, 0xC209316D, 0xF3E12BF0, 0x55962044, 0x90311ECA, 0x3646157E, 0x07AE0FE3, 0xA1D90457,
+        0x579174BE, 0xF1E67F0A, 0xC00E6597, 0x66796E23, 0xA3DE50AD, 0x05A95B19, 0x34414184, 0x92364A30
+    },
+    {
+        0x00000000, 0xCCAA009E, 0x4225077D, 0x8E8F07E3, 0x844A0EFA, 0x48E00E64, 0xC66F0987, 0x0AC50919,
+        0xD3E51BB5, 0x1F4F1B2B, 0x91C01CC8, 0x5D6A1C56, 0x57AF154F, 0x9B0515D1, 0x158A1232, 0xD92012AC,
+        0x7CBB312B, 0xB01131B5, 0x3E9E3656, 0xF23436C8, 0xF8F13FD1, 0x345B3F4F, 0xBAD438AC, 0x767E3832,
+        0xAF5E2A9E, 0x63F42A00, 0xED7B2DE3, 0x21D12D7D, 0x2B142464, 0xE7BE24FA, 0x69312319, 0xA59B2387,
+        0xF9766256, 0x35DC62C8, 0xBB53652B, 0x77F965B5, 0x7D3C6CAC, 0xB1966C32, 0x3F196BD1, 0xF3B36B4F,
+        0x2A9379E3, 0xE639797D, 0x68B67E9E, 0xA41C7E00, 0xAED97719, 0x62737787, 0xECFC7064, 0x205670FA,
+        0x85CD537D, 0x496753E3, 0xC7E85400, 0x0B42549E, 0x01875D87, 0xCD2D5D19, 0x43A25AFA, 0x8F085A64,
+        0x562848C8, 0x9A824856, 0x140D4FB5, 0xD8A74F2B, 0xD2624632, 0x1EC846AC, 0x9047414F, 0x5CED41D1,
+        0x299DC2ED, 0xE537C273, 0x6BB8C590, 0xA712C50E, 0xADD7CC17, 0x617DCC89, 0xEFF2CB6A, 0x2358CBF4,
+        0xFA78D958, 0x36D2D9C6, 0xB85DDE25, 0x74F7DEBB, 0x7E32D7A2, 0xB298D73C, 0x3C17D0DF, 0xF0BDD041,
+        0x5526F3C6, 0x998CF358, 0x1703F4BB, 0xDBA9F425, 0xD16CFD3C, 0x1DC6FDA2, 0x9349FA41, 0x5FE3FADF,
+        0x86C3E873, 0x4A69E8ED, 0xC4E6EF0E, 0x084CEF90, 0x0289E689, 0xCE23E617, 0x40ACE1F4, 0x8C06E16A,
+        0xD0EBA0BB, 0x1C41A025, 0x92CEA7C6, 0x5E64A758, 0x54A1AE41, 0x980BAEDF, 0x1684A93C, 0xDA2EA9A2,
+        0x030EBB0E, 0xCFA4BB90, 0x412BBC73, 0x8D81BCED, 0x8744B5F4, 0x4BEEB56A, 0xC561B289, 0x09CBB217,
+        0xAC509190, 0x60FA910E, 0xEE7596ED, 0x22DF9673, 0x281A9F6A, 0xE4B09FF4, 0x6A3F9817, 0xA6959889,
+        0x7FB58A25, 0xB31F8ABB, 0x3D908D58, 0xF13A8DC6, 0xFBFF84DF, 0x37558441, 0xB9DA83A2, 0x7570833C,
+        0x533B85DA, 0x9F918544, 0x111E82A7, 0xDDB48239, 0xD7718B20, 0x1BDB8BBE, 0x95548C5D, 0x59FE8CC3,
+        0x80DE9E6F, 0x4C749EF1, 0xC2FB9912, 0x0E51998C, 0x04949095, 0xC83E900B, 0x46B197E8, 0x8A1B9776,
+        0x2F80B4F1, 0xE32AB46F, 0x6DA5B38C, 0xA10FB312, 0xABCABA0B, 0x6760BA95, 0xE9EFBD76, 0x2545BDE8,
+        0xFC65AF44, 0x30CFAFDA, 0xBE40A839, 0x72EAA8A7, 0x782FA1BE, 0xB485A120, 0x3A0AA6C3, 0xF6A0A65D,
+        0xAA4DE78C, 0x66E7E712, 0xE868E0F1, 0x24C2E06F, 0x2E07E976, 0xE2ADE9E8, 0x6C22EE0B, 0xA088EE95,
+        0x79A8FC39, 0xB502FCA7, 0x3B8DFB44, 0xF727FBDA, 0xFDE2F2C3, 0x3148F25D, 0xBFC7F5BE, 0x736DF520,
+        0xD6F6D6A7, 0x1A5CD639, 0x94D3D1DA, 0x5879D144, 0x52BCD85D, 0x9E16D8C3, 0x1099DF20, 0xDC33DFBE,
+        0x0513CD12, 0xC9B9CD8C, 0x4736CA6F, 0x8B9CCAF1, 0x8159C3E8, 0x4DF3C376, 0xC37CC495, 0x0FD6C40B,
+        0x7AA64737, 0xB60C47A9, 0x3883404A, 0xF42940D4, 0xFEEC49CD, 0x32464953, 0xBCC94EB0, 0x70634E2E,
+        0xA9435C82, 0x65E95C1C, 0xEB665BFF, 0x27CC5B61, 0x2D095278, 0xE1A352E6, 0x6F2C5505, 0xA386559B,
+        0x061D761C, 0xCAB77682, 0x44387161, 0x889271FF, 0x825778E6, 0x4EFD7878, 0xC0727F9B, 0x0CD87F05,
+        0xD5F86DA9, 0x19526D37, 0x97DD6AD4, 0x5B776A4A, 0x51B26353, 0x9D1863CD, 0x1397642E, 0xDF3D64B0,
+        0x83D02561, 0x4F7A25FF, 0xC1F5221C, 0x0D5F2282, 0x079A2B9B, 0xCB302B05, 0x45BF2CE6, 0x89152C78,
+        0x50353ED4, 0x9C9F3E4A, 0x121039A9, 0xDEBA3937, 0xD47F302E, 0x18D530B0, 0x965A3753, 0x5AF037CD,
+        0xFF6B144A, 0x33C114D4, 0xBD4E1337, 0x71E413A9, 0x7B211AB0, 0xB78B1A2E, 0x39041DCD, 0xF5AE1D53,
+        0x2C8E0FFF, 0xE0240F61, 0x6EAB0882, 0xA201081C, 0xA8C40105, 0x646E019B, 0xEAE10678, 0x264B06E6
+    }
+};
 
 // Flag to note GPU acceleration is available,
 // referenced from other modules to support GPU data loading
@@ -407,10 +770,20 @@ bool isGpuReady = false;
 static int screenshotCounter = 0;           // Screenshots counter
 #endif
 
+#if defined(RAYLIB_SUPPORT_GIF_RECORDING) || defined(RAYLIB_SUPPORT_MODULE_RTEXTURES)
+static ScreenCaptureBuffer captureBuffers[RAYLIB_SCREEN_CAPTURE_BUFFERS] = { 0 };  // Screen capture buffers
+static unsigned int captureSequence = 0;    // Screen capture sequence counter
+static unsigned int captureTicket = 0;      // Last screen capture background task ticket
+static double captureFrameTime = 0.0;       // Main thread time spent capturing on current frame
+#endif
+static RaylibScreenCaptureStats captureStats = { 0 };   // Screen capture cost stats
+
 #if defined(RAYLIB_SUPPORT_GIF_RECORDING)
 static unsigned int gifFrameCounter = 0;    // GIF frames counter
 static bool gifRecording = false;           // GIF recording state
-static MsfGifState gifState = { 0 };        // MSGIF context state
+static int gifWidth = 0;                    // GIF recording frames width
+static int gifHeight = 0;                   // GIF recording frames height
+static MsfGifState gifState = { 0 };        // MSGIF context state (only accessed on background thread)
 #endif
 
 #if defined(RAYLIB_SUPPORT_AUTOMATION_EVENTS)
@@ -515,16 +888,49 @@ extern int InitPlatform(void);          // Initialize platform (graphics, inputs
 extern void ClosePlatform(void);        // Close platform
 
 static void InitTimer(void);                                // Initialize timer, hi-resolution if available (required by InitPlatform())
+static void UpdateFrameStats(double workTime, double waitTime, double spinTime, double overshootTime, bool missed); // Update frame timing and pacing stats
+#if defined(FRAME_PACER_AVAILABLE)
+static unsigned long long int GetMonotonicTime(void);      // Get monotonic clock time in nanoseconds
+static double WaitDeadline(unsigned long long int deadline, double *spinTime); // Wait until absolute deadline, returns wake-up delay in seconds
+#endif
+static void RegisterInputEvent(int type, int code, int action, RaylibVector2 value);  // Register input event into events queue (required by platform input callbacks)
+static void ResetInputEvents(void);                         // Reset input events registered for a new frame (required by PollInputEvents())
 static void SetupFramebuffer(int width, int height);        // Setup main framebuffer (required by InitPlatform())
 static void SetupViewport(int width, int height);           // Set viewport for a provided width and height
 
-static void ScanDirectoryFiles(const char *basePath, RaylibFilePathList *list, const char *filter);   // Scan all files and directories in a base path
-static void ScanDirectoryFilesRecursively(const char *basePath, RaylibFilePathList *list, const char *filter);  // Scan all files and directories recursively from a base path
+static bool ScanDirectory(char *path, int pathLength, const char *filter, bool scanSubdirs, RaylibScanDirectoryCallback callback, void *userData, unsigned int *count);  // Scan files and directories in path, reporting them to callback
+static bool AddFilePath(const char *filePath, bool isDirectory, void *userData);            // Add scanned path to file paths pool (FilePathPool)
+static RaylibFilePathList LoadFilePathPool(FilePathPool *pool);                             // Load compact file paths list from paths pool, pool is unloaded
+
+static void UpdateHashState(RaylibHashState *state, const unsigned char *data, int dataSize, void (*hashBlock)(unsigned int *, const unsigned char *));  // Update hash state, processing full 64 bytes blocks
+static void FinishHashState(RaylibHashState *state, const unsigned char *length, void (*hashBlock)(unsigned int *, const unsigned char *));  // Pad hash message and process last blocks
+static void HashBlockMD5(unsigned int *hash, const unsigned char *block);  // Process one 64 bytes block of MD5 hash
+static void HashBlockSHA1(unsigned int *hash, const unsigned char *block); // Process one 64 bytes block of SHA-1 hash
+static unsigned long long ReadLittleEndian64(const unsigned char *data);   // Read 64bit little endian value from unaligned data
+
+#if defined(RAYLIB_SUPPORT_COMPRESSION_API)
+static int CompressChunks(const unsigned char *data, int dataSize, int chunkSize, unsigned char *output);   // Compress data into independent chunks (in parallel), returns compressed size or -1 on failure
+static int DecompressChunks(const unsigned char *compData, int compDataSize, unsigned char **data, int *dataCapacity, int *dataSize);  // Decompress all complete chunks (in parallel), returns bytes consumed or -1 on failure
+static void CompressChunksRange(void *userData, int start, int end);     // Compress a range of chunks groups (CompressionChunksJob)
+static void DecompressChunksRange(void *userData, int start, int end);   // Decompress a range of chunks (CompressionChunksJob)
+#endif
 
 #if defined(RAYLIB_SUPPORT_AUTOMATION_EVENTS)
 static void RecordAutomationEvent(void); // Record frame events (to internal events array)
 #endif
 
+#if defined(RAYLIB_SUPPORT_GIF_RECORDING) || defined(RAYLIB_SUPPORT_MODULE_RTEXTURES)
+static bool CaptureScreenFrame(bool gifFrame, int width, int height, int delay, const char *fileName, bool wait);  // Capture screen frame, read back and encoded asynchronously (GIF frame or screenshot)
+static void UpdateScreenCapture(bool wait);     // Queue read back frames for encoding (in capture order) and release encoded frames buffers
+static void FlushScreenCapture(void);           // Wait until all captured frames are read back and encoded
+static void CloseScreenCapture(void);           // Flush and unload screen capture buffers
+static void EncodeScreenCapture(void *userData);    // Encode captured frame, GIF frame or screenshot file (background task)
+#endif
+#if defined(RAYLIB_SUPPORT_GIF_RECORDING)
+static void BeginGifRecording(void *userData);  // Begin GIF recording, userData: frames width and height (background task)
+static void EndGifRecording(void *userData);    // End GIF recording, saved to userData file path if not NULL (background task)
+#endif
+
 #if defined(_WIN32) && !defined(PLATFORM_DESKTOP_RGFW)
 // NOTE: We declare Sleep() function symbol to avoid including windows.h (kernel32.lib linkage required)
 void __stdcall Sleep(unsigned long msTimeout);              // Required for: RaylibWaitTime()
@@ -582,6 +988,12 @@ const char *RaylibTextFormat(const char *text, ...);              // Formatting
     // i.e software rendering backend or console backend!
 #endif
 
+// Input events queue access lock, platforms registering input events from multiple threads must define it
+#ifndef INPUT_EVENTS_LOCK
+    #define INPUT_EVENTS_LOCK()
+    #define INPUT_EVENTS_UNLOCK()
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition: Window and Graphics Device
 //----------------------------------------------------------------------------------
@@ -694,8 +1106,6 @@ void RaylibInitWindow(int width, int height, const char *title)
     CORE.Input.Mouse.scale = (RaylibVector2){ 1.0f, 1.0f };
     CORE.Input.Mouse.cursor = RAYLIB_MOUSE_CURSOR_ARROW;
     CORE.Input.Gamepad.lastButtonPressed = RAYLIB_GAMEPAD_BUTTON_UNKNOWN;
-    
-    InitMouseQueue(&CORE.Input.Mouse.eventQueue);
 
     // Initialize platform
     //--------------------------------------------------------------
@@ -755,23 +1165,34 @@ void RaylibCloseWindow(void)
 #if defined(RAYLIB_SUPPORT_GIF_RECORDING)
     if (gifRecording)
     {
-        MsfGifResult result = msf_gif_end(&gifState);
-        msf_gif_free(result);
+        // Recording is discarded once pending frames are encoded
+        UpdateScreenCapture(true);
+        captureTicket = QueueBackgroundTask(EndGifRecording, NULL);
         gifRecording = false;
     }
 #endif
 
+#if defined(RAYLIB_SUPPORT_GIF_RECORDING) || defined(RAYLIB_SUPPORT_MODULE_RTEXTURES)
+    CloseScreenCapture();       // Wait for pending screenshots and unload capture buffers
+#endif
+
 #if defined(RAYLIB_SUPPORT_MODULE_RTEXT) && defined(RAYLIB_SUPPORT_DEFAULT_FONT)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
 
     rlglClose();                // De-init rlgl
 
+    CloseWorkerThreads();       // Stop worker threads, if pool was initialized
+
     // De-initialize platform
     //--------------------------------------------------------------
     ClosePlatform();
     //--------------------------------------------------------------
 
+    // Free input events queue
+    RL_FREE(CORE.Input.events.events);
+    memset(&CORE.Input.events, 0, sizeof(InputEventQueue));
+
     CORE.Window.ready = false;
     RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "Window closed successfully");
 }
@@ -923,28 +1344,15 @@ void RaylibEndDrawing(void)
     // Draw record indicator
     if (gifRecording)
     {
-        #ifndef GIF_RECORD_FRAMERATE
-        #define GIF_RECORD_FRAMERATE    10
-        #endif
         gifFrameCounter += (unsigned int)(RaylibGetFrameTime()*1000);
 
         // NOTE: We record one gif frame depending on the desired gif framerate
         if (gifFrameCounter > 1000/GIF_RECORD_FRAMERATE)
         {
-            // Get image data for the current frame (from backbuffer)
-            // NOTE: This process is quite slow... :(
-            RaylibVector2 scale = RaylibGetWindowScaleDPI();
-            unsigned char *screenData = rlReadScreenPixels((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
-
-            #ifndef GIF_RECORD_BITRATE
-            #define GIF_RECORD_BITRATE 16
-            #endif
-
-            // Add the frame to the gif recording, given how many frames have passed in centiseconds
-            msf_gif_frame(&gifState, screenData, gifFrameCounter/10, GIF_RECORD_BITRATE, (int)((float)CORE.Window.render.width*scale.x)*4);
-            gifFrameCounter -= 1000/GIF_RECORD_FRAMERATE;
-
-            RL_FREE(screenData);    // Free image data
+            // Capture current frame (from backbuffer), given how many frames have passed in centiseconds
+            // NOTE: Pixels are read back some frames later and the frame is encoded on background thread,
+            // if all capture buffers are busy the frame is dropped and its time added to next frame
+            if (CaptureScreenFrame(true, gifWidth, gifHeight, gifFrameCounter/10, NULL, false)) gifFrameCounter -= 1000/GIF_RECORD_FRAMERATE;
         }
 
     #if defined(RAYLIB_SUPPORT_MODULE_RSHAPES) && defined(RAYLIB_SUPPORT_MODULE_RTEXT)
@@ -960,6 +1368,24 @@ void RaylibEndDrawing(void)
     }
 #endif
 
+#if defined(RAYLIB_SUPPORT_GIF_RECORDING) || defined(RAYLIB_SUPPORT_MODULE_RTEXTURES)
+    // Read back and encode captured frames, accounting main thread capture cost
+    if (captureStats.pendingCount > 0)
+    {
+        double startTime = RaylibGetTime();
+        UpdateScreenCapture(false);
+        captureFrameTime += RaylibGetTime() - startTime;
+    }
+
+    if (captureFrameTime > 0.0)
+    {
+        captureStats.captureTime = (float)captureFrameTime;
+        if (captureStats.captureTime > captureStats.maxCaptureTime) captureStats.maxCaptureTime = captureStats.captureTime;
+        captureStats.totalCaptureTime += (float)captureFrameTime;
+        captureFrameTime = 0.0;
+    }
+#endif
+
 #if defined(RAYLIB_SUPPORT_AUTOMATION_EVENTS)
     if (automationEventRecording) RecordAutomationEvent();    // Event recording
 #endif
@@ -974,18 +1400,50 @@ void RaylibEndDrawing(void)
 
     CORE.Time.frame = CORE.Time.update + CORE.Time.draw;
 
-    // Wait for some milliseconds...
-    if (CORE.Time.frame < CORE.Time.target)
+    double workTime = CORE.Time.frame;
+    double waitTime = 0.0;
+    double spinTime = 0.0;
+    double overshootTime = 0.0;
+    bool missed = false;
+
+#if defined(FRAME_PACER_AVAILABLE)
+    // Wait until next frame deadline, deadlines are absolute so wait inaccuracy does not accumulate
+    if (CORE.Time.target > 0.0)
     {
-        RaylibWaitTime(CORE.Time.target - CORE.Time.frame);
+        unsigned long long int now = GetMonotonicTime();
+
+        if (CORE.Time.deadline == 0) CORE.Time.deadline = now - (unsigned long long int)(workTime*1000000000.0);
+        CORE.Time.deadline += (unsigned long long int)(CORE.Time.target*1000000000.0);
+
+        // Frame missed, restart deadlines from current time (no catching up with shorter frames)
+        if (CORE.Time.deadline <= now)
+        {
+            CORE.Time.deadline = now;
+            missed = true;
+        }
+        else overshootTime = WaitDeadline(CORE.Time.deadline, &spinTime);
+    }
+#else
+    // Wait for some milliseconds...
+    if (CORE.Time.frame < CORE.Time.target) RaylibWaitTime(CORE.Time.target - CORE.Time.frame);
+    else if (CORE.Time.target > 0.0) missed = true;
+#endif
 
+    if ((CORE.Time.target > 0.0) && !missed)
+    {
         CORE.Time.current = RaylibGetTime();
-        double waitTime = CORE.Time.current - CORE.Time.previous;
+        waitTime = CORE.Time.current - CORE.Time.previous;
         CORE.Time.previous = CORE.Time.current;
 
         CORE.Time.frame += waitTime;    // Total frame time: update + draw + wait
+
+    #if !defined(FRAME_PACER_AVAILABLE)
+        if (CORE.Time.frame > CORE.Time.target) overshootTime = CORE.Time.frame - CORE.Time.target;
+    #endif
     }
 
+    UpdateFrameStats(workTime, waitTime, spinTime, overshootTime, missed);
+
     // RaylibPollInputEvents();      // Poll user events (before next frame update)
 #endif
 
@@ -999,23 +1457,37 @@ void RaylibEndDrawing(void)
             {
                 gifRecording = false;
 
-                MsfGifResult result = msf_gif_end(&gifState);
+                // Queue pending frames before ending recording, file is saved on background thread
+                // NOTE: Recording is still ended if file name can not be allocated, it is not saved
+                char *fileName = (char *)RL_MALLOC(512*sizeof(char));
+                if (fileName != NULL) strcpy(fileName, RaylibTextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter));
+                else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "SYSTEM: Failed to allocate GIF recording file name, recording not saved");
 
-                RaylibSaveFileData(RaylibTextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter), result.data, (unsigned int)result.dataSize);
-                msf_gif_free(result);
+                UpdateScreenCapture(true);
+                captureTicket = QueueBackgroundTask(EndGifRecording, fileName);
 
                 RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "SYSTEM: Finish animated GIF recording");
             }
             else
             {
-                gifRecording = true;
-                gifFrameCounter = 0;
-
                 RaylibVector2 scale = RaylibGetWindowScaleDPI();
-                msf_gif_begin(&gifState, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
-                screenshotCounter++;
+                int *size = (int *)RL_MALLOC(2*sizeof(int));
+
+                if (size != NULL)
+                {
+                    gifRecording = true;
+                    gifFrameCounter = 0;
+                    gifWidth = (int)((float)CORE.Window.render.width*scale.x);
+                    gifHeight = (int)((float)CORE.Window.render.height*scale.y);
+
+                    size[0] = gifWidth;
+                    size[1] = gifHeight;
+                    captureTicket = QueueBackgroundTask(BeginGifRecording, size);
+                    screenshotCounter++;
 
-                RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "SYSTEM: Start animated GIF recording: %s", RaylibTextFormat("screenrec%03i.gif", screenshotCounter));
+                    RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "SYSTEM: Start animated GIF recording: %s", RaylibTextFormat("screenrec%03i.gif", screenshotCounter));
+                }
+                else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "SYSTEM: Failed to start animated GIF recording, memory could not be allocated");
             }
         }
         else
@@ -1678,6 +2150,8 @@ void RaylibSetTargetFPS(int fps)
     if (fps < 1) CORE.Time.target = 0.0;
     else CORE.Time.target = 1.0/(double)fps;
 
+    CORE.Time.deadline = 0;         // Restart frame deadlines
+
     RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "TIMER: Target time per frame: %02.03f milliseconds", (float)CORE.Time.target*1000.0f);
 }
 
@@ -1730,6 +2204,18 @@ float RaylibGetFrameTime(void)
     return (float)CORE.Time.frame;
 }
 
+// Get frame timing and pacing stats
+RaylibFrameStats RaylibGetFrameStats(void)
+{
+    return CORE.Time.stats;
+}
+
+// Reset frame timing and pacing stats
+void RaylibResetFrameStats(void)
+{
+    memset(&CORE.Time.stats, 0, sizeof(RaylibFrameStats));
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition: Custom frame control
 //----------------------------------------------------------------------------------
@@ -1747,6 +2233,11 @@ void RaylibWaitTime(double seconds)
 {
     if (seconds < 0) return;    // Security check
 
+#if defined(FRAME_PACER_AVAILABLE)
+    // Sleep until absolute deadline, busy wait only an adaptive window
+    double spinTime = 0.0;
+    WaitDeadline(GetMonotonicTime() + (unsigned long long int)(seconds*1000000000.0), &spinTime);
+#else
 #if defined(RAYLIB_SUPPORT_BUSY_WAIT_LOOP) || defined(RAYLIB_SUPPORT_PARTIALBUSY_WAIT_LOOP)
     double destinationTime = RaylibGetTime() + seconds;
 #endif
@@ -1782,6 +2273,7 @@ void RaylibWaitTime(double seconds)
         while (RaylibGetTime() < destinationTime) { }
     #endif
 #endif
+#endif  // FRAME_PACER_AVAILABLE
 }
 
 //----------------------------------------------------------------------------------
@@ -1888,22 +2380,36 @@ void RaylibTakeScreenshot(const char *fileName)
     if (strchr(fileName, '\'') != NULL) { RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "SYSTEM: Provided fileName could be potentially malicious, avoid [\'] character"); return; }
 
     RaylibVector2 scale = RaylibGetWindowScaleDPI();
-    unsigned char *imgData = rlReadScreenPixels((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
-    RaylibImage image = { imgData, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y), 1, RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
 
     char path[512] = { 0 };
     strcpy(path, RaylibTextFormat("%s/%s", CORE.Storage.basePath, RaylibGetFileName(fileName)));
 
-    RaylibExportImage(image, path);           // WARNING: Module required: rtextures
-    RL_FREE(imgData);
-
-    if (RaylibFileExists(path)) RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", path);
-    else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "SYSTEM: [%s] Screenshot could not be saved", path);
+    // NOTE: Pixels are read back some frames later and the image is saved on background thread,
+    // all pending screenshots are saved on RaylibCloseWindow()
+    // WARNING: Custom trace log and save file data callbacks are called from background thread
+    CaptureScreenFrame(false, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y), 0, path, true);
 #else
     RAYLIB_TRACELOG(RAYLIB_LOG_WARNING,"IMAGE: RaylibExportImage() requires module: rtextures");
 #endif
 }
 
+// Get screen capture (screenshots and GIF recording) cost stats
+RaylibScreenCaptureStats RaylibGetScreenCaptureStats(void)
+{
+    return captureStats;
+}
+
+// Reset screen capture cost stats
+// NOTE: Pending frames count and capture mode are kept
+void RaylibResetScreenCaptureStats(void)
+{
+    RaylibScreenCaptureStats stats = { 0 };
+    stats.pendingCount = captureStats.pendingCount;
+    stats.async = captureStats.async;
+
+    captureStats = stats;
+}
+
 // Setup window configuration flags (view FLAGS)
 // NOTE: This function is expected to be called before window creation,
 // because it sets up some flags for the window creation process
@@ -1939,10 +2445,11 @@ bool RaylibFileExists(const char *fileName)
 }
 
 // Check file extension
-// NOTE: Extensions checking is not case-sensitive
+// NOTE: Extensions checking is not case-sensitive, no static buffers used (safe to call from any thread)
 bool RaylibIsFileExtension(const char *fileName, const char *ext)
 {
     #define MAX_FILE_EXTENSION_LENGTH  16
+    #define MAX_FILE_EXTENSIONS_CHECK  64
 
     bool result = false;
     const char *fileExt = RaylibGetFileExtension(fileName);
@@ -1950,15 +2457,19 @@ bool RaylibIsFileExtension(const char *fileName, const char *ext)
     if (fileExt != NULL)
     {
 #if defined(RAYLIB_SUPPORT_MODULE_RTEXT) && defined(RAYLIB_SUPPORT_TEXT_MANIPULATION)
-        int extCount = 0;
-        const char **checkExts = RaylibTextSplit(ext, ';', &extCount); // WARNING: Module required: rtext
+        char extsBuffer[MAX_FILE_EXTENSIONS_CHECK*8] = { 0 };
+        const char *checkExts[MAX_FILE_EXTENSIONS_CHECK] = { 0 };
+        int extCount = RaylibTextSplitBuffer(extsBuffer, MAX_FILE_EXTENSIONS_CHECK*8, checkExts, MAX_FILE_EXTENSIONS_CHECK, ext, ';'); // WARNING: Module required: rtext
 
         char fileExtLower[MAX_FILE_EXTENSION_LENGTH + 1] = { 0 };
-        strncpy(fileExtLower, RaylibTextToLower(fileExt), MAX_FILE_EXTENSION_LENGTH); // WARNING: Module required: rtext
+        RaylibTextToLowerBuffer(fileExtLower, MAX_FILE_EXTENSION_LENGTH + 1, fileExt); // WARNING: Module required: rtext
 
         for (int i = 0; i < extCount; i++)
         {
-            if (strcmp(fileExtLower, RaylibTextToLower(checkExts[i])) == 0)
+            char checkExtLower[MAX_FILE_EXTENSION_LENGTH + 1] = { 0 };
+            RaylibTextToLowerBuffer(checkExtLower, MAX_FILE_EXTENSION_LENGTH + 1, checkExts[i]);
+
+            if (strcmp(fileExtLower, checkExtLower) == 0)
             {
                 result = true;
                 break;
@@ -2258,68 +2769,50 @@ const char *RaylibGetApplicationDirectory(void)
 
 // Load directory filepaths
 // NOTE: Base path is prepended to the scanned filepaths
-// WARNING: Directory is scanned twice, first time to get files count
 // No recursive scanning is done!
 RaylibFilePathList RaylibLoadDirectoryFiles(const char *dirPath)
 {
-    RaylibFilePathList files = { 0 };
-    unsigned int fileCounter = 0;
-
-    struct dirent *entity;
-    DIR *dir = opendir(dirPath);
-
-    if (dir != NULL) // It's a directory
-    {
-        // SCAN 1: Count files
-        while ((entity = readdir(dir)) != NULL)
-        {
-            // NOTE: We skip '.' (current dir) and '..' (parent dir) filepaths
-            if ((strcmp(entity->d_name, ".") != 0) && (strcmp(entity->d_name, "..") != 0)) fileCounter++;
-        }
-
-        // Memory allocation for dirFileCount
-        files.capacity = fileCounter;
-        files.paths = (char **)RL_MALLOC(files.capacity*sizeof(char *));
-        for (unsigned int i = 0; i < files.capacity; i++) files.paths[i] = (char *)RL_MALLOC(RAYLIB_MAX_FILEPATH_LENGTH*sizeof(char));
-
-        closedir(dir);
-
-        // SCAN 2: Read filepaths
-        // NOTE: Directory paths are also registered
-        ScanDirectoryFiles(dirPath, &files, NULL);
-
-        // Security check: read files.count should match fileCounter
-        if (files.count != files.capacity) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "FILEIO: Read files count do not match capacity allocated");
-    }
-    else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "FILEIO: Failed to open requested directory");  // Maybe it's a file...
-
-    return files;
+    return RaylibLoadDirectoryFilesEx(dirPath, NULL, false);
 }
 
 // Load directory filepaths with extension filtering and recursive directory scan
-// NOTE: On recursive loading we do not pre-scan for file count, we use RAYLIB_MAX_FILEPATH_CAPACITY
+// NOTE: Paths are stored in a single allocation (pointers array followed by paths strings),
+// list grows as required while scanning, no maximum capacity
 RaylibFilePathList RaylibLoadDirectoryFilesEx(const char *basePath, const char *filter, bool scanSubdirs)
 {
-    RaylibFilePathList files = { 0 };
-
-    files.capacity = RAYLIB_MAX_FILEPATH_CAPACITY;
-    files.paths = (char **)RL_CALLOC(files.capacity, sizeof(char *));
-    for (unsigned int i = 0; i < files.capacity; i++) files.paths[i] = (char *)RL_CALLOC(RAYLIB_MAX_FILEPATH_LENGTH, sizeof(char));
+    FilePathPool pool = { 0 };
 
     // WARNING: basePath is always prepended to scanned paths
-    if (scanSubdirs) ScanDirectoryFilesRecursively(basePath, &files, filter);
-    else ScanDirectoryFiles(basePath, &files, filter);
+    RaylibScanDirectoryFiles(basePath, filter, scanSubdirs, AddFilePath, &pool);
 
-    return files;
+    return LoadFilePathPool(&pool);
 }
 
 // Unload directory filepaths
 // WARNING: files.count is not reseted to 0 after unloading
 void RaylibUnloadDirectoryFiles(RaylibFilePathList files)
 {
-    for (unsigned int i = 0; i < files.capacity; i++) RL_FREE(files.paths[i]);
+    RL_FREE(files.paths);       // NOTE: Paths strings are allocated along with pointers array
+}
+
+// Scan directory filepaths with extension filtering and recursive directory scan,
+// every path is provided to callback as scanned, returns number of paths provided
+// NOTE: Paths are filtered as RaylibLoadDirectoryFilesEx(), scan stops when callback returns false
+// WARNING: Provided path string is only valid during callback call
+unsigned int RaylibScanDirectoryFiles(const char *basePath, const char *filter, bool scanSubdirs, RaylibScanDirectoryCallback callback, void *userData)
+{
+    unsigned int count = 0;
+    char path[RAYLIB_MAX_FILEPATH_LENGTH] = { 0 };
+    int pathLength = (basePath != NULL)? (int)strlen(basePath) : 0;
 
-    RL_FREE(files.paths);
+    if ((pathLength > 0) && (pathLength < RAYLIB_MAX_FILEPATH_LENGTH) && (callback != NULL))
+    {
+        memcpy(path, basePath, pathLength + 1);
+        ScanDirectory(path, pathLength, filter, scanSubdirs, callback, userData, &count);
+    }
+    else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "FILEIO: Failed to scan requested directory");
+
+    return count;
 }
 
 // Create directories (including full path requested), returns 0 on success
@@ -2493,8 +2986,6 @@ long RaylibGetFileModTime(const char *fileName)
 // Compress data (DEFLATE algorithm)
 unsigned char *RaylibCompressData(const unsigned char *data, int dataSize, int *compDataSize)
 {
-    #define COMPRESSION_QUALITY_DEFLATE  8
-
     unsigned char *compData = NULL;
 
 #if defined(RAYLIB_SUPPORT_COMPRESSION_API)
@@ -2503,7 +2994,7 @@ unsigned char *RaylibCompressData(const unsigned char *data, int dataSize, int *
     int bounds = sdefl_bound(dataSize);
     compData = (unsigned char *)RL_CALLOC(bounds, 1);
 
-    *compDataSize = sdeflate(sdefl, compData, data, dataSize, COMPRESSION_QUALITY_DEFLATE);   // Compression level 8, same as stbiw
+    *compDataSize = sdeflate(sdefl, compData, data, dataSize, COMPRESSION_QUALITY_DEFLATE);
     RL_FREE(sdefl);
 
     RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "SYSTEM: Compress data: Original size: %i -> Comp. size: %i", dataSize, *compDataSize);
@@ -2537,1309 +3028,2119 @@ unsigned char *RaylibDecompressData(const unsigned char *compData, int compDataS
     return data;
 }
 
-// Encode data to Base64 string
-char *RaylibEncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize)
+// Compress data into independent chunks (DEFLATE algorithm), chunks are compressed in parallel
+// NOTE: Output is not a raw DEFLATE stream, it must be decompressed with RaylibDecompressDataChunked()
+// or a decompression stream, chunkSize = 0 uses RAYLIB_COMPRESSION_CHUNK_SIZE
+unsigned char *RaylibCompressDataChunked(const unsigned char *data, int dataSize, int chunkSize, int *compDataSize)
 {
-    static const unsigned char base64encodeTable[] = {
-        'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',
-        'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
-        'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'
-    };
+    unsigned char *compData = NULL;
+    *compDataSize = 0;
 
-    static const int modTable[] = { 0, 2, 1 };
+#if defined(RAYLIB_SUPPORT_COMPRESSION_API)
+    if (chunkSize <= 0) chunkSize = RAYLIB_COMPRESSION_CHUNK_SIZE;
 
-    *outputSize = 4*((dataSize + 2)/3);
+    if ((data != NULL) && (dataSize > 0))
+    {
+        int chunkCount = (dataSize + chunkSize - 1)/chunkSize;
+        compData = (unsigned char *)RL_MALLOC((size_t)chunkCount*(COMPRESSION_CHUNK_HEADER_SIZE + sdefl_bound(chunkSize)));
 
-    char *encodedData = (char *)RL_MALLOC(*outputSize);
+        if (compData != NULL) *compDataSize = CompressChunks(data, dataSize, chunkSize, compData);
 
-    if (encodedData == NULL) return NULL;   // Security check
+        if (*compDataSize < 0)
+        {
+            RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "SYSTEM: Failed to compress chunked data, memory could not be allocated");
+            RL_FREE(compData);
+            compData = NULL;
+            *compDataSize = 0;
+        }
+    }
 
-    for (int i = 0, j = 0; i < dataSize;)
-    {
-        unsigned int octetA = (i < dataSize)? (unsigned char)data[i++] : 0;
-        unsigned int octetB = (i < dataSize)? (unsigned char)data[i++] : 0;
-        unsigned int octetC = (i < dataSize)? (unsigned char)data[i++] : 0;
+    RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "SYSTEM: Compress data chunked: Original size: %i -> Comp. size: %i", dataSize, *compDataSize);
+#endif
 
-        unsigned int triple = (octetA << 0x10) + (octetB << 0x08) + octetC;
+    return compData;
+}
 
-        encodedData[j++] = base64encodeTable[(triple >> 3*6) & 0x3F];
-        encodedData[j++] = base64encodeTable[(triple >> 2*6) & 0x3F];
-        encodedData[j++] = base64encodeTable[(triple >> 1*6) & 0x3F];
-        encodedData[j++] = base64encodeTable[(triple >> 0*6) & 0x3F];
-    }
+// Decompress data compressed into independent chunks (DEFLATE algorithm), chunks are decompressed in parallel
+// NOTE: Output size is read from chunks headers, no maximum decompression size guessing required
+unsigned char *RaylibDecompressDataChunked(const unsigned char *compData, int compDataSize, int *dataSize)
+{
+    unsigned char *data = NULL;
+    *dataSize = 0;
 
-    for (int i = 0; i < modTable[dataSize%3]; i++) encodedData[*outputSize - 1 - i] = '=';  // Padding character
+#if defined(RAYLIB_SUPPORT_COMPRESSION_API)
+    int dataCapacity = 0;
+    int consumed = DecompressChunks(compData, compDataSize, &data, &dataCapacity, dataSize);
 
-    return encodedData;
+    if (consumed != compDataSize)
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "SYSTEM: Failed to decompress chunked data, data is not valid");
+        RL_FREE(data);
+        data = NULL;
+        *dataSize = 0;
+    }
+    else RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "SYSTEM: Decompress data chunked: Comp. size: %i -> Original size: %i", compDataSize, *dataSize);
+#endif
+
+    return data;
 }
 
-// Decode Base64 string data
-unsigned char *RaylibDecodeDataBase64(const unsigned char *data, int *outputSize)
+// Load compression stream, data is compressed incrementally into independent chunks
+// NOTE: chunkSize = 0 uses RAYLIB_COMPRESSION_CHUNK_SIZE, memory used is bounded by chunk size and update data size
+RaylibCompressionStream *RaylibLoadCompressionStream(int chunkSize)
 {
-    static const unsigned char base64decodeTable[] = {
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 62, 0, 0, 0, 63, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
-        11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 0, 0, 0, 0, 0, 0, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
-        37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51
-    };
+    RaylibCompressionStream *stream = NULL;
 
-    // Get output size of Base64 input data
-    int outSize = 0;
-    for (int i = 0; data[4*i] != 0; i++)
+#if defined(RAYLIB_SUPPORT_COMPRESSION_API)
+    stream = (RaylibCompressionStream *)RL_CALLOC(1, sizeof(RaylibCompressionStream));
+
+    if (stream != NULL)
     {
-        if (data[4*i + 3] == '=')
+        stream->chunkSize = (chunkSize > 0)? chunkSize : RAYLIB_COMPRESSION_CHUNK_SIZE;
+        stream->inputCapacity = stream->chunkSize;
+        stream->input = (unsigned char *)RL_MALLOC(stream->inputCapacity);
+        stream->outputCapacity = COMPRESSION_CHUNK_HEADER_SIZE + sdefl_bound(stream->chunkSize);
+        stream->output = (unsigned char *)RL_MALLOC(stream->outputCapacity);
+
+        if ((stream->input == NULL) || (stream->output == NULL))
         {
-            if (data[4*i + 2] == '=') outSize += 1;
-            else outSize += 2;
+            RaylibUnloadCompressionStream(stream);
+            stream = NULL;
         }
-        else outSize += 3;
     }
 
-    // Allocate memory to store decoded Base64 data
-    unsigned char *decodedData = (unsigned char *)RL_MALLOC(outSize);
+    if (stream == NULL) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "SYSTEM: Failed to load compression stream, memory could not be allocated");
+#endif
 
-    for (int i = 0; i < outSize/3; i++)
-    {
-        unsigned char a = base64decodeTable[(int)data[4*i]];
-        unsigned char b = base64decodeTable[(int)data[4*i + 1]];
-        unsigned char c = base64decodeTable[(int)data[4*i + 2]];
-        unsigned char d = base64decodeTable[(int)data[4*i + 3]];
+    return stream;
+}
 
-        decodedData[3*i] = (a << 2) | (b >> 4);
-        decodedData[3*i + 1] = (b << 4) | (c >> 2);
-        decodedData[3*i + 2] = (c << 6) | d;
-    }
+// Load decompression stream, chunks data is decompressed incrementally as provided
+RaylibCompressionStream *RaylibLoadDecompressionStream(void)
+{
+    RaylibCompressionStream *stream = NULL;
 
-    if (outSize%3 == 1)
+#if defined(RAYLIB_SUPPORT_COMPRESSION_API)
+    stream = (RaylibCompressionStream *)RL_CALLOC(1, sizeof(RaylibCompressionStream));
+
+    if (stream != NULL)
     {
-        int n = outSize/3;
-        unsigned char a = base64decodeTable[(int)data[4*n]];
-        unsigned char b = base64decodeTable[(int)data[4*n + 1]];
-        decodedData[outSize - 1] = (a << 2) | (b >> 4);
+        stream->decompress = true;
+        stream->outputCapacity = RAYLIB_COMPRESSION_CHUNK_SIZE;     // NOTE: Grown if required by chunks size
+        stream->output = (unsigned char *)RL_MALLOC(stream->outputCapacity);
+
+        if (stream->output == NULL)
+        {
+            RaylibUnloadCompressionStream(stream);
+            stream = NULL;
+        }
     }
-    else if (outSize%3 == 2)
+
+    if (stream == NULL) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "SYSTEM: Failed to load decompression stream, memory could not be allocated");
+#endif
+
+    return stream;
+}
+
+// Unload compression/decompression stream
+void RaylibUnloadCompressionStream(RaylibCompressionStream *stream)
+{
+    if (stream != NULL)
     {
-        int n = outSize/3;
-        unsigned char a = base64decodeTable[(int)data[4*n]];
-        unsigned char b = base64decodeTable[(int)data[4*n + 1]];
-        unsigned char c = base64decodeTable[(int)data[4*n + 2]];
-        decodedData[outSize - 2] = (a << 2) | (b >> 4);
-        decodedData[outSize - 1] = (b << 4) | (c >> 2);
+        RL_FREE(stream->input);
+        RL_FREE(stream->output);
+        RL_FREE(stream);
     }
-
-    *outputSize = outSize;
-    return decodedData;
 }
 
-// Compute CRC32 hash code
-unsigned int RaylibComputeCRC32(unsigned char *data, int dataSize)
+// Update compression/decompression stream with new data, returns output data available
+// NOTE: Returned data is valid until next stream update, NULL is returned if stream data is not valid
+const unsigned char *RaylibUpdateCompressionStream(RaylibCompressionStream *stream, const unsigned char *data, int dataSize, int *outputSize)
 {
-    static unsigned int crcTable[256] = {
-        0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
-        0x0eDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
-        0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
-        0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
-        0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172, 0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
-        0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
-        0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
-        0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924, 0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
-        0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
-        0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
-        0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E, 0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
-        0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
-        0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
-        0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0, 0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
-        0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
-        0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
-        0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A, 0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
-        0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
-        0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
-        0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC, 0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
-        0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
-        0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
-        0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236, 0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
-        0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
-        0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
-        0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38, 0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
-        0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
-        0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
-        0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2, 0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
-        0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
-        0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
-        0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
-    };
-
-    unsigned int crc = ~0u;
-
-    for (int i = 0; i < dataSize; i++) crc = (crc >> 8) ^ crcTable[data[i] ^ (crc & 0xff)];
+    unsigned char *output = NULL;
+    *outputSize = 0;
 
-    return ~crc;
-}
-
-// Compute MD5 hash code
-// NOTE: Returns a static int[4] array (16 bytes)
-unsigned int *RaylibComputeMD5(unsigned char *data, int dataSize)
-{
-    #define ROTATE_LEFT(x, c) (((x) << (c)) | ((x) >> (32 - (c))))
-
-    static unsigned int hash[4] = { 0 };  // Hash to be returned
-
-    // WARNING: All variables are unsigned 32 bit and wrap modulo 2^32 when calculating
-
-    // NOTE: r specifies the per-round shift amounts
-    unsigned int r[] = {
-        7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
-        5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
-        4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
-        6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
-    };
-
-    // Using binary integer part of the sines of integers (in radians) as constants
-    unsigned int k[] = {
-        0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
-        0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
-        0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
-        0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
-        0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa,
-        0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
-        0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed,
-        0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
-        0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
-        0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
-        0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05,
-        0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
-        0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039,
-        0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
-        0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
-        0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
-    };
+#if defined(RAYLIB_SUPPORT_COMPRESSION_API)
+    if ((stream == NULL) || stream->failed || (dataSize < 0) || ((data == NULL) && (dataSize > 0))) return NULL;
 
-    hash[0] = 0x67452301;
-    hash[1] = 0xefcdab89;
-    hash[2] = 0x98badcfe;
-    hash[3] = 0x10325476;
+    if (stream->decompress)
+    {
+        const unsigned char *compData = data;
+        int compDataSize = dataSize;
 
-    // Pre-processing: adding a single 1 bit
-    // Append '1' bit to message
-    // NOTE: The input bytes are considered as bits strings,
-    // where the first bit is the most significant bit of the byte
+        // Append data to pending input if there is a partial chunk from previous update
+        if (stream->inputSize > 0)
+        {
+            if ((stream->inputSize + dataSize) > stream->inputCapacity)
+            {
+                unsigned char *input = (unsigned char *)RL_REALLOC(stream->input, stream->inputSize + dataSize);
 
-    // Pre-processing: padding with zeros
-    // Append '0' bit until message length in bit 448 (mod 512)
-    // Append length mod (2 pow 64) to message
+                if (input == NULL)
+                {
+                    RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "SYSTEM: Failed to decompress stream, memory could not be allocated");
+                    stream->failed = true;
+                    return NULL;
+                }
 
-    int newDataSize = ((((dataSize + 8)/64) + 1)*64) - 8;
+                stream->input = input;
+                stream->inputCapacity = stream->inputSize + dataSize;
+            }
 
-    unsigned char *msg = RL_CALLOC(newDataSize + 64, 1); // Initialize with '0' bits, allocating 64 extra bytes
-    memcpy(msg, data, dataSize);
-    msg[dataSize] = 128; // Write the '1' bit
+            if (dataSize > 0) memcpy(stream->input + stream->inputSize, data, dataSize);
+            stream->inputSize += dataSize;
+            compData = stream->input;
+            compDataSize = stream->inputSize;
+        }
 
-    unsigned int bitsLen = 8*dataSize;
-    memcpy(msg + newDataSize, &bitsLen, 4); // Append the len in bits at the end of the buffer
+        int consumed = DecompressChunks(compData, compDataSize, &stream->output, &stream->outputCapacity, outputSize);
 
-    // Process the message in successive 512-bit chunks for each 512-bit chunk of message
-    for (int offset = 0; offset < newDataSize; offset += (512/8))
-    {
-        // Break chunk into sixteen 32-bit words w[j], 0 <= j <= 15
-        unsigned int *w = (unsigned int *)(msg + offset);
+        if (consumed < 0)
+        {
+            RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "SYSTEM: Failed to decompress stream, data is not valid");
+            stream->failed = true;
+            *outputSize = 0;
+            return NULL;
+        }
 
-        // Initialize hash value for this chunk
-        unsigned int a = hash[0];
-        unsigned int b = hash[1];
-        unsigned int c = hash[2];
-        unsigned int d = hash[3];
+        // Keep remaining partial chunk for next update
+        int remaining = compDataSize - consumed;
 
-        for (int i = 0; i < 64; i++)
+        // NOTE: Pending input is only grown when remaining data is not already on it
+        if (remaining > stream->inputCapacity)
         {
-            unsigned int f = 0;
-            unsigned int g = 0;
+            unsigned char *input = (unsigned char *)RL_REALLOC(stream->input, remaining);
 
-            if (i < 16)
-            {
-                f = (b & c) | ((~b) & d);
-                g = i;
-            }
-            else if (i < 32)
-            {
-                f = (d & b) | ((~d) & c);
-                g = (5*i + 1)%16;
-            }
-            else if (i < 48)
-            {
-                f = b ^ c ^ d;
-                g = (3*i + 5)%16;
-            }
-            else
+            if (input == NULL)
             {
-                f = c ^ (b | (~d));
-                g = (7*i)%16;
+                RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "SYSTEM: Failed to decompress stream, memory could not be allocated");
+                stream->failed = true;
+                *outputSize = 0;
+                return NULL;
             }
 
-            unsigned int temp = d;
-            d = c;
-            c = b;
-            b = b + ROTATE_LEFT((a + f + k[i] + w[g]), r[i]);
-            a = temp;
+            stream->input = input;
+            stream->inputCapacity = remaining;
         }
 
-        // Add chunk's hash to result so far
-        hash[0] += a;
-        hash[1] += b;
-        hash[2] += c;
-        hash[3] += d;
+        if (remaining > 0) memmove(stream->input, compData + consumed, remaining);
+        stream->inputSize = remaining;
     }
+    else
+    {
+        int chunkSize = stream->chunkSize;
+        int fill = 0;           // Data used to complete pending chunk
+        int fullSize = 0;       // Data compressed directly from provided data (full chunks)
 
-    RL_FREE(msg);
-
-    return hash;
-}
+        if ((stream->inputSize + dataSize) >= chunkSize)
+        {
+            if (stream->inputSize > 0) fill = chunkSize - stream->inputSize;
+            fullSize = ((dataSize - fill)/chunkSize)*chunkSize;
+        }
 
-// Compute SHA-1 hash code
-// NOTE: Returns a static int[5] array (20 bytes)
-unsigned int *RaylibComputeSHA1(unsigned char *data, int dataSize) {
-    #define ROTATE_LEFT(x, c) (((x) << (c)) | ((x) >> (32 - (c))))
+        int chunkCount = ((fill > 0)? 1 : 0) + fullSize/chunkSize;
+        int capacity = chunkCount*(COMPRESSION_CHUNK_HEADER_SIZE + sdefl_bound(chunkSize));
 
-    static unsigned int hash[5] = { 0 };  // Hash to be returned
+        if (capacity > stream->outputCapacity)
+        {
+            RL_FREE(stream->output);
+            stream->output = (unsigned char *)RL_MALLOC(capacity);
+            stream->outputCapacity = (stream->output != NULL)? capacity : 0;
 
-    // Initialize hash values
-    hash[0] = 0x67452301;
-    hash[1] = 0xEFCDAB89;
-    hash[2] = 0x98BADCFE;
-    hash[3] = 0x10325476;
-    hash[4] = 0xC3D2E1F0;
-
-    // Pre-processing: adding a single 1 bit
-    // Append '1' bit to message
-    // NOTE: The input bytes are considered as bits strings,
-    // where the first bit is the most significant bit of the byte
-
-    // Pre-processing: padding with zeros
-    // Append '0' bit until message length in bit 448 (mod 512)
-    // Append length mod (2 pow 64) to message
-
-    int newDataSize = ((((dataSize + 8)/64) + 1)*64);
-
-    unsigned char *msg = RL_CALLOC(newDataSize, 1); // Initialize with '0' bits
-    memcpy(msg, data, dataSize);
-    msg[dataSize] = 128; // Write the '1' bit
-
-    unsigned int bitsLen = 8*dataSize;
-    msg[newDataSize-1] = bitsLen;
-
-    // Process the message in successive 512-bit chunks
-    for (int offset = 0; offset < newDataSize; offset += (512/8))
-    {
-        // Break chunk into sixteen 32-bit words w[j], 0 <= j <= 15
-        unsigned int w[80] = {0};
-        for (int i = 0; i < 16; i++) {
-            w[i] = (msg[offset + (i * 4) + 0] << 24) |
-                   (msg[offset + (i * 4) + 1] << 16) |
-                   (msg[offset + (i * 4) + 2] << 8) |
-                   (msg[offset + (i * 4) + 3]);
+            if (stream->output == NULL)
+            {
+                RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "SYSTEM: Failed to compress stream, memory could not be allocated");
+                stream->failed = true;
+                return NULL;
+            }
         }
 
-        // Message schedule: extend the sixteen 32-bit words into eighty 32-bit words:
-        for (int i = 16; i < 80; ++i) {
-            w[i] = ROTATE_LEFT(w[i-3] ^ w[i-8] ^ w[i-14] ^ w[i-16], 1);
+        int fillCompSize = 0;
+        int fullCompSize = 0;
+
+        if (fill > 0)
+        {
+            memcpy(stream->input + stream->inputSize, data, fill);
+            fillCompSize = CompressChunks(stream->input, chunkSize, chunkSize, stream->output);
+            stream->inputSize = 0;
         }
 
-        // Initialize hash value for this chunk
-        unsigned int a = hash[0];
-        unsigned int b = hash[1];
-        unsigned int c = hash[2];
-        unsigned int d = hash[3];
-        unsigned int e = hash[4];
+        if ((fullSize > 0) && (fillCompSize >= 0)) fullCompSize = CompressChunks(data + fill, fullSize, chunkSize, stream->output + fillCompSize);
 
-        for (int i = 0; i < 80; i++)
+        if ((fillCompSize < 0) || (fullCompSize < 0))
         {
-            unsigned int f = 0;
-            unsigned int k = 0;
-
-            if (i < 20) {
-                f = (b & c) | ((~b) & d);
-                k = 0x5A827999;
-            } else if (i < 40) {
-                f = b ^ c ^ d;
-                k = 0x6ED9EBA1;
-            } else if (i < 60) {
-                f = (b & c) | (b & d) | (c & d);
-                k = 0x8F1BBCDC;
-            } else {
-                f = b ^ c ^ d;
-                k = 0xCA62C1D6;
-            }
-
-            unsigned int temp = ROTATE_LEFT(a, 5) + f + e + k + w[i];
-            e = d;
-            d = c;
-            c = ROTATE_LEFT(b, 30);
-            b = a;
-            a = temp;
+            RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "SYSTEM: Failed to compress stream, memory could not be allocated");
+            stream->failed = true;
+            return NULL;
         }
 
-        // Add this chunk's hash to result so far
-        hash[0] += a;
-        hash[1] += b;
-        hash[2] += c;
-        hash[3] += d;
-        hash[4] += e;
+        *outputSize = fillCompSize + fullCompSize;
+
+        // Keep remaining data for next chunk
+        if ((dataSize - fill - fullSize) > 0) memcpy(stream->input + stream->inputSize, data + fill + fullSize, dataSize - fill - fullSize);
+        stream->inputSize += dataSize - fill - fullSize;
     }
 
-    free(msg);
+    output = stream->output;
+#endif
 
-    return hash;
+    return output;
 }
 
-//----------------------------------------------------------------------------------
-// Module Functions Definition: Automation Events Recording and Playing
-//----------------------------------------------------------------------------------
-
-// Load automation events list from file, NULL for empty list, capacity = RAYLIB_MAX_AUTOMATION_EVENTS
-RaylibAutomationEventList RaylibLoadAutomationEventList(const char *fileName)
+// Finish compression/decompression stream, returns last output data available
+// NOTE: On compression, last partial chunk is compressed; on decompression, NULL is
+// returned if a partial chunk is pending (truncated data), stream can be reused after finishing
+const unsigned char *RaylibFinishCompressionStream(RaylibCompressionStream *stream, int *outputSize)
 {
-    RaylibAutomationEventList list = { 0 };
+    unsigned char *output = NULL;
+    *outputSize = 0;
 
-    // Allocate and empty automation event list, ready to record new events
-    list.events = (RaylibAutomationEvent *)RL_CALLOC(RAYLIB_MAX_AUTOMATION_EVENTS, sizeof(RaylibAutomationEvent));
-    list.capacity = RAYLIB_MAX_AUTOMATION_EVENTS;
+#if defined(RAYLIB_SUPPORT_COMPRESSION_API)
+    if ((stream == NULL) || stream->failed) return NULL;
 
-#if defined(RAYLIB_SUPPORT_AUTOMATION_EVENTS)
-    if (fileName == NULL) RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "AUTOMATION: New empty events list loaded successfully");
-    else
+    if (stream->decompress)
     {
-        // Load automation events file (binary)
-        /*
-        //int dataSize = 0;
-        //unsigned char *data = RaylibLoadFileData(fileName, &dataSize);
-
-        FILE *raeFile = fopen(fileName, "rb");
-        unsigned char fileId[4] = { 0 };
-
-        fread(fileId, 1, 4, raeFile);
-
-        if ((fileId[0] == 'r') && (fileId[1] == 'A') && (fileId[2] == 'E') && (fileId[1] == ' '))
+        if (stream->inputSize > 0)
         {
-            fread(&eventCount, sizeof(int), 1, raeFile);
-            RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "Events loaded: %i\n", eventCount);
-            fread(events, sizeof(RaylibAutomationEvent), eventCount, raeFile);
+            RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "SYSTEM: Failed to finish decompression stream, data is truncated");
+            stream->inputSize = 0;
+            return NULL;
         }
+    }
+    else if (stream->inputSize > 0)
+    {
+        int capacity = COMPRESSION_CHUNK_HEADER_SIZE + sdefl_bound(stream->inputSize);
 
-        fclose(raeFile);
-        */
-
-        // Load events file (text)
-        //unsigned char *buffer = RaylibLoadFileText(fileName);
-        FILE *raeFile = fopen(fileName, "rt");
-
-        if (raeFile != NULL)
+        if (capacity > stream->outputCapacity)
         {
-            unsigned int counter = 0;
-            char buffer[256] = { 0 };
-            char eventDesc[64] = { 0 };
-
-            fgets(buffer, 256, raeFile);
-
-            while (!feof(raeFile))
-            {
-                switch (buffer[0])
-                {
-                    case 'c': sscanf(buffer, "c %i", &list.count); break;
-                    case 'e':
-                    {
-                        sscanf(buffer, "e %d %d %d %d %d %d %[^\n]s", &list.events[counter].frame, &list.events[counter].type,
-                               &list.events[counter].params[0], &list.events[counter].params[1], &list.events[counter].params[2], &list.events[counter].params[3], eventDesc);
-
-                        counter++;
-                    } break;
-                    default: break;
-                }
-
-                fgets(buffer, 256, raeFile);
-            }
+            RL_FREE(stream->output);
+            stream->output = (unsigned char *)RL_MALLOC(capacity);
+            stream->outputCapacity = (stream->output != NULL)? capacity : 0;
 
-            if (counter != list.count)
+            if (stream->output == NULL)
             {
-                RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "AUTOMATION: Events read from file [%i] do not mach event count specified [%i]", counter, list.count);
-                list.count = counter;
+                RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "SYSTEM: Failed to compress stream, memory could not be allocated");
+                stream->failed = true;
+                return NULL;
             }
+        }
 
-            fclose(raeFile);
+        *outputSize = CompressChunks(stream->input, stream->inputSize, stream->chunkSize, stream->output);
+        stream->inputSize = 0;
 
-            RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "AUTOMATION: Events file loaded successfully");
+        if (*outputSize < 0)
+        {
+            RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "SYSTEM: Failed to finish compression stream, memory could not be allocated");
+            *outputSize = 0;
+            return NULL;
         }
-
-        RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "AUTOMATION: Events loaded from file: %i", list.count);
     }
-#endif
-    return list;
-}
 
-// Unload automation events list from file
-void RaylibUnloadAutomationEventList(RaylibAutomationEventList list)
-{
-#if defined(RAYLIB_SUPPORT_AUTOMATION_EVENTS)
-    RL_FREE(list.events);
+    output = stream->output;
 #endif
+
+    return output;
 }
 
-// Export automation events list as text file
-bool RaylibExportAutomationEventList(RaylibAutomationEventList list, const char *fileName)
+// Encode data to Base64 string
+char *RaylibEncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize)
 {
-    bool success = false;
+    static const unsigned char base64encodeTable[] = {
+        'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',
+        'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+        'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'
+    };
 
-#if defined(RAYLIB_SUPPORT_AUTOMATION_EVENTS)
-    // Export events as binary file
-    // TODO: Save to memory buffer and RaylibSaveFileData()
-    /*
-    unsigned char fileId[4] = "rAE ";
-    FILE *raeFile = fopen(fileName, "wb");
-    fwrite(fileId, sizeof(unsigned char), 4, raeFile);
-    fwrite(&eventCount, sizeof(int), 1, raeFile);
-    fwrite(events, sizeof(RaylibAutomationEvent), eventCount, raeFile);
-    fclose(raeFile);
-    */
+    static const int modTable[] = { 0, 2, 1 };
 
-    // Export events as text
-    // TODO: Save to memory buffer and RaylibSaveFileText()
-    char *txtData = (char *)RL_CALLOC(256*list.count + 2048, sizeof(char)); // 256 characters per line plus some header
+    *outputSize = 4*((dataSize + 2)/3);
 
-    int byteCount = 0;
-    byteCount += sprintf(txtData + byteCount, "#\n");
-    byteCount += sprintf(txtData + byteCount, "# Automation events exporter v1.0 - raylib automation events list\n");
-    byteCount += sprintf(txtData + byteCount, "#\n");
-    byteCount += sprintf(txtData + byteCount, "#    c <events_count>\n");
-    byteCount += sprintf(txtData + byteCount, "#    e <frame> <event_type> <param0> <param1> <param2> <param3> // <event_type_name>\n");
-    byteCount += sprintf(txtData + byteCount, "#\n");
-    byteCount += sprintf(txtData + byteCount, "# more info and bugs-report:  github.com/raysan5/raylib\n");
-    byteCount += sprintf(txtData + byteCount, "# feedback and support:       ray[at]raylib.com\n");
-    byteCount += sprintf(txtData + byteCount, "#\n");
-    byteCount += sprintf(txtData + byteCount, "# Copyright (c) 2023-2024 Ramon Santamaria (@raysan5)\n");
-    byteCount += sprintf(txtData + byteCount, "#\n\n");
+    char *encodedData = (char *)RL_MALLOC(*outputSize);
 
-    // Add events data
-    byteCount += sprintf(txtData + byteCount, "c %i\n", list.count);
-    for (unsigned int i = 0; i < list.count; i++)
+    if (encodedData == NULL) return NULL;   // Security check
+
+    for (int i = 0, j = 0; i < dataSize;)
     {
-        byteCount += snprintf(txtData + byteCount, 256, "e %i %i %i %i %i %i // Event: %s\n", list.events[i].frame, list.events[i].type,
-            list.events[i].params[0], list.events[i].params[1], list.events[i].params[2], list.events[i].params[3], autoEventTypeName[list.events[i].type]);
-    }
+        unsigned int octetA = (i < dataSize)? (unsigned char)data[i++] : 0;
+        unsigned int octetB = (i < dataSize)? (unsigned char)data[i++] : 0;
+        unsigned int octetC = (i < dataSize)? (unsigned char)data[i++] : 0;
 
-    // NOTE: Text data size exported is determined by '\0' (NULL) character
-    success = RaylibSaveFileText(fileName, txtData);
+        unsigned int triple = (octetA << 0x10) + (octetB << 0x08) + octetC;
 
-    RL_FREE(txtData);
-#endif
+        encodedData[j++] = base64encodeTable[(triple >> 3*6) & 0x3F];
+        encodedData[j++] = base64encodeTable[(triple >> 2*6) & 0x3F];
+        encodedData[j++] = base64encodeTable[(triple >> 1*6) & 0x3F];
+        encodedData[j++] = base64encodeTable[(triple >> 0*6) & 0x3F];
+    }
 
-    return success;
+    for (int i = 0; i < modTable[dataSize%3]; i++) encodedData[*outputSize - 1 - i] = '=';  // Padding character
+
+    return encodedData;
 }
 
-// Setup automation event list to record to
-void RaylibSetAutomationEventList(RaylibAutomationEventList *list)
-{
-#if defined(RAYLIB_SUPPORT_AUTOMATION_EVENTS)
-    currentEventList = list;
-#endif
+// Decode Base64 string data
+unsigned char *RaylibDecodeDataBase64(const unsigned char *data, int *outputSize)
+{
+    static const unsigned char base64decodeTable[] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 62, 0, 0, 0, 63, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+        11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 0, 0, 0, 0, 0, 0, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+        37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51
+    };
+
+    // Get output size of Base64 input data
+    int outSize = 0;
+    for (int i = 0; data[4*i] != 0; i++)
+    {
+        if (data[4*i + 3] == '=')
+        {
+            if (data[4*i + 2] == '=') outSize += 1;
+            else outSize += 2;
+        }
+        else outSize += 3;
+    }
+
+    // Allocate memory to store decoded Base64 data
+    unsigned char *decodedData = (unsigned char *)RL_MALLOC(outSize);
+
+    for (int i = 0; i < outSize/3; i++)
+    {
+        unsigned char a = base64decodeTable[(int)data[4*i]];
+        unsigned char b = base64decodeTable[(int)data[4*i + 1]];
+        unsigned char c = base64decodeTable[(int)data[4*i + 2]];
+        unsigned char d = base64decodeTable[(int)data[4*i + 3]];
+
+        decodedData[3*i] = (a << 2) | (b >> 4);
+        decodedData[3*i + 1] = (b << 4) | (c >> 2);
+        decodedData[3*i + 2] = (c << 6) | d;
+    }
+
+    if (outSize%3 == 1)
+    {
+        int n = outSize/3;
+        unsigned char a = base64decodeTable[(int)data[4*n]];
+        unsigned char b = base64decodeTable[(int)data[4*n + 1]];
+        decodedData[outSize - 1] = (a << 2) | (b >> 4);
+    }
+    else if (outSize%3 == 2)
+    {
+        int n = outSize/3;
+        unsigned char a = base64decodeTable[(int)data[4*n]];
+        unsigned char b = base64decodeTable[(int)data[4*n + 1]];
+        unsigned char c = base64decodeTable[(int)data[4*n + 2]];
+        decodedData[outSize - 2] = (a << 2) | (b >> 4);
+        decodedData[outSize - 1] = (b << 4) | (c >> 2);
+    }
+
+    *outputSize = outSize;
+    return decodedData;
 }
 
-// Set automation event internal base frame to start recording
-void RaylibSetAutomationEventBaseFrame(int frame)
+// Compute CRC32 hash code
+unsigned int RaylibComputeCRC32(unsigned char *data, int dataSize)
 {
-    CORE.Time.frameCounter = frame;
+    return RaylibUpdateCRC32(0, data, dataSize);
 }
 
-// Start recording automation events (RaylibAutomationEventList must be set)
-void RaylibStartAutomationEventRecording(void)
+// Update CRC32 hash code with new data, start with crc = 0
+// NOTE: Returned value is the CRC32 of all data provided so far (finalized), it can be updated again with more data,
+// data is processed 8 bytes at a time using 8 lookup tables (slicing-by-8)
+unsigned int RaylibUpdateCRC32(unsigned int crc, const unsigned char *data, int dataSize)
 {
-#if defined(RAYLIB_SUPPORT_AUTOMATION_EVENTS)
-    automationEventRecording = true;
-#endif
+    crc = ~crc;
+
+    // Process data 8 bytes at a time
+    for (; dataSize >= 8; dataSize -= 8, data += 8)
+    {
+        unsigned int low = crc ^ (data[0] | (data[1] << 8) | (data[2] << 16) | ((unsigned int)data[3] << 24));
+        unsigned int high = data[4] | (data[5] << 8) | (data[6] << 16) | ((unsigned int)data[7] << 24);
+
+        crc = crcTables[7][low & 0xff] ^ crcTables[6][(low >> 8) & 0xff] ^ crcTables[5][(low >> 16) & 0xff] ^ crcTables[4][low >> 24] ^
+              crcTables[3][high & 0xff] ^ crcTables[2][(high >> 8) & 0xff] ^ crcTables[1][(high >> 16) & 0xff] ^ crcTables[0][high >> 24];
+    }
+
+    for (int i = 0; i < dataSize; i++) crc = (crc >> 8) ^ crcTables[0][data[i] ^ (crc & 0xff)];
+
+    return ~crc;
 }
 
-// Stop recording automation events
-void RaylibStopAutomationEventRecording(void)
+// Compute MD5 hash code
+// NOTE: Returns a static int[4] array (16 bytes)
+unsigned int *RaylibComputeMD5(unsigned char *data, int dataSize)
 {
-#if defined(RAYLIB_SUPPORT_AUTOMATION_EVENTS)
-    automationEventRecording = false;
-#endif
+    static unsigned int hash[4] = { 0 };  // Hash to be returned
+
+    RaylibHashState state = { 0 };
+    RaylibInitHashMD5(&state);
+    RaylibUpdateHashMD5(&state, data, dataSize);
+    RaylibFinishHashMD5(&state, hash);
+
+    return hash;
 }
 
-// Play a recorded automation event
-void RaylibPlayAutomationEvent(RaylibAutomationEvent event)
+// Compute SHA-1 hash code
+// NOTE: Returns a static int[5] array (20 bytes)
+unsigned int *RaylibComputeSHA1(unsigned char *data, int dataSize)
 {
-#if defined(RAYLIB_SUPPORT_AUTOMATION_EVENTS)
-    // WARNING: When should event be played? After/before/replace RaylibPollInputEvents()? -> Up to the user!
+    static unsigned int hash[5] = { 0 };  // Hash to be returned
 
-    if (!automationEventRecording)      // TODO: Allow recording events while playing?
+    RaylibHashState state = { 0 };
+    RaylibInitHashSHA1(&state);
+    RaylibUpdateHashSHA1(&state, data, dataSize);
+    RaylibFinishHashSHA1(&state, hash);
+
+    return hash;
+}
+
+// Init hash state for incremental MD5 hash computation
+void RaylibInitHashMD5(RaylibHashState *state)
+{
+    memset(state, 0, sizeof(RaylibHashState));
+
+    state->hash[0] = 0x67452301;
+    state->hash[1] = 0xefcdab89;
+    state->hash[2] = 0x98badcfe;
+    state->hash[3] = 0x10325476;
+}
+
+// Update MD5 hash state with new data
+void RaylibUpdateHashMD5(RaylibHashState *state, const unsigned char *data, int dataSize)
+{
+    UpdateHashState(state, data, dataSize, HashBlockMD5);
+}
+
+// Finish MD5 hash computation, hash code written to int[4] array (16 bytes)
+// NOTE: Hash state must be initialized again to compute a new hash
+void RaylibFinishHashMD5(RaylibHashState *state, unsigned int *hash)
+{
+    // Append length in bits at the end of the padded message, little endian
+    unsigned long long bitsLength = state->dataSize*8;
+    unsigned char length[8] = { 0 };
+    for (int i = 0; i < 8; i++) length[i] = (unsigned char)(bitsLength >> (8*i));
+
+    FinishHashState(state, length, HashBlockMD5);
+
+    for (int i = 0; i < 4; i++) hash[i] = state->hash[i];
+}
+
+// Init hash state for incremental SHA-1 hash computation
+void RaylibInitHashSHA1(RaylibHashState *state)
+{
+    memset(state, 0, sizeof(RaylibHashState));
+
+    state->hash[0] = 0x67452301;
+    state->hash[1] = 0xEFCDAB89;
+    state->hash[2] = 0x98BADCFE;
+    state->hash[3] = 0x10325476;
+    state->hash[4] = 0xC3D2E1F0;
+}
+
+// Update SHA-1 hash state with new data
+void RaylibUpdateHashSHA1(RaylibHashState *state, const unsigned char *data, int dataSize)
+{
+    UpdateHashState(state, data, dataSize, HashBlockSHA1);
+}
+
+// Finish SHA-1 hash computation, hash code written to int[5] array (20 bytes)
+// NOTE: Hash state must be initialized again to compute a new hash
+void RaylibFinishHashSHA1(RaylibHashState *state, unsigned int *hash)
+{
+    // Append length in bits at the end of the padded message, big endian
+    unsigned long long bitsLength = state->dataSize*8;
+    unsigned char length[8] = { 0 };
+    for (int i = 0; i < 8; i++) length[7 - i] = (unsigned char)(bitsLength >> (8*i));
+
+    FinishHashState(state, length, HashBlockSHA1);
+
+    for (int i = 0; i < 5; i++) hash[i] = state->hash[i];
+}
+
+// Compute 64bit hash code, non-cryptographic (xxHash64 algorithm)
+// NOTE: Fast hash intended for content identification (i.e. caching), not for security
+unsigned long long RaylibComputeXXH64(const unsigned char *data, int dataSize, unsigned long long seed)
+{
+    #define XXH64_PRIME1 0x9E3779B185EBCA87ULL
+    #define XXH64_PRIME2 0xC2B2AE3D27D4EB4FULL
+    #define XXH64_PRIME3 0x165667B19E3779F9ULL
+    #define XXH64_PRIME4 0x85EBCA77C2B2AE63ULL
+    #define XXH64_PRIME5 0x27D4EB2F165667C5ULL
+    #define ROTATE_LEFT64(x, c) (((x) << (c)) | ((x) >> (64 - (c))))
+
+    const unsigned char *end = data + dataSize;
+    unsigned long long hash = 0;
+
+    if (dataSize >= 32)
     {
-        switch (event.type)
-        {
-            // Input event
-            case INPUT_KEY_UP: CORE.Input.Keyboard.currentKeyState[event.params[0]] = false; break;             // param[0]: key
-            case INPUT_KEY_DOWN: {                                                                              // param[0]: key
-                CORE.Input.Keyboard.currentKeyState[event.params[0]] = true;
+        unsigned long long v[4] = { seed + XXH64_PRIME1 + XXH64_PRIME2, seed + XXH64_PRIME2, seed, seed - XXH64_PRIME1 };
 
-                if (CORE.Input.Keyboard.previousKeyState[event.params[0]] == false)
-                {
-                    if (CORE.Input.Keyboard.keyPressedQueueCount < RAYLIB_MAX_KEY_PRESSED_QUEUE)
-                    {
-                        // Add character to the queue
-                        CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount] = event.params[0];
-                        CORE.Input.Keyboard.keyPressedQueueCount++;
-                    }
-                }
-            } break;
-            case INPUT_MOUSE_BUTTON_UP: CORE.Input.Mouse.currentButtonState[event.params[0]] = false; break;    // param[0]: key
-            case INPUT_MOUSE_BUTTON_DOWN: CORE.Input.Mouse.currentButtonState[event.params[0]] = true; break;   // param[0]: key
-            case INPUT_MOUSE_POSITION:      // param[0]: x, param[1]: y
-            {
-                CORE.Input.Mouse.currentPosition.x = (float)event.params[0];
-                CORE.Input.Mouse.currentPosition.y = (float)event.params[1];
-            } break;
-            case INPUT_MOUSE_WHEEL_MOTION:  // param[0]: x delta, param[1]: y delta
-            {
-                CORE.Input.Mouse.currentWheelMove.x = (float)event.params[0];
-                CORE.Input.Mouse.currentWheelMove.y = (float)event.params[1];
-            } break;
-            case INPUT_TOUCH_UP: CORE.Input.Touch.currentTouchState[event.params[0]] = false; break;            // param[0]: id
-            case INPUT_TOUCH_DOWN: CORE.Input.Touch.currentTouchState[event.params[0]] = true; break;           // param[0]: id
-            case INPUT_TOUCH_POSITION:      // param[0]: id, param[1]: x, param[2]: y
-            {
-                CORE.Input.Touch.position[event.params[0]].x = (float)event.params[1];
-                CORE.Input.Touch.position[event.params[0]].y = (float)event.params[2];
-            } break;
-            case INPUT_GAMEPAD_CONNECT: CORE.Input.Gamepad.ready[event.params[0]] = true; break;                // param[0]: gamepad
-            case INPUT_GAMEPAD_DISCONNECT: CORE.Input.Gamepad.ready[event.params[0]] = false; break;            // param[0]: gamepad
-            case INPUT_GAMEPAD_BUTTON_UP: CORE.Input.Gamepad.currentButtonState[event.params[0]][event.params[1]] = false; break;    // param[0]: gamepad, param[1]: button
-            case INPUT_GAMEPAD_BUTTON_DOWN: CORE.Input.Gamepad.currentButtonState[event.params[0]][event.params[1]] = true; break;   // param[0]: gamepad, param[1]: button
-            case INPUT_GAMEPAD_AXIS_MOTION: // param[0]: gamepad, param[1]: axis, param[2]: delta
+        // Process data in 32 bytes stripes, 4 independent lanes
+        for (; (end - data) >= 32; data += 32)
+        {
+            for (int i = 0; i < 4; i++)
             {
-                CORE.Input.Gamepad.axisState[event.params[0]][event.params[1]] = ((float)event.params[2]/32768.0f);
-            } break;
-    #if defined(RAYLIB_SUPPORT_GESTURES_SYSTEM)
-            case INPUT_GESTURE: GESTURES.current = event.params[0]; break;     // param[0]: gesture (enum RaylibGesture) -> rgestures.h: GESTURES.current
-    #endif
-            // Window event
-            case WINDOW_CLOSE: CORE.Window.shouldClose = true; break;
-            case WINDOW_MAXIMIZE: RaylibMaximizeWindow(); break;
-            case WINDOW_MINIMIZE: RaylibMinimizeWindow(); break;
-            case WINDOW_RESIZE: RaylibSetWindowSize(event.params[0], event.params[1]); break;
+                v[i] += ReadLittleEndian64(data + 8*i)*XXH64_PRIME2;
+                v[i] = ROTATE_LEFT64(v[i], 31)*XXH64_PRIME1;
+            }
+        }
 
-            // Custom event
-    #if defined(RAYLIB_SUPPORT_SCREEN_CAPTURE)
-            case ACTION_TAKE_SCREENSHOT:
-            {
-                RaylibTakeScreenshot(RaylibTextFormat("screenshot%03i.png", screenshotCounter));
-                screenshotCounter++;
-            } break;
-    #endif
-            case ACTION_SETTARGETFPS: RaylibSetTargetFPS(event.params[0]); break;
-            default: break;
+        hash = ROTATE_LEFT64(v[0], 1) + ROTATE_LEFT64(v[1], 7) + ROTATE_LEFT64(v[2], 12) + ROTATE_LEFT64(v[3], 18);
+
+        for (int i = 0; i < 4; i++)
+        {
+            v[i] *= XXH64_PRIME2;
+            hash ^= ROTATE_LEFT64(v[i], 31)*XXH64_PRIME1;
+            hash = hash*XXH64_PRIME1 + XXH64_PRIME4;
         }
+    }
+    else hash = seed + XXH64_PRIME5;
 
-        RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "AUTOMATION PLAY: Frame: %i | Event type: %i | Event parameters: %i, %i, %i", event.frame, event.type, event.params[0], event.params[1], event.params[2]);
+    hash += (unsigned long long)dataSize;
+
+    // Process remaining data (less than 32 bytes)
+    for (; (end - data) >= 8; data += 8)
+    {
+        unsigned long long k = ReadLittleEndian64(data)*XXH64_PRIME2;
+        hash ^= ROTATE_LEFT64(k, 31)*XXH64_PRIME1;
+        hash = ROTATE_LEFT64(hash, 27)*XXH64_PRIME1 + XXH64_PRIME4;
     }
-#endif
+
+    if ((end - data) >= 4)
+    {
+        unsigned long long k = data[0] | (data[1] << 8) | (data[2] << 16) | ((unsigned int)data[3] << 24);
+        hash ^= k*XXH64_PRIME1;
+        hash = ROTATE_LEFT64(hash, 23)*XXH64_PRIME2 + XXH64_PRIME3;
+        data += 4;
+    }
+
+    for (; data < end; data++)
+    {
+        hash ^= (*data)*XXH64_PRIME5;
+        hash = ROTATE_LEFT64(hash, 11)*XXH64_PRIME1;
+    }
+
+    // Final mix (avalanche)
+    hash ^= hash >> 33;
+    hash *= XXH64_PRIME2;
+    hash ^= hash >> 29;
+    hash *= XXH64_PRIME3;
+    hash ^= hash >> 32;
+
+    return hash;
 }
 
 //----------------------------------------------------------------------------------
-// Module Functions Definition: Input Handling: Keyboard
+// Module Functions Definition: Automation Events Recording and Playing
 //----------------------------------------------------------------------------------
 
-// Check if a key has been pressed once
-bool RaylibIsKeyPressed(int key)
+// Load automation events list from file, NULL for empty list, capacity = RAYLIB_MAX_AUTOMATION_EVENTS
+RaylibAutomationEventList RaylibLoadAutomationEventList(const char *fileName)
+{
+    RaylibAutomationEventList list = { 0 };
+
+    // Allocate and empty automation event list, ready to record new events
+    list.events = (RaylibAutomationEvent *)RL_CALLOC(RAYLIB_MAX_AUTOMATION_EVENTS, sizeof(RaylibAutomationEvent));
+    list.capacity = RAYLIB_MAX_AUTOMATION_EVENTS;
+
+#if defined(RAYLIB_SUPPORT_AUTOMATION_EVENTS)
+    if (fileName == NULL) RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "AUTOMATION: New empty events list loaded successfully");
+    else
+    {
+        // Load automation events file (binary)
+        /*
+        //int dataSize = 0;
+        //unsigned char *data = RaylibLoadFileData(fileName, &dataSize);
+
+        FILE *raeFile = fopen(fileName, "rb");
+        unsigned char fileId[4] = { 0 };
+
+        fread(fileId, 1, 4, raeFile);
+
+        if ((fileId[0] == 'r') && (fileId[1] == 'A') && (fileId[2] == 'E') && (fileId[1] == ' '))
+        {
+            fread(&eventCount, sizeof(int), 1, raeFile);
+            RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "Events loaded: %i\n", eventCount);
+            fread(events, sizeof(RaylibAutomationEvent), eventCount, raeFile);
+        }
+
+        fclose(raeFile);
+        */
+
+        // Load events file (text)
+        //unsigned char *buffer = RaylibLoadFileText(fileName);
+        FILE *raeFile = fopen(fileName, "rt");
+
+        if (raeFile != NULL)
+        {
+            unsigned int counter = 0;
+            char buffer[256] = { 0 };
+            char eventDesc[64] = { 0 };
+
+            fgets(buffer, 256, raeFile);
+
+            while (!feof(raeFile))
+            {
+                switch (buffer[0])
+                {
+                    case 'c': sscanf(buffer, "c %i", &list.count); break;
+                    case 'e':
+                    {
+                        sscanf(buffer, "e %d %d %d %d %d %d %[^\n]s", &list.events[counter].frame, &list.events[counter].type,
+                               &list.events[counter].params[0], &list.events[counter].params[1], &list.events[counter].params[2], &list.events[counter].params[3], eventDesc);
+
+                        counter++;
+                    } break;
+                    default: break;
+                }
+
+                fgets(buffer, 256, raeFile);
+            }
+
+            if (counter != list.count)
+            {
+                RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "AUTOMATION: Events read from file [%i] do not mach event count specified [%i]", counter, list.count);
+                list.count = counter;
+            }
+
+            fclose(raeFile);
+
+            RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "AUTOMATION: Events file loaded successfully");
+        }
+
+        RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "AUTOMATION: Events loaded from file: %i", list.count);
+    }
+#endif
+    return list;
+}
+
+// Unload automation events list from file
+void RaylibUnloadAutomationEventList(RaylibAutomationEventList list)
+{
+#if defined(RAYLIB_SUPPORT_AUTOMATION_EVENTS)
+    RL_FREE(list.events);
+#endif
+}
+
+// Export automation events list as text file
+bool RaylibExportAutomationEventList(RaylibAutomationEventList list, const char *fileName)
+{
+    bool success = false;
+
+#if defined(RAYLIB_SUPPORT_AUTOMATION_EVENTS)
+    // Export events as binary file
+    // TODO: Save to memory buffer and RaylibSaveFileData()
+    /*
+    unsigned char fileId[4] = "rAE ";
+    FILE *raeFile = fopen(fileName, "wb");
+    fwrite(fileId, sizeof(unsigned char), 4, raeFile);
+    fwrite(&eventCount, sizeof(int), 1, raeFile);
+    fwrite(events, sizeof(RaylibAutomationEvent), eventCount, raeFile);
+    fclose(raeFile);
+    */
+
+    // Export events as text
+    // TODO: Save to memory buffer and RaylibSaveFileText()
+    char *txtData = (char *)RL_CALLOC(256*list.count + 2048, sizeof(char)); // 256 characters per line plus some header
+
+    int byteCount = 0;
+    byteCount += sprintf(txtData + byteCount, "#\n");
+    byteCount += sprintf(txtData + byteCount, "# Automation events exporter v1.0 - raylib automation events list\n");
+    byteCount += sprintf(txtData + byteCount, "#\n");
+    byteCount += sprintf(txtData + byteCount, "#    c <events_count>\n");
+    byteCount += sprintf(txtData + byteCount, "#    e <frame> <event_type> <param0> <param1> <param2> <param3> // <event_type_name>\n");
+    byteCount += sprintf(txtData + byteCount, "#\n");
+    byteCount += sprintf(txtData + byteCount, "# more info and bugs-report:  github.com/raysan5/raylib\n");
+    byteCount += sprintf(txtData + byteCount, "# feedback and support:       ray[at]raylib.com\n");
+    byteCount += sprintf(txtData + byteCount, "#\n");
+    byteCount += sprintf(txtData + byteCount, "# Copyright (c) 2023-2024 Ramon Santamaria (@raysan5)\n");
+    byteCount += sprintf(txtData + byteCount, "#\n\n");
+
+    // Add events data
+    byteCount += sprintf(txtData + byteCount, "c %i\n", list.count);
+    for (unsigned int i = 0; i < list.count; i++)
+    {
+        byteCount += snprintf(txtData + byteCount, 256, "e %i %i %i %i %i %i // Event: %s\n", list.events[i].frame, list.events[i].type,
+            list.events[i].params[0], list.events[i].params[1], list.events[i].params[2], list.events[i].params[3], autoEventTypeName[list.events[i].type]);
+    }
+
+    // NOTE: Text data size exported is determined by '\0' (NULL) character
+    success = RaylibSaveFileText(fileName, txtData);
+
+    RL_FREE(txtData);
+#endif
+
+    return success;
+}
+
+// Setup automation event list to record to
+void RaylibSetAutomationEventList(RaylibAutomationEventList *list)
+{
+#if defined(RAYLIB_SUPPORT_AUTOMATION_EVENTS)
+    currentEventList = list;
+#endif
+}
+
+// Set automation event internal base frame to start recording
+void RaylibSetAutomationEventBaseFrame(int frame)
+{
+    CORE.Time.frameCounter = frame;
+}
+
+// Start recording automation events (RaylibAutomationEventList must be set)
+void RaylibStartAutomationEventRecording(void)
+{
+#if defined(RAYLIB_SUPPORT_AUTOMATION_EVENTS)
+    automationEventRecording = true;
+#endif
+}
+
+// Stop recording automation events
+void RaylibStopAutomationEventRecording(void)
+{
+#if defined(RAYLIB_SUPPORT_AUTOMATION_EVENTS)
+    automationEventRecording = false;
+#endif
+}
+
+// Play a recorded automation event
+void RaylibPlayAutomationEvent(RaylibAutomationEvent event)
+{
+#if defined(RAYLIB_SUPPORT_AUTOMATION_EVENTS)
+    // WARNING: When should event be played? After/before/replace RaylibPollInputEvents()? -> Up to the user!
+
+    if (!automationEventRecording)      // TODO: Allow recording events while playing?
+    {
+        switch (event.type)
+        {
+            // Input event
+            case INPUT_KEY_UP: CORE.Input.Keyboard.currentKeyState[event.params[0]] = false; break;             // param[0]: key
+            case INPUT_KEY_DOWN: {                                                                              // param[0]: key
+                CORE.Input.Keyboard.currentKeyState[event.params[0]] = true;
+
+                // Add key pressed to the events queue
+                if (CORE.Input.Keyboard.previousKeyState[event.params[0]] == false) RegisterInputEvent(RAYLIB_INPUT_EVENT_KEY, event.params[0], 1, (RaylibVector2){ 0.0f, 0.0f });
+            } break;
+            case INPUT_MOUSE_BUTTON_UP: CORE.Input.Mouse.currentButtonState[event.params[0]] = false; break;    // param[0]: key
+            case INPUT_MOUSE_BUTTON_DOWN: CORE.Input.Mouse.currentButtonState[event.params[0]] = true; break;   // param[0]: key
+            case INPUT_MOUSE_POSITION:      // param[0]: x, param[1]: y
+            {
+                CORE.Input.Mouse.currentPosition.x = (float)event.params[0];
+                CORE.Input.Mouse.currentPosition.y = (float)event.params[1];
+            } break;
+            case INPUT_MOUSE_WHEEL_MOTION:  // param[0]: x delta, param[1]: y delta
+            {
+                CORE.Input.Mouse.currentWheelMove.x = (float)event.params[0];
+                CORE.Input.Mouse.currentWheelMove.y = (float)event.params[1];
+            } break;
+            case INPUT_TOUCH_UP: CORE.Input.Touch.currentTouchState[event.params[0]] = false; break;            // param[0]: id
+            case INPUT_TOUCH_DOWN: CORE.Input.Touch.currentTouchState[event.params[0]] = true; break;           // param[0]: id
+            case INPUT_TOUCH_POSITION:      // param[0]: id, param[1]: x, param[2]: y
+            {
+                CORE.Input.Touch.position[event.params[0]].x = (float)event.params[1];
+                CORE.Input.Touch.position[event.params[0]].y = (float)event.params[2];
+            } break;
+            case INPUT_GAMEPAD_CONNECT: CORE.Input.Gamepad.ready[event.params[0]] = true; break;                // param[0]: gamepad
+            case INPUT_GAMEPAD_DISCONNECT: CORE.Input.Gamepad.ready[event.params[0]] = false; break;            // param[0]: gamepad
+            case INPUT_GAMEPAD_BUTTON_UP: CORE.Input.Gamepad.currentButtonState[event.params[0]][event.params[1]] = false; break;    // param[0]: gamepad, param[1]: button
+            case INPUT_GAMEPAD_BUTTON_DOWN: CORE.Input.Gamepad.currentButtonState[event.params[0]][event.params[1]] = true; break;   // param[0]: gamepad, param[1]: button
+            case INPUT_GAMEPAD_AXIS_MOTION: // param[0]: gamepad, param[1]: axis, param[2]: delta
+            {
+                CORE.Input.Gamepad.axisState[event.params[0]][event.params[1]] = ((float)event.params[2]/32768.0f);
+            } break;
+    #if defined(RAYLIB_SUPPORT_GESTURES_SYSTEM)
+            case INPUT_GESTURE: GESTURES.current = event.params[0]; break;     // param[0]: gesture (enum RaylibGesture) -> rgestures.h: GESTURES.current
+    #endif
+            // Window event
+            case WINDOW_CLOSE: CORE.Window.shouldClose = true; break;
+            case WINDOW_MAXIMIZE: RaylibMaximizeWindow(); break;
+            case WINDOW_MINIMIZE: RaylibMinimizeWindow(); break;
+            case WINDOW_RESIZE: RaylibSetWindowSize(event.params[0], event.params[1]); break;
+
+            // Custom event
+    #if defined(RAYLIB_SUPPORT_SCREEN_CAPTURE)
+            case ACTION_TAKE_SCREENSHOT:
+            {
+                RaylibTakeScreenshot(RaylibTextFormat("screenshot%03i.png", screenshotCounter));
+                screenshotCounter++;
+            } break;
+    #endif
+            case ACTION_SETTARGETFPS: RaylibSetTargetFPS(event.params[0]); break;
+            default: break;
+        }
+
+        RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "AUTOMATION PLAY: Frame: %i | Event type: %i | Event parameters: %i, %i, %i", event.frame, event.type, event.params[0], event.params[1], event.params[2]);
+    }
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Input Handling: Keyboard
+//----------------------------------------------------------------------------------
+
+// Check if a key has been pressed once
+bool RaylibIsKeyPressed(int key)
+{
+
+    bool pressed = false;
+
+    if ((key > 0) && (key < RAYLIB_MAX_KEYBOARD_KEYS))
+    {
+        if ((CORE.Input.Keyboard.previousKeyState[key] == 0) && (CORE.Input.Keyboard.currentKeyState[key] == 1)) pressed = true;
+    }
+
+    return pressed;
+}
+
+// Check if a key has been pressed again
+bool RaylibIsKeyPressedRepeat(int key)
+{
+    bool repeat = false;
+
+    if ((key > 0) && (key < RAYLIB_MAX_KEYBOARD_KEYS))
+    {
+        if (CORE.Input.Keyboard.keyRepeatInFrame[key] == 1) repeat = true;
+    }
+
+    return repeat;
+}
+
+// Check if a key is being pressed (key held down)
+bool RaylibIsKeyDown(int key)
+{
+    bool down = false;
+
+    if ((key > 0) && (key < RAYLIB_MAX_KEYBOARD_KEYS))
+    {
+        if (CORE.Input.Keyboard.currentKeyState[key] == 1) down = true;
+    }
+
+    return down;
+}
+
+// Check if a key has been released once
+bool RaylibIsKeyReleased(int key)
+{
+    bool released = false;
+
+    if ((key > 0) && (key < RAYLIB_MAX_KEYBOARD_KEYS))
+    {
+        if ((CORE.Input.Keyboard.previousKeyState[key] == 1) && (CORE.Input.Keyboard.currentKeyState[key] == 0)) released = true;
+    }
+
+    return released;
+}
+
+// Check if a key is NOT being pressed (key not held down)
+bool RaylibIsKeyUp(int key)
+{
+    bool up = false;
+
+    if ((key > 0) && (key < RAYLIB_MAX_KEYBOARD_KEYS))
+    {
+        if (CORE.Input.Keyboard.currentKeyState[key] == 0) up = true;
+    }
+
+    return up;
+}
+
+// Get the last key pressed
+// NOTE: Key pressed events are taken from the input events queue, every event is checked only once
+int RaylibGetKeyPressed(void)
+{
+    int value = 0;
+    InputEventQueue *queue = &CORE.Input.events;
+
+    INPUT_EVENTS_LOCK();
+
+    for (; (value == 0) && (queue->keyHead != queue->tail); queue->keyHead++)
+    {
+        RaylibInputEvent *event = &queue->events[queue->keyHead & (queue->capacity - 1)];
+
+        if ((event->type == RAYLIB_INPUT_EVENT_KEY) && (event->action == 1)) value = event->code;
+    }
+
+    INPUT_EVENTS_UNLOCK();
+
+    return value;
+}
+
+// Get the last char pressed
+// NOTE: Char events are taken from the input events queue, every event is checked only once
+int RaylibGetCharPressed(void)
+{
+    int value = 0;
+    InputEventQueue *queue = &CORE.Input.events;
+
+    INPUT_EVENTS_LOCK();
+
+    for (; (value == 0) && (queue->charHead != queue->tail); queue->charHead++)
+    {
+        RaylibInputEvent *event = &queue->events[queue->charHead & (queue->capacity - 1)];
+
+        if (event->type == RAYLIB_INPUT_EVENT_CHAR) value = event->code;
+    }
+
+    INPUT_EVENTS_UNLOCK();
+
+    return value;
+}
+
+// Set a custom key to exit program
+// NOTE: default exitKey is set to ESCAPE
+void RaylibSetExitKey(int key)
+{
+    CORE.Input.Keyboard.exitKey = key;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Input Handling: Gamepad
+//----------------------------------------------------------------------------------
+
+// NOTE: Functions with a platform-specific implementation on rcore_<platform>.c
+//int RaylibSetGamepadMappings(const char *mappings)
+
+// Check if a gamepad is available
+bool RaylibIsGamepadAvailable(int gamepad)
+{
+    bool result = false;
+
+    if ((gamepad < RAYLIB_MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad]) result = true;
+
+    return result;
+}
+
+// Get gamepad internal name id
+const char *RaylibGetGamepadName(int gamepad)
+{
+    return CORE.Input.Gamepad.name[gamepad];
+}
+
+// Check if a gamepad button has been pressed once
+bool RaylibIsGamepadButtonPressed(int gamepad, int button)
+{
+    bool pressed = false;
+
+    if ((gamepad < RAYLIB_MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad] && (button < RAYLIB_MAX_GAMEPAD_BUTTONS) &&
+        (CORE.Input.Gamepad.previousButtonState[gamepad][button] == 0) && (CORE.Input.Gamepad.currentButtonState[gamepad][button] == 1)) pressed = true;
+
+    return pressed;
+}
+
+// Check if a gamepad button is being pressed
+bool RaylibIsGamepadButtonDown(int gamepad, int button)
+{
+    bool down = false;
+
+    if ((gamepad < RAYLIB_MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad] && (button < RAYLIB_MAX_GAMEPAD_BUTTONS) &&
+        (CORE.Input.Gamepad.currentButtonState[gamepad][button] == 1)) down = true;
+
+    return down;
+}
+
+// Check if a gamepad button has NOT been pressed once
+bool RaylibIsGamepadButtonReleased(int gamepad, int button)
+{
+    bool released = false;
+
+    if ((gamepad < RAYLIB_MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad] && (button < RAYLIB_MAX_GAMEPAD_BUTTONS) &&
+        (CORE.Input.Gamepad.previousButtonState[gamepad][button] == 1) && (CORE.Input.Gamepad.currentButtonState[gamepad][button] == 0)) released = true;
+
+    return released;
+}
+
+// Check if a gamepad button is NOT being pressed
+bool RaylibIsGamepadButtonUp(int gamepad, int button)
+{
+    bool up = false;
+
+    if ((gamepad < RAYLIB_MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad] && (button < RAYLIB_MAX_GAMEPAD_BUTTONS) &&
+        (CORE.Input.Gamepad.currentButtonState[gamepad][button] == 0)) up = true;
+
+    return up;
+}
+
+// Get the last gamepad button pressed
+int RaylibGetGamepadButtonPressed(void)
+{
+    return CORE.Input.Gamepad.lastButtonPressed;
+}
+
+// Get gamepad axis count
+int RaylibGetGamepadAxisCount(int gamepad)
+{
+    return CORE.Input.Gamepad.axisCount[gamepad];
+}
+
+// Get axis movement vector for a gamepad
+float RaylibGetGamepadAxisMovement(int gamepad, int axis)
+{
+    float value = (axis == RAYLIB_GAMEPAD_AXIS_LEFT_TRIGGER || axis == RAYLIB_GAMEPAD_AXIS_RIGHT_TRIGGER)? -1.0f : 0.0f;
+
+    if ((gamepad < RAYLIB_MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad] && (axis < RAYLIB_MAX_GAMEPAD_AXIS)) {
+        float movement = value < 0.0f ? CORE.Input.Gamepad.axisState[gamepad][axis] : fabsf(CORE.Input.Gamepad.axisState[gamepad][axis]);
+
+        if (movement > value) value = CORE.Input.Gamepad.axisState[gamepad][axis];
+    }
+
+    return value;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Input Handling: Mouse
+//----------------------------------------------------------------------------------
+
+// NOTE: Functions with a platform-specific implementation on rcore_<platform>.c
+//void RaylibSetMousePosition(int x, int y)
+//void RaylibSetMouseCursor(int cursor)
+
+// Check if a mouse button has been pressed once
+bool RaylibIsMouseButtonPressed(int button)
+{
+    bool pressed = false;
+
+    if ((CORE.Input.Mouse.currentButtonState[button] == 1) && (CORE.Input.Mouse.previousButtonState[button] == 0)) pressed = true;
+
+    // Map touches to mouse buttons checking
+    if ((CORE.Input.Touch.currentTouchState[button] == 1) && (CORE.Input.Touch.previousTouchState[button] == 0)) pressed = true;
+
+    return pressed;
+}
+
+// Improved version using a queue to catch events happening between to calls to PollInputEvents()
+bool RaylibHasMouseButtonBeenDown(int button)
+{
+    bool pressed = false;
+    InputEventQueue *queue = &CORE.Input.events;
+
+    INPUT_EVENTS_LOCK();
+
+    // Check mouse button events registered since last RaylibClearEventQueue() call
+    for (unsigned int i = queue->mouseHead; i != queue->mouseTail; i++)
+    {
+        RaylibInputEvent *event = &queue->mouseButtons[i & (RAYLIB_MAX_MOUSE_BUTTON_EVENTS - 1)];
+
+        if ((event->code == button) && (event->action == 1))
+        {
+            pressed = true;
+            CORE.Input.Mouse.previousButtonState[button] = 1;
+        }
+    }
+
+    INPUT_EVENTS_UNLOCK();
+
+    return pressed;
+}
+
+void RaylibClearEventQueue()
+{
+    INPUT_EVENTS_LOCK();
+    CORE.Input.events.mouseHead = CORE.Input.events.mouseTail;
+    INPUT_EVENTS_UNLOCK();
+}
+
+// Check if a mouse button is being pressed
+bool RaylibIsMouseButtonDown(int button)
+{
+    bool down = false;
+
+    if (CORE.Input.Mouse.currentButtonState[button] == 1) down = true;
+
+    // NOTE: Touches are considered like mouse buttons
+    if (CORE.Input.Touch.currentTouchState[button] == 1) down = true;
+
+    return down;
+}
+
+// Check if a mouse button has been released once
+bool RaylibIsMouseButtonReleased(int button)
+{
+    bool released = false;
+    bool pressed = false;
+
+    if ((CORE.Input.Mouse.currentButtonState[button] == 0) && (CORE.Input.Mouse.previousButtonState[button] == 1)) released = true;
+
+    InputEventQueue *queue = &CORE.Input.events;
+
+    INPUT_EVENTS_LOCK();
+
+    // Check mouse button events registered since last RaylibClearEventQueue() call
+    for (unsigned int i = queue->mouseHead; i != queue->mouseTail; i++)
+    {
+        RaylibInputEvent *event = &queue->mouseButtons[i & (RAYLIB_MAX_MOUSE_BUTTON_EVENTS - 1)];
+
+        if (event->code == button)
+        {
+            if (event->action == 1) pressed = true;
+            if (pressed && (event->action == 0)) released = true;
+        }
+    }
+
+    INPUT_EVENTS_UNLOCK();
+
+    if (released) CORE.Input.Mouse.previousButtonState[button] = 0;
+
+    // Map touches to mouse buttons checking
+    if ((CORE.Input.Touch.currentTouchState[button] == 0) && (CORE.Input.Touch.previousTouchState[button] == 1)) released = true;
+
+    return released;
+}
+
+// Check if a mouse button is NOT being pressed
+bool RaylibIsMouseButtonUp(int button)
+{
+    bool up = false;
+
+    if (CORE.Input.Mouse.currentButtonState[button] == 0) up = true;
+
+    // NOTE: Touches are considered like mouse buttons
+    if (CORE.Input.Touch.currentTouchState[button] == 0) up = true;
+	
+	if (up) {
+		CORE.Input.Mouse.previousButtonState[button] = 0;
+	}
+	
+    return up;
+}
+
+// Get mouse position X
+int RaylibGetMouseX(void)
+{
+    int mouseX = (int)((CORE.Input.Mouse.currentPosition.x + CORE.Input.Mouse.offset.x)*CORE.Input.Mouse.scale.x);
+    return mouseX;
+}
+
+// Get mouse position Y
+int RaylibGetMouseY(void)
+{
+    int mouseY = (int)((CORE.Input.Mouse.currentPosition.y + CORE.Input.Mouse.offset.y)*CORE.Input.Mouse.scale.y);
+    return mouseY;
+}
+
+// Get mouse position XY
+RaylibVector2 RaylibGetMousePosition(void)
+{
+    RaylibVector2 position = { 0 };
+
+    position.x = (CORE.Input.Mouse.currentPosition.x + CORE.Input.Mouse.offset.x)*CORE.Input.Mouse.scale.x;
+    position.y = (CORE.Input.Mouse.currentPosition.y + CORE.Input.Mouse.offset.y)*CORE.Input.Mouse.scale.y;
+
+    return position;
+}
+
+// Get mouse delta between frames
+RaylibVector2 RaylibGetMouseDelta(void)
+{
+    RaylibVector2 delta = { 0 };
+
+    delta.x = CORE.Input.Mouse.currentPosition.x - CORE.Input.Mouse.previousPosition.x;
+    delta.y = CORE.Input.Mouse.currentPosition.y - CORE.Input.Mouse.previousPosition.y;
+
+    return delta;
+}
+
+// Set mouse offset
+// NOTE: Useful when rendering to different size targets
+void RaylibSetMouseOffset(int offsetX, int offsetY)
+{
+    CORE.Input.Mouse.offset = (RaylibVector2){ (float)offsetX, (float)offsetY };
+}
+
+// Set mouse scaling
+// NOTE: Useful when rendering to different size targets
+void RaylibSetMouseScale(float scaleX, float scaleY)
+{
+    CORE.Input.Mouse.scale = (RaylibVector2){ scaleX, scaleY };
+}
+
+// Get mouse wheel movement Y
+float RaylibGetMouseWheelMove(void)
+{
+    float result = 0.0f;
+
+    if (fabsf(CORE.Input.Mouse.currentWheelMove.x) > fabsf(CORE.Input.Mouse.currentWheelMove.y)) result = (float)CORE.Input.Mouse.currentWheelMove.x;
+    else result = (float)CORE.Input.Mouse.currentWheelMove.y;
+
+    return result;
+}
+
+// Get mouse wheel movement X/Y as a vector
+RaylibVector2 RaylibGetMouseWheelMoveV(void)
+{
+    RaylibVector2 result = { 0 };
+
+    result = CORE.Input.Mouse.currentWheelMove;
+
+    return result;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Input Handling: Touch
+//----------------------------------------------------------------------------------
+
+// Get touch position X for touch point 0 (relative to screen size)
+int RaylibGetTouchX(void)
+{
+    int touchX = (int)CORE.Input.Touch.position[0].x;
+    return touchX;
+}
+
+// Get touch position Y for touch point 0 (relative to screen size)
+int RaylibGetTouchY(void)
 {
+    int touchY = (int)CORE.Input.Touch.position[0].y;
+    return touchY;
+}
 
-    bool pressed = false;
+// Get touch position XY for a touch point index (relative to screen size)
+// TODO: Touch position should be scaled depending on display size and render size
+RaylibVector2 RaylibGetTouchPosition(int index)
+{
+    RaylibVector2 position = { -1.0f, -1.0f };
 
-    if ((key > 0) && (key < RAYLIB_MAX_KEYBOARD_KEYS))
-    {
-        if ((CORE.Input.Keyboard.previousKeyState[key] == 0) && (CORE.Input.Keyboard.currentKeyState[key] == 1)) pressed = true;
-    }
+    if (index < RAYLIB_MAX_TOUCH_POINTS) position = CORE.Input.Touch.position[index];
+    else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "INPUT: Required touch point out of range (Max touch points: %i)", RAYLIB_MAX_TOUCH_POINTS);
 
-    return pressed;
+    return position;
 }
 
-// Check if a key has been pressed again
-bool RaylibIsKeyPressedRepeat(int key)
+// Get touch point identifier for given index
+int RaylibGetTouchPointId(int index)
 {
-    bool repeat = false;
+    int id = -1;
 
-    if ((key > 0) && (key < RAYLIB_MAX_KEYBOARD_KEYS))
-    {
-        if (CORE.Input.Keyboard.keyRepeatInFrame[key] == 1) repeat = true;
-    }
+    if (index < RAYLIB_MAX_TOUCH_POINTS) id = CORE.Input.Touch.pointId[index];
 
-    return repeat;
+    return id;
 }
 
-// Check if a key is being pressed (key held down)
-bool RaylibIsKeyDown(int key)
+// Get number of touch points
+int RaylibGetTouchPointCount(void)
 {
-    bool down = false;
+    return CORE.Input.Touch.pointCount;
+}
 
-    if ((key > 0) && (key < RAYLIB_MAX_KEYBOARD_KEYS))
-    {
-        if (CORE.Input.Keyboard.currentKeyState[key] == 1) down = true;
-    }
+// Get number of input events registered in current frame (all types)
+int RaylibGetInputEventCount(void)
+{
+    INPUT_EVENTS_LOCK();
+    int count = (int)(CORE.Input.events.tail - CORE.Input.events.frameHead);
+    INPUT_EVENTS_UNLOCK();
 
-    return down;
+    return count;
 }
 
-// Check if a key has been released once
-bool RaylibIsKeyReleased(int key)
+// Get input event registered in current frame, in order of arrival
+// NOTE: Events registered between two PollInputEvents() calls are all kept, event time can be
+// compared with RaylibGetTime() after frame presentation to measure input latency
+RaylibInputEvent RaylibGetInputEvent(int index)
 {
-    bool released = false;
+    RaylibInputEvent event = { 0 };
+    InputEventQueue *queue = &CORE.Input.events;
 
-    if ((key > 0) && (key < RAYLIB_MAX_KEYBOARD_KEYS))
-    {
-        if ((CORE.Input.Keyboard.previousKeyState[key] == 1) && (CORE.Input.Keyboard.currentKeyState[key] == 0)) released = true;
-    }
+    INPUT_EVENTS_LOCK();
+    if ((index >= 0) && ((unsigned int)index < (queue->tail - queue->frameHead))) event = queue->events[(queue->frameHead + index) & (queue->capacity - 1)];
+    INPUT_EVENTS_UNLOCK();
 
-    return released;
+    return event;
 }
 
-// Check if a key is NOT being pressed (key not held down)
-bool RaylibIsKeyUp(int key)
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// NOTE: Functions with a platform-specific implementation on rcore_<platform>.c
+//int InitPlatform(void)
+//void ClosePlatform(void)
+
+// Initialize hi-resolution timer
+void InitTimer(void)
 {
-    bool up = false;
+    // Setting a higher resolution can improve the accuracy of time-out intervals in wait functions
+    // However, it can also reduce overall system performance, because the thread scheduler switches tasks more often
+    // High resolutions can also prevent the CPU power management system from entering power-saving modes
+    // Setting a higher resolution does not improve the accuracy of the high-resolution performance counter
+#if defined(_WIN32) && defined(RAYLIB_SUPPORT_WINMM_HIGHRES_TIMER) && !defined(RAYLIB_SUPPORT_BUSY_WAIT_LOOP) && !defined(PLATFORM_DESKTOP_SDL)
+    timeBeginPeriod(1);                 // Setup high-resolution timer to 1ms (granularity of 1-2 ms)
+#endif
 
-    if ((key > 0) && (key < RAYLIB_MAX_KEYBOARD_KEYS))
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__EMSCRIPTEN__)
+    struct timespec now = { 0 };
+
+    if (clock_gettime(CLOCK_MONOTONIC, &now) == 0)  // Success
     {
-        if (CORE.Input.Keyboard.currentKeyState[key] == 0) up = true;
+        CORE.Time.base = (unsigned long long int)now.tv_sec*1000000000LLU + (unsigned long long int)now.tv_nsec;
     }
+    else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "TIMER: Hi-resolution timer not available");
+#endif
 
-    return up;
+    CORE.Time.previous = RaylibGetTime();     // Get time as double
+    CORE.Time.deadline = 0;
+    CORE.Time.wakeupError = FRAME_PACER_MIN_SPIN_TIME;
+    CORE.Time.wakeupDeviation = 0.0;
 }
 
-// Get the last key pressed
-int RaylibGetKeyPressed(void)
+// Update frame timing and pacing stats
+static void UpdateFrameStats(double workTime, double waitTime, double spinTime, double overshootTime, bool missed)
 {
-    int value = 0;
+    RaylibFrameStats *stats = &CORE.Time.stats;
 
-    if (CORE.Input.Keyboard.keyPressedQueueCount > 0)
-    {
-        // Get character from the queue head
-        value = CORE.Input.Keyboard.keyPressedQueue[0];
+    stats->frameCount++;
+    if (missed) stats->missedCount++;
 
-        // Shift elements 1 step toward the head
-        for (int i = 0; i < (CORE.Input.Keyboard.keyPressedQueueCount - 1); i++)
-            CORE.Input.Keyboard.keyPressedQueue[i] = CORE.Input.Keyboard.keyPressedQueue[i + 1];
+    stats->workTime = (float)workTime;
+    stats->waitTime = (float)waitTime;
+    stats->spinTime = (float)spinTime;
+    stats->overshootTime = (float)overshootTime;
+    if (stats->overshootTime > stats->maxOvershootTime) stats->maxOvershootTime = stats->overshootTime;
+    stats->wakeupError = (float)(CORE.Time.wakeupError + 4.0*CORE.Time.wakeupDeviation);
 
-        // Reset last character in the queue
-        CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount - 1] = 0;
-        CORE.Input.Keyboard.keyPressedQueueCount--;
+    // Register wake-up delay histogram, bucket i: delay < 2^i microseconds
+    if (!missed)
+    {
+        double overshootMicros = overshootTime*1000000.0;
+        int bucket = 0;
+        while ((bucket < 15) && (overshootMicros >= (double)(1 << bucket))) bucket++;
+        stats->overshootHistogram[bucket]++;
     }
+}
 
-    return value;
+#if defined(FRAME_PACER_AVAILABLE)
+// Get monotonic clock time in nanoseconds
+static unsigned long long int GetMonotonicTime(void)
+{
+    struct timespec now = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (unsigned long long int)now.tv_sec*1000000000LLU + (unsigned long long int)now.tv_nsec;
 }
 
-// Get the last char pressed
-int RaylibGetCharPressed(void)
+// Wait until absolute deadline (monotonic time in nanoseconds), returns wake-up delay in seconds
+// NOTE: Thread sleeps until deadline minus a busy wait window, the window is sized to the measured
+// sleep wake-up error (moving average plus 4 mean deviations) so it adapts to the system scheduler
+static double WaitDeadline(unsigned long long int deadline, double *spinTime)
 {
-    int value = 0;
+    double spinWindow = CORE.Time.wakeupError + 4.0*CORE.Time.wakeupDeviation;
+    if (spinWindow < FRAME_PACER_MIN_SPIN_TIME) spinWindow = FRAME_PACER_MIN_SPIN_TIME;
+    else if (spinWindow > FRAME_PACER_MAX_SPIN_TIME) spinWindow = FRAME_PACER_MAX_SPIN_TIME;
+
+    unsigned long long int spinWindowNs = (unsigned long long int)(spinWindow*1000000000.0);
+    unsigned long long int now = GetMonotonicTime();
 
-    if (CORE.Input.Keyboard.charPressedQueueCount > 0)
+    if ((deadline > now) && ((deadline - now) > spinWindowNs))
     {
-        // Get character from the queue head
-        value = CORE.Input.Keyboard.charPressedQueue[0];
+        unsigned long long int wakeup = deadline - spinWindowNs;
+        struct timespec request = { (time_t)(wakeup/1000000000LLU), (long)(wakeup%1000000000LLU) };
 
-        // Shift elements 1 step toward the head
-        for (int i = 0; i < (CORE.Input.Keyboard.charPressedQueueCount - 1); i++)
-            CORE.Input.Keyboard.charPressedQueue[i] = CORE.Input.Keyboard.charPressedQueue[i + 1];
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &request, NULL) == EINTR) continue;
 
-        // Reset last character in the queue
-        CORE.Input.Keyboard.charPressedQueue[CORE.Input.Keyboard.charPressedQueueCount - 1] = 0;
-        CORE.Input.Keyboard.charPressedQueueCount--;
+        now = GetMonotonicTime();
+
+        // Update wake-up error estimation, late wake-ups grow the busy wait window
+        // NOTE: Samples are clamped to max window, a single preemption should not inflate it for many frames
+        double error = (now > wakeup)? (double)(now - wakeup)/1000000000.0 : 0.0;
+        if (error > FRAME_PACER_MAX_SPIN_TIME) error = FRAME_PACER_MAX_SPIN_TIME;
+        CORE.Time.wakeupError += (error - CORE.Time.wakeupError)*FRAME_PACER_ERROR_FILTER;
+        CORE.Time.wakeupDeviation += (fabs(error - CORE.Time.wakeupError) - CORE.Time.wakeupDeviation)*FRAME_PACER_ERROR_FILTER;
     }
 
-    return value;
-}
+    // Busy wait remaining time
+    unsigned long long int spinStart = now;
+    while (now < deadline) now = GetMonotonicTime();
 
-// Set a custom key to exit program
-// NOTE: default exitKey is set to ESCAPE
-void RaylibSetExitKey(int key)
-{
-    CORE.Input.Keyboard.exitKey = key;
+    *spinTime = (double)(now - spinStart)/1000000000.0;
+
+    return (double)(now - deadline)/1000000000.0;
 }
+#endif
 
-//----------------------------------------------------------------------------------
-// Module Functions Definition: Input Handling: Gamepad
-//----------------------------------------------------------------------------------
+// Set viewport for a provided width and height
+void SetupViewport(int width, int height)
+{
+    CORE.Window.render.width = width;
+    CORE.Window.render.height = height;
 
-// NOTE: Functions with a platform-specific implementation on rcore_<platform>.c
-//int RaylibSetGamepadMappings(const char *mappings)
+    // Set viewport width and height
+    // NOTE: We consider render size (scaled) and offset in case black bars are required and
+    // render area does not match full display area (this situation is only applicable on fullscreen mode)
+#if defined(__APPLE__)
+    RaylibVector2 scale = RaylibGetWindowScaleDPI();
+    rlViewport(CORE.Window.renderOffset.x/2*scale.x, CORE.Window.renderOffset.y/2*scale.y, (CORE.Window.render.width)*scale.x, (CORE.Window.render.height)*scale.y);
+#else
+    rlViewport(CORE.Window.renderOffset.x/2, CORE.Window.renderOffset.y/2, CORE.Window.render.width, CORE.Window.render.height);
+#endif
 
-// Check if a gamepad is available
-bool RaylibIsGamepadAvailable(int gamepad)
-{
-    bool result = false;
+    rlMatrixMode(RL_PROJECTION);        // Switch to projection matrix
+    rlLoadIdentity();                   // Reset current matrix (projection)
 
-    if ((gamepad < RAYLIB_MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad]) result = true;
+    // Set orthographic projection to current framebuffer size
+    // NOTE: Configured top-left corner as (0, 0)
+    rlOrtho(0, CORE.Window.render.width, CORE.Window.render.height, 0, 0.0f, 1.0f);
 
-    return result;
+    rlMatrixMode(RL_MODELVIEW);         // Switch back to modelview matrix
+    rlLoadIdentity();                   // Reset current matrix (modelview)
 }
 
-// Get gamepad internal name id
-const char *RaylibGetGamepadName(int gamepad)
+// Compute framebuffer size relative to screen size and display size
+// NOTE: Global variables CORE.Window.render.width/CORE.Window.render.height and CORE.Window.renderOffset.x/CORE.Window.renderOffset.y can be modified
+void SetupFramebuffer(int width, int height)
 {
-    return CORE.Input.Gamepad.name[gamepad];
-}
+    // Calculate CORE.Window.render.width and CORE.Window.render.height, we have the display size (input params) and the desired screen size (global var)
+    if ((CORE.Window.screen.width > CORE.Window.display.width) || (CORE.Window.screen.height > CORE.Window.display.height))
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "DISPLAY: Downscaling required: Screen size (%ix%i) is bigger than display size (%ix%i)", CORE.Window.screen.width, CORE.Window.screen.height, CORE.Window.display.width, CORE.Window.display.height);
 
-// Check if a gamepad button has been pressed once
-bool RaylibIsGamepadButtonPressed(int gamepad, int button)
-{
-    bool pressed = false;
+        // Downscaling to fit display with border-bars
+        float widthRatio = (float)CORE.Window.display.width/(float)CORE.Window.screen.width;
+        float heightRatio = (float)CORE.Window.display.height/(float)CORE.Window.screen.height;
 
-    if ((gamepad < RAYLIB_MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad] && (button < RAYLIB_MAX_GAMEPAD_BUTTONS) &&
-        (CORE.Input.Gamepad.previousButtonState[gamepad][button] == 0) && (CORE.Input.Gamepad.currentButtonState[gamepad][button] == 1)) pressed = true;
+        if (widthRatio <= heightRatio)
+        {
+            CORE.Window.render.width = CORE.Window.display.width;
+            CORE.Window.render.height = (int)round((float)CORE.Window.screen.height*widthRatio);
+            CORE.Window.renderOffset.x = 0;
+            CORE.Window.renderOffset.y = (CORE.Window.display.height - CORE.Window.render.height);
+        }
+        else
+        {
+            CORE.Window.render.width = (int)round((float)CORE.Window.screen.width*heightRatio);
+            CORE.Window.render.height = CORE.Window.display.height;
+            CORE.Window.renderOffset.x = (CORE.Window.display.width - CORE.Window.render.width);
+            CORE.Window.renderOffset.y = 0;
+        }
 
-    return pressed;
-}
+        // Screen scaling required
+        float scaleRatio = (float)CORE.Window.render.width/(float)CORE.Window.screen.width;
+        CORE.Window.screenScale = RaylibMatrixScale(scaleRatio, scaleRatio, 1.0f);
 
-// Check if a gamepad button is being pressed
-bool RaylibIsGamepadButtonDown(int gamepad, int button)
-{
-    bool down = false;
+        // NOTE: We render to full display resolution!
+        // We just need to calculate above parameters for downscale matrix and offsets
+        CORE.Window.render.width = CORE.Window.display.width;
+        CORE.Window.render.height = CORE.Window.display.height;
 
-    if ((gamepad < RAYLIB_MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad] && (button < RAYLIB_MAX_GAMEPAD_BUTTONS) &&
-        (CORE.Input.Gamepad.currentButtonState[gamepad][button] == 1)) down = true;
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "DISPLAY: Downscale matrix generated, content will be rendered at (%ix%i)", CORE.Window.render.width, CORE.Window.render.height);
+    }
+    else if ((CORE.Window.screen.width < CORE.Window.display.width) || (CORE.Window.screen.height < CORE.Window.display.height))
+    {
+        // Required screen size is smaller than display size
+        RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "DISPLAY: Upscaling required: Screen size (%ix%i) smaller than display size (%ix%i)", CORE.Window.screen.width, CORE.Window.screen.height, CORE.Window.display.width, CORE.Window.display.height);
 
-    return down;
+        if ((CORE.Window.screen.width == 0) || (CORE.Window.screen.height == 0))
+        {
+            CORE.Window.screen.width = CORE.Window.display.width;
+            CORE.Window.screen.height = CORE.Window.display.height;
+        }
+
+        // Upscaling to fit display with border-bars
+        float displayRatio = (float)CORE.Window.display.width/(float)CORE.Window.display.height;
+        float screenRatio = (float)CORE.Window.screen.width/(float)CORE.Window.screen.height;
+
+        if (displayRatio <= screenRatio)
+        {
+            CORE.Window.render.width = CORE.Window.screen.width;
+            CORE.Window.render.height = (int)round((float)CORE.Window.screen.width/displayRatio);
+            CORE.Window.renderOffset.x = 0;
+            CORE.Window.renderOffset.y = (CORE.Window.render.height - CORE.Window.screen.height);
+        }
+        else
+        {
+            CORE.Window.render.width = (int)round((float)CORE.Window.screen.height*displayRatio);
+            CORE.Window.render.height = CORE.Window.screen.height;
+            CORE.Window.renderOffset.x = (CORE.Window.render.width - CORE.Window.screen.width);
+            CORE.Window.renderOffset.y = 0;
+        }
+    }
+    else
+    {
+        CORE.Window.render.width = CORE.Window.screen.width;
+        CORE.Window.render.height = CORE.Window.screen.height;
+        CORE.Window.renderOffset.x = 0;
+        CORE.Window.renderOffset.y = 0;
+    }
 }
 
-// Check if a gamepad button has NOT been pressed once
-bool RaylibIsGamepadButtonReleased(int gamepad, int button)
+// Scan files and directories in path, reporting them to callback, returns false if scan was stopped by callback
+// NOTE: Scanned entries names are appended to path buffer (RAYLIB_MAX_FILEPATH_LENGTH size), file
+// type is taken from directory entry when available (d_type), avoiding a stat() call per entry
+// Filtering: with no filter, all entries are reported (only files on recursive scan), with filter,
+// files with a filter extension are reported and directories only if filter contains DIRECTORY_FILTER_TAG
+static bool ScanDirectory(char *path, int pathLength, const char *filter, bool scanSubdirs, RaylibScanDirectoryCallback callback, void *userData, unsigned int *count)
 {
-    bool released = false;
+    bool scanning = true;
+    bool includeDirs = (filter == NULL)? !scanSubdirs : (RaylibTextFindIndex(filter, DIRECTORY_FILTER_TAG) >= 0);
 
-    if ((gamepad < RAYLIB_MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad] && (button < RAYLIB_MAX_GAMEPAD_BUTTONS) &&
-        (CORE.Input.Gamepad.previousButtonState[gamepad][button] == 1) && (CORE.Input.Gamepad.currentButtonState[gamepad][button] == 0)) released = true;
+    struct dirent *dp = NULL;
+    DIR *dir = opendir(path);
+
+    if (dir != NULL)
+    {
+        while (scanning && ((dp = readdir(dir)) != NULL))
+        {
+            if ((strcmp(dp->d_name, ".") == 0) || (strcmp(dp->d_name, "..") == 0)) continue;
+
+            // Construct new path from our base path
+            int nameLength = (int)strlen(dp->d_name);
+
+            if ((pathLength + 1 + nameLength) >= RAYLIB_MAX_FILEPATH_LENGTH)
+            {
+                RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "FILEIO: Filepath too long, skipped (%s)", dp->d_name);
+                continue;
+            }
+
+        #if defined(_WIN32)
+            path[pathLength] = '\\';
+        #else
+            path[pathLength] = '/';
+        #endif
+            memcpy(path + pathLength + 1, dp->d_name, nameLength + 1);
+
+            bool isFile = false;
+        #if defined(DT_DIR)
+            if (dp->d_type == DT_REG) isFile = true;
+            else if (dp->d_type == DT_DIR) isFile = false;
+            else isFile = RaylibIsPathFile(path);   // Symbolic links and unknown types require stat()
+        #else
+            isFile = RaylibIsPathFile(path);
+        #endif
+
+            if (isFile)
+            {
+                if ((filter == NULL) || RaylibIsFileExtension(path, filter))
+                {
+                    scanning = callback(path, false, userData);
+                    (*count)++;
+                }
+            }
+            else
+            {
+                if (includeDirs)
+                {
+                    scanning = callback(path, true, userData);
+                    (*count)++;
+                }
 
-    return released;
-}
+                if (scanning && scanSubdirs) scanning = ScanDirectory(path, pathLength + 1 + nameLength, filter, scanSubdirs, callback, userData, count);
+            }
+        }
 
-// Check if a gamepad button is NOT being pressed
-bool RaylibIsGamepadButtonUp(int gamepad, int button)
-{
-    bool up = false;
+        closedir(dir);
+    }
+    else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", path);
 
-    if ((gamepad < RAYLIB_MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad] && (button < RAYLIB_MAX_GAMEPAD_BUTTONS) &&
-        (CORE.Input.Gamepad.currentButtonState[gamepad][button] == 0)) up = true;
+    path[pathLength] = '\0';
 
-    return up;
+    return scanning;
 }
 
-// Get the last gamepad button pressed
-int RaylibGetGamepadButtonPressed(void)
+// Add scanned path to file paths pool (FilePathPool), growing pool as required
+static bool AddFilePath(const char *filePath, bool isDirectory, void *userData)
 {
-    return CORE.Input.Gamepad.lastButtonPressed;
-}
+    (void)isDirectory;  // Directories are listed as files, scan filtering decides if they are provided
 
-// Get gamepad axis count
-int RaylibGetGamepadAxisCount(int gamepad)
-{
-    return CORE.Input.Gamepad.axisCount[gamepad];
-}
+    FilePathPool *pool = (FilePathPool *)userData;
+    unsigned int length = (unsigned int)strlen(filePath) + 1;
 
-// Get axis movement vector for a gamepad
-float RaylibGetGamepadAxisMovement(int gamepad, int axis)
-{
-    float value = (axis == RAYLIB_GAMEPAD_AXIS_LEFT_TRIGGER || axis == RAYLIB_GAMEPAD_AXIS_RIGHT_TRIGGER)? -1.0f : 0.0f;
+    if ((pool->size + length) > pool->capacity)
+    {
+        unsigned int capacity = (pool->capacity > 0)? pool->capacity*2 : 4096;
+        while ((pool->size + length) > capacity) capacity *= 2;
 
-    if ((gamepad < RAYLIB_MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad] && (axis < RAYLIB_MAX_GAMEPAD_AXIS)) {
-        float movement = value < 0.0f ? CORE.Input.Gamepad.axisState[gamepad][axis] : fabsf(CORE.Input.Gamepad.axisState[gamepad][axis]);
+        char *data = (char *)RL_REALLOC(pool->data, capacity);
+        if (data == NULL) return false;
 
-        if (movement > value) value = CORE.Input.Gamepad.axisState[gamepad][axis];
+        pool->data = data;
+        pool->capacity = capacity;
     }
 
-    return value;
-}
-
-//----------------------------------------------------------------------------------
-// Module Functions Definition: Input Handling: Mouse
-//----------------------------------------------------------------------------------
-
-// NOTE: Functions with a platform-specific implementation on rcore_<platform>.c
-//void RaylibSetMousePosition(int x, int y)
-//void RaylibSetMouseCursor(int cursor)
+    if (pool->count == pool->offsetCapacity)
+    {
+        unsigned int capacity = (pool->offsetCapacity > 0)? pool->offsetCapacity*2 : 64;
 
-// Check if a mouse button has been pressed once
-bool RaylibIsMouseButtonPressed(int button)
-{
-    bool pressed = false;
+        unsigned int *offsets = (unsigned int *)RL_REALLOC(pool->offsets, capacity*sizeof(unsigned int));
+        if (offsets == NULL) return false;
 
-    if ((CORE.Input.Mouse.currentButtonState[button] == 1) && (CORE.Input.Mouse.previousButtonState[button] == 0)) pressed = true;
+        pool->offsets = offsets;
+        pool->offsetCapacity = capacity;
+    }
 
-    // Map touches to mouse buttons checking
-    if ((CORE.Input.Touch.currentTouchState[button] == 1) && (CORE.Input.Touch.previousTouchState[button] == 0)) pressed = true;
+    memcpy(pool->data + pool->size, filePath, length);
+    pool->offsets[pool->count] = pool->size;
+    pool->size += length;
+    pool->count++;
 
-    return pressed;
+    return true;
 }
 
-// Improved version using a queue to catch events happening between to calls to PollInputEvents()
-bool RaylibHasMouseButtonBeenDown(int button)
+// Load compact file paths list from paths pool, pool is unloaded
+// NOTE: A single allocation is used, paths pointers array followed by paths strings
+static RaylibFilePathList LoadFilePathPool(FilePathPool *pool)
 {
-    bool pressed = false;
-    
-    _GLFWmouseEventQueue* queue = &CORE.Input.Mouse.eventQueue;
-    
-    // Iterate over the queue using C-style indexing
-    for (int i = queue->head; i != queue->tail; i = (i + 1) % queue->capacity) 
+    RaylibFilePathList files = { 0 };
+
+    if (pool->count > 0)
     {
-        if (queue->events[i].button == button && queue->events[i].action == GLFW_PRESS) {
-            pressed = true;
-        	CORE.Input.Mouse.previousButtonState[button] = 1;
+        files.paths = (char **)RL_MALLOC(pool->count*sizeof(char *) + pool->size);
+
+        if (files.paths != NULL)
+        {
+            char *data = (char *)(files.paths + pool->count);
+            memcpy(data, pool->data, pool->size);
+
+            for (unsigned int i = 0; i < pool->count; i++) files.paths[i] = data + pool->offsets[i];
+
+            files.capacity = pool->count;
+            files.count = pool->count;
         }
     }
 
-    return pressed;
-}
+    RL_FREE(pool->data);
+    RL_FREE(pool->offsets);
 
-void RaylibClearEventQueue()
-{
-	CORE.Input.Mouse.eventQueue.head = 0;
-    CORE.Input.Mouse.eventQueue.tail = 0;
+    return files;
 }
 
-// Check if a mouse button is being pressed
-bool RaylibIsMouseButtonDown(int button)
+#if defined(RAYLIB_SUPPORT_COMPRESSION_API)
+// Compress data into independent chunks (in parallel), returns compressed size or -1 on failure
+// NOTE: Output must have space for COMPRESSION_CHUNK_HEADER_SIZE + sdefl_bound(chunkSize) bytes per chunk,
+// chunks are compressed into fixed size slots and compacted afterwards
+static int CompressChunks(const unsigned char *data, int dataSize, int chunkSize, unsigned char *output)
 {
-    bool down = false;
+    int chunkCount = (dataSize + chunkSize - 1)/chunkSize;
+    int compSize = 0;
 
-    if (CORE.Input.Mouse.currentButtonState[button] == 1) down = true;
+    CompressionChunksJob job = { 0 };
+    job.data = data;
+    job.dataSize = dataSize;
+    job.chunkSize = chunkSize;
+    job.output = output;
+    job.slotSize = COMPRESSION_CHUNK_HEADER_SIZE + sdefl_bound(chunkSize);
+    job.sizes = (int *)RL_MALLOC(chunkCount*sizeof(int));
 
-    // NOTE: Touches are considered like mouse buttons
-    if (CORE.Input.Touch.currentTouchState[button] == 1) down = true;
+    if (job.sizes == NULL) return -1;
 
-    return down;
-}
+    // One group of consecutive chunks per worker thread, so compressor state is allocated once per worker
+    int workerCount = GetWorkerThreadCount();
+    job.groupCount = (chunkCount < workerCount)? chunkCount : workerCount;
 
-// Check if a mouse button has been released once
-bool RaylibIsMouseButtonReleased(int button)
-{
-    bool released = false;
-    bool pressed = false;
+    ParallelFor(job.groupCount, 1, CompressChunksRange, &job);
 
-    if ((CORE.Input.Mouse.currentButtonState[button] == 0) && (CORE.Input.Mouse.previousButtonState[button] == 1)) released = true;
-    
-    _GLFWmouseEventQueue* queue = &CORE.Input.Mouse.eventQueue;
-    
-    // Iterate over the queue using C-style indexing
-    for (int i = queue->head; i != queue->tail; i = (i + 1) % queue->capacity) 
-    {
-        if (queue->events[i].button == button) {
-			if (queue->events[i].action == GLFW_PRESS) {
-				pressed = true;
-			}
-	        if (pressed && queue->events[i].action == GLFW_RELEASE) {
-	            released = true;
-	        }
-	    }
+    for (int i = 0; i < chunkCount; i++)
+    {
+        if (job.sizes[i] < 0)
+        {
+            RL_FREE(job.sizes);
+            return -1;
+        }
+
+        int size = COMPRESSION_CHUNK_HEADER_SIZE + job.sizes[i];
+
+        if (compSize != i*job.slotSize) memmove(output + compSize, output + i*job.slotSize, size);
+        compSize += size;
     }
-    
-    if (released) {
-		CORE.Input.Mouse.previousButtonState[button] = 0;
-	}
 
-    // Map touches to mouse buttons checking
-    if ((CORE.Input.Touch.currentTouchState[button] == 0) && (CORE.Input.Touch.previousTouchState[button] == 1)) released = true;
+    RL_FREE(job.sizes);
 
-    return released;
+    return compSize;
 }
 
-// Check if a mouse button is NOT being pressed
-bool RaylibIsMouseButtonUp(int button)
+// Decompress all complete chunks (in parallel), returns bytes consumed or -1 on failure
+// NOTE: Output buffer is grown if required, a trailing partial chunk is not consumed
+static int DecompressChunks(const unsigned char *compData, int compDataSize, unsigned char **data, int *dataCapacity, int *dataSize)
 {
-    bool up = false;
-
-    if (CORE.Input.Mouse.currentButtonState[button] == 0) up = true;
+    int consumed = 0;
+    int chunkCount = 0;
+    int size = 0;
 
-    // NOTE: Touches are considered like mouse buttons
-    if (CORE.Input.Touch.currentTouchState[button] == 0) up = true;
-	
-	if (up) {
-		CORE.Input.Mouse.previousButtonState[button] = 0;
-	}
-	
-    return up;
-}
+    *dataSize = 0;
+    if ((compData == NULL) || (compDataSize <= 0)) return 0;
 
-// Get mouse position X
-int RaylibGetMouseX(void)
-{
-    int mouseX = (int)((CORE.Input.Mouse.currentPosition.x + CORE.Input.Mouse.offset.x)*CORE.Input.Mouse.scale.x);
-    return mouseX;
-}
+    // Parse chunks headers, count complete chunks
+    while ((consumed + COMPRESSION_CHUNK_HEADER_SIZE) <= compDataSize)
+    {
+        const unsigned char *header = compData + consumed;
+        unsigned int chunkSize = header[0] | (header[1] << 8) | (header[2] << 16) | ((unsigned int)header[3] << 24);
+        unsigned int chunkCompSize = header[4] | (header[5] << 8) | (header[6] << 16) | ((unsigned int)header[7] << 24);
 
-// Get mouse position Y
-int RaylibGetMouseY(void)
-{
-    int mouseY = (int)((CORE.Input.Mouse.currentPosition.y + CORE.Input.Mouse.offset.y)*CORE.Input.Mouse.scale.y);
-    return mouseY;
-}
+        if ((chunkSize == 0) || (chunkSize > (RAYLIB_MAX_DECOMPRESSION_SIZE*1024*1024)) ||
+            (chunkCompSize > (unsigned int)sdefl_bound(chunkSize)) || ((unsigned int)size > (0x7fffffffu - chunkSize))) return -1;
 
-// Get mouse position XY
-RaylibVector2 RaylibGetMousePosition(void)
-{
-    RaylibVector2 position = { 0 };
+        if ((consumed + COMPRESSION_CHUNK_HEADER_SIZE + (int)chunkCompSize) > compDataSize) break;   // Partial chunk
 
-    position.x = (CORE.Input.Mouse.currentPosition.x + CORE.Input.Mouse.offset.x)*CORE.Input.Mouse.scale.x;
-    position.y = (CORE.Input.Mouse.currentPosition.y + CORE.Input.Mouse.offset.y)*CORE.Input.Mouse.scale.y;
+        consumed += COMPRESSION_CHUNK_HEADER_SIZE + chunkCompSize;
+        size += chunkSize;
+        chunkCount++;
+    }
 
-    return position;
-}
+    if (chunkCount == 0) return 0;
 
-// Get mouse delta between frames
-RaylibVector2 RaylibGetMouseDelta(void)
-{
-    RaylibVector2 delta = { 0 };
+    if (size > *dataCapacity)
+    {
+        RL_FREE(*data);
+        *data = (unsigned char *)RL_MALLOC(size);
+        *dataCapacity = (*data != NULL)? size : 0;
 
-    delta.x = CORE.Input.Mouse.currentPosition.x - CORE.Input.Mouse.previousPosition.x;
-    delta.y = CORE.Input.Mouse.currentPosition.y - CORE.Input.Mouse.previousPosition.y;
+        if (*data == NULL) return -1;
+    }
 
-    return delta;
-}
+    CompressionChunksJob job = { 0 };
+    job.data = compData;
+    job.output = *data;
+    job.offsets = (int *)RL_MALLOC(chunkCount*2*sizeof(int));
+    job.sizes = (int *)RL_MALLOC(chunkCount*sizeof(int));
 
-// Set mouse offset
-// NOTE: Useful when rendering to different size targets
-void RaylibSetMouseOffset(int offsetX, int offsetY)
-{
-    CORE.Input.Mouse.offset = (RaylibVector2){ (float)offsetX, (float)offsetY };
-}
+    if ((job.offsets == NULL) || (job.sizes == NULL))
+    {
+        RL_FREE(job.offsets);
+        RL_FREE(job.sizes);
+        return -1;
+    }
 
-// Set mouse scaling
-// NOTE: Useful when rendering to different size targets
-void RaylibSetMouseScale(float scaleX, float scaleY)
-{
-    CORE.Input.Mouse.scale = (RaylibVector2){ scaleX, scaleY };
-}
+    for (int i = 0, inOffset = 0, outOffset = 0; i < chunkCount; i++)
+    {
+        const unsigned char *header = compData + inOffset;
 
-// Get mouse wheel movement Y
-float RaylibGetMouseWheelMove(void)
-{
-    float result = 0.0f;
+        job.offsets[i*2] = inOffset;
+        job.offsets[i*2 + 1] = outOffset;
+        inOffset += COMPRESSION_CHUNK_HEADER_SIZE + (header[4] | (header[5] << 8) | (header[6] << 16) | (header[7] << 24));
+        outOffset += header[0] | (header[1] << 8) | (header[2] << 16) | (header[3] << 24);
+    }
 
-    if (fabsf(CORE.Input.Mouse.currentWheelMove.x) > fabsf(CORE.Input.Mouse.currentWheelMove.y)) result = (float)CORE.Input.Mouse.currentWheelMove.x;
-    else result = (float)CORE.Input.Mouse.currentWheelMove.y;
+    ParallelFor(chunkCount, 1, DecompressChunksRange, &job);
 
-    return result;
-}
+    // Check every chunk decompressed to its expected size (and data CRC32)
+    bool failed = false;
+    for (int i = 0; i < chunkCount; i++)
+    {
+        const unsigned char *header = compData + job.offsets[i*2];
 
-// Get mouse wheel movement X/Y as a vector
-RaylibVector2 RaylibGetMouseWheelMoveV(void)
-{
-    RaylibVector2 result = { 0 };
+        if (job.sizes[i] != (header[0] | (header[1] << 8) | (header[2] << 16) | (header[3] << 24))) failed = true;
+    }
 
-    result = CORE.Input.Mouse.currentWheelMove;
+    RL_FREE(job.offsets);
+    RL_FREE(job.sizes);
 
-    return result;
-}
+    if (failed) return -1;
 
-//----------------------------------------------------------------------------------
-// Module Functions Definition: Input Handling: Touch
-//----------------------------------------------------------------------------------
+    *dataSize = size;
 
-// Get touch position X for touch point 0 (relative to screen size)
-int RaylibGetTouchX(void)
-{
-    int touchX = (int)CORE.Input.Touch.position[0].x;
-    return touchX;
+    return consumed;
 }
 
-// Get touch position Y for touch point 0 (relative to screen size)
-int RaylibGetTouchY(void)
+// Compress a range of chunks groups (CompressionChunksJob)
+static void CompressChunksRange(void *userData, int start, int end)
 {
-    int touchY = (int)CORE.Input.Touch.position[0].y;
-    return touchY;
-}
+    CompressionChunksJob *job = (CompressionChunksJob *)userData;
+    int chunkCount = (job->dataSize + job->chunkSize - 1)/job->chunkSize;
+    struct sdefl *sdefl = RL_CALLOC(1, sizeof(struct sdefl));   // WARNING: struct sdefl is almost 1MB, reused for all chunks in range groups
 
-// Get touch position XY for a touch point index (relative to screen size)
-// TODO: Touch position should be scaled depending on display size and render size
-RaylibVector2 RaylibGetTouchPosition(int index)
-{
-    RaylibVector2 position = { -1.0f, -1.0f };
+    for (int i = (int)((long long)start*chunkCount/job->groupCount); i < (int)((long long)end*chunkCount/job->groupCount); i++)
+    {
+        // NOTE: Compressor state allocation failure is reported as failed size
+        if (sdefl == NULL)
+        {
+            job->sizes[i] = -1;
+            continue;
+        }
 
-    if (index < RAYLIB_MAX_TOUCH_POINTS) position = CORE.Input.Touch.position[index];
-    else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "INPUT: Required touch point out of range (Max touch points: %i)", RAYLIB_MAX_TOUCH_POINTS);
+        int offset = i*job->chunkSize;
+        int chunkSize = ((job->dataSize - offset) < job->chunkSize)? (job->dataSize - offset) : job->chunkSize;
+        unsigned char *header = job->output + i*job->slotSize;
 
-    return position;
-}
+        int compSize = sdeflate(sdefl, header + COMPRESSION_CHUNK_HEADER_SIZE, job->data + offset, chunkSize, COMPRESSION_QUALITY_DEFLATE);
+        unsigned int crc = RaylibUpdateCRC32(0, job->data + offset, chunkSize);
 
-// Get touch point identifier for given index
-int RaylibGetTouchPointId(int index)
-{
-    int id = -1;
+        for (int b = 0; b < 4; b++)
+        {
+            header[b] = (unsigned char)(chunkSize >> (8*b));
+            header[4 + b] = (unsigned char)(compSize >> (8*b));
+            header[8 + b] = (unsigned char)(crc >> (8*b));
+        }
 
-    if (index < RAYLIB_MAX_TOUCH_POINTS) id = CORE.Input.Touch.pointId[index];
+        job->sizes[i] = compSize;
+    }
 
-    return id;
+    RL_FREE(sdefl);
 }
 
-// Get number of touch points
-int RaylibGetTouchPointCount(void)
+// Decompress a range of chunks (CompressionChunksJob)
+static void DecompressChunksRange(void *userData, int start, int end)
 {
-    return CORE.Input.Touch.pointCount;
-}
+    CompressionChunksJob *job = (CompressionChunksJob *)userData;
 
-//----------------------------------------------------------------------------------
-// Module Internal Functions Definition
-//----------------------------------------------------------------------------------
+    for (int i = start; i < end; i++)
+    {
+        const unsigned char *header = job->data + job->offsets[i*2];
+        int chunkSize = header[0] | (header[1] << 8) | (header[2] << 16) | (header[3] << 24);
+        int chunkCompSize = header[4] | (header[5] << 8) | (header[6] << 16) | (header[7] << 24);
 
-// NOTE: Functions with a platform-specific implementation on rcore_<platform>.c
-//int InitPlatform(void)
-//void ClosePlatform(void)
+        unsigned int crc = header[8] | (header[9] << 8) | (header[10] << 16) | ((unsigned int)header[11] << 24);
 
-// Initialize hi-resolution timer
-void InitTimer(void)
-{
-    // Setting a higher resolution can improve the accuracy of time-out intervals in wait functions
-    // However, it can also reduce overall system performance, because the thread scheduler switches tasks more often
-    // High resolutions can also prevent the CPU power management system from entering power-saving modes
-    // Setting a higher resolution does not improve the accuracy of the high-resolution performance counter
-#if defined(_WIN32) && defined(RAYLIB_SUPPORT_WINMM_HIGHRES_TIMER) && !defined(RAYLIB_SUPPORT_BUSY_WAIT_LOOP) && !defined(PLATFORM_DESKTOP_SDL)
-    timeBeginPeriod(1);                 // Setup high-resolution timer to 1ms (granularity of 1-2 ms)
+        // NOTE: Every chunk writes its own size, checked once all chunks are processed, corrupted data is reported as failed size
+        job->sizes[i] = sinflate(job->output + job->offsets[i*2 + 1], chunkSize, header + COMPRESSION_CHUNK_HEADER_SIZE, chunkCompSize);
+        if ((job->sizes[i] == chunkSize) && (RaylibUpdateCRC32(0, job->output + job->offsets[i*2 + 1], chunkSize) != crc)) job->sizes[i] = -1;
+    }
+}
 #endif
 
-#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__EMSCRIPTEN__)
-    struct timespec now = { 0 };
+// Update hash state with new data, processing full 64 bytes blocks (MD5, SHA-1)
+static void UpdateHashState(RaylibHashState *state, const unsigned char *data, int dataSize, void (*hashBlock)(unsigned int *, const unsigned char *))
+{
+    state->dataSize += dataSize;
 
-    if (clock_gettime(CLOCK_MONOTONIC, &now) == 0)  // Success
+    // Complete pending block first
+    if (state->blockSize > 0)
     {
-        CORE.Time.base = (unsigned long long int)now.tv_sec*1000000000LLU + (unsigned long long int)now.tv_nsec;
-    }
-    else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "TIMER: Hi-resolution timer not available");
-#endif
+        int size = ((64 - (int)state->blockSize) < dataSize)? (64 - (int)state->blockSize) : dataSize;
 
-    CORE.Time.previous = RaylibGetTime();     // Get time as double
-}
+        memcpy(state->block + state->blockSize, data, size);
+        state->blockSize += size;
+        data += size;
+        dataSize -= size;
 
-// Set viewport for a provided width and height
-void SetupViewport(int width, int height)
-{
-    CORE.Window.render.width = width;
-    CORE.Window.render.height = height;
+        if (state->blockSize < 64) return;
 
-    // Set viewport width and height
-    // NOTE: We consider render size (scaled) and offset in case black bars are required and
-    // render area does not match full display area (this situation is only applicable on fullscreen mode)
-#if defined(__APPLE__)
-    RaylibVector2 scale = RaylibGetWindowScaleDPI();
-    rlViewport(CORE.Window.renderOffset.x/2*scale.x, CORE.Window.renderOffset.y/2*scale.y, (CORE.Window.render.width)*scale.x, (CORE.Window.render.height)*scale.y);
-#else
-    rlViewport(CORE.Window.renderOffset.x/2, CORE.Window.renderOffset.y/2, CORE.Window.render.width, CORE.Window.render.height);
-#endif
+        hashBlock(state->hash, state->block);
+        state->blockSize = 0;
+    }
+
+    // Process full blocks directly from data, no copy required
+    for (; dataSize >= 64; dataSize -= 64, data += 64) hashBlock(state->hash, data);
+
+    if (dataSize > 0)
+    {
+        memcpy(state->block, data, dataSize);
+        state->blockSize = dataSize;
+    }
+}
 
-    rlMatrixMode(RL_PROJECTION);        // Switch to projection matrix
-    rlLoadIdentity();                   // Reset current matrix (projection)
+// Pad hash message and process last blocks (MD5, SHA-1)
+// NOTE: Message is padded with a '1' bit and '0' bits until length is 448 (mod 512), then 64bit length is appended
+static void FinishHashState(RaylibHashState *state, const unsigned char *length, void (*hashBlock)(unsigned int *, const unsigned char *))
+{
+    state->block[state->blockSize++] = 0x80;     // Append '1' bit
 
-    // Set orthographic projection to current framebuffer size
-    // NOTE: Configured top-left corner as (0, 0)
-    rlOrtho(0, CORE.Window.render.width, CORE.Window.render.height, 0, 0.0f, 1.0f);
+    if (state->blockSize > 56)
+    {
+        memset(state->block + state->blockSize, 0, 64 - state->blockSize);
+        hashBlock(state->hash, state->block);
+        state->blockSize = 0;
+    }
 
-    rlMatrixMode(RL_MODELVIEW);         // Switch back to modelview matrix
-    rlLoadIdentity();                   // Reset current matrix (modelview)
+    memset(state->block + state->blockSize, 0, 56 - state->blockSize);
+    memcpy(state->block + 56, length, 8);
+    hashBlock(state->hash, state->block);
+    state->blockSize = 0;
 }
 
-// Compute framebuffer size relative to screen size and display size
-// NOTE: Global variables CORE.Window.render.width/CORE.Window.render.height and CORE.Window.renderOffset.x/CORE.Window.renderOffset.y can be modified
-void SetupFramebuffer(int width, int height)
+// Process one 64 bytes block of MD5 hash
+static void HashBlockMD5(unsigned int *hash, const unsigned char *block)
 {
-    // Calculate CORE.Window.render.width and CORE.Window.render.height, we have the display size (input params) and the desired screen size (global var)
-    if ((CORE.Window.screen.width > CORE.Window.display.width) || (CORE.Window.screen.height > CORE.Window.display.height))
-    {
-        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "DISPLAY: Downscaling required: Screen size (%ix%i) is bigger than display size (%ix%i)", CORE.Window.screen.width, CORE.Window.screen.height, CORE.Window.display.width, CORE.Window.display.height);
+    #define ROTATE_LEFT(x, c) (((x) << (c)) | ((x) >> (32 - (c))))
 
-        // Downscaling to fit display with border-bars
-        float widthRatio = (float)CORE.Window.display.width/(float)CORE.Window.screen.width;
-        float heightRatio = (float)CORE.Window.display.height/(float)CORE.Window.screen.height;
+    // WARNING: All variables are unsigned 32 bit and wrap modulo 2^32 when calculating
 
-        if (widthRatio <= heightRatio)
-        {
-            CORE.Window.render.width = CORE.Window.display.width;
-            CORE.Window.render.height = (int)round((float)CORE.Window.screen.height*widthRatio);
-            CORE.Window.renderOffset.x = 0;
-            CORE.Window.renderOffset.y = (CORE.Window.display.height - CORE.Window.render.height);
-        }
-        else
-        {
-            CORE.Window.render.width = (int)round((float)CORE.Window.screen.width*heightRatio);
-            CORE.Window.render.height = CORE.Window.display.height;
-            CORE.Window.renderOffset.x = (CORE.Window.display.width - CORE.Window.render.width);
-            CORE.Window.renderOffset.y = 0;
-        }
+    // NOTE: r specifies the per-round shift amounts
+    static const unsigned int r[64] = {
+        7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+        5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
+        4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+        6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
+    };
 
-        // Screen scaling required
-        float scaleRatio = (float)CORE.Window.render.width/(float)CORE.Window.screen.width;
-        CORE.Window.screenScale = RaylibMatrixScale(scaleRatio, scaleRatio, 1.0f);
+    // Using binary integer part of the sines of integers (in radians) as constants
+    static const unsigned int k[64] = {
+        0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
+        0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+        0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
+        0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+        0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa,
+        0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+        0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed,
+        0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+        0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
+        0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+        0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05,
+        0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+        0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039,
+        0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+        0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
+        0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+    };
 
-        // NOTE: We render to full display resolution!
-        // We just need to calculate above parameters for downscale matrix and offsets
-        CORE.Window.render.width = CORE.Window.display.width;
-        CORE.Window.render.height = CORE.Window.display.height;
+    // Break chunk into sixteen 32-bit words w[j], 0 <= j <= 15, little endian
+    unsigned int w[16] = { 0 };
+    for (int i = 0; i < 16; i++) w[i] = block[i*4] | (block[i*4 + 1] << 8) | (block[i*4 + 2] << 16) | ((unsigned int)block[i*4 + 3] << 24);
 
-        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "DISPLAY: Downscale matrix generated, content will be rendered at (%ix%i)", CORE.Window.render.width, CORE.Window.render.height);
-    }
-    else if ((CORE.Window.screen.width < CORE.Window.display.width) || (CORE.Window.screen.height < CORE.Window.display.height))
+    // Initialize hash value for this chunk
+    unsigned int a = hash[0];
+    unsigned int b = hash[1];
+    unsigned int c = hash[2];
+    unsigned int d = hash[3];
+
+    for (int i = 0; i < 64; i++)
     {
-        // Required screen size is smaller than display size
-        RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "DISPLAY: Upscaling required: Screen size (%ix%i) smaller than display size (%ix%i)", CORE.Window.screen.width, CORE.Window.screen.height, CORE.Window.display.width, CORE.Window.display.height);
+        unsigned int f = 0;
+        unsigned int g = 0;
 
-        if ((CORE.Window.screen.width == 0) || (CORE.Window.screen.height == 0))
+        if (i < 16)
         {
-            CORE.Window.screen.width = CORE.Window.display.width;
-            CORE.Window.screen.height = CORE.Window.display.height;
+            f = (b & c) | ((~b) & d);
+            g = i;
         }
-
-        // Upscaling to fit display with border-bars
-        float displayRatio = (float)CORE.Window.display.width/(float)CORE.Window.display.height;
-        float screenRatio = (float)CORE.Window.screen.width/(float)CORE.Window.screen.height;
-
-        if (displayRatio <= screenRatio)
+        else if (i < 32)
         {
-            CORE.Window.render.width = CORE.Window.screen.width;
-            CORE.Window.render.height = (int)round((float)CORE.Window.screen.width/displayRatio);
-            CORE.Window.renderOffset.x = 0;
-            CORE.Window.renderOffset.y = (CORE.Window.render.height - CORE.Window.screen.height);
+            f = (d & b) | ((~d) & c);
+            g = (5*i + 1)%16;
+        }
+        else if (i < 48)
+        {
+            f = b ^ c ^ d;
+            g = (3*i + 5)%16;
         }
         else
         {
-            CORE.Window.render.width = (int)round((float)CORE.Window.screen.height*displayRatio);
-            CORE.Window.render.height = CORE.Window.screen.height;
-            CORE.Window.renderOffset.x = (CORE.Window.render.width - CORE.Window.screen.width);
-            CORE.Window.renderOffset.y = 0;
+            f = c ^ (b | (~d));
+            g = (7*i)%16;
         }
+
+        unsigned int temp = d;
+        d = c;
+        c = b;
+        b = b + ROTATE_LEFT((a + f + k[i] + w[g]), r[i]);
+        a = temp;
     }
-    else
-    {
-        CORE.Window.render.width = CORE.Window.screen.width;
-        CORE.Window.render.height = CORE.Window.screen.height;
-        CORE.Window.renderOffset.x = 0;
-        CORE.Window.renderOffset.y = 0;
-    }
+
+    // Add chunk's hash to result so far
+    hash[0] += a;
+    hash[1] += b;
+    hash[2] += c;
+    hash[3] += d;
 }
 
-// Scan all files and directories in a base path
-// WARNING: files.paths[] must be previously allocated and
-// contain enough space to store all required paths
-static void ScanDirectoryFiles(const char *basePath, RaylibFilePathList *files, const char *filter)
+// Process one 64 bytes block of SHA-1 hash
+static void HashBlockSHA1(unsigned int *hash, const unsigned char *block)
 {
-    static char path[RAYLIB_MAX_FILEPATH_LENGTH] = { 0 };
-    memset(path, 0, RAYLIB_MAX_FILEPATH_LENGTH);
+    // Break chunk into sixteen 32-bit words w[j], 0 <= j <= 15, big endian
+    unsigned int w[80] = { 0 };
+    for (int i = 0; i < 16; i++) w[i] = ((unsigned int)block[i*4] << 24) | (block[i*4 + 1] << 16) | (block[i*4 + 2] << 8) | block[i*4 + 3];
 
-    struct dirent *dp = NULL;
-    DIR *dir = opendir(basePath);
+    // Message schedule: extend the sixteen 32-bit words into eighty 32-bit words
+    for (int i = 16; i < 80; i++) w[i] = ROTATE_LEFT(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
 
-    if (dir != NULL)
+    // Initialize hash value for this chunk
+    unsigned int a = hash[0];
+    unsigned int b = hash[1];
+    unsigned int c = hash[2];
+    unsigned int d = hash[3];
+    unsigned int e = hash[4];
+
+    for (int i = 0; i < 80; i++)
     {
-        while ((dp = readdir(dir)) != NULL)
-        {
-            if ((strcmp(dp->d_name, ".") != 0) &&
-                (strcmp(dp->d_name, "..") != 0))
-            {
-            #if defined(_WIN32)
-                sprintf(path, "%s\\%s", basePath, dp->d_name);
-            #else
-                sprintf(path, "%s/%s", basePath, dp->d_name);
-            #endif
+        unsigned int f = 0;
+        unsigned int k = 0;
 
-                if (filter != NULL)
-                {
-                    if (RaylibIsPathFile(path))
-                    {
-                        if (RaylibIsFileExtension(path, filter))
-                        {
-                            strcpy(files->paths[files->count], path);
-                            files->count++;
-                        }
-                    }
-                    else
-                    {
-                        if (RaylibTextFindIndex(filter, DIRECTORY_FILTER_TAG) >= 0)
-                        {
-                            strcpy(files->paths[files->count], path);
-                            files->count++;
-                        }
-                    }
-                }
-                else
-                {
-                    strcpy(files->paths[files->count], path);
-                    files->count++;
-                }
-            }
+        if (i < 20)
+        {
+            f = (b & c) | ((~b) & d);
+            k = 0x5A827999;
+        }
+        else if (i < 40)
+        {
+            f = b ^ c ^ d;
+            k = 0x6ED9EBA1;
+        }
+        else if (i < 60)
+        {
+            f = (b & c) | (b & d) | (c & d);
+            k = 0x8F1BBCDC;
+        }
+        else
+        {
+            f = b ^ c ^ d;
+            k = 0xCA62C1D6;
         }
 
-        closedir(dir);
+        unsigned int temp = ROTATE_LEFT(a, 5) + f + e + k + w[i];
+        e = d;
+        d = c;
+        c = ROTATE_LEFT(b, 30);
+        b = a;
+        a = temp;
     }
-    else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", basePath);
+
+    // Add this chunk's hash to result so far
+    hash[0] += a;
+    hash[1] += b;
+    hash[2] += c;
+    hash[3] += d;
+    hash[4] += e;
 }
 
-// Scan all files and directories recursively from a base path
-static void ScanDirectoryFilesRecursively(const char *basePath, RaylibFilePathList *files, const char *filter)
+// Read 64bit little endian value from unaligned data
+static unsigned long long ReadLittleEndian64(const unsigned char *data)
 {
-    char path[RAYLIB_MAX_FILEPATH_LENGTH] = { 0 };
-    memset(path, 0, RAYLIB_MAX_FILEPATH_LENGTH);
+    unsigned long long value = 0;
 
-    struct dirent *dp = NULL;
-    DIR *dir = opendir(basePath);
+    for (int i = 7; i >= 0; i--) value = (value << 8) | data[i];
 
-    if (dir != NULL)
+    return value;
+}
+
+// Register input event into events queue
+// NOTE: Events queue grows if full, events are never dropped
+static void RegisterInputEvent(int type, int code, int action, RaylibVector2 value)
+{
+    InputEventQueue *queue = &CORE.Input.events;
+    RaylibInputEvent event = { RaylibGetTime(), type, code, action, value };
+
+    INPUT_EVENTS_LOCK();
+
+    // Mouse button events are also kept in their own history, other events can not push them out
+    if (type == RAYLIB_INPUT_EVENT_MOUSE_BUTTON)
     {
-        while (((dp = readdir(dir)) != NULL) && (files->count < files->capacity))
-        {
-            if ((strcmp(dp->d_name, ".") != 0) && (strcmp(dp->d_name, "..") != 0))
-            {
-                // Construct new path from our base path
-            #if defined(_WIN32)
-                sprintf(path, "%s\\%s", basePath, dp->d_name);
-            #else
-                sprintf(path, "%s/%s", basePath, dp->d_name);
-            #endif
-
-                if (RaylibIsPathFile(path))
-                {
-                    if (filter != NULL)
-                    {
-                        if (RaylibIsFileExtension(path, filter))
-                        {
-                            strcpy(files->paths[files->count], path);
-                            files->count++;
-                        }
-                    }
-                    else
-                    {
-                        strcpy(files->paths[files->count], path);
-                        files->count++;
-                    }
+        queue->mouseButtons[queue->mouseTail & (RAYLIB_MAX_MOUSE_BUTTON_EVENTS - 1)] = event;
+        queue->mouseTail++;
 
-                    if (files->count >= files->capacity)
-                    {
-                        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "FILEIO: Maximum filepath scan capacity reached (%i files)", files->capacity);
-                        break;
-                    }
-                }
-                else
-                {
-                    if ((filter != NULL) && (RaylibTextFindIndex(filter, DIRECTORY_FILTER_TAG) >= 0))
-                    {
-                        strcpy(files->paths[files->count], path);
-                        files->count++;
-                    }
+        if ((queue->mouseTail - queue->mouseHead) > RAYLIB_MAX_MOUSE_BUTTON_EVENTS) queue->mouseHead = queue->mouseTail - RAYLIB_MAX_MOUSE_BUTTON_EVENTS;
+    }
 
-                    if (files->count >= files->capacity)
-                    {
-                        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "FILEIO: Maximum filepath scan capacity reached (%i files)", files->capacity);
-                        break;
-                    }
+    if ((queue->tail - queue->head) == queue->capacity)
+    {
+        unsigned int capacity = (queue->capacity > 0)? queue->capacity*2 : RAYLIB_INPUT_EVENT_QUEUE_CAPACITY;
+        RaylibInputEvent *events = (RaylibInputEvent *)RL_MALLOC(capacity*sizeof(RaylibInputEvent));
 
-                    ScanDirectoryFilesRecursively(path, files, filter);
-                }
-            }
+        if (events == NULL)
+        {
+            INPUT_EVENTS_UNLOCK();
+            RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "INPUT: Failed to grow input events queue, event discarded");
+            return;
         }
 
-        closedir(dir);
+        // Move stored events to new buffer, positions are kept
+        for (unsigned int i = queue->head; i != queue->tail; i++) events[i & (capacity - 1)] = queue->events[i & (queue->capacity - 1)];
+
+        RL_FREE(queue->events);
+        queue->events = events;
+        queue->capacity = capacity;
     }
-    else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", basePath);
+
+    queue->events[queue->tail & (queue->capacity - 1)] = event;
+    queue->tail++;
+
+    INPUT_EVENTS_UNLOCK();
+}
+
+// Reset input events registered for a new frame
+// NOTE: Mouse button events from previous frames are kept in their own history, required by RaylibHasMouseButtonBeenDown()
+static void ResetInputEvents(void)
+{
+    InputEventQueue *queue = &CORE.Input.events;
+
+    INPUT_EVENTS_LOCK();
+
+    queue->head = queue->tail;
+    queue->frameHead = queue->tail;
+    queue->keyHead = queue->tail;
+    queue->charHead = queue->tail;
+
+    INPUT_EVENTS_UNLOCK();
 }
 
 #if defined(RAYLIB_SUPPORT_AUTOMATION_EVENTS)
@@ -4109,6 +5410,231 @@ static void RecordAutomationEvent(void)
 }
 #endif
 
+#if defined(RAYLIB_SUPPORT_GIF_RECORDING) || defined(RAYLIB_SUPPORT_MODULE_RTEXTURES)
+// Capture screen frame, pixels are read back and encoded asynchronously (GIF frame or screenshot)
+// NOTE: Returns false if all capture buffers are busy, unless wait is requested (pending frames are flushed)
+static bool CaptureScreenFrame(bool gifFrame, int width, int height, int delay, const char *fileName, bool wait)
+{
+    double startTime = RaylibGetTime();
+    ScreenCaptureBuffer *buffer = NULL;
+
+    if ((width <= 0) || (height <= 0)) return false;
+
+    if (captureStats.pendingCount > 0) UpdateScreenCapture(false);
+
+    for (int i = 0; (i < RAYLIB_SCREEN_CAPTURE_BUFFERS) && (buffer == NULL); i++)
+    {
+        if (captureBuffers[i].state == SCREEN_CAPTURE_FREE) buffer = &captureBuffers[i];
+    }
+
+    if ((buffer == NULL) && wait)
+    {
+        FlushScreenCapture();
+        buffer = &captureBuffers[0];
+    }
+
+    if (buffer == NULL)
+    {
+        captureStats.droppedCount++;
+        captureFrameTime += RaylibGetTime() - startTime;
+        return false;
+    }
+
+    buffer->gifFrame = gifFrame;
+    buffer->width = width;
+    buffer->height = height;
+    buffer->delay = delay;
+    buffer->sequence = captureSequence++;
+    buffer->encodeTime = 0.0;
+    if (fileName != NULL) strcpy(buffer->fileName, fileName);
+
+    // Pixel pack buffer is reloaded on screen size change
+    // NOTE: If not supported pboId is 0 and pixels are read synchronously
+    int size = width*height*4;
+
+    if (buffer->pboSize != size)
+    {
+        if (buffer->pboId != 0) rlUnloadPixelPackBuffer(buffer->pboId);
+
+        buffer->pboId = rlLoadPixelPackBuffer(size);
+        buffer->pboSize = size;
+    }
+
+    if (buffer->pboId != 0)
+    {
+        buffer->fence = rlReadScreenPixelsAsync(buffer->pboId, width, height);
+        buffer->state = SCREEN_CAPTURE_READING;
+    }
+    else
+    {
+        buffer->pixels = rlReadScreenPixels(width, height);
+        buffer->state = SCREEN_CAPTURE_ENCODING;
+        buffer->ticket = QueueBackgroundTask(EncodeScreenCapture, buffer);
+        captureTicket = buffer->ticket;
+    }
+
+    captureStats.async = (buffer->pboId != 0);
+    captureStats.frameCount++;
+    captureStats.pendingCount++;
+    captureFrameTime += RaylibGetTime() - startTime;
+
+    return true;
+}
+
+// Queue read back frames for encoding (in capture order) and release encoded frames buffers
+// NOTE: If wait is requested, all frames being read are queued for encoding, waiting for GPU if required
+static void UpdateScreenCapture(bool wait)
+{
+    // Queue frames for encoding in capture order, stop at first frame not read back yet
+    while (true)
+    {
+        ScreenCaptureBuffer *buffer = NULL;
+
+        for (int i = 0; i < RAYLIB_SCREEN_CAPTURE_BUFFERS; i++)
+        {
+            if ((captureBuffers[i].state == SCREEN_CAPTURE_READING) &&
+                ((buffer == NULL) || ((int)(captureBuffers[i].sequence - buffer->sequence) < 0))) buffer = &captureBuffers[i];
+        }
+
+        if ((buffer == NULL) || !rlIsPixelsReadComplete(buffer->fence, wait)) break;
+
+        rlUnloadPixelsReadFence(buffer->fence);
+        buffer->fence = NULL;
+        buffer->pixels = rlMapPixelPackBuffer(buffer->pboId, buffer->pboSize);
+
+        if (buffer->pixels == NULL)
+        {
+            RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "SYSTEM: Screen capture pixels could not be read back, frame dropped");
+            buffer->state = SCREEN_CAPTURE_FREE;
+            continue;
+        }
+
+        buffer->state = SCREEN_CAPTURE_ENCODING;
+        buffer->ticket = QueueBackgroundTask(EncodeScreenCapture, buffer);
+        captureTicket = buffer->ticket;
+    }
+
+    // Release encoded frames buffers
+    captureStats.pendingCount = 0;
+
+    for (int i = 0; i < RAYLIB_SCREEN_CAPTURE_BUFFERS; i++)
+    {
+        ScreenCaptureBuffer *buffer = &captureBuffers[i];
+
+        if ((buffer->state == SCREEN_CAPTURE_ENCODING) && IsBackgroundTaskDone(buffer->ticket))
+        {
+            if (buffer->pboId != 0) rlUnmapPixelPackBuffer(buffer->pboId);
+            else RL_FREE(buffer->pixels);
+
+            buffer->pixels = NULL;
+            buffer->state = SCREEN_CAPTURE_FREE;
+
+            captureStats.encodeTime = (float)buffer->encodeTime;
+            if (captureStats.encodeTime > captureStats.maxEncodeTime) captureStats.maxEncodeTime = captureStats.encodeTime;
+        }
+
+        if (buffer->state != SCREEN_CAPTURE_FREE) captureStats.pendingCount++;
+    }
+}
+
+// Wait until all captured frames are read back and encoded
+static void FlushScreenCapture(void)
+{
+    UpdateScreenCapture(true);
+    WaitBackgroundTask(captureTicket);
+    UpdateScreenCapture(false);
+}
+
+// Flush and unload screen capture buffers
+static void CloseScreenCapture(void)
+{
+    FlushScreenCapture();
+
+    for (int i = 0; i < RAYLIB_SCREEN_CAPTURE_BUFFERS; i++)
+    {
+        if (captureBuffers[i].pboId != 0) rlUnloadPixelPackBuffer(captureBuffers[i].pboId);
+        captureBuffers[i] = (ScreenCaptureBuffer){ 0 };
+    }
+}
+
+// Encode captured frame, GIF frame or screenshot file
+// NOTE: Processed on background thread, pixels read back from pixel pack buffer are bottom row first
+static void EncodeScreenCapture(void *userData)
+{
+    ScreenCaptureBuffer *buffer = (ScreenCaptureBuffer *)userData;
+    double startTime = RaylibGetTime();
+    bool bottomUp = (buffer->pboId != 0);
+    int pitch = buffer->width*4;
+
+#if defined(RAYLIB_SUPPORT_GIF_RECORDING)
+    if (buffer->gifFrame)
+    {
+        // NOTE: Negative pitch flips the image, alpha is not used
+        msf_gif_frame(&gifState, buffer->pixels, buffer->delay, GIF_RECORD_BITRATE, bottomUp? -pitch : pitch);
+    }
+#endif
+
+#if defined(RAYLIB_SUPPORT_MODULE_RTEXTURES)
+    if (!buffer->gifFrame)
+    {
+        unsigned char *imgData = buffer->pixels;
+
+        // Flip image vertically, alpha set to 255 (no transparent image retrieval)
+        if (bottomUp)
+        {
+            imgData = (unsigned char *)RL_MALLOC(buffer->height*pitch*sizeof(unsigned char));
+
+            for (int y = 0; y < buffer->height; y++)
+            {
+                unsigned char *row = imgData + y*pitch;
+                memcpy(row, buffer->pixels + (buffer->height - 1 - y)*pitch, pitch);
+                for (int x = 3; x < pitch; x += 4) row[x] = 255;
+            }
+        }
+
+        RaylibImage image = { imgData, buffer->width, buffer->height, 1, RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+        RaylibExportImage(image, buffer->fileName);           // WARNING: Module required: rtextures
+
+        if (bottomUp) RL_FREE(imgData);
+
+        if (RaylibFileExists(buffer->fileName)) RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", buffer->fileName);
+        else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "SYSTEM: [%s] Screenshot could not be saved", buffer->fileName);
+    }
+#endif
+
+    buffer->encodeTime = RaylibGetTime() - startTime;
+}
+#endif  // RAYLIB_SUPPORT_GIF_RECORDING || RAYLIB_SUPPORT_MODULE_RTEXTURES
+
+#if defined(RAYLIB_SUPPORT_GIF_RECORDING)
+// Begin GIF recording, userData: frames width and height
+// NOTE: Processed on background thread, as all gifState accesses
+static void BeginGifRecording(void *userData)
+{
+    int *size = (int *)userData;
+
+    msf_gif_begin(&gifState, size[0], size[1]);
+
+    RL_FREE(size);
+}
+
+// End GIF recording, saved to userData file path if not NULL
+// NOTE: Processed on background thread, once all recording frames are encoded
+static void EndGifRecording(void *userData)
+{
+    char *fileName = (char *)userData;
+    MsfGifResult result = msf_gif_end(&gifState);
+
+    if (fileName != NULL)
+    {
+        if (RaylibSaveFileData(fileName, result.data, (unsigned int)result.dataSize)) RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "SYSTEM: [%s] Animated GIF recording saved successfully", fileName);
+        RL_FREE(fileName);
+    }
+
+    msf_gif_free(result);
+}
+#endif
+
 #if !defined(RAYLIB_SUPPORT_MODULE_RTEXT)
 // Formatting of text with variables to 'embed'
 // WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
@@ -20,6 +20,12 @@
 *
 *       Internal buffer (and resources) must be manually unloaded calling rlglClose()
 *
+*       Draw sorting can be enabled with rlEnableDrawSorting() for 2D layers: batch draw calls
+*       are stable-sorted by (layer, texture) and adjacent draws sharing mode are merged before
+*       submission, so painter's order is only kept between layers (rlSetDrawLayer()) and between
+*       draws sharing a texture. Sorting works on one batch at a time: up to RL_DEFAULT_BATCH_DRAWCALLS
+*       draw calls (and batch vertex capacity), a full batch is submitted before recording more draws
+*
 *   CONFIGURATION:
 *       #define RAYLIB_GRAPHICS_API_OPENGL_11
 *       #define RAYLIB_GRAPHICS_API_OPENGL_21
@@ -46,6 +52,11 @@
 *       #define RLGL_ENABLE_OPENGL_DEBUG_CONTEXT
 *           Enable debug context (only available on OpenGL 4.3)
 *
+*       #define RLGL_ENABLE_BATCH_STREAMING
+*           Stream render batch vertex data over a ring of buffers to avoid CPU stalls on the driver:
+*           persistent mapped buffers synced with fences on OpenGL 4.3 (GL_ARB_buffer_storage),
+*           buffer orphaning on OpenGL 3.3 and OpenGL ES
+*
 *       rlgl capabilities could be customized just defining some internal
 *       values before library inclusion (default values listed):
 *
@@ -53,6 +64,7 @@
 *       #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering)
 *       #define RL_DEFAULT_BATCH_DRAWCALLS          256    // Default number of batch draw calls (by state changes: mode, texture)
 *       #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (RaylibSetShaderValueTexture())
+*       #define RL_DEFAULT_BATCH_STREAM_BUFFERS       3    // Minimum number of batch buffers when streaming (RLGL_ENABLE_BATCH_STREAMING)
 *
 *       #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal RaylibMatrix stack
 *       #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
@@ -221,6 +233,9 @@
 #ifndef RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS
     #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (RaylibSetShaderValueTexture())
 #endif
+#ifndef RL_DEFAULT_BATCH_STREAM_BUFFERS
+    #define RL_DEFAULT_BATCH_STREAM_BUFFERS          3      // Minimum number of batch buffers when streaming (RLGL_ENABLE_BATCH_STREAMING)
+#endif
 
 // Internal RaylibMatrix stack
 #ifndef RL_MAX_MATRIX_STACK_SIZE
@@ -393,6 +408,8 @@ typedef struct rlVertexBuffer {
 #endif
     unsigned int vaoId;         // OpenGL Vertex Array Object id
     unsigned int vboId[5];      // OpenGL Vertex Buffer Objects id (5 types of vertex data)
+    void *fence;                // OpenGL fence sync object (GLsync), set while GPU could be reading the buffer (persistent streaming)
+    void *mappedData[4];        // Persistent mapped data (positions, texcoords, normals, colors), vertex arrays point to a RAM copy while draw sorting
 } rlVertexBuffer;
 
 // Draw call type
@@ -406,6 +423,7 @@ typedef struct rlDrawCall {
     //unsigned int vaoId;       // Vertex array id to be used on the draw -> Using RLGL.currentBatch->vertexBuffer.vaoId
     //unsigned int shaderId;    // RaylibShader id to be used on the draw -> Using RLGL.currentShaderId
     unsigned int textureId;     // RaylibTexture id to be used on the draw -> Use to create new draw call if changes
+    int layer;                  // Draw layer, first sort key when draw sorting is enabled
 
     //RaylibMatrix projection;        // Projection matrix for this draw -> Using RLGL.projection by default
     //RaylibMatrix modelview;         // Modelview matrix for this draw -> Using RLGL.modelview by default
@@ -420,8 +438,23 @@ typedef struct rlRenderBatch {
     rlDrawCall *draws;          // Draw calls array, depends on textureId
     int drawCounter;            // Draw calls counter
     float currentDepth;         // Current depth value for next draw
+
+    int streamMode;             // Vertex data upload mode (rlBatchStreamMode)
+    int streamWaitCount;        // Number of times CPU had to wait for GPU to release a buffer (persistent streaming)
+
+    int drawsRecorded;          // Number of non-empty draw calls recorded (accumulated, reset by user)
+    int drawsIssued;            // Number of draw calls submitted to GPU after sorting/merging (accumulated, reset by user)
+    void *sortBuffer;           // Scratch memory used to reorder vertex data on draw sorting (allocated on first use)
+    void *recordBuffer;         // RAM vertex data recorded while draw sorting on persistent streaming, mapped buffers are write-only
 } rlRenderBatch;
 
+// Render batch vertex data upload mode
+typedef enum {
+    RL_BATCH_STREAM_SUBDATA = 0,    // Vertex data copied from CPU arrays with glBufferSubData() (default)
+    RL_BATCH_STREAM_ORPHANING,      // Buffer storage orphaned with glBufferData(NULL) before copying CPU arrays
+    RL_BATCH_STREAM_PERSISTENT      // Vertex data written directly into persistent mapped buffers, synced with fences
+} rlBatchStreamMode;
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -723,10 +756,15 @@ RAYLIB_RLAPI rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 RAYLIB_RLAPI void rlUnloadRenderBatch(rlRenderBatch batch);    // Unload render batch system
 RAYLIB_RLAPI void rlDrawRenderBatch(rlRenderBatch *batch);     // Draw render batch data (Update->Draw->Reset)
 RAYLIB_RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch); // Set the active render batch for rlgl (NULL for default internal)
+RAYLIB_RLAPI rlRenderBatch *rlGetRenderBatchActive(void);      // Get the active render batch for rlgl (default internal if none set)
 RAYLIB_RLAPI void rlDrawRenderBatchActive(void);               // Update and draw internal render batch
 RAYLIB_RLAPI bool rlCheckRenderBatchLimit(int vCount);         // Check internal buffer overflow for a given number of vertex
 
 RAYLIB_RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
+RAYLIB_RLAPI void rlEnableDrawSorting(void);                   // Enable draw calls sorting and merging on batch draw (2D layers)
+RAYLIB_RLAPI void rlDisableDrawSorting(void);                  // Disable draw calls sorting and merging on batch draw
+RAYLIB_RLAPI bool rlIsDrawSortingEnabled(void);                // Check if draw sorting is enabled
+RAYLIB_RLAPI void rlSetDrawLayer(int layer);                   // Set current draw layer, only used as sort key if draw sorting is enabled
 
 //------------------------------------------------------------------------------------------------------------------------
 
@@ -757,6 +795,13 @@ RAYLIB_RLAPI void rlUnloadTexture(unsigned int id);
 RAYLIB_RLAPI void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps); // Generate mipmap data for selected texture
 RAYLIB_RLAPI void *rlReadTexturePixels(unsigned int id, int width, int height, int format); // Read texture pixel data
 RAYLIB_RLAPI unsigned char *rlReadScreenPixels(int width, int height);           // Read screen pixel data (color buffer)
+RAYLIB_RLAPI unsigned int rlLoadPixelPackBuffer(int size);                       // Load pixel pack buffer (PBO) for asynchronous pixels read, returns 0 if not supported
+RAYLIB_RLAPI void rlUnloadPixelPackBuffer(unsigned int id);                      // Unload pixel pack buffer
+RAYLIB_RLAPI void *rlReadScreenPixelsAsync(unsigned int id, int width, int height); // Start reading screen pixel data into pixel pack buffer, returns read fence
+RAYLIB_RLAPI bool rlIsPixelsReadComplete(void *fence, bool wait);                // Check if asynchronous pixels read is completed, optionally waiting for it
+RAYLIB_RLAPI void rlUnloadPixelsReadFence(void *fence);                          // Unload asynchronous pixels read fence
+RAYLIB_RLAPI unsigned char *rlMapPixelPackBuffer(unsigned int id, int size);     // Map pixel pack buffer data for reading (bottom row first, alpha not modified)
+RAYLIB_RLAPI void rlUnmapPixelPackBuffer(unsigned int id);                       // Unmap pixel pack buffer data
 
 // Framebuffer management (fbo)
 RAYLIB_RLAPI unsigned int rlLoadFramebuffer(void);                               // Load an empty framebuffer
@@ -1063,6 +1108,8 @@ typedef struct rlglData {
         int *currentShaderLocs;             // Current shader locations pointer to be used on rendering (by default, defaultShaderLocs)
 
         bool stereoRender;                  // Stereo rendering flag
+        bool drawSorting;                   // Draw calls sorting and merging flag
+        int drawLayer;                      // Current draw layer (draw sorting key)
         RaylibMatrix projectionStereo[2];         // VR stereo rendering eyes projection matrices
         RaylibMatrix viewOffsetStereo[2];         // VR stereo rendering eyes view offset matrices
 
@@ -1100,6 +1147,7 @@ typedef struct rlglData {
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // RaylibShader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool bufferStorage;                 // Immutable buffer storage support, required for persistent mapping (GL_ARB_buffer_storage)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
@@ -1109,6 +1157,16 @@ typedef struct rlglData {
 
 typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions loader signature (same as GLADloadproc)
 
+// Draw call sort key, used to reorder batch draws when draw sorting is enabled
+typedef struct rlDrawCallKey {
+    int layer;                  // Draw layer
+    unsigned int textureId;     // Draw texture id
+    int mode;                   // Draw mode (not sorted, only merged)
+    int index;                  // Draw index on batch (keeps sorting stable)
+    int vertexOffset;           // Draw first vertex on batch buffer
+    int vertexCount;            // Draw number of vertex
+} rlDrawCallKey;
+
 #endif  // RAYLIB_GRAPHICS_API_OPENGL_33 || RAYLIB_GRAPHICS_API_OPENGL_ES2
 
 //----------------------------------------------------------------------------------
@@ -1139,6 +1197,11 @@ static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+static void rlLoadBatchVertexArrays(rlVertexBuffer *buffer); // Load render batch vertex data arrays in RAM (CPU), zero initialized
+static void *rlLoadBatchBufferData(int size, const void *data, int streamMode); // Load render batch vertex data into bound array buffer
+static void rlSortRenderBatchDraws(rlRenderBatch *batch);    // Sort render batch draw calls by key and merge compatible ones
+static void rlSelectBatchVertexArrays(rlRenderBatch *batch); // Select vertex arrays written by rlVertex3f(), RAM copy while draw sorting on persistent streaming
+static int rlCompareDrawCallKeys(const void *a, const void *b); // Compare draw call keys for sorting (layer, texture, index)
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static const char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
@@ -1475,6 +1538,7 @@ void rlBegin(int mode)
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = RLGL.State.defaultTextureId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = RLGL.State.drawLayer;
     }
 }
 
@@ -1671,11 +1735,91 @@ void rlSetTexture(unsigned int id)
 
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = RLGL.State.drawLayer;
         }
 #endif
     }
 }
 
+// Enable draw calls sorting and merging on batch draw
+// NOTE: Draws already recorded are submitted first, they were not recorded expecting reordering,
+// draws are only sorted within a batch (up to RL_DEFAULT_BATCH_DRAWCALLS draw calls)
+void rlEnableDrawSorting(void)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.State.drawSorting)
+    {
+        rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.State.drawSorting = true;
+        rlSelectBatchVertexArrays(RLGL.currentBatch);
+    }
+#endif
+}
+
+// Disable draw calls sorting and merging on batch draw
+void rlDisableDrawSorting(void)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.drawSorting)
+    {
+        rlDrawRenderBatch(RLGL.currentBatch);   // Draws recorded with sorting enabled are still sorted
+        RLGL.State.drawSorting = false;
+        rlSelectBatchVertexArrays(RLGL.currentBatch);
+    }
+#endif
+}
+
+// Check if draw sorting is enabled
+bool rlIsDrawSortingEnabled(void)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    return RLGL.State.drawSorting;
+#else
+    return false;
+#endif
+}
+
+// Set current draw layer
+// NOTE: Layer is only used as first sort key when draw sorting is enabled, a layer change
+// registers a new draw call keeping current mode and texture
+void rlSetDrawLayer(int layer)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.drawLayer = layer;
+
+    if (RLGL.State.drawSorting && (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer != layer))
+    {
+        rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+        if (draw->vertexCount > 0)
+        {
+            int mode = draw->mode;
+            unsigned int textureId = draw->textureId;
+
+            // Make sure current draw vertexCount is aligned a multiple of 4 (same as rlBegin() and rlSetTexture())
+            if (draw->mode == RL_LINES) draw->vertexAlignment = ((draw->vertexCount < 4)? draw->vertexCount : draw->vertexCount%4);
+            else if (draw->mode == RL_TRIANGLES) draw->vertexAlignment = ((draw->vertexCount < 4)? 1 : (4 - (draw->vertexCount%4)));
+            else draw->vertexAlignment = 0;
+
+            if (!rlCheckRenderBatchLimit(draw->vertexAlignment))
+            {
+                RLGL.State.vertexCounter += draw->vertexAlignment;
+                RLGL.currentBatch->drawCounter++;
+            }
+
+            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+
+            draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+            draw->mode = mode;
+            draw->textureId = textureId;
+            draw->vertexCount = 0;
+        }
+
+        draw->layer = layer;
+    }
+#endif
+}
+
 // Select and active a texture slot
 void rlActiveTextureSlot(int slot)
 {
@@ -2391,6 +2535,7 @@ void rlLoadExtensions(void *loader)
     #if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
     RLGL.ExtSupported.computeShader = GLAD_GL_ARB_compute_shader;
     RLGL.ExtSupported.ssbo = GLAD_GL_ARB_shader_storage_buffer_object;
+    RLGL.ExtSupported.bufferStorage = GLAD_GL_ARB_buffer_storage;
     #endif
 
 #endif  // RAYLIB_GRAPHICS_API_OPENGL_33
@@ -2726,18 +2871,26 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     rlRenderBatch batch = { 0 };
 
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+#if defined(RLGL_ENABLE_BATCH_STREAMING)
+    // Streaming rotates over several buffers, so the buffer being filled is not the one GPU could be reading
+    batch.streamMode = RL_BATCH_STREAM_ORPHANING;
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
+    if (RLGL.ExtSupported.bufferStorage) batch.streamMode = RL_BATCH_STREAM_PERSISTENT;
+#endif
+    if (numBuffers < RL_DEFAULT_BATCH_STREAM_BUFFERS) numBuffers = RL_DEFAULT_BATCH_STREAM_BUFFERS;
+#endif
+
     // Initialize CPU (RAM) vertex buffers (position, texcoord, color data and indexes)
+    // NOTE: On persistent streaming, vertex data arrays are mapped from GPU buffers
     //--------------------------------------------------------------------------------------------
-    batch.vertexBuffer = (rlVertexBuffer *)RL_MALLOC(numBuffers*sizeof(rlVertexBuffer));
+    batch.vertexBuffer = (rlVertexBuffer *)RL_CALLOC(numBuffers, sizeof(rlVertexBuffer));
 
     for (int i = 0; i < numBuffers; i++)
     {
         batch.vertexBuffer[i].elementCount = bufferElements;
 
-        batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
-        batch.vertexBuffer[i].normals = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+        if (batch.streamMode != RL_BATCH_STREAM_PERSISTENT) rlLoadBatchVertexArrays(&batch.vertexBuffer[i]);
+
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
         batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
 #endif
@@ -2745,11 +2898,6 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         batch.vertexBuffer[i].indices = (unsigned short *)RL_MALLOC(bufferElements*6*sizeof(unsigned short));  // 6 int by quad (indices)
 #endif
 
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
-        for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].normals[j] = 0.0f;
-        for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
-
         int k = 0;
 
         // Indices can be initialized right now
@@ -2786,31 +2934,63 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         // Vertex position buffer (shader-location = 0)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
         glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
+        void *mappedData = rlLoadBatchBufferData(bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, batch.streamMode);
+        if (mappedData != NULL) batch.vertexBuffer[i].vertices = (float *)mappedData;
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
 
         // Vertex texcoord buffer (shader-location = 1)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
         glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
+        mappedData = rlLoadBatchBufferData(bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, batch.streamMode);
+        if (mappedData != NULL) batch.vertexBuffer[i].texcoords = (float *)mappedData;
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
 
         // Vertex normal buffer (shader-location = 2)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
         glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].normals, GL_DYNAMIC_DRAW);
+        mappedData = rlLoadBatchBufferData(bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].normals, batch.streamMode);
+        if (mappedData != NULL) batch.vertexBuffer[i].normals = (float *)mappedData;
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
 
         // Vertex color buffer (shader-location = 3)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
         glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[3]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
+        mappedData = rlLoadBatchBufferData(bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, batch.streamMode);
+        if (mappedData != NULL) batch.vertexBuffer[i].colors = (unsigned char *)mappedData;
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
 
+        if ((batch.streamMode == RL_BATCH_STREAM_PERSISTENT) && ((batch.vertexBuffer[i].vertices == NULL) ||
+            (batch.vertexBuffer[i].texcoords == NULL) || (batch.vertexBuffer[i].normals == NULL) || (batch.vertexBuffer[i].colors == NULL)))
+        {
+            // Persistent mapping failed, fallback to orphaning with vertex data arrays in RAM (CPU)
+            // NOTE: Immutable storage can not be reallocated, buffers loaded up to now are deleted and loaded again
+            RAYLIB_TRACELOG(RL_LOG_WARNING, "RLGL: Render batch persistent mapping failed, using buffer orphaning");
+
+            for (int j = 0; j <= i; j++)
+            {
+                glDeleteBuffers(5, batch.vertexBuffer[j].vboId);
+                if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[j].vaoId);
+            }
+
+            batch.streamMode = RL_BATCH_STREAM_ORPHANING;
+            for (int j = 0; j < numBuffers; j++) rlLoadBatchVertexArrays(&batch.vertexBuffer[j]);
+
+            i = -1;
+            continue;
+        }
+
+        if (batch.streamMode == RL_BATCH_STREAM_PERSISTENT)
+        {
+            batch.vertexBuffer[i].mappedData[0] = batch.vertexBuffer[i].vertices;
+            batch.vertexBuffer[i].mappedData[1] = batch.vertexBuffer[i].texcoords;
+            batch.vertexBuffer[i].mappedData[2] = batch.vertexBuffer[i].normals;
+            batch.vertexBuffer[i].mappedData[3] = batch.vertexBuffer[i].colors;
+        }
+
         // Fill index buffer
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[4]);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[4]);
@@ -2822,7 +3002,9 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 #endif
     }
 
-    RAYLIB_TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
+    if (batch.streamMode == RL_BATCH_STREAM_PERSISTENT) RAYLIB_TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU) [persistent mapped: %i buffers]", numBuffers);
+    else if (batch.streamMode == RL_BATCH_STREAM_ORPHANING) RAYLIB_TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU) [orphaning: %i buffers]", numBuffers);
+    else RAYLIB_TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
 
     // Unbind the current VAO
     if (RLGL.ExtSupported.vao) glBindVertexArray(0);
@@ -2840,6 +3022,7 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         //batch.draws[i].vaoId = 0;
         //batch.draws[i].shaderId = 0;
         batch.draws[i].textureId = RLGL.State.defaultTextureId;
+        batch.draws[i].layer = RLGL.State.drawLayer;
         //batch.draws[i].RLGL.State.projection = rlMatrixIdentity();
         //batch.draws[i].RLGL.State.modelview = rlMatrixIdentity();
     }
@@ -2875,7 +3058,12 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
             glBindVertexArray(0);
         }
 
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
+        if (batch.vertexBuffer[i].fence != NULL) glDeleteSync((GLsync)batch.vertexBuffer[i].fence);
+#endif
+
         // Delete VBOs from GPU (VRAM)
+        // NOTE: Persistent mapped buffers are unmapped on deletion
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
@@ -2886,16 +3074,21 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
 
         // Free vertex arrays memory from CPU (RAM)
-        RL_FREE(batch.vertexBuffer[i].vertices);
-        RL_FREE(batch.vertexBuffer[i].texcoords);
-        RL_FREE(batch.vertexBuffer[i].normals);
-        RL_FREE(batch.vertexBuffer[i].colors);
+        if (batch.streamMode != RL_BATCH_STREAM_PERSISTENT)
+        {
+            RL_FREE(batch.vertexBuffer[i].vertices);
+            RL_FREE(batch.vertexBuffer[i].texcoords);
+            RL_FREE(batch.vertexBuffer[i].normals);
+            RL_FREE(batch.vertexBuffer[i].colors);
+        }
         RL_FREE(batch.vertexBuffer[i].indices);
     }
 
     // Unload arrays
     RL_FREE(batch.vertexBuffer);
     RL_FREE(batch.draws);
+    RL_FREE(batch.sortBuffer);
+    RL_FREE(batch.recordBuffer);
 #endif
 }
 
@@ -2904,32 +3097,53 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
 void rlDrawRenderBatch(rlRenderBatch *batch)
 {
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    // Sort and merge draw calls (if enabled), vertex data is reordered before upload
+    //------------------------------------------------------------------------------------------------------------
+    if (RLGL.State.vertexCounter > 0)
+    {
+        for (int i = 0; i < batch->drawCounter; i++) if (batch->draws[i].vertexCount > 0) batch->drawsRecorded++;
+
+        // NOTE: Persistent mapped buffers are write-only, draws are only sorted if recorded in RAM
+        bool recordedInRam = (batch->vertexBuffer[batch->currentBuffer].vertices != batch->vertexBuffer[batch->currentBuffer].mappedData[0]);
+
+        if (RLGL.State.drawSorting && (batch->drawCounter > 1) && recordedInRam) rlSortRenderBatchDraws(batch);
+
+        for (int i = 0; i < batch->drawCounter; i++) if (batch->draws[i].vertexCount > 0) batch->drawsIssued++;
+    }
+    //------------------------------------------------------------------------------------------------------------
+
     // Update batch vertex buffers
     //------------------------------------------------------------------------------------------------------------
     // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
+    // NOTE: Persistent mapped buffers are already written by rlVertex3f() and coherent, no upload required,
+    // except for vertex data recorded in RAM for draw sorting, just copied to mapped buffers
     // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (use a change detector flag?)
-    if (RLGL.State.vertexCounter > 0)
+    if ((RLGL.State.vertexCounter > 0) && (batch->streamMode != RL_BATCH_STREAM_PERSISTENT))
     {
         // Activate elements VAO
         if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
 
         // Vertex positions buffer
         glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+        if (batch->streamMode == RL_BATCH_STREAM_ORPHANING) glBufferData(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].elementCount*3*4*sizeof(float), NULL, GL_DYNAMIC_DRAW);   // Orphan storage, GPU could still be using it
         glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
         //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
 
         // RaylibTexture coordinates buffer
         glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
+        if (batch->streamMode == RL_BATCH_STREAM_ORPHANING) glBufferData(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].elementCount*2*4*sizeof(float), NULL, GL_DYNAMIC_DRAW);
         glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
         //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
 
         // Normals buffer
         glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
+        if (batch->streamMode == RL_BATCH_STREAM_ORPHANING) glBufferData(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].elementCount*3*4*sizeof(float), NULL, GL_DYNAMIC_DRAW);
         glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].normals);
         //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].normals, GL_DYNAMIC_DRAW); // Update all buffer
 
         // Colors buffer
         glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
+        if (batch->streamMode == RL_BATCH_STREAM_ORPHANING) glBufferData(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].elementCount*4*4*sizeof(unsigned char), NULL, GL_DYNAMIC_DRAW);
         glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
         //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
 
@@ -2951,6 +3165,15 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         // Unbind the current VAO
         if (RLGL.ExtSupported.vao) glBindVertexArray(0);
     }
+    else if ((RLGL.State.vertexCounter > 0) && (batch->vertexBuffer[batch->currentBuffer].vertices != batch->vertexBuffer[batch->currentBuffer].mappedData[0]))
+    {
+        // NOTE: GPU already released current buffer (fence waited on buffer change), only written, never read
+        rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+        memcpy(buffer->mappedData[0], buffer->vertices, RLGL.State.vertexCounter*3*sizeof(float));
+        memcpy(buffer->mappedData[1], buffer->texcoords, RLGL.State.vertexCounter*2*sizeof(float));
+        memcpy(buffer->mappedData[2], buffer->normals, RLGL.State.vertexCounter*3*sizeof(float));
+        memcpy(buffer->mappedData[3], buffer->colors, RLGL.State.vertexCounter*4*sizeof(unsigned char));
+    }
     //------------------------------------------------------------------------------------------------------------
 
     // Draw batch vertex buffers (considering VR stereo if required)
@@ -3054,21 +3277,25 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 
             for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
             {
-                // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
-
-                if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
-                else
+                // NOTE: Empty draws (last draw could be empty) are skipped, nothing to submit
+                if (batch->draws[i].vertexCount > 0)
                 {
+                    // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
+                    glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+
+                    if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
+                    else
+                    {
     #if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
-                    // We need to define the number of indices to be processed: elementCount*6
-                    // NOTE: The final parameter tells the GPU the offset in bytes from the
-                    // start of the index buffer to the location of the first index to process
-                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset/4*6*sizeof(GLuint)));
+                        // We need to define the number of indices to be processed: elementCount*6
+                        // NOTE: The final parameter tells the GPU the offset in bytes from the
+                        // start of the index buffer to the location of the first index to process
+                        glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset/4*6*sizeof(GLuint)));
     #endif
     #if defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(vertexOffset/4*6*sizeof(GLushort)));
+                        glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(vertexOffset/4*6*sizeof(GLushort)));
     #endif
+                    }
                 }
 
                 vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
@@ -3090,6 +3317,14 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 
     // Restore viewport to default measures
     if (eyeCount == 2) rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
+    // Fence draw commands reading current buffer, it can't be written again until GPU is done with them
+    if ((batch->streamMode == RL_BATCH_STREAM_PERSISTENT) && (RLGL.State.vertexCounter > 0))
+    {
+        batch->vertexBuffer[batch->currentBuffer].fence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+#endif
     //------------------------------------------------------------------------------------------------------------
 
     // Reset batch buffers
@@ -3110,6 +3345,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         batch->draws[i].mode = RL_QUADS;
         batch->draws[i].vertexCount = 0;
         batch->draws[i].textureId = RLGL.State.defaultTextureId;
+        batch->draws[i].layer = RLGL.State.drawLayer;
     }
 
     // Reset active texture units for next batch
@@ -3122,6 +3358,23 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // Change to next buffer in the list (in case of multi-buffering)
     batch->currentBuffer++;
     if (batch->currentBuffer >= batch->bufferCount) batch->currentBuffer = 0;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
+    // Wait for GPU to release next buffer before rlVertex3f() writes into it
+    if (batch->vertexBuffer[batch->currentBuffer].fence != NULL)
+    {
+        GLsync fence = (GLsync)batch->vertexBuffer[batch->currentBuffer].fence;
+        GLenum result = glClientWaitSync(fence, 0, 0);
+
+        if ((result == GL_TIMEOUT_EXPIRED) || (result == GL_WAIT_FAILED)) batch->streamWaitCount++;
+
+        // NOTE: Commands are flushed on first wait so the fence is guaranteed to signal
+        while (result == GL_TIMEOUT_EXPIRED) result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+
+        glDeleteSync(fence);
+        batch->vertexBuffer[batch->currentBuffer].fence = NULL;
+    }
+#endif
 #endif
 }
 
@@ -3133,6 +3386,18 @@ void rlSetRenderBatchActive(rlRenderBatch *batch)
 
     if (batch != NULL) RLGL.currentBatch = batch;
     else RLGL.currentBatch = &RLGL.defaultBatch;
+
+    rlSelectBatchVertexArrays(RLGL.currentBatch);
+#endif
+}
+
+// Get the active render batch for rlgl
+rlRenderBatch *rlGetRenderBatchActive(void)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    return RLGL.currentBatch;
+#else
+    return NULL;
 #endif
 }
 
@@ -3700,6 +3965,102 @@ unsigned char *rlReadScreenPixels(int width, int height)
     return imgData;     // NOTE: image data should be freed
 }
 
+// Load pixel pack buffer (PBO) for asynchronous pixels read
+// NOTE: Requires OpenGL 3.3, returns 0 if not supported
+unsigned int rlLoadPixelPackBuffer(int size)
+{
+    unsigned int id = 0;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+
+    return id;
+}
+
+// Unload pixel pack buffer
+void rlUnloadPixelPackBuffer(unsigned int id)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    glDeleteBuffers(1, &id);
+#endif
+}
+
+// Start reading screen pixel data (color buffer) into pixel pack buffer, returns read fence
+// NOTE: Pixels are copied by the GPU once previous commands complete, calling thread is not stalled,
+// read completion is checked with rlIsPixelsReadComplete(), fence must be unloaded with rlUnloadPixelsReadFence()
+void *rlReadScreenPixelsAsync(unsigned int id, int width, int height)
+{
+    void *fence = NULL;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    fence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+#endif
+
+    return fence;
+}
+
+// Check if asynchronous pixels read is completed, optionally waiting for it
+bool rlIsPixelsReadComplete(void *fence, bool wait)
+{
+    bool complete = true;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    if (fence != NULL)
+    {
+        // NOTE: Commands are flushed on check so the fence is guaranteed to signal
+        GLenum result = glClientWaitSync((GLsync)fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+
+        if (wait) while (result == GL_TIMEOUT_EXPIRED) result = glClientWaitSync((GLsync)fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+
+        complete = (result != GL_TIMEOUT_EXPIRED);
+    }
+#endif
+
+    return complete;
+}
+
+// Unload asynchronous pixels read fence
+void rlUnloadPixelsReadFence(void *fence)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    if (fence != NULL) glDeleteSync((GLsync)fence);
+#endif
+}
+
+// Map pixel pack buffer data for reading
+// NOTE: Pixels keep glReadPixels() layout: bottom row first and alpha not modified,
+// mapped data can be read from any thread but buffer must be unmapped before being used again
+unsigned char *rlMapPixelPackBuffer(unsigned int id, int size)
+{
+    unsigned char *pixels = NULL;
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    pixels = (unsigned char *)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+
+    return pixels;
+}
+
+// Unmap pixel pack buffer data
+void rlUnmapPixelPackBuffer(unsigned int id)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+}
+
 // Framebuffer management (fbo)
 //-----------------------------------------------------------------------------------------
 // Load a framebuffer to be used for rendering
@@ -4993,6 +5354,189 @@ static void rlUnloadShaderDefault(void)
     RAYLIB_TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
 }
 
+// Load render batch vertex data arrays in RAM (CPU), zero initialized
+static void rlLoadBatchVertexArrays(rlVertexBuffer *buffer)
+{
+    int bufferElements = buffer->elementCount;
+
+    buffer->vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
+    buffer->texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
+    buffer->normals = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));         // 3 float by vertex, 4 vertex by quad
+    buffer->colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+
+    for (int j = 0; j < (3*4*bufferElements); j++) buffer->vertices[j] = 0.0f;
+    for (int j = 0; j < (2*4*bufferElements); j++) buffer->texcoords[j] = 0.0f;
+    for (int j = 0; j < (3*4*bufferElements); j++) buffer->normals[j] = 0.0f;
+    for (int j = 0; j < (4*4*bufferElements); j++) buffer->colors[j] = 0;
+}
+
+// Load render batch vertex data into currently bound GL_ARRAY_BUFFER
+// NOTE: On persistent streaming, immutable storage is mapped and returned, data is uploaded otherwise
+static void *rlLoadBatchBufferData(int size, const void *data, int streamMode)
+{
+    void *mappedData = NULL;
+
+    if (streamMode == RL_BATCH_STREAM_PERSISTENT)
+    {
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_43)
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+        glBufferStorage(GL_ARRAY_BUFFER, size, NULL, flags);
+        mappedData = glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags);
+
+        if (mappedData != NULL) memset(mappedData, 0, size);
+        else RAYLIB_TRACELOG(RL_LOG_WARNING, "RLGL: Failed to map render batch vertex buffer");
+#endif
+    }
+    else glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
+
+    return mappedData;
+}
+
+// Sort render batch draw calls by key (layer, texture) and merge consecutive ones sharing texture and mode
+// NOTE: Mode is not a sort key, so draws sharing a texture keep their recording order (lines over triangles)
+// NOTE: Vertex data is reordered so every merged draw is contiguous on the buffer, merged draws
+// keep the 4-vertex alignment required by QUADS indexing, sorting is stable (recording order kept)
+static void rlSortRenderBatchDraws(rlRenderBatch *batch)
+{
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+    int vertexCapacity = buffer->elementCount*4;
+
+    if (batch->sortBuffer == NULL) batch->sortBuffer = RL_MALLOC(RL_DEFAULT_BATCH_DRAWCALLS*sizeof(rlDrawCallKey) + vertexCapacity*(8*sizeof(float) + 4*sizeof(unsigned char)));
+    if (batch->sortBuffer == NULL) return;
+
+    rlDrawCallKey *keys = (rlDrawCallKey *)batch->sortBuffer;
+    float *vertices = (float *)(keys + RL_DEFAULT_BATCH_DRAWCALLS);
+    float *texcoords = vertices + vertexCapacity*3;
+    float *normals = texcoords + vertexCapacity*2;
+    unsigned char *colors = (unsigned char *)(normals + vertexCapacity*3);
+
+    // Get keys of non-empty draws
+    int keyCount = 0;
+    for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
+    {
+        if (batch->draws[i].vertexCount > 0)
+        {
+            keys[keyCount].layer = batch->draws[i].layer;
+            keys[keyCount].textureId = batch->draws[i].textureId;
+            keys[keyCount].mode = batch->draws[i].mode;
+            keys[keyCount].index = i;
+            keys[keyCount].vertexOffset = vertexOffset;
+            keys[keyCount].vertexCount = batch->draws[i].vertexCount;
+            keyCount++;
+        }
+
+        vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+    }
+
+    qsort(keys, keyCount, sizeof(rlDrawCallKey), rlCompareDrawCallKeys);
+
+    // Check reordered vertex data fits on buffer, alignment vertex could be required on different positions
+    int vertexCount = 0;
+    for (int k = 0; k < keyCount; k++)
+    {
+        if ((k > 0) && ((keys[k].textureId != keys[k - 1].textureId) || (keys[k].mode != keys[k - 1].mode))) vertexCount += (4 - vertexCount%4)%4;
+        vertexCount += keys[k].vertexCount;
+    }
+
+    if (vertexCount > vertexCapacity) return;
+
+    // Gather vertex data in sorted order, merging draws sharing texture and mode
+    // NOTE: Draws can be replaced in place, merged draws are never more than keys already processed
+    rlDrawCall *merged = batch->draws;
+    int drawCount = 0;
+    vertexCount = 0;
+
+    for (int k = 0; k < keyCount; k++)
+    {
+        int count = keys[k].vertexCount;
+        int offset = keys[k].vertexOffset;
+
+        if ((k == 0) || (keys[k].textureId != keys[k - 1].textureId) || (keys[k].mode != keys[k - 1].mode))
+        {
+            if (drawCount > 0)
+            {
+                merged[drawCount - 1].vertexAlignment = (4 - vertexCount%4)%4;
+                vertexCount += merged[drawCount - 1].vertexAlignment;
+            }
+
+            merged[drawCount].mode = keys[k].mode;
+            merged[drawCount].vertexCount = 0;
+            merged[drawCount].vertexAlignment = 0;
+            merged[drawCount].textureId = keys[k].textureId;
+            merged[drawCount].layer = keys[k].layer;
+            drawCount++;
+        }
+
+        memcpy(vertices + vertexCount*3, buffer->vertices + offset*3, count*3*sizeof(float));
+        memcpy(texcoords + vertexCount*2, buffer->texcoords + offset*2, count*2*sizeof(float));
+        memcpy(normals + vertexCount*3, buffer->normals + offset*3, count*3*sizeof(float));
+        memcpy(colors + vertexCount*4, buffer->colors + offset*4, count*4*sizeof(unsigned char));
+
+        merged[drawCount - 1].vertexCount += count;
+        vertexCount += count;
+    }
+
+    // Copy reordered data back to batch arrays
+    // NOTE: Batch arrays are always in RAM here, persistent mapped buffers are written after sorting
+    memcpy(buffer->vertices, vertices, vertexCount*3*sizeof(float));
+    memcpy(buffer->texcoords, texcoords, vertexCount*2*sizeof(float));
+    memcpy(buffer->normals, normals, vertexCount*3*sizeof(float));
+    memcpy(buffer->colors, colors, vertexCount*4*sizeof(unsigned char));
+
+    batch->drawCounter = drawCount;
+    RLGL.State.vertexCounter = vertexCount;
+}
+
+// Select vertex arrays written by rlVertex3f(), RAM copy while draw sorting on persistent streaming
+// NOTE: Sorting requires reading recorded vertex data, persistent mapped buffers are write-only,
+// all batch buffers share the same RAM copy, only current buffer is recorded at a time
+static void rlSelectBatchVertexArrays(rlRenderBatch *batch)
+{
+    if (batch->streamMode != RL_BATCH_STREAM_PERSISTENT) return;
+
+    int vertexCapacity = batch->vertexBuffer[0].elementCount*4;
+
+    if (RLGL.State.drawSorting && (batch->recordBuffer == NULL))
+    {
+        batch->recordBuffer = RL_MALLOC(vertexCapacity*(8*sizeof(float) + 4*sizeof(unsigned char)));
+        if (batch->recordBuffer == NULL) RAYLIB_TRACELOG(RL_LOG_WARNING, "RLGL: Failed to allocate draw sorting vertex data, draws not sorted");
+    }
+
+    for (int i = 0; i < batch->bufferCount; i++)
+    {
+        rlVertexBuffer *buffer = &batch->vertexBuffer[i];
+
+        if (RLGL.State.drawSorting && (batch->recordBuffer != NULL))
+        {
+            buffer->vertices = (float *)batch->recordBuffer;
+            buffer->texcoords = buffer->vertices + vertexCapacity*3;
+            buffer->normals = buffer->texcoords + vertexCapacity*2;
+            buffer->colors = (unsigned char *)(buffer->normals + vertexCapacity*3);
+        }
+        else
+        {
+            buffer->vertices = (float *)buffer->mappedData[0];
+            buffer->texcoords = (float *)buffer->mappedData[1];
+            buffer->normals = (float *)buffer->mappedData[2];
+            buffer->colors = (unsigned char *)buffer->mappedData[3];
+        }
+    }
+}
+
+// Compare draw call keys for sorting: layer, texture and recording index
+// NOTE: Shader and blend mode changes submit the batch, they never need sorting
+static int rlCompareDrawCallKeys(const void *a, const void *b)
+{
+    const rlDrawCallKey *keyA = (const rlDrawCallKey *)a;
+    const rlDrawCallKey *keyB = (const rlDrawCallKey *)b;
+
+    if (keyA->layer != keyB->layer) return (keyA->layer < keyB->layer)? -1 : 1;
+    if (keyA->textureId != keyB->textureId) return (keyA->textureId < keyB->textureId)? -1 : 1;
+
+    return (keyA->index < keyB->index)? -1 : 1;
+}
+
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 // Get compressed format official GL identifier name
 static const char *rlGetCompressedFormatName(int format)
@@ -132,11 +132,51 @@
 #ifndef RAYLIB_MAX_MESH_VERTEX_BUFFERS
     #define RAYLIB_MAX_MESH_VERTEX_BUFFERS  9    // Maximum vertex buffers (VBO) per mesh
 #endif
+#ifndef RAYLIB_SKINNING_BATCH_VERTICES
+    #define RAYLIB_SKINNING_BATCH_VERTICES 4096  // Minimum vertices skinned per worker thread range
+#endif
+#ifndef RAYLIB_SKINNING_MAX_BONES
+    #define RAYLIB_SKINNING_MAX_BONES       256  // Maximum bones used by CPU skinning (bone ids are unsigned char)
+#endif
+#ifndef RAYLIB_ANIMATION_KEY_TOLERANCE
+    #define RAYLIB_ANIMATION_KEY_TOLERANCE 0.0001f  // Keyframes reproduced by interpolation within tolerance are dropped on clips loading
+#endif
+#ifndef RAYLIB_COLLISION_BATCH_RAYS
+    #define RAYLIB_COLLISION_BATCH_RAYS      64  // Minimum rays tested per worker thread range
+#endif
+
+#define MESH_BVH_BINS                   16      // Number of bins evaluated per axis on mesh BVH splitting (binned SAH)
+#define MESH_BVH_MAX_DEPTH              64      // Maximum mesh BVH depth, also ray traversal stack size
+#define MESH_BVH_LEAF_TRIANGLES          2      // Mesh BVH nodes with this number of triangles (or less) are not split
+
+#define INSTANCE_BUFFER_BATCH_TRANSFORMS 256    // Instance transforms converted to column-major per buffer upload (stack batch)
+
+// SIMD instruction set used by CPU skinning
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #include <xmmintrin.h>  // Required for: __m128, _mm_loadu_ps(), _mm_mul_ps(), _mm_add_ps() [Used in SkinMeshVertices()]
+    #define SKINNING_SIMD_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>   // Required for: float32x4_t, vld1q_f32(), vmlaq_n_f32() [Used in SkinMeshVertices()]
+    #define SKINNING_SIMD_NEON
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// CPU skinning job data, shared by worker threads
+typedef struct SkinningJob {
+    const RaylibMesh *mesh;         // RaylibMesh to skin, animVertices and animNormals are updated
+    const float *boneColumns;       // Bone matrices in column-major order (16 floats per bone)
+} SkinningJob;
+
+// Ray collision job data for mesh BVH, shared by worker threads
+typedef struct MeshBVHRayJob {
+    const RaylibMeshBVH *bvh;       // Mesh BVH to test rays against
+    const RaylibRay *rays;          // Rays to test (world space)
+    RaylibRayCollision *collisions; // Collision results, one per ray
+    RaylibMatrix invTransform;      // World space to mesh space transform
+    RaylibMatrix normalTransform;   // Mesh space to world space normals transform (inverse transpose, handedness corrected)
+} MeshBVHRayJob;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -156,6 +196,7 @@ static RaylibModelAnimation *LoadModelAnimationsIQM(const char *fileName, int *a
 #if defined(RAYLIB_SUPPORT_FILEFORMAT_GLTF)
 static RaylibModel LoadGLTF(const char *fileName);    // Load GLTF mesh data
 static RaylibModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *animCount);  // Load GLTF animation data
+static RaylibModelAnimationClip *LoadModelAnimationClipsGLTF(const char *fileName, int *clipCount, float tolerance); // Load GLTF animation data as keyframe clips
 #endif
 #if defined(RAYLIB_SUPPORT_FILEFORMAT_VOX)
 static RaylibModel LoadVOX(const char *filename);     // Load VOX mesh data
@@ -164,6 +205,11 @@ static RaylibModel LoadVOX(const char *filename);     // Load VOX mesh data
 static RaylibModel LoadM3D(const char *filename);     // Load M3D mesh data
 static RaylibModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCount);   // Load M3D animation data
 #endif
+static void SkinMeshVertices(void *userData, int start, int end);  // Skin a range of mesh vertices (SkinningJob), blending bone matrices by weights
+static void GetRayCollisionsMeshBVH(void *userData, int start, int end);  // Get collision info for a range of rays against mesh BVH (MeshBVHRayJob)
+static void UpdateModelBoneMatrices(RaylibModel model, const RaylibTransform *pose, int boneCount);  // Update model meshes bone matrices for an animation pose (model space)
+static void UpdateModelSkinning(RaylibModel model);  // Update model meshes animated vertex data with current bone matrices (CPU skinning)
+static void SampleAnimationClipPose(RaylibModelAnimationClip clip, float time, RaylibTransform *pose);  // Sample animation clip pose at time (model space)
 #if defined(RAYLIB_SUPPORT_FILEFORMAT_OBJ) || defined(RAYLIB_SUPPORT_FILEFORMAT_MTL)
 static void ProcessMaterialsOBJ(RaylibMaterial *rayMaterials, tinyobj_material_t *materials, int materialCount);  // Process obj materials
 #endif
@@ -1670,9 +1716,170 @@ void RaylibDrawMesh(RaylibMesh mesh, RaylibMaterial material, RaylibMatrix trans
 void RaylibDrawMeshInstanced(RaylibMesh mesh, RaylibMaterial material, const RaylibMatrix *transforms, int instances)
 {
 #if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
-    // Instancing required variables
-    Raylibfloat16 *instanceTransforms = NULL;
-    unsigned int instancesVboId = 0;
+    if ((transforms == NULL) || (instances <= 0)) return;
+
+    // Instances transforms are uploaded once to a temporary instance buffer, unloaded after drawing
+    // NOTE: Instances drawn every frame should use a retained instance buffer, see RaylibLoadInstanceBuffer()
+    Raylibfloat16 *instanceTransforms = (Raylibfloat16 *)RL_MALLOC(instances*sizeof(Raylibfloat16));
+
+    if (instanceTransforms == NULL)
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "MESH: Failed to allocate instances transforms");
+        return;
+    }
+
+    for (int i = 0; i < instances; i++) instanceTransforms[i] = RaylibMatrixToFloatV(transforms[i]);
+
+    unsigned int vboId = rlLoadVertexBuffer(instanceTransforms, instances*sizeof(Raylibfloat16), false);
+    RL_FREE(instanceTransforms);
+
+    RaylibInstanceBuffer buffer = { 0 };
+    buffer.capacity = instances;
+    buffer.vboId = &vboId;
+
+    if (vboId > 0) RaylibDrawMeshInstanceBuffer(mesh, material, buffer, instances);
+
+    rlUnloadVertexBuffer(vboId);
+#endif
+}
+
+// Load instance buffer in GPU for capacity instances, with optional custom attributes (1 to 4 floats each)
+// NOTE: Instances data is uploaded with RaylibUpdateInstanceBufferTransforms() and RaylibUpdateInstanceBufferAttribute(),
+// custom attributes are sent to shader locations set in buffer.attribLocs
+RaylibInstanceBuffer RaylibLoadInstanceBuffer(int capacity, const int *attribSizes, int attribCount)
+{
+    RaylibInstanceBuffer buffer = { 0 };
+
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    if (capacity <= 0)
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "MESH: Instance buffer capacity not valid: %i", capacity);
+        return buffer;
+    }
+
+    if (attribSizes == NULL) attribCount = 0;
+
+    buffer.capacity = capacity;
+    buffer.attribCount = (attribCount > 0)? attribCount : 0;
+    buffer.vboId = (unsigned int *)RL_CALLOC(buffer.attribCount + 1, sizeof(unsigned int));
+
+    if (buffer.attribCount > 0)
+    {
+        buffer.attribSizes = (int *)RL_MALLOC(buffer.attribCount*sizeof(int));
+        buffer.attribLocs = (int *)RL_MALLOC(buffer.attribCount*sizeof(int));
+    }
+
+    if ((buffer.vboId == NULL) || ((buffer.attribCount > 0) && ((buffer.attribSizes == NULL) || (buffer.attribLocs == NULL))))
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "MESH: Failed to allocate instance buffer data");
+
+        RL_FREE(buffer.vboId);
+        RL_FREE(buffer.attribSizes);
+        RL_FREE(buffer.attribLocs);
+
+        return (RaylibInstanceBuffer){ 0 };
+    }
+
+    // Instances transformation matrices, stored as Raylibfloat16 arrays (column-major)
+    buffer.vboId[0] = rlLoadVertexBuffer(NULL, capacity*sizeof(Raylibfloat16), true);
+
+    if (buffer.attribCount > 0)
+    {
+        for (int i = 0; i < buffer.attribCount; i++)
+        {
+            buffer.attribSizes[i] = (attribSizes[i] < 1)? 1 : (attribSizes[i] > 4)? 4 : attribSizes[i];
+            buffer.attribLocs[i] = -1;
+            buffer.vboId[i + 1] = rlLoadVertexBuffer(NULL, capacity*buffer.attribSizes[i]*sizeof(float), true);
+        }
+    }
+#endif
+
+    return buffer;
+}
+
+// Check if an instance buffer is valid (loaded in GPU)
+bool RaylibIsInstanceBufferValid(RaylibInstanceBuffer buffer)
+{
+    bool result = false;
+
+    if ((buffer.vboId != NULL) &&           // Validate buffer ids allocated
+        (buffer.vboId[0] > 0) &&            // Validate transforms buffer loaded in GPU
+        (buffer.capacity > 0)) result = true; // Validate instances capacity
+
+    for (int i = 0; (i < buffer.attribCount) && result; i++)
+    {
+        if (buffer.vboId[i + 1] == 0) result = false;   // Custom attribute buffer not loaded in GPU
+    }
+
+    return result;
+}
+
+// Update instance buffer transforms for instances range [offset, offset + count)
+// NOTE: Only the updated range is uploaded, transforms are converted to column-major in batches on the stack
+void RaylibUpdateInstanceBufferTransforms(RaylibInstanceBuffer buffer, const RaylibMatrix *transforms, int offset, int count)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    if ((buffer.vboId == NULL) || (transforms == NULL) || (offset < 0) || (count <= 0) || ((offset + count) > buffer.capacity))
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "MESH: Instance buffer transforms update out of range");
+        return;
+    }
+
+    Raylibfloat16 batch[INSTANCE_BUFFER_BATCH_TRANSFORMS];
+
+    for (int i = 0; i < count; i += INSTANCE_BUFFER_BATCH_TRANSFORMS)
+    {
+        int batchCount = ((count - i) < INSTANCE_BUFFER_BATCH_TRANSFORMS)? (count - i) : INSTANCE_BUFFER_BATCH_TRANSFORMS;
+
+        for (int k = 0; k < batchCount; k++) batch[k] = RaylibMatrixToFloatV(transforms[i + k]);
+
+        rlUpdateVertexBuffer(buffer.vboId[0], batch, batchCount*sizeof(Raylibfloat16), (offset + i)*sizeof(Raylibfloat16));
+    }
+#endif
+}
+
+// Update instance buffer custom attribute data for instances range [offset, offset + count)
+// NOTE: data must provide attribSizes[attrib] floats per instance
+void RaylibUpdateInstanceBufferAttribute(RaylibInstanceBuffer buffer, int attrib, const float *data, int offset, int count)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    if ((buffer.vboId == NULL) || (attrib < 0) || (attrib >= buffer.attribCount) || (data == NULL) ||
+        (offset < 0) || (count <= 0) || ((offset + count) > buffer.capacity))
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "MESH: Instance buffer attribute update out of range");
+        return;
+    }
+
+    int stride = buffer.attribSizes[attrib]*sizeof(float);
+
+    rlUpdateVertexBuffer(buffer.vboId[attrib + 1], data, count*stride, offset*stride);
+#endif
+}
+
+// Unload instance buffer from GPU memory (VRAM)
+void RaylibUnloadInstanceBuffer(RaylibInstanceBuffer buffer)
+{
+    if (buffer.vboId != NULL) for (int i = 0; i <= buffer.attribCount; i++) rlUnloadVertexBuffer(buffer.vboId[i]);
+
+    RL_FREE(buffer.vboId);
+    RL_FREE(buffer.attribSizes);
+    RL_FREE(buffer.attribLocs);
+}
+
+// Draw multiple mesh instances with material, using instance buffer data
+// NOTE: Instances transforms are sent to shader location RAYLIB_SHADER_LOC_MATRIX_MODEL (mat4 attribute),
+// instance attributes are only attached to mesh VAO while drawing
+void RaylibDrawMeshInstanceBuffer(RaylibMesh mesh, RaylibMaterial material, RaylibInstanceBuffer buffer, int instances)
+{
+#if defined(RAYLIB_GRAPHICS_API_OPENGL_33) || defined(RAYLIB_GRAPHICS_API_OPENGL_ES2)
+    if ((buffer.vboId == NULL) || (instances <= 0)) return;
+    if (instances > buffer.capacity)
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "MESH: Instances to draw (%i) exceed instance buffer capacity (%i)", instances, buffer.capacity);
+        instances = buffer.capacity;
+    }
+
+    int transformLoc = material.shader.locs[RAYLIB_SHADER_LOC_MATRIX_MODEL];
 
     // Bind shader program
     rlEnableShader(material.shader.id);
@@ -1719,27 +1926,31 @@ void RaylibDrawMeshInstanced(RaylibMesh mesh, RaylibMaterial material, const Ray
     if (material.shader.locs[RAYLIB_SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(material.shader.locs[RAYLIB_SHADER_LOC_MATRIX_VIEW], matView);
     if (material.shader.locs[RAYLIB_SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(material.shader.locs[RAYLIB_SHADER_LOC_MATRIX_PROJECTION], matProjection);
 
-    // Create instances buffer
-    instanceTransforms = (Raylibfloat16 *)RL_MALLOC(instances*sizeof(Raylibfloat16));
-
-    // Fill buffer with instances transformations as Raylibfloat16 arrays
-    for (int i = 0; i < instances; i++) instanceTransforms[i] = RaylibMatrixToFloatV(transforms[i]);
-
-    // Enable mesh VAO to attach new buffer
+    // Enable mesh VAO to attach instance buffers
     rlEnableVertexArray(mesh.vaoId);
 
-    // This could alternatively use a static VBO and either glMapBuffer() or glBufferSubData()
-    // It isn't clear which would be reliably faster in all cases and on all platforms,
-    // anecdotally glMapBuffer() seems very slow (syncs) while glBufferSubData() seems
-    // no faster, since we're transferring all the transform matrices anyway
-    instancesVboId = rlLoadVertexBuffer(instanceTransforms, instances*sizeof(Raylibfloat16), false);
-
     // Instances transformation matrices are send to shader attribute location: RAYLIB_SHADER_LOC_MATRIX_MODEL
-    for (unsigned int i = 0; i < 4; i++)
+    if (transformLoc != -1)
     {
-        rlEnableVertexAttribute(material.shader.locs[RAYLIB_SHADER_LOC_MATRIX_MODEL] + i);
-        rlSetVertexAttribute(material.shader.locs[RAYLIB_SHADER_LOC_MATRIX_MODEL] + i, 4, RL_FLOAT, 0, sizeof(RaylibMatrix), i*sizeof(RaylibVector4));
-        rlSetVertexAttributeDivisor(material.shader.locs[RAYLIB_SHADER_LOC_MATRIX_MODEL] + i, 1);
+        rlEnableVertexBuffer(buffer.vboId[0]);
+
+        for (unsigned int i = 0; i < 4; i++)
+        {
+            rlEnableVertexAttribute(transformLoc + i);
+            rlSetVertexAttribute(transformLoc + i, 4, RL_FLOAT, 0, sizeof(RaylibMatrix), i*sizeof(RaylibVector4));
+            rlSetVertexAttributeDivisor(transformLoc + i, 1);
+        }
+    }
+
+    // Instances custom attributes are send to shader attribute locations: buffer.attribLocs
+    for (int i = 0; i < buffer.attribCount; i++)
+    {
+        if (buffer.attribLocs[i] == -1) continue;
+
+        rlEnableVertexBuffer(buffer.vboId[i + 1]);
+        rlEnableVertexAttribute(buffer.attribLocs[i]);
+        rlSetVertexAttribute(buffer.attribLocs[i], buffer.attribSizes[i], RL_FLOAT, 0, 0, 0);
+        rlSetVertexAttributeDivisor(buffer.attribLocs[i], 1);
     }
 
     rlDisableVertexBuffer();
@@ -1897,6 +2108,25 @@ void RaylibDrawMeshInstanced(RaylibMesh mesh, RaylibMaterial material, const Ray
         }
     }
 
+    // Detach instance attributes from mesh VAO (or default vertex state),
+    // the mesh could be drawn later without instancing or with a different instance buffer
+    if (transformLoc != -1)
+    {
+        for (unsigned int i = 0; i < 4; i++)
+        {
+            rlSetVertexAttributeDivisor(transformLoc + i, 0);
+            rlDisableVertexAttribute(transformLoc + i);
+        }
+    }
+
+    for (int i = 0; i < buffer.attribCount; i++)
+    {
+        if (buffer.attribLocs[i] == -1) continue;
+
+        rlSetVertexAttributeDivisor(buffer.attribLocs[i], 0);
+        rlDisableVertexAttribute(buffer.attribLocs[i]);
+    }
+
     // Disable all possible vertex array objects (or VBOs)
     rlDisableVertexArray();
     rlDisableVertexBuffer();
@@ -1904,10 +2134,6 @@ void RaylibDrawMeshInstanced(RaylibMesh mesh, RaylibMaterial material, const Ray
 
     // Disable shader program
     rlDisableShader();
-
-    // Remove instance transforms buffer
-    rlUnloadVertexBuffer(instancesVboId);
-    RL_FREE(instanceTransforms);
 #endif
 }
 
@@ -2271,102 +2497,15 @@ void RaylibUpdateModelAnimationBones(RaylibModel model, RaylibModelAnimation ani
     {
         if (frame >= anim.frameCount) frame = frame%anim.frameCount;
 
-        for (int i = 0; i < model.meshCount; i++)
-        {
-            if (model.meshes[i].boneMatrices)
-            {
-                assert(model.meshes[i].boneCount == anim.boneCount);
-
-                for (int boneId = 0; boneId < model.meshes[i].boneCount; boneId++)
-                {
-                    RaylibVector3 inTranslation = model.bindPose[boneId].translation;
-                    Quaternion inRotation = model.bindPose[boneId].rotation;
-                    RaylibVector3 inScale = model.bindPose[boneId].scale;
-
-                    RaylibVector3 outTranslation = anim.framePoses[frame][boneId].translation;
-                    Quaternion outRotation = anim.framePoses[frame][boneId].rotation;
-                    RaylibVector3 outScale = anim.framePoses[frame][boneId].scale;
-
-                    RaylibVector3 invTranslation = RaylibVector3RotateByQuaternion(RaylibVector3Negate(inTranslation), RaylibQuaternionInvert(inRotation));
-                    Quaternion invRotation = RaylibQuaternionInvert(inRotation);
-                    RaylibVector3 invScale = RaylibVector3Divide((RaylibVector3){ 1.0f, 1.0f, 1.0f }, inScale);
-
-                    RaylibVector3 boneTranslation = RaylibVector3Add(
-                        RaylibVector3RotateByQuaternion(RaylibVector3Multiply(outScale, invTranslation),
-                        outRotation), outTranslation);
-                    Quaternion boneRotation = RaylibQuaternionMultiply(outRotation, invRotation);
-                    RaylibVector3 boneScale = RaylibVector3Multiply(outScale, invScale);
-
-                    RaylibMatrix boneMatrix = RaylibMatrixMultiply(RaylibMatrixMultiply(
-                        RaylibQuaternionToMatrix(boneRotation),
-                        RaylibMatrixTranslate(boneTranslation.x, boneTranslation.y, boneTranslation.z)),
-                        RaylibMatrixScale(boneScale.x, boneScale.y, boneScale.z));
-
-                    model.meshes[i].boneMatrices[boneId] = boneMatrix;
-                }
-            }
-        }
+        UpdateModelBoneMatrices(model, anim.framePoses[frame], anim.boneCount);
     }
 }
 
-// at least 2x speed up vs the old method 
 // Update model animated vertex data (positions and normals) for a given frame
-// NOTE: Updated data is uploaded to GPU
 void RaylibUpdateModelAnimation(RaylibModel model, RaylibModelAnimation anim, int frame)
 {
-    RaylibUpdateModelAnimationBones(model,anim,frame);
-    for (int m = 0; m < model.meshCount; m++)
-    {
-        RaylibMesh mesh = model.meshes[m];
-        RaylibVector3 animVertex = { 0 };
-        RaylibVector3 animNormal = { 0 };
-        int boneId = 0;
-        int boneCounter = 0;
-        float boneWeight = 0.0;
-        bool updated = false;           // Flag to check when anim vertex information is updated
-        const int vValues = mesh.vertexCount*3;
-        for (int vCounter = 0; vCounter < vValues; vCounter += 3)
-        {
-            mesh.animVertices[vCounter] = 0;
-            mesh.animVertices[vCounter + 1] = 0;
-            mesh.animVertices[vCounter + 2] = 0;
-            if (mesh.animNormals != NULL)
-            {
-                mesh.animNormals[vCounter] = 0;
-                mesh.animNormals[vCounter + 1] = 0;
-                mesh.animNormals[vCounter + 2] = 0;
-            }
-                // Iterates over 4 bones per vertex
-            for (int j = 0; j < 4; j++, boneCounter++)
-            {
-                boneWeight = mesh.boneWeights[boneCounter];
-                boneId = mesh.boneIds[boneCounter];
-                // Early stop when no transformation will be applied
-                if (boneWeight == 0.0f) continue;
-                animVertex = (RaylibVector3){ mesh.vertices[vCounter], mesh.vertices[vCounter + 1], mesh.vertices[vCounter + 2] };
-                animVertex = RaylibVector3Transform(animVertex,model.meshes[m].boneMatrices[boneId]);
-                mesh.animVertices[vCounter] += animVertex.x * boneWeight;
-                mesh.animVertices[vCounter+1] += animVertex.y * boneWeight;
-                mesh.animVertices[vCounter+2] += animVertex.z * boneWeight;
-                updated = true;
-                // Normals processing
-                // NOTE: We use meshes.baseNormals (default normal) to calculate meshes.normals (animated normals)
-                if (mesh.normals != NULL)
-                {
-                    animNormal = (RaylibVector3){ mesh.normals[vCounter], mesh.normals[vCounter + 1], mesh.normals[vCounter + 2] };
-                    animNormal = RaylibVector3Transform(animNormal,model.meshes[m].boneMatrices[boneId]);
-                    mesh.animNormals[vCounter] += animNormal.x*boneWeight;
-                    mesh.animNormals[vCounter + 1] += animNormal.y*boneWeight;
-                    mesh.animNormals[vCounter + 2] += animNormal.z*boneWeight;
-                }
-            }
-        }
-        if (updated)
-        {
-            rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0); // Update vertex position
-            rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);  // Update vertex normals
-        }
-    }
+    RaylibUpdateModelAnimationBones(model, anim, frame);
+    UpdateModelSkinning(model);
 }
 
 // Unload animation array data
@@ -2403,6 +2542,79 @@ bool RaylibIsModelAnimationValid(RaylibModel model, RaylibModelAnimation anim)
     return result;
 }
 
+// Load model animations from file as keyframe clips
+// NOTE: Only glTF animations are keyframe based, keyframes reproduced by interpolation
+// within RAYLIB_ANIMATION_KEY_TOLERANCE are dropped on loading
+RaylibModelAnimationClip *RaylibLoadModelAnimationClips(const char *fileName, int *clipCount)
+{
+    RaylibModelAnimationClip *clips = NULL;
+    *clipCount = 0;
+
+#if defined(RAYLIB_SUPPORT_FILEFORMAT_GLTF)
+    if (RaylibIsFileExtension(fileName, ".gltf;.glb")) clips = LoadModelAnimationClipsGLTF(fileName, clipCount, RAYLIB_ANIMATION_KEY_TOLERANCE);
+#endif
+
+    return clips;
+}
+
+// Update model animated bones transform matrices at a given time (in seconds)
+// NOTE: Time is wrapped to clip duration, tracks sampling is faster when time increases between calls
+void RaylibUpdateModelAnimationClipBones(RaylibModel model, RaylibModelAnimationClip clip, float time)
+{
+    if ((clip.boneCount > 0) && (clip.bones != NULL) && (clip.tracks != NULL))
+    {
+        if (clip.duration > 0.0f)
+        {
+            time = fmodf(time, clip.duration);
+            if (time < 0.0f) time += clip.duration;
+        }
+
+        // NOTE: Pose is kept on stack for common skeletons, only bigger ones require allocation
+        RaylibTransform posePool[RAYLIB_SKINNING_MAX_BONES];
+        RaylibTransform *pose = posePool;
+        if (clip.boneCount > RAYLIB_SKINNING_MAX_BONES) pose = (RaylibTransform *)RL_MALLOC(clip.boneCount*sizeof(RaylibTransform));
+
+        if (pose != NULL)
+        {
+            SampleAnimationClipPose(clip, time, pose);
+            UpdateModelBoneMatrices(model, pose, clip.boneCount);
+
+            if (pose != posePool) RL_FREE(pose);
+        }
+        else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "ANIMATION: Failed to allocate clip pose");
+    }
+}
+
+// Update model animated vertex data (positions and normals) at a given time (in seconds)
+void RaylibUpdateModelAnimationClip(RaylibModel model, RaylibModelAnimationClip clip, float time)
+{
+    RaylibUpdateModelAnimationClipBones(model, clip, time);
+    UpdateModelSkinning(model);
+}
+
+// Unload animation clip array data
+void RaylibUnloadModelAnimationClips(RaylibModelAnimationClip *clips, int clipCount)
+{
+    for (int i = 0; i < clipCount; i++) RaylibUnloadModelAnimationClip(clips[i]);
+    RL_FREE(clips);
+}
+
+// Unload animation clip data
+void RaylibUnloadModelAnimationClip(RaylibModelAnimationClip clip)
+{
+    if (clip.tracks != NULL)
+    {
+        for (int i = 0; i < clip.boneCount*3; i++)
+        {
+            RL_FREE(clip.tracks[i].times);
+            RL_FREE(clip.tracks[i].values);
+        }
+    }
+
+    RL_FREE(clip.tracks);
+    RL_FREE(clip.bones);
+}
+
 #if defined(RAYLIB_SUPPORT_MESH_GENERATION)
 // Generate polygonal mesh
 RaylibMesh RaylibGenMeshPoly(int sides, float radius)
@@ -3556,17 +3768,7 @@ RaylibBoundingBox RaylibGetMeshBoundingBox(RaylibMesh mesh)
     RaylibVector3 minVertex = { 0 };
     RaylibVector3 maxVertex = { 0 };
 
-    if (mesh.vertices != NULL)
-    {
-        minVertex = (RaylibVector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
-        maxVertex = (RaylibVector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
-
-        for (int i = 1; i < mesh.vertexCount; i++)
-        {
-            minVertex = RaylibVector3Min(minVertex, (RaylibVector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
-            maxVertex = RaylibVector3Max(maxVertex, (RaylibVector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
-        }
-    }
+    if (mesh.vertices != NULL) RaylibVector3MinMaxArray(&minVertex, &maxVertex, (const RaylibVector3 *)mesh.vertices, mesh.vertexCount);
 
     // Create the bounding box
     RaylibBoundingBox box = { 0 };
@@ -4045,29 +4247,43 @@ RaylibRayCollision RaylibGetRayCollisionMesh(RaylibRay ray, RaylibMesh mesh, Ray
     if (mesh.vertices != NULL)
     {
         int triangleCount = mesh.triangleCount;
+        RaylibVector3 *vertdata = (RaylibVector3 *)mesh.vertices;
+
+        // Indexed meshes share vertices between triangles, all vertices are transformed once (if memory available)
+        RaylibVector3 *transformed = NULL;
+        if (mesh.indices != NULL) transformed = (RaylibVector3 *)RL_MALLOC(mesh.vertexCount*sizeof(RaylibVector3));
+        if (transformed != NULL) RaylibVector3TransformArray(transformed, vertdata, mesh.vertexCount, transform);
 
         // Test against all triangles in mesh
         for (int i = 0; i < triangleCount; i++)
         {
             RaylibVector3 a, b, c;
-            RaylibVector3* vertdata = (RaylibVector3*)mesh.vertices;
 
-            if (mesh.indices)
+            if (transformed != NULL)
             {
-                a = vertdata[mesh.indices[i*3 + 0]];
-                b = vertdata[mesh.indices[i*3 + 1]];
-                c = vertdata[mesh.indices[i*3 + 2]];
+                a = transformed[mesh.indices[i*3 + 0]];
+                b = transformed[mesh.indices[i*3 + 1]];
+                c = transformed[mesh.indices[i*3 + 2]];
             }
             else
             {
-                a = vertdata[i*3 + 0];
-                b = vertdata[i*3 + 1];
-                c = vertdata[i*3 + 2];
-            }
+                if (mesh.indices)
+                {
+                    a = vertdata[mesh.indices[i*3 + 0]];
+                    b = vertdata[mesh.indices[i*3 + 1]];
+                    c = vertdata[mesh.indices[i*3 + 2]];
+                }
+                else
+                {
+                    a = vertdata[i*3 + 0];
+                    b = vertdata[i*3 + 1];
+                    c = vertdata[i*3 + 2];
+                }
 
-            a = RaylibVector3Transform(a, transform);
-            b = RaylibVector3Transform(b, transform);
-            c = RaylibVector3Transform(c, transform);
+                a = RaylibVector3Transform(a, transform);
+                b = RaylibVector3Transform(b, transform);
+                c = RaylibVector3Transform(c, transform);
+            }
 
             RaylibRayCollision triHitInfo = RaylibGetRayCollisionTriangle(ray, a, b, c);
 
@@ -4077,90 +4293,654 @@ RaylibRayCollision RaylibGetRayCollisionMesh(RaylibRay ray, RaylibMesh mesh, Ray
                 if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
             }
         }
+
+        RL_FREE(transformed);
     }
 
     return collision;
 }
 
-// Get collision info between ray and triangle
-// NOTE: The points are expected to be in counter-clockwise winding
-// NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
-RaylibRayCollision RaylibGetRayCollisionTriangle(RaylibRay ray, RaylibVector3 p1, RaylibVector3 p2, RaylibVector3 p3)
+// Load mesh bounding volume hierarchy for ray queries
+// NOTE: Built with binned surface area heuristic (SAH), triangles are copied so mesh can be modified
+// or unloaded after, but BVH must be reloaded if mesh vertex data changes
+RaylibMeshBVH RaylibLoadMeshBVH(RaylibMesh mesh)
 {
-    #define RAYLIB_EPSILON 0.000001f        // A small number
+    RaylibMeshBVH bvh = { 0 };
 
-    RaylibRayCollision collision = { 0 };
-    RaylibVector3 edge1 = { 0 };
-    RaylibVector3 edge2 = { 0 };
-    RaylibVector3 p, q, tv;
-    float det, invDet, u, v, t;
+    if ((mesh.vertices == NULL) || (mesh.triangleCount <= 0))
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "MESH: BVH can not be built, mesh vertex data not available");
+        return bvh;
+    }
 
-    // Find vectors for two edges sharing V1
-    edge1 = RaylibVector3Subtract(p2, p1);
-    edge2 = RaylibVector3Subtract(p3, p1);
+    int triangleCount = mesh.triangleCount;
+    RaylibVector3 *vertdata = (RaylibVector3 *)mesh.vertices;
 
-    // Begin calculating determinant - also used to calculate u parameter
-    p = RaylibVector3CrossProduct(ray.direction, edge2);
+    // Triangles bounds and centroids, triangles are sorted by node using indices
+    RaylibBoundingBox *bounds = (RaylibBoundingBox *)RL_MALLOC(triangleCount*sizeof(RaylibBoundingBox));
+    RaylibVector3 *centroids = (RaylibVector3 *)RL_MALLOC(triangleCount*sizeof(RaylibVector3));
+    int *triangles = (int *)RL_MALLOC(triangleCount*sizeof(int));
+    int *depths = (int *)RL_MALLOC((2*triangleCount - 1)*sizeof(int));
 
-    // If determinant is near zero, ray lies in plane of triangle or ray is parallel to plane of triangle
-    det = RaylibVector3DotProduct(edge1, p);
+    for (int i = 0; i < triangleCount; i++)
+    {
+        RaylibVector3 a, b, c;
 
-    // Avoid culling!
-    if ((det > -RAYLIB_EPSILON) && (det < RAYLIB_EPSILON)) return collision;
+        if (mesh.indices)
+        {
+            a = vertdata[mesh.indices[i*3 + 0]];
+            b = vertdata[mesh.indices[i*3 + 1]];
+            c = vertdata[mesh.indices[i*3 + 2]];
+        }
+        else
+        {
+            a = vertdata[i*3 + 0];
+            b = vertdata[i*3 + 1];
+            c = vertdata[i*3 + 2];
+        }
 
-    invDet = 1.0f/det;
+        bounds[i].min = RaylibVector3Min(RaylibVector3Min(a, b), c);
+        bounds[i].max = RaylibVector3Max(RaylibVector3Max(a, b), c);
+        centroids[i] = RaylibVector3Scale(RaylibVector3Add(bounds[i].min, bounds[i].max), 0.5f);
+        triangles[i] = i;
+    }
 
-    // Calculate distance from V1 to ray origin
-    tv = RaylibVector3Subtract(ray.position, p1);
+    // Binary tree with one triangle per leaf at most requires 2*n - 1 nodes
+    bvh.nodes = (RaylibMeshBVHNode *)RL_MALLOC((2*triangleCount - 1)*sizeof(RaylibMeshBVHNode));
+    bvh.nodes[0].first = 0;
+    bvh.nodes[0].count = triangleCount;
+    bvh.nodeCount = 1;
+    depths[0] = 0;
 
-    // Calculate u parameter and test bound
-    u = RaylibVector3DotProduct(tv, p)*invDet;
+    // Nodes are processed in creation order, children are always appended after their parent
+    for (int n = 0; n < bvh.nodeCount; n++)
+    {
+        RaylibMeshBVHNode *node = &bvh.nodes[n];
+        int first = node->first;
+        int count = node->count;
 
-    // The intersection lies outside the triangle
-    if ((u < 0.0f) || (u > 1.0f)) return collision;
+        // Compute node bounds and its triangles centroids bounds
+        RaylibVector3 centroidMin = centroids[triangles[first]];
+        RaylibVector3 centroidMax = centroidMin;
+        node->min = bounds[triangles[first]].min;
+        node->max = bounds[triangles[first]].max;
 
-    // Prepare to test v parameter
-    q = RaylibVector3CrossProduct(tv, edge1);
+        for (int i = first + 1; i < first + count; i++)
+        {
+            node->min = RaylibVector3Min(node->min, bounds[triangles[i]].min);
+            node->max = RaylibVector3Max(node->max, bounds[triangles[i]].max);
+            centroidMin = RaylibVector3Min(centroidMin, centroids[triangles[i]]);
+            centroidMax = RaylibVector3Max(centroidMax, centroids[triangles[i]]);
+        }
 
-    // Calculate V parameter and test bound
-    v = RaylibVector3DotProduct(ray.direction, q)*invDet;
+        if ((count <= MESH_BVH_LEAF_TRIANGLES) || (depths[n] >= (MESH_BVH_MAX_DEPTH - 1))) continue;
 
-    // The intersection lies outside the triangle
-    if ((v < 0.0f) || ((u + v) > 1.0f)) return collision;
+        // Find best split plane evaluating surface area heuristic on bins boundaries of every axis,
+        // cost of traversing a node is considered the same as testing a triangle
+        RaylibVector3 nodeSize = RaylibVector3Subtract(node->max, node->min);
+        float nodeArea = nodeSize.x*nodeSize.y + nodeSize.y*nodeSize.z + nodeSize.z*nodeSize.x;
+        float bestCost = (float)count;
+        int bestAxis = -1;
+        int bestBin = 0;
 
-    t = RaylibVector3DotProduct(edge2, q)*invDet;
+        for (int axis = 0; axis < 3; axis++)
+        {
+            float axisMin = (&centroidMin.x)[axis];
+            float axisExtent = (&centroidMax.x)[axis] - axisMin;
 
-    if (t > RAYLIB_EPSILON)
-    {
-        // RaylibRay hit, get hit point and normal
-        collision.hit = true;
-        collision.distance = t;
-        collision.normal = RaylibVector3Normalize(RaylibVector3CrossProduct(edge1, edge2));
-        collision.point = RaylibVector3Add(ray.position, RaylibVector3Scale(ray.direction, t));
-    }
+            if (axisExtent <= 0.0f) continue;
 
-    return collision;
-}
+            int binCounts[MESH_BVH_BINS] = { 0 };
+            RaylibBoundingBox binBounds[MESH_BVH_BINS] = { 0 };
+            float binScale = MESH_BVH_BINS/axisExtent;
 
-// Get collision info between ray and quad
-// NOTE: The points are expected to be in counter-clockwise winding
-RaylibRayCollision RaylibGetRayCollisionQuad(RaylibRay ray, RaylibVector3 p1, RaylibVector3 p2, RaylibVector3 p3, RaylibVector3 p4)
-{
-    RaylibRayCollision collision = { 0 };
+            for (int i = first; i < first + count; i++)
+            {
+                int bin = (int)(((&centroids[triangles[i]].x)[axis] - axisMin)*binScale);
+                if (bin > (MESH_BVH_BINS - 1)) bin = MESH_BVH_BINS - 1;
 
-    collision = RaylibGetRayCollisionTriangle(ray, p1, p2, p4);
+                if (binCounts[bin] == 0) binBounds[bin] = bounds[triangles[i]];
+                else
+                {
+                    binBounds[bin].min = RaylibVector3Min(binBounds[bin].min, bounds[triangles[i]].min);
+                    binBounds[bin].max = RaylibVector3Max(binBounds[bin].max, bounds[triangles[i]].max);
+                }
 
-    if (!collision.hit) collision = RaylibGetRayCollisionTriangle(ray, p2, p3, p4);
+                binCounts[bin]++;
+            }
 
-    return collision;
-}
+            // Sweep bins from the right accumulating area*count, then from the left evaluating splits
+            float rightCosts[MESH_BVH_BINS] = { 0 };
+            RaylibBoundingBox box = { 0 };
+            int boxCount = 0;
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
-#if defined(RAYLIB_SUPPORT_FILEFORMAT_IQM) || defined(RAYLIB_SUPPORT_FILEFORMAT_GLTF)
-// Build pose from parent joints
-// NOTE: Required for animations loading (required by IQM and GLTF)
+            for (int bin = MESH_BVH_BINS - 1; bin > 0; bin--)
+            {
+                if (binCounts[bin] > 0)
+                {
+                    if (boxCount == 0) box = binBounds[bin];
+                    else
+                    {
+                        box.min = RaylibVector3Min(box.min, binBounds[bin].min);
+                        box.max = RaylibVector3Max(box.max, binBounds[bin].max);
+                    }
+
+                    boxCount += binCounts[bin];
+                }
+
+                RaylibVector3 size = RaylibVector3Subtract(box.max, box.min);
+                rightCosts[bin] = (size.x*size.y + size.y*size.z + size.z*size.x)*boxCount;
+            }
+
+            boxCount = 0;
+
+            for (int bin = 0; bin < MESH_BVH_BINS - 1; bin++)
+            {
+                if (binCounts[bin] > 0)
+                {
+                    if (boxCount == 0) box = binBounds[bin];
+                    else
+                    {
+                        box.min = RaylibVector3Min(box.min, binBounds[bin].min);
+                        box.max = RaylibVector3Max(box.max, binBounds[bin].max);
+                    }
+
+                    boxCount += binCounts[bin];
+                }
+
+                if ((boxCount == 0) || (boxCount == count)) continue;
+
+                RaylibVector3 size = RaylibVector3Subtract(box.max, box.min);
+                float cost = 1.0f + ((size.x*size.y + size.y*size.z + size.z*size.x)*boxCount + rightCosts[bin + 1])/nodeArea;
+
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestBin = bin;
+                }
+            }
+        }
+
+        // Splitting is not worth it, keep node as leaf
+        if (bestAxis < 0) continue;
+
+        // Partition node triangles in place, left child gets bins [0, bestBin]
+        float axisMin = (&centroidMin.x)[bestAxis];
+        float binScale = MESH_BVH_BINS/((&centroidMax.x)[bestAxis] - axisMin);
+        int left = first;
+        int right = first + count - 1;
+
+        while (left <= right)
+        {
+            int bin = (int)(((&centroids[triangles[left]].x)[bestAxis] - axisMin)*binScale);
+            if (bin > (MESH_BVH_BINS - 1)) bin = MESH_BVH_BINS - 1;
+
+            if (bin <= bestBin) left++;
+            else
+            {
+                int temp = triangles[left];
+                triangles[left] = triangles[right];
+                triangles[right] = temp;
+                right--;
+            }
+        }
+
+        int leftCount = left - first;
+        if ((leftCount == 0) || (leftCount == count)) continue;
+
+        int child = bvh.nodeCount;
+        bvh.nodes[child].first = first;
+        bvh.nodes[child].count = leftCount;
+        bvh.nodes[child + 1].first = left;
+        bvh.nodes[child + 1].count = count - leftCount;
+        depths[child] = depths[n] + 1;
+        depths[child + 1] = depths[n] + 1;
+        bvh.nodeCount += 2;
+
+        node->first = child;
+        node->count = 0;
+    }
+
+    // Store triangles vertex positions in leaf order for cache friendly traversal
+    bvh.triangleCount = triangleCount;
+    bvh.vertices = (RaylibVector3 *)RL_MALLOC(triangleCount*3*sizeof(RaylibVector3));
+
+    for (int i = 0; i < triangleCount; i++)
+    {
+        int triangle = triangles[i];
+
+        for (int v = 0; v < 3; v++)
+        {
+            bvh.vertices[i*3 + v] = (mesh.indices)? vertdata[mesh.indices[triangle*3 + v]] : vertdata[triangle*3 + v];
+        }
+    }
+
+    bvh.nodes = (RaylibMeshBVHNode *)RL_REALLOC(bvh.nodes, bvh.nodeCount*sizeof(RaylibMeshBVHNode));
+
+    RL_FREE(bounds);
+    RL_FREE(centroids);
+    RL_FREE(triangles);
+    RL_FREE(depths);
+
+    RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "MESH: BVH loaded successfully (%i triangles, %i nodes)", bvh.triangleCount, bvh.nodeCount);
+
+    return bvh;
+}
+
+// Unload mesh bounding volume hierarchy
+void RaylibUnloadMeshBVH(RaylibMeshBVH bvh)
+{
+    RL_FREE(bvh.nodes);
+    RL_FREE(bvh.vertices);
+}
+
+// Get collision info between ray and mesh using its bounding volume hierarchy
+// NOTE: Results match RaylibGetRayCollisionMesh(), ray is transformed into mesh space instead of transforming mesh
+RaylibRayCollision RaylibGetRayCollisionMeshBVH(RaylibRay ray, RaylibMeshBVH bvh, RaylibMatrix transform)
+{
+    RaylibRayCollision collision = { 0 };
+
+    RaylibGetRayCollisionMeshBVHBatch(&ray, 1, bvh, transform, &collision);
+
+    return collision;
+}
+
+// Get collision info between multiple rays and mesh using its bounding volume hierarchy
+// NOTE: Rays are distributed over worker threads, collisions must hold rayCount elements
+void RaylibGetRayCollisionMeshBVHBatch(const RaylibRay *rays, int rayCount, RaylibMeshBVH bvh, RaylibMatrix transform, RaylibRayCollision *collisions)
+{
+    if ((rays == NULL) || (collisions == NULL) || (rayCount <= 0)) return;
+
+    MeshBVHRayJob job = { 0 };
+    job.bvh = &bvh;
+    job.rays = rays;
+    job.collisions = collisions;
+    job.invTransform = RaylibMatrixInvert(transform);
+
+    // Normals are transformed by inverse transpose, mirroring transforms also flip triangles winding
+    job.normalTransform = RaylibMatrixTranspose(job.invTransform);
+    if (RaylibMatrixDeterminant(transform) < 0.0f) job.normalTransform = RaylibMatrixMultiply(job.normalTransform, RaylibMatrixScale(-1.0f, -1.0f, -1.0f));
+
+    ParallelFor(rayCount, RAYLIB_COLLISION_BATCH_RAYS, GetRayCollisionsMeshBVH, &job);
+}
+
+// Get collision info between ray and triangle
+// NOTE: The points are expected to be in counter-clockwise winding
+// NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
+RaylibRayCollision RaylibGetRayCollisionTriangle(RaylibRay ray, RaylibVector3 p1, RaylibVector3 p2, RaylibVector3 p3)
+{
+    #define RAYLIB_EPSILON 0.000001f        // A small number
+
+    RaylibRayCollision collision = { 0 };
+    RaylibVector3 edge1 = { 0 };
+    RaylibVector3 edge2 = { 0 };
+    RaylibVector3 p, q, tv;
+    float det, invDet, u, v, t;
+
+    // Find vectors for two edges sharing V1
+    edge1 = RaylibVector3Subtract(p2, p1);
+    edge2 = RaylibVector3Subtract(p3, p1);
+
+    // Begin calculating determinant - also used to calculate u parameter
+    p = RaylibVector3CrossProduct(ray.direction, edge2);
+
+    // If determinant is near zero, ray lies in plane of triangle or ray is parallel to plane of triangle
+    det = RaylibVector3DotProduct(edge1, p);
+
+    // Avoid culling!
+    if ((det > -RAYLIB_EPSILON) && (det < RAYLIB_EPSILON)) return collision;
+
+    invDet = 1.0f/det;
+
+    // Calculate distance from V1 to ray origin
+    tv = RaylibVector3Subtract(ray.position, p1);
+
+    // Calculate u parameter and test bound
+    u = RaylibVector3DotProduct(tv, p)*invDet;
+
+    // The intersection lies outside the triangle
+    if ((u < 0.0f) || (u > 1.0f)) return collision;
+
+    // Prepare to test v parameter
+    q = RaylibVector3CrossProduct(tv, edge1);
+
+    // Calculate V parameter and test bound
+    v = RaylibVector3DotProduct(ray.direction, q)*invDet;
+
+    // The intersection lies outside the triangle
+    if ((v < 0.0f) || ((u + v) > 1.0f)) return collision;
+
+    t = RaylibVector3DotProduct(edge2, q)*invDet;
+
+    if (t > RAYLIB_EPSILON)
+    {
+        // RaylibRay hit, get hit point and normal
+        collision.hit = true;
+        collision.distance = t;
+        collision.normal = RaylibVector3Normalize(RaylibVector3CrossProduct(edge1, edge2));
+        collision.point = RaylibVector3Add(ray.position, RaylibVector3Scale(ray.direction, t));
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and quad
+// NOTE: The points are expected to be in counter-clockwise winding
+RaylibRayCollision RaylibGetRayCollisionQuad(RaylibRay ray, RaylibVector3 p1, RaylibVector3 p2, RaylibVector3 p3, RaylibVector3 p4)
+{
+    RaylibRayCollision collision = { 0 };
+
+    collision = RaylibGetRayCollisionTriangle(ray, p1, p2, p4);
+
+    if (!collision.hit) collision = RaylibGetRayCollisionTriangle(ray, p2, p3, p4);
+
+    return collision;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+// Skin a range of mesh vertices, positions and normals are transformed by the weighted blend of up to 4 bone matrices
+// NOTE: Blending the matrices first gives the same result as blending the transformed vertices
+// but requires a single transform per vertex, vertices with no bone influence result in zero
+static void SkinMeshVertices(void *userData, int start, int end)
+{
+    const SkinningJob *job = (const SkinningJob *)userData;
+    const RaylibMesh *mesh = job->mesh;
+    const float *boneColumns = job->boneColumns;
+    const bool skinNormals = (mesh->normals != NULL) && (mesh->animNormals != NULL);
+
+    for (int v = start; v < end; v++)
+    {
+        const float *weights = mesh->boneWeights + v*4;
+        const unsigned char *ids = mesh->boneIds + v*4;
+        const float *vertex = mesh->vertices + v*3;
+        float *animVertex = mesh->animVertices + v*3;
+
+#if defined(SKINNING_SIMD_SSE) || defined(SKINNING_SIMD_NEON)
+        float result[4] = { 0 };
+    #if defined(SKINNING_SIMD_SSE)
+        __m128 col0 = _mm_setzero_ps();
+        __m128 col1 = _mm_setzero_ps();
+        __m128 col2 = _mm_setzero_ps();
+        __m128 col3 = _mm_setzero_ps();
+
+        for (int j = 0; j < 4; j++)
+        {
+            if (weights[j] == 0.0f) continue;
+
+            const float *bone = boneColumns + ids[j]*16;
+            __m128 weight = _mm_set1_ps(weights[j]);
+
+            col0 = _mm_add_ps(col0, _mm_mul_ps(_mm_loadu_ps(bone), weight));
+            col1 = _mm_add_ps(col1, _mm_mul_ps(_mm_loadu_ps(bone + 4), weight));
+            col2 = _mm_add_ps(col2, _mm_mul_ps(_mm_loadu_ps(bone + 8), weight));
+            col3 = _mm_add_ps(col3, _mm_mul_ps(_mm_loadu_ps(bone + 12), weight));
+        }
+
+        __m128 position = _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, _mm_set1_ps(vertex[0])), _mm_mul_ps(col1, _mm_set1_ps(vertex[1]))),
+                                     _mm_add_ps(_mm_mul_ps(col2, _mm_set1_ps(vertex[2])), col3));
+        _mm_storeu_ps(result, position);
+    #else
+        float32x4_t col0 = vdupq_n_f32(0.0f);
+        float32x4_t col1 = vdupq_n_f32(0.0f);
+        float32x4_t col2 = vdupq_n_f32(0.0f);
+        float32x4_t col3 = vdupq_n_f32(0.0f);
+
+        for (int j = 0; j < 4; j++)
+        {
+            if (weights[j] == 0.0f) continue;
+
+            const float *bone = boneColumns + ids[j]*16;
+
+            col0 = vmlaq_n_f32(col0, vld1q_f32(bone), weights[j]);
+            col1 = vmlaq_n_f32(col1, vld1q_f32(bone + 4), weights[j]);
+            col2 = vmlaq_n_f32(col2, vld1q_f32(bone + 8), weights[j]);
+            col3 = vmlaq_n_f32(col3, vld1q_f32(bone + 12), weights[j]);
+        }
+
+        float32x4_t position = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(col3, col0, vertex[0]), col1, vertex[1]), col2, vertex[2]);
+        vst1q_f32(result, position);
+    #endif
+        animVertex[0] = result[0];
+        animVertex[1] = result[1];
+        animVertex[2] = result[2];
+
+        if (skinNormals)
+        {
+            const float *normal = mesh->normals + v*3;
+            float *animNormal = mesh->animNormals + v*3;
+
+    #if defined(SKINNING_SIMD_SSE)
+            __m128 transformed = _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, _mm_set1_ps(normal[0])), _mm_mul_ps(col1, _mm_set1_ps(normal[1]))),
+                                            _mm_add_ps(_mm_mul_ps(col2, _mm_set1_ps(normal[2])), col3));
+            _mm_storeu_ps(result, transformed);
+    #else
+            float32x4_t transformed = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(col3, col0, normal[0]), col1, normal[1]), col2, normal[2]);
+            vst1q_f32(result, transformed);
+    #endif
+            animNormal[0] = result[0];
+            animNormal[1] = result[1];
+            animNormal[2] = result[2];
+        }
+#else
+        float mat[16] = { 0 };
+
+        for (int j = 0; j < 4; j++)
+        {
+            if (weights[j] == 0.0f) continue;
+
+            const float *bone = boneColumns + ids[j]*16;
+            for (int k = 0; k < 16; k++) mat[k] += bone[k]*weights[j];
+        }
+
+        animVertex[0] = mat[0]*vertex[0] + mat[4]*vertex[1] + mat[8]*vertex[2] + mat[12];
+        animVertex[1] = mat[1]*vertex[0] + mat[5]*vertex[1] + mat[9]*vertex[2] + mat[13];
+        animVertex[2] = mat[2]*vertex[0] + mat[6]*vertex[1] + mat[10]*vertex[2] + mat[14];
+
+        if (skinNormals)
+        {
+            const float *normal = mesh->normals + v*3;
+            float *animNormal = mesh->animNormals + v*3;
+
+            animNormal[0] = mat[0]*normal[0] + mat[4]*normal[1] + mat[8]*normal[2] + mat[12];
+            animNormal[1] = mat[1]*normal[0] + mat[5]*normal[1] + mat[9]*normal[2] + mat[13];
+            animNormal[2] = mat[2]*normal[0] + mat[6]*normal[1] + mat[10]*normal[2] + mat[14];
+        }
+#endif
+    }
+}
+
+// Get collision info for a range of rays against mesh BVH (MeshBVHRayJob)
+// NOTE: Ray direction is transformed but not normalized, so hit distances are the same in world and mesh space
+static void GetRayCollisionsMeshBVH(void *userData, int start, int end)
+{
+    const MeshBVHRayJob *job = (const MeshBVHRayJob *)userData;
+    const RaylibMeshBVH *bvh = job->bvh;
+    const RaylibMatrix inv = job->invTransform;
+    const RaylibMatrix nrm = job->normalTransform;
+
+    int stack[MESH_BVH_MAX_DEPTH] = { 0 };
+    float stackDistances[MESH_BVH_MAX_DEPTH] = { 0 };
+
+    for (int r = start; r < end; r++)
+    {
+        RaylibRay ray = job->rays[r];
+        RaylibRayCollision collision = { 0 };
+
+        if (bvh->nodeCount > 0)
+        {
+            RaylibRay localRay = { 0 };
+            localRay.position = RaylibVector3Transform(ray.position, inv);
+            localRay.direction.x = inv.m0*ray.direction.x + inv.m4*ray.direction.y + inv.m8*ray.direction.z;
+            localRay.direction.y = inv.m1*ray.direction.x + inv.m5*ray.direction.y + inv.m9*ray.direction.z;
+            localRay.direction.z = inv.m2*ray.direction.x + inv.m6*ray.direction.y + inv.m10*ray.direction.z;
+
+            // Zero direction components give infinite slabs, handled by fminf()/fmaxf()
+            RaylibVector3 invDir = { 1.0f/localRay.direction.x, 1.0f/localRay.direction.y, 1.0f/localRay.direction.z };
+            float closest = INFINITY;
+            int stackCount = 0;
+
+            stack[stackCount] = 0;
+            stackDistances[stackCount] = 0.0f;
+            stackCount++;
+
+            while (stackCount > 0)
+            {
+                stackCount--;
+                if (stackDistances[stackCount] > closest) continue;
+
+                const RaylibMeshBVHNode *node = &bvh->nodes[stack[stackCount]];
+
+                if (node->count > 0)
+                {
+                    for (int i = node->first; i < node->first + node->count; i++)
+                    {
+                        RaylibRayCollision triHitInfo = RaylibGetRayCollisionTriangle(localRay, bvh->vertices[i*3 + 0], bvh->vertices[i*3 + 1], bvh->vertices[i*3 + 2]);
+
+                        // Save the closest hit triangle
+                        if (triHitInfo.hit && (triHitInfo.distance < closest))
+                        {
+                            closest = triHitInfo.distance;
+                            collision = triHitInfo;
+                        }
+                    }
+                }
+                else
+                {
+                    // Test both children bounds (slab test), nearest child is traversed first
+                    float childDistances[2] = { 0 };
+                    bool childHits[2] = { 0 };
+
+                    for (int c = 0; c < 2; c++)
+                    {
+                        const RaylibMeshBVHNode *child = &bvh->nodes[node->first + c];
+                        float tx1 = (child->min.x - localRay.position.x)*invDir.x;
+                        float tx2 = (child->max.x - localRay.position.x)*invDir.x;
+                        float ty1 = (child->min.y - localRay.position.y)*invDir.y;
+                        float ty2 = (child->max.y - localRay.position.y)*invDir.y;
+                        float tz1 = (child->min.z - localRay.position.z)*invDir.z;
+                        float tz2 = (child->max.z - localRay.position.z)*invDir.z;
+
+                        float tmin = fmaxf(fmaxf(fminf(tx1, tx2), fminf(ty1, ty2)), fmaxf(fminf(tz1, tz2), 0.0f));
+                        float tmax = fminf(fminf(fmaxf(tx1, tx2), fmaxf(ty1, ty2)), fminf(fmaxf(tz1, tz2), closest));
+
+                        childDistances[c] = tmin;
+                        childHits[c] = (tmin <= tmax);
+                    }
+
+                    int nearChild = (childDistances[1] < childDistances[0])? 1 : 0;
+
+                    if (childHits[1 - nearChild])
+                    {
+                        stack[stackCount] = node->first + 1 - nearChild;
+                        stackDistances[stackCount] = childDistances[1 - nearChild];
+                        stackCount++;
+                    }
+
+                    if (childHits[nearChild])
+                    {
+                        stack[stackCount] = node->first + nearChild;
+                        stackDistances[stackCount] = childDistances[nearChild];
+                        stackCount++;
+                    }
+                }
+            }
+
+            if (collision.hit)
+            {
+                // Hit point and normal back to world space
+                RaylibVector3 normal = collision.normal;
+                collision.normal.x = nrm.m0*normal.x + nrm.m4*normal.y + nrm.m8*normal.z;
+                collision.normal.y = nrm.m1*normal.x + nrm.m5*normal.y + nrm.m9*normal.z;
+                collision.normal.z = nrm.m2*normal.x + nrm.m6*normal.y + nrm.m10*normal.z;
+                collision.normal = RaylibVector3Normalize(collision.normal);
+                collision.point = RaylibVector3Add(ray.position, RaylibVector3Scale(ray.direction, collision.distance));
+            }
+        }
+
+        job->collisions[r] = collision;
+    }
+}
+
+// Update model meshes bone matrices for an animation pose (bones transforms in model space)
+static void UpdateModelBoneMatrices(RaylibModel model, const RaylibTransform *pose, int boneCount)
+{
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        if (model.meshes[i].boneMatrices)
+        {
+            assert(model.meshes[i].boneCount == boneCount);
+
+            for (int boneId = 0; boneId < model.meshes[i].boneCount; boneId++)
+            {
+                RaylibVector3 inTranslation = model.bindPose[boneId].translation;
+                Quaternion inRotation = model.bindPose[boneId].rotation;
+                RaylibVector3 inScale = model.bindPose[boneId].scale;
+
+                RaylibVector3 outTranslation = pose[boneId].translation;
+                Quaternion outRotation = pose[boneId].rotation;
+                RaylibVector3 outScale = pose[boneId].scale;
+
+                RaylibVector3 invTranslation = RaylibVector3RotateByQuaternion(RaylibVector3Negate(inTranslation), RaylibQuaternionInvert(inRotation));
+                Quaternion invRotation = RaylibQuaternionInvert(inRotation);
+                RaylibVector3 invScale = RaylibVector3Divide((RaylibVector3){ 1.0f, 1.0f, 1.0f }, inScale);
+
+                RaylibVector3 boneTranslation = RaylibVector3Add(
+                    RaylibVector3RotateByQuaternion(RaylibVector3Multiply(outScale, invTranslation),
+                    outRotation), outTranslation);
+                Quaternion boneRotation = RaylibQuaternionMultiply(outRotation, invRotation);
+                RaylibVector3 boneScale = RaylibVector3Multiply(outScale, invScale);
+
+                RaylibMatrix boneMatrix = RaylibMatrixMultiply(RaylibMatrixMultiply(
+                    RaylibQuaternionToMatrix(boneRotation),
+                    RaylibMatrixTranslate(boneTranslation.x, boneTranslation.y, boneTranslation.z)),
+                    RaylibMatrixScale(boneScale.x, boneScale.y, boneScale.z));
+
+                model.meshes[i].boneMatrices[boneId] = boneMatrix;
+            }
+        }
+    }
+}
+
+// Update model meshes animated vertex data (positions and normals) with current bone matrices
+// NOTE: Bone matrices are blended once per vertex (SIMD when available) and big meshes
+// are split over worker threads, updated data is uploaded to GPU on calling thread
+static void UpdateModelSkinning(RaylibModel model)
+{
+    float boneColumns[RAYLIB_SKINNING_MAX_BONES*16];    // Bone matrices (column-major), kept on stack so skinning is reentrant
+
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        RaylibMesh mesh = model.meshes[m];
+
+        if ((mesh.boneMatrices == NULL) || (mesh.boneIds == NULL) || (mesh.boneWeights == NULL) || (mesh.animVertices == NULL)) continue;
+
+        // Bone matrices are converted to column-major order, ready to be blended by columns
+        int boneCount = (mesh.boneCount < RAYLIB_SKINNING_MAX_BONES)? mesh.boneCount : RAYLIB_SKINNING_MAX_BONES;
+
+        for (int boneId = 0; boneId < boneCount; boneId++)
+        {
+            RaylibMatrix mat = mesh.boneMatrices[boneId];
+            float *col = boneColumns + boneId*16;
+
+            col[0] = mat.m0; col[1] = mat.m1; col[2] = mat.m2; col[3] = mat.m3;
+            col[4] = mat.m4; col[5] = mat.m5; col[6] = mat.m6; col[7] = mat.m7;
+            col[8] = mat.m8; col[9] = mat.m9; col[10] = mat.m10; col[11] = mat.m11;
+            col[12] = mat.m12; col[13] = mat.m13; col[14] = mat.m14; col[15] = mat.m15;
+        }
+
+        SkinningJob job = { &mesh, boneColumns };
+        ParallelFor(mesh.vertexCount, RAYLIB_SKINNING_BATCH_VERTICES, SkinMeshVertices, &job);
+
+        rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0);    // Update vertex position
+        if ((mesh.normals != NULL) && (mesh.animNormals != NULL)) rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);   // Update vertex normals
+    }
+}
+
+// Build pose from parent joints
+// NOTE: Required for animations loading (required by IQM and GLTF)
 static void BuildPoseFromParentJoints(RaylibBoneInfo *bones, int boneCount, RaylibTransform *transforms)
 {
     for (int i = 0; i < boneCount; i++)
@@ -4179,6 +4959,187 @@ static void BuildPoseFromParentJoints(RaylibBoneInfo *bones, int boneCount, Rayl
         }
     }
 }
+
+// Interpolate animation values: spherical for rotations (4 components), linear otherwise
+static void InterpolateAnimationValues(const float *value1, const float *value2, int components, float amount, float *result)
+{
+    if (components == 4)
+    {
+        Quaternion q = RaylibQuaternionSlerp((Quaternion){ value1[0], value1[1], value1[2], value1[3] }, (Quaternion){ value2[0], value2[1], value2[2], value2[3] }, amount);
+
+        result[0] = q.x;
+        result[1] = q.y;
+        result[2] = q.z;
+        result[3] = q.w;
+    }
+    else
+    {
+        for (int c = 0; c < components; c++) result[c] = value1[c] + amount*(value2[c] - value1[c]);
+    }
+}
+
+// Sample animation track value at time
+// NOTE: Track cursor keeps the last sampled keyframe, so sampling at increasing times
+// just checks next keyframe, binary search is only required on jumps
+static void SampleAnimationTrack(RaylibAnimationTrack *track, float time, float *value)
+{
+    const int components = track->components;
+    const bool cubic = (track->interpolation == RAYLIB_ANIMATION_INTERPOLATION_CUBIC);
+    const int stride = cubic? 3*components : components;
+    const int offset = cubic? components : 0;      // Value position on keyframe data (cubic spline: in-tangent, value, out-tangent)
+    const float *times = track->times;
+    const int last = track->keyCount - 1;
+
+    if ((last == 0) || (time <= times[0])) { memcpy(value, track->values + offset, components*sizeof(float)); return; }
+    if (time >= times[last]) { memcpy(value, track->values + last*stride + offset, components*sizeof(float)); return; }
+
+    // Find keyframe k: times[k] <= time < times[k + 1]
+    int k = track->cursor;
+
+    if ((k < 0) || (k >= last) || (times[k] > time)) k = -1;
+    else if (time >= times[k + 1])
+    {
+        k++;
+        if (time >= times[k + 1]) k = -1;
+    }
+
+    if (k == -1)
+    {
+        int low = 0;
+        int high = last - 1;
+
+        while (low < high)
+        {
+            int mid = (low + high + 1)/2;
+
+            if (times[mid] <= time) low = mid;
+            else high = mid - 1;
+        }
+
+        k = low;
+    }
+
+    track->cursor = k;
+
+    const float *value1 = track->values + k*stride + offset;
+    const float *value2 = track->values + (k + 1)*stride + offset;
+    const float duration = times[k + 1] - times[k];
+    const float amount = (time - times[k])/duration;
+
+    switch (track->interpolation)
+    {
+        case RAYLIB_ANIMATION_INTERPOLATION_STEP: memcpy(value, value1, components*sizeof(float)); break;
+        case RAYLIB_ANIMATION_INTERPOLATION_LINEAR: InterpolateAnimationValues(value1, value2, components, amount, value); break;
+        case RAYLIB_ANIMATION_INTERPOLATION_CUBIC:
+        {
+            // Cubic hermite spline, tangents are scaled by keyframes duration as described in the glTF 2.0 specification
+            const float *outTangent1 = value1 + components;
+            const float *inTangent2 = value2 - components;
+            const float amount2 = amount*amount;
+            const float amount3 = amount2*amount;
+            const float h00 = 2*amount3 - 3*amount2 + 1;
+            const float h10 = (amount3 - 2*amount2 + amount)*duration;
+            const float h01 = -2*amount3 + 3*amount2;
+            const float h11 = (amount3 - amount2)*duration;
+
+            for (int c = 0; c < components; c++) value[c] = h00*value1[c] + h10*outTangent1[c] + h01*value2[c] + h11*inTangent2[c];
+
+            if (components == 4)
+            {
+                float length = sqrtf(value[0]*value[0] + value[1]*value[1] + value[2]*value[2] + value[3]*value[3]);
+                if (length > 0.0f) for (int c = 0; c < 4; c++) value[c] /= length;
+            }
+        } break;
+        default: break;
+    }
+}
+
+// Sample animation clip pose at time, bones transforms are returned in model space
+static void SampleAnimationClipPose(RaylibModelAnimationClip clip, float time, RaylibTransform *pose)
+{
+    for (int i = 0; i < clip.boneCount; i++)
+    {
+        SampleAnimationTrack(&clip.tracks[i*3], time, &pose[i].translation.x);
+        SampleAnimationTrack(&clip.tracks[i*3 + 1], time, &pose[i].rotation.x);
+        SampleAnimationTrack(&clip.tracks[i*3 + 2], time, &pose[i].scale.x);
+    }
+
+    BuildPoseFromParentJoints(clip.bones, clip.boneCount, pose);
+}
+
+#if defined(RAYLIB_SUPPORT_FILEFORMAT_GLTF)
+// Check if two animation values are equal within tolerance, rotations q and -q are considered equal
+static bool AnimationValuesEqual(const float *value1, const float *value2, int components, float tolerance)
+{
+    bool equal = true;
+    bool negatedEqual = (components == 4);
+
+    for (int c = 0; c < components; c++)
+    {
+        if (fabsf(value1[c] - value2[c]) > tolerance) equal = false;
+        if (fabsf(value1[c] + value2[c]) > tolerance) negatedEqual = false;
+    }
+
+    return (equal || negatedEqual);
+}
+
+#define ANIMATION_TRACK_MAX_KEY_SPAN 64    // Maximum keyframes dropped in a row on track reduction, bounds reduction cost
+
+// Reduce animation track keyframes, dropping the ones reproduced within tolerance by interpolating kept neighbours
+// NOTE: Only step and linear tracks are reduced, a track with all keyframes equal is reduced to a single keyframe
+static void ReduceAnimationTrackKeys(RaylibAnimationTrack *track, float tolerance)
+{
+    const int components = track->components;
+    float *times = track->times;
+    float *values = track->values;
+
+    if ((track->interpolation == RAYLIB_ANIMATION_INTERPOLATION_CUBIC) || (track->keyCount < 2)) return;
+
+    // Keyframes are compacted in place, last kept keyframe is always at [keptCount - 1]
+    int keptCount = 1;
+    int lastKept = 0;
+
+    for (int i = 1; i < track->keyCount; i++)
+    {
+        const float *kept = values + (keptCount - 1)*components;
+        bool drop = false;
+
+        if (track->interpolation == RAYLIB_ANIMATION_INTERPOLATION_STEP) drop = AnimationValuesEqual(values + i*components, kept, components, tolerance);
+        else if ((i < (track->keyCount - 1)) && ((i - lastKept) < ANIMATION_TRACK_MAX_KEY_SPAN))
+        {
+            // Keyframe i is dropped if interpolating from last kept keyframe to keyframe i + 1
+            // reproduces keyframe i and all keyframes already dropped after the last kept one
+            const float *next = values + (i + 1)*components;
+            float duration = times[i + 1] - times[keptCount - 1];
+            float value[4] = { 0 };
+
+            drop = true;
+
+            for (int j = lastKept + 1; (j <= i) && drop; j++)
+            {
+                float amount = (duration > 0.0f)? (times[j] - times[keptCount - 1])/duration : 0.0f;
+
+                InterpolateAnimationValues(kept, next, components, amount, value);
+                drop = AnimationValuesEqual(value, values + j*components, components, tolerance);
+            }
+        }
+
+        if (!drop)
+        {
+            times[keptCount] = times[i];
+            memmove(values + keptCount*components, values + i*components, components*sizeof(float));
+            keptCount++;
+            lastKept = i;
+        }
+    }
+
+    // Constant track, a single keyframe is required
+    bool constant = true;
+    for (int i = 1; (i < keptCount) && constant; i++) constant = AnimationValuesEqual(values + i*components, values, components, tolerance);
+
+    track->keyCount = constant? 1 : keptCount;
+    track->cursor = 0;
+}
 #endif
 
 #if defined(RAYLIB_SUPPORT_FILEFORMAT_OBJ)
@@ -5431,14 +6392,8 @@ static RaylibModel LoadGLTF(const char *fileName)
                             LOAD_ATTRIBUTE(attribute, 3, float, model.meshes[meshIndex].vertices)
 
                             // RaylibTransform the vertices
-                            float *vertices = model.meshes[meshIndex].vertices;
-                            for (unsigned int k = 0; k < attribute->count; k++)
-                            {
-                                RaylibVector3 vt = RaylibVector3Transform((RaylibVector3){ vertices[3*k], vertices[3*k+1], vertices[3*k+2] }, worldMatrix);
-                                vertices[3*k] = vt.x;
-                                vertices[3*k+1] = vt.y;
-                                vertices[3*k+2] = vt.z;
-                            }
+                            RaylibVector3 *vertices = (RaylibVector3 *)model.meshes[meshIndex].vertices;
+                            RaylibVector3TransformArray(vertices, vertices, (int)attribute->count, worldMatrix);
                         }
                         else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "MODEL: [%s] Vertices attribute data format not supported, use vec3 float", fileName);
                     }
@@ -5455,14 +6410,8 @@ static RaylibModel LoadGLTF(const char *fileName)
                             LOAD_ATTRIBUTE(attribute, 3, float, model.meshes[meshIndex].normals)
 
                             // RaylibTransform the normals
-                            float *normals = model.meshes[meshIndex].normals;
-                            for (unsigned int k = 0; k < attribute->count; k++)
-                            {
-                                RaylibVector3 nt = RaylibVector3Transform((RaylibVector3){ normals[3*k], normals[3*k+1], normals[3*k+2] }, worldMatrixNormals);
-                                normals[3*k] = nt.x;
-                                normals[3*k+1] = nt.y;
-                                normals[3*k+2] = nt.z;
-                            }
+                            RaylibVector3 *normals = (RaylibVector3 *)model.meshes[meshIndex].normals;
+                            RaylibVector3TransformNormalArray(normals, normals, (int)attribute->count, worldMatrixNormals);
                         }
                         else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "MODEL: [%s] Normal attribute data format not supported, use vec3 float", fileName);
                     }
@@ -5908,150 +6857,192 @@ static RaylibModel LoadGLTF(const char *fileName)
     return model;
 }
 
-// Get interpolated pose for bone sampler at a specific time. Returns true on success
-static bool GetPoseAtTimeGLTF(cgltf_interpolation_type interpolationType, cgltf_accessor *input, cgltf_accessor *output, float time, void *data)
+// Load animation track keyframes from glTF animation sampler
+static bool LoadAnimationTrackGLTF(cgltf_animation_sampler *sampler, int components, float tolerance, RaylibAnimationTrack *track, float *duration)
 {
-    if (interpolationType >= cgltf_interpolation_type_max_enum) return false;
+    int interpolation = RAYLIB_ANIMATION_INTERPOLATION_LINEAR;
+    if (sampler->interpolation == cgltf_interpolation_type_step) interpolation = RAYLIB_ANIMATION_INTERPOLATION_STEP;
+    else if (sampler->interpolation == cgltf_interpolation_type_cubic_spline) interpolation = RAYLIB_ANIMATION_INTERPOLATION_CUBIC;
+
+    int keyCount = (int)sampler->input->count;
+    int valueCount = (interpolation == RAYLIB_ANIMATION_INTERPOLATION_CUBIC)? 3*keyCount : keyCount;
+
+    if ((keyCount == 0) || ((int)sampler->output->count < valueCount) || ((int)cgltf_num_components(sampler->output->type) != components)) return false;
 
-    // Input and output should have the same count
-    float tstart = 0.0f;
-    float tend = 0.0f;
-    int keyframe = 0;       // Defaults to first pose
+    float *times = RL_MALLOC(keyCount*sizeof(float));
+    float *values = RL_MALLOC(valueCount*components*sizeof(float));
 
-    for (int i = 0; i < (int)input->count - 1; i++)
+    // NOTE: Normalized integer components (KHR_mesh_quantization) are converted to float
+    if ((cgltf_accessor_unpack_floats(sampler->input, times, keyCount) == 0) ||
+        (cgltf_accessor_unpack_floats(sampler->output, values, valueCount*components) == 0))
     {
-        cgltf_bool r1 = cgltf_accessor_read_float(input, i, &tstart, 1);
-        if (!r1) return false;
+        RL_FREE(times);
+        RL_FREE(values);
+        return false;
+    }
 
-        cgltf_bool r2 = cgltf_accessor_read_float(input, i + 1, &tend, 1);
-        if (!r2) return false;
+    *track = (RaylibAnimationTrack){ keyCount, interpolation, components, times, values, 0 };
+    *duration = times[keyCount - 1];
 
-        if ((tstart <= time) && (time < tend))
-        {
-            keyframe = i;
-            break;
-        }
+    ReduceAnimationTrackKeys(track, tolerance);
+
+    if (track->keyCount < keyCount)
+    {
+        valueCount = (interpolation == RAYLIB_ANIMATION_INTERPOLATION_CUBIC)? 3*track->keyCount : track->keyCount;
+        track->times = RL_REALLOC(track->times, track->keyCount*sizeof(float));
+        track->values = RL_REALLOC(track->values, valueCount*components*sizeof(float));
     }
 
-    // Constant animation, no need to interpolate
-    if (RaylibFloatEquals(tend, tstart)) return true;
+    return true;
+}
 
-    float duration = fmaxf((tend - tstart), RAYLIB_EPSILON);
-    float t = (time - tstart)/duration;
-    t = (t < 0.0f)? 0.0f : t;
-    t = (t > 1.0f)? 1.0f : t;
+// Load glTF animation as keyframe tracks for skin bones
+// NOTE: Bones not animated by a channel get a single keyframe track with joint node transform
+static RaylibModelAnimationClip LoadModelAnimationClipGLTF(const char *fileName, cgltf_skin skin, cgltf_animation *animData, float tolerance)
+{
+    RaylibModelAnimationClip clip = { 0 };
 
-    if (output->component_type != cgltf_component_type_r_32f) return false;
+    clip.bones = LoadBoneInfoGLTF(skin, &clip.boneCount);
+    clip.tracks = RL_CALLOC(clip.boneCount*3, sizeof(RaylibAnimationTrack));
 
-    if (output->type == cgltf_type_vec3)
+    for (unsigned int j = 0; j < animData->channels_count; j++)
     {
-        switch (interpolationType)
+        cgltf_animation_channel *channel = &animData->channels[j];
+        int boneIndex = -1;
+
+        for (unsigned int k = 0; k < skin.joints_count; k++)
         {
-            case cgltf_interpolation_type_step:
+            if (channel->target_node == skin.joints[k])
             {
-                float tmp[3] = { 0.0f };
-                cgltf_accessor_read_float(output, keyframe, tmp, 3);
-                RaylibVector3 v1 = {tmp[0], tmp[1], tmp[2]};
-                RaylibVector3 *r = data;
+                boneIndex = k;
+                break;
+            }
+        }
 
-                *r = v1;
-            } break;
-            case cgltf_interpolation_type_linear:
+        if (boneIndex == -1)
+        {
+            // Animation channel for a node not in the armature
+            continue;
+        }
+
+        int path = -1;
+        if (channel->target_path == cgltf_animation_path_type_translation) path = 0;
+        else if (channel->target_path == cgltf_animation_path_type_rotation) path = 1;
+        else if (channel->target_path == cgltf_animation_path_type_scale) path = 2;
+
+        if (channel->sampler->interpolation == cgltf_interpolation_type_max_enum)
+        {
+            RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "MODEL: [%s] Invalid interpolation curve encountered for GLTF animation.", fileName);
+        }
+        else if (path == -1)
+        {
+            RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "MODEL: [%s] Unsupported target_path on channel %d's sampler for animation %s. Skipping.", fileName, j, (animData->name != NULL)? animData->name : "NULL");
+        }
+        else
+        {
+            RaylibAnimationTrack *track = &clip.tracks[boneIndex*3 + path];
+
+            if (track->keyCount > 0)
             {
-                float tmp[3] = { 0.0f };
-                cgltf_accessor_read_float(output, keyframe, tmp, 3);
-                RaylibVector3 v1 = {tmp[0], tmp[1], tmp[2]};
-                cgltf_accessor_read_float(output, keyframe+1, tmp, 3);
-                RaylibVector3 v2 = {tmp[0], tmp[1], tmp[2]};
-                RaylibVector3 *r = data;
-
-                *r = RaylibVector3Lerp(v1, v2, t);
-            } break;
-            case cgltf_interpolation_type_cubic_spline:
+                RL_FREE(track->times);
+                RL_FREE(track->values);
+            }
+
+            float duration = 0.0f;
+
+            if (LoadAnimationTrackGLTF(channel->sampler, (path == 1)? 4 : 3, tolerance, track, &duration))
             {
-                float tmp[3] = { 0.0f };
-                cgltf_accessor_read_float(output, 3*keyframe+1, tmp, 3);
-                RaylibVector3 v1 = {tmp[0], tmp[1], tmp[2]};
-                cgltf_accessor_read_float(output, 3*keyframe+2, tmp, 3);
-                RaylibVector3 tangent1 = {tmp[0], tmp[1], tmp[2]};
-                cgltf_accessor_read_float(output, 3*(keyframe+1)+1, tmp, 3);
-                RaylibVector3 v2 = {tmp[0], tmp[1], tmp[2]};
-                cgltf_accessor_read_float(output, 3*(keyframe+1), tmp, 3);
-                RaylibVector3 tangent2 = {tmp[0], tmp[1], tmp[2]};
-                RaylibVector3 *r = data;
-
-                *r = RaylibVector3CubicHermite(v1, tangent1, v2, tangent2, t);
-            } break;
-            default: break;
+                clip.duration = (duration > clip.duration)? duration : clip.duration;
+            }
+            else
+            {
+                *track = (RaylibAnimationTrack){ 0 };
+                RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "MODEL: [%s] Failed to load pose data for bone %s", fileName, clip.bones[boneIndex].name);
+            }
         }
     }
-    else if (output->type == cgltf_type_vec4)
+
+    // Bone components not animated keep joint node transform
+    for (int k = 0; k < clip.boneCount; k++)
     {
-        // Only v4 is for rotations, so we know it's a quaternion
-        switch (interpolationType)
+        const float *rest[3] = { skin.joints[k]->translation, skin.joints[k]->rotation, skin.joints[k]->scale };
+
+        for (int path = 0; path < 3; path++)
         {
-            case cgltf_interpolation_type_step:
-            {
-                float tmp[4] = { 0.0f };
-                cgltf_accessor_read_float(output, keyframe, tmp, 4);
-                RaylibVector4 v1 = {tmp[0], tmp[1], tmp[2], tmp[3]};
-                RaylibVector4 *r = data;
+            RaylibAnimationTrack *track = &clip.tracks[k*3 + path];
 
-                *r = v1;
-            } break;
-            case cgltf_interpolation_type_linear:
-            {
-                float tmp[4] = { 0.0f };
-                cgltf_accessor_read_float(output, keyframe, tmp, 4);
-                RaylibVector4 v1 = {tmp[0], tmp[1], tmp[2], tmp[3]};
-                cgltf_accessor_read_float(output, keyframe+1, tmp, 4);
-                RaylibVector4 v2 = {tmp[0], tmp[1], tmp[2], tmp[3]};
-                RaylibVector4 *r = data;
-
-                *r = RaylibQuaternionSlerp(v1, v2, t);
-            } break;
-            case cgltf_interpolation_type_cubic_spline:
+            if (track->keyCount == 0)
             {
-                float tmp[4] = { 0.0f };
-                cgltf_accessor_read_float(output, 3*keyframe+1, tmp, 4);
-                RaylibVector4 v1 = {tmp[0], tmp[1], tmp[2], tmp[3]};
-                cgltf_accessor_read_float(output, 3*keyframe+2, tmp, 4);
-                RaylibVector4 outTangent1 = {tmp[0], tmp[1], tmp[2], 0.0f};
-                cgltf_accessor_read_float(output, 3*(keyframe+1)+1, tmp, 4);
-                RaylibVector4 v2 = {tmp[0], tmp[1], tmp[2], tmp[3]};
-                cgltf_accessor_read_float(output, 3*(keyframe+1), tmp, 4);
-                RaylibVector4 inTangent2 = {tmp[0], tmp[1], tmp[2], 0.0f};
-                RaylibVector4 *r = data;
-
-                v1 = RaylibQuaternionNormalize(v1);
-                v2 = RaylibQuaternionNormalize(v2);
-
-                if (RaylibVector4DotProduct(v1, v2) < 0.0f)
-                {
-                    v2 = RaylibVector4Negate(v2);
-                }
+                int components = (path == 1)? 4 : 3;
 
-                outTangent1 = RaylibVector4Scale(outTangent1, duration);
-                inTangent2 = RaylibVector4Scale(inTangent2, duration);
-
-                *r = RaylibQuaternionCubicHermiteSpline(v1, outTangent1, v2, inTangent2, t);
-            } break;
-            default: break;
+                *track = (RaylibAnimationTrack){ 1, RAYLIB_ANIMATION_INTERPOLATION_STEP, components, RL_CALLOC(1, sizeof(float)), RL_MALLOC(components*sizeof(float)), 0 };
+                memcpy(track->values, rest[path], components*sizeof(float));
+            }
         }
     }
 
-    return true;
+    if (animData->name != NULL)
+    {
+        strncpy(clip.name, animData->name, sizeof(clip.name));
+        clip.name[sizeof(clip.name) - 1] = '\0';
+    }
+
+    return clip;
 }
 
 #define GLTF_ANIMDELAY 17    // Animation frames delay, (~1000 ms/60 FPS = 16.666666* ms)
 
+// Load glTF animations baked into frame poses
+// NOTE: Animations are loaded as keyframe clips (only exact keyframes reduction) and sampled every GLTF_ANIMDELAY
 static RaylibModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *animCount)
+{
+    int clipCount = 0;
+    RaylibModelAnimationClip *clips = LoadModelAnimationClipsGLTF(fileName, &clipCount, 0.0f);
+    RaylibModelAnimation *animations = NULL;
+
+    *animCount = clipCount;
+
+    if (clips != NULL)
+    {
+        animations = RL_MALLOC(clipCount*sizeof(RaylibModelAnimation));
+
+        for (int i = 0; i < clipCount; i++)
+        {
+            animations[i].boneCount = clips[i].boneCount;
+            animations[i].bones = clips[i].bones;
+            memcpy(animations[i].name, clips[i].name, sizeof(animations[i].name));
+
+            animations[i].frameCount = (int)(clips[i].duration*1000.0f/GLTF_ANIMDELAY) + 1;
+            animations[i].framePoses = RL_MALLOC(animations[i].frameCount*sizeof(RaylibTransform *));
+
+            for (int j = 0; j < animations[i].frameCount; j++)
+            {
+                animations[i].framePoses[j] = RL_MALLOC(animations[i].boneCount*sizeof(RaylibTransform));
+                SampleAnimationClipPose(clips[i], ((float)j*GLTF_ANIMDELAY)/1000.0f, animations[i].framePoses[j]);
+            }
+
+            RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "MODEL: [%s] Loaded animation: %s (%d frames, %fs)", fileName, (clips[i].name[0] != '\0')? clips[i].name : "NULL", animations[i].frameCount, clips[i].duration);
+
+            // Bones are now owned by baked animation
+            clips[i].bones = NULL;
+            RaylibUnloadModelAnimationClip(clips[i]);
+        }
+
+        RL_FREE(clips);
+    }
+
+    return animations;
+}
+
+// Load glTF animations as keyframe clips, keyframes reproduced by interpolation within tolerance are dropped
+static RaylibModelAnimationClip *LoadModelAnimationClipsGLTF(const char *fileName, int *clipCount, float tolerance)
 {
     // glTF file loading
     int dataSize = 0;
     unsigned char *fileData = RaylibLoadFileData(fileName, &dataSize);
 
-    RaylibModelAnimation *animations = NULL;
+    RaylibModelAnimationClip *clips = NULL;
+    *clipCount = 0;
 
     // glTF data loading
     cgltf_options options = { 0 };
@@ -6063,7 +7054,7 @@ static RaylibModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *
     if (result != cgltf_result_success)
     {
         RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "MODEL: [%s] Failed to load glTF data", fileName);
-        *animCount = 0;
+        RaylibUnloadFileData(fileData);
         return NULL;
     }
 
@@ -6072,151 +7063,23 @@ static RaylibModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *
 
     if (result == cgltf_result_success)
     {
-        if (data->skins_count > 0)
+        if ((data->skins_count > 0) && (data->animations_count > 0))
         {
-            cgltf_skin skin = data->skins[0];
-            *animCount = (int)data->animations_count;
-            animations = RL_MALLOC(data->animations_count*sizeof(RaylibModelAnimation));
-
-            for (unsigned int i = 0; i < data->animations_count; i++)
-            {
-                animations[i].bones = LoadBoneInfoGLTF(skin, &animations[i].boneCount);
-
-                cgltf_animation animData = data->animations[i];
+            *clipCount = (int)data->animations_count;
+            clips = RL_MALLOC(data->animations_count*sizeof(RaylibModelAnimationClip));
 
-                struct Channels {
-                    cgltf_animation_channel *translate;
-                    cgltf_animation_channel *rotate;
-                    cgltf_animation_channel *scale;
-                    cgltf_interpolation_type interpolationType;
-                };
-
-                struct Channels *boneChannels = RL_CALLOC(animations[i].boneCount, sizeof(struct Channels));
-                float animDuration = 0.0f;
-
-                for (unsigned int j = 0; j < animData.channels_count; j++)
-                {
-                    cgltf_animation_channel channel = animData.channels[j];
-                    int boneIndex = -1;
-
-                    for (unsigned int k = 0; k < skin.joints_count; k++)
-                    {
-                        if (animData.channels[j].target_node == skin.joints[k])
-                        {
-                            boneIndex = k;
-                            break;
-                        }
-                    }
-
-                    if (boneIndex == -1)
-                    {
-                        // Animation channel for a node not in the armature
-                        continue;
-                    }
-
-                    boneChannels[boneIndex].interpolationType = animData.channels[j].sampler->interpolation;
-
-                    if (animData.channels[j].sampler->interpolation != cgltf_interpolation_type_max_enum)
-                    {
-                        if (channel.target_path == cgltf_animation_path_type_translation)
-                        {
-                            boneChannels[boneIndex].translate = &animData.channels[j];
-                        }
-                        else if (channel.target_path == cgltf_animation_path_type_rotation)
-                        {
-                            boneChannels[boneIndex].rotate = &animData.channels[j];
-                        }
-                        else if (channel.target_path == cgltf_animation_path_type_scale)
-                        {
-                            boneChannels[boneIndex].scale = &animData.channels[j];
-                        }
-                        else
-                        {
-                            RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "MODEL: [%s] Unsupported target_path on channel %d's sampler for animation %d. Skipping.", fileName, j, i);
-                        }
-                    }
-                    else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "MODEL: [%s] Invalid interpolation curve encountered for GLTF animation.", fileName);
-
-                    float t = 0.0f;
-                    cgltf_bool r = cgltf_accessor_read_float(channel.sampler->input, channel.sampler->input->count - 1, &t, 1);
-
-                    if (!r)
-                    {
-                        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "MODEL: [%s] Failed to load input time", fileName);
-                        continue;
-                    }
-
-                    animDuration = (t > animDuration)? t : animDuration;
-                }
-
-                if (animData.name != NULL)
-                {
-                    strncpy(animations[i].name, animData.name, sizeof(animations[i].name));
-                    animations[i].name[sizeof(animations[i].name) - 1] = '\0';
-                }
-
-                animations[i].frameCount = (int)(animDuration*1000.0f/GLTF_ANIMDELAY) + 1;
-                animations[i].framePoses = RL_MALLOC(animations[i].frameCount*sizeof(RaylibTransform *));
-
-                for (int j = 0; j < animations[i].frameCount; j++)
-                {
-                    animations[i].framePoses[j] = RL_MALLOC(animations[i].boneCount*sizeof(RaylibTransform));
-                    float time = ((float) j*GLTF_ANIMDELAY)/1000.0f;
-
-                    for (int k = 0; k < animations[i].boneCount; k++)
-                    {
-                        RaylibVector3 translation = {skin.joints[k]->translation[0], skin.joints[k]->translation[1], skin.joints[k]->translation[2]};
-                        Quaternion rotation = {skin.joints[k]->rotation[0], skin.joints[k]->rotation[1], skin.joints[k]->rotation[2], skin.joints[k]->rotation[3]};
-                        RaylibVector3 scale = {skin.joints[k]->scale[0], skin.joints[k]->scale[1], skin.joints[k]->scale[2]};
-
-                        if (boneChannels[k].translate)
-                        {
-                            if (!GetPoseAtTimeGLTF(boneChannels[k].interpolationType, boneChannels[k].translate->sampler->input, boneChannels[k].translate->sampler->output, time, &translation))
-                            {
-                                RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "MODEL: [%s] Failed to load translate pose data for bone %s", fileName, animations[i].bones[k].name);
-                            }
-                        }
-
-                        if (boneChannels[k].rotate)
-                        {
-                            if (!GetPoseAtTimeGLTF(boneChannels[k].interpolationType, boneChannels[k].rotate->sampler->input, boneChannels[k].rotate->sampler->output, time, &rotation))
-                            {
-                                RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "MODEL: [%s] Failed to load rotate pose data for bone %s", fileName, animations[i].bones[k].name);
-                            }
-                        }
-
-                        if (boneChannels[k].scale)
-                        {
-                            if (!GetPoseAtTimeGLTF(boneChannels[k].interpolationType, boneChannels[k].scale->sampler->input, boneChannels[k].scale->sampler->output, time, &scale))
-                            {
-                                RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "MODEL: [%s] Failed to load scale pose data for bone %s", fileName, animations[i].bones[k].name);
-                            }
-                        }
-
-                        animations[i].framePoses[j][k] = (RaylibTransform){
-                            .translation = translation,
-                            .rotation = rotation,
-                            .scale = scale
-                        };
-                    }
-
-                    BuildPoseFromParentJoints(animations[i].bones, animations[i].boneCount, animations[i].framePoses[j]);
-                }
-
-                RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "MODEL: [%s] Loaded animation: %s (%d frames, %fs)", fileName, (animData.name != NULL)? animData.name : "NULL", animations[i].frameCount, animDuration);
-                RL_FREE(boneChannels);
-            }
+            for (unsigned int i = 0; i < data->animations_count; i++) clips[i] = LoadModelAnimationClipGLTF(fileName, data->skins[0], &data->animations[i], tolerance);
         }
 
         if (data->skins_count > 1)
         {
             RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "MODEL: [%s] expected exactly one skin to load animation data from, but found %i", fileName, data->skins_count);
         }
-
-        cgltf_free(data);
     }
+
+    cgltf_free(data);
     RaylibUnloadFileData(fileData);
-    return animations;
+    return clips;
 }
 #endif
 
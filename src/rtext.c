@@ -93,6 +93,13 @@
         #pragma GCC diagnostic ignored "-Wunused-function"
     #endif
 
+    // Glyphs rasterization temporary memory comes from per-thread scratch buffers when provided as stb_truetype userdata
+    typedef struct FontScratch FontScratch;
+    static void *LoadFontScratchMemory(FontScratch *scratch, size_t size);
+
+    #define STBTT_malloc(x, u)  ((u)? LoadFontScratchMemory((FontScratch *)(u), (x)) : RL_MALLOC(x))
+    #define STBTT_free(x, u)    do { if (!(u)) RL_FREE(x); } while (0)
+
     #define STBTT_STATIC
     #define STB_TRUETYPE_IMPLEMENTATION
     #include "external/stb_truetype.h"      // Required for: ttf font data reading
@@ -115,11 +122,90 @@
 #ifndef RAYLIB_MAX_TEXTSPLIT_COUNT
     #define RAYLIB_MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: RaylibTextSplit()
 #endif
+#ifndef RAYLIB_GLYPH_LOOKUP_DENSE_SIZE
+    #define RAYLIB_GLYPH_LOOKUP_DENSE_SIZE              592        // Codepoints directly indexed by glyph lookup table (Basic Latin to Latin Extended-B)
+#endif
+#ifndef RAYLIB_FONT_LOADING_BATCH_GLYPHS
+    #define RAYLIB_FONT_LOADING_BATCH_GLYPHS             16        // Minimum glyphs rasterized per worker thread range: RaylibLoadFontData()
+#endif
+#ifndef RAYLIB_FONT_DYNAMIC_ATLAS_SIZE
+    #define RAYLIB_FONT_DYNAMIC_ATLAS_SIZE             1024        // Default atlas texture size for dynamic fonts: RaylibLoadFontDynamic()
+#endif
+
+#define FONT_CACHE_GLYPH_MISSING                        -2        // Dynamic font lookup index for codepoints not available in font
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+typedef struct FontCache FontCache;
+
+// Glyph lookup table, maps codepoints to glyph index
+// NOTE: Codepoints below RAYLIB_GLYPH_LOOKUP_DENSE_SIZE are directly indexed,
+// other codepoints are stored in an open-addressing hash table (linear probing)
+struct RaylibGlyphLookup {
+    int fallbackIndex;                              // Glyph index used for codepoints not available in font ('?' glyph)
+    int dense[RAYLIB_GLYPH_LOOKUP_DENSE_SIZE];      // Glyph index by codepoint, -1 if not available
+    unsigned int hashCapacity;                      // Hash table capacity (power of two), 0 if not required
+    int *hashCodepoints;                            // Hash table codepoints, -1 for empty slots
+    int *hashIndices;                               // Hash table glyph indices
+    FontCache *cache;                               // Dynamic font glyphs cache, NULL for fonts with all glyphs loaded
+};
+
+#if defined(RAYLIB_SUPPORT_FILEFORMAT_TTF)
+// Dynamic font atlas shelf, glyphs cells are packed left to right
+typedef struct FontCacheShelf {
+    int y;                                          // Shelf position Y in atlas
+    int height;                                     // Shelf height
+    int width;                                      // Shelf width used
+} FontCacheShelf;
+
+// Dynamic font glyphs cache
+// NOTE: Font glyphs and recs arrays are used as cache slots, glyphs are rasterized on first use,
+// packed in atlas shelves and least recently used glyphs are evicted when atlas or slots are full
+struct FontCache {
+    unsigned char *fileData;                        // TTF font file data, kept for glyphs rasterization
+    int dataSize;                                   // TTF font file data size
+    stbtt_fontinfo fontInfo;                        // Font info, used to check glyphs availability
+    int atlasSize;                                  // Atlas texture size (width and height)
+    int slotCapacity;                               // Glyphs slots available (font glyphCount)
+    int slotCount;                                  // Glyphs slots in use
+    int missingCount;                               // Missing codepoints cached in lookup hash table
+    RaylibRectangle *cells;                         // Atlas cells by slot, including glyph padding
+    int *lruPrev;                                   // Previous (more recently used) slot, -1 for none
+    int *lruNext;                                   // Next (less recently used) slot, -1 for none
+    int lruHead;                                    // Most recently used slot
+    int lruTail;                                    // Least recently used slot
+    FontCacheShelf *shelves;                        // Atlas shelves
+    int shelfCount;                                 // Atlas shelves count
+    unsigned int hits;                              // Glyph lookups found in cache
+    unsigned int misses;                            // Glyph lookups rasterized on demand
+    unsigned int evictions;                         // Glyphs evicted from cache
+};
+#endif
+
+#if defined(RAYLIB_SUPPORT_FILEFORMAT_TTF)
+// Glyphs rasterization scratch memory, one per worker thread range
+// NOTE: Linear allocator reset after every glyph, allocations not fitting go to an overflow list
+// and buffer grows to the peak size required on reset
+struct FontScratch {
+    unsigned char *buffer;                          // Scratch buffer
+    size_t capacity;                                // Scratch buffer size
+    size_t used;                                    // Scratch buffer bytes used
+    size_t peak;                                    // Bytes required since last reset (including overflow)
+    void *overflow;                                 // Overflow allocations list (first pointer-size bytes link next one)
+};
+
+// Glyphs rasterization job data, shared by worker threads
+typedef struct FontGlyphsJob {
+    const stbtt_fontinfo *fontInfo;                 // Font info, copied by every worker range
+    const int *codepoints;                          // Codepoints to rasterize
+    RaylibGlyphInfo *glyphs;                        // Glyphs to fill, one per codepoint
+    int fontSize;                                   // Font size in pixels
+    int type;                                       // Font type (RaylibFontType)
+    float scaleFactor;                              // Font scale factor for font size
+    int ascent;                                     // Font ascent (unscaled)
+} FontGlyphsJob;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -145,6 +231,22 @@ static RaylibFont LoadBMFont(const char *fileName);   // Load a BMFont file (Ang
 #if defined(SUPPORT_FILEFORMAT_BDF)
 static RaylibGlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, int *codepoints, int codepointCount, int *outFontSize);
 #endif
+static RaylibGlyphLookup *LoadGlyphLookup(const RaylibGlyphInfo *glyphs, int glyphCount);   // Load codepoint to glyph index lookup table
+static void UnloadGlyphLookup(RaylibGlyphLookup *lookup);                                   // Unload codepoint to glyph index lookup table
+static void SetTextLayoutTexcoords(float *quad, RaylibRectangle rec, float padding, Texture2D texture);  // Set text layout glyph quad texcoords from glyph atlas rectangle
+static int FormatTextBuffer(char *buffer, int bufferSize, const char *text, va_list args);  // Format text into buffer, truncated with "..." if it does not fit
+#if defined(RAYLIB_SUPPORT_FILEFORMAT_TTF)
+static void ResetFontScratch(FontScratch *scratch);                                         // Reset glyphs rasterization scratch memory, growing buffer if required
+static void LoadFontGlyphs(void *userData, int start, int end);                             // Rasterize a range of glyphs (FontGlyphsJob)
+static RaylibFont LoadFontDynamicData(unsigned char *fileData, int dataSize, int fontSize, int atlasSize);  // Load dynamic font taking ownership of TTF file data
+static int LoadFontCacheGlyph(RaylibFont font, int codepoint);                              // Rasterize glyph into dynamic font cache, returns glyph index
+static void SetFontCacheIndex(RaylibGlyphLookup *lookup, int codepoint, int index);         // Set dynamic font codepoint glyph index in lookup table, -1 to remove it
+static int SetFontCacheMissing(RaylibFont font, int codepoint);                             // Cache dynamic font codepoint as missing, returns fallback glyph index
+static bool PackFontCacheCell(FontCache *cache, int width, int height, RaylibRectangle *cell);  // Pack a new cell in dynamic font atlas shelves
+static void EvictFontCacheGlyph(RaylibFont font, int index);                                // Evict glyph from dynamic font cache, keeping its slot and atlas cell
+static void ResetFontCache(RaylibFont font);                                                // Evict all glyphs from dynamic font cache, clearing atlas shelves
+#endif
+
 static int textLineSpacing = 2;                 // Text vertical line spacing in pixels (between lines)
 
 #if defined(RAYLIB_SUPPORT_DEFAULT_FONT)
@@ -301,6 +403,7 @@ extern void LoadFontDefault(void)
     RaylibUnloadImage(imFont);
 
     defaultFont.baseSize = (int)defaultFont.recs[0].height;
+    defaultFont.glyphLookup = LoadGlyphLookup(defaultFont.glyphs, defaultFont.glyphCount);
 
     RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "FONT: Default font loaded successfully (%i glyphs)", defaultFont.glyphCount);
 }
@@ -312,6 +415,7 @@ extern void UnloadFontDefault(void)
     if (isGpuReady) RaylibUnloadTexture(defaultFont.texture);
     RL_FREE(defaultFont.glyphs);
     RL_FREE(defaultFont.recs);
+    UnloadGlyphLookup(defaultFont.glyphLookup);
 }
 #endif      // RAYLIB_SUPPORT_DEFAULT_FONT
 
@@ -519,6 +623,7 @@ RaylibFont RaylibLoadFontFromImage(RaylibImage image, RaylibColor key, int first
     RaylibUnloadImage(fontClear);     // Unload processed image once converted to texture
 
     font.baseSize = (int)font.recs[0].height;
+    font.glyphLookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
 
     return font;
 }
@@ -529,7 +634,7 @@ RaylibFont RaylibLoadFontFromMemory(const char *fileType, const unsigned char *f
     RaylibFont font = { 0 };
 
     char fileExtLower[16] = { 0 };
-    strncpy(fileExtLower, RaylibTextToLower(fileType), 16 - 1);
+    RaylibTextToLowerBuffer(fileExtLower, 16, fileType);
 
     font.baseSize = fontSize;
     font.glyphCount = (codepointCount > 0)? codepointCount : 95;
@@ -571,6 +676,8 @@ RaylibFont RaylibLoadFontFromMemory(const char *fileType, const unsigned char *f
 
         RaylibUnloadImage(atlas);
 
+        font.glyphLookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
+
         RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
     }
     else font = RaylibGetFontDefault();
@@ -581,6 +688,102 @@ RaylibFont RaylibLoadFontFromMemory(const char *fileType, const unsigned char *f
     return font;
 }
 
+// Load dynamic font from TTF file, glyphs are rasterized on first use into atlas texture
+// NOTE: atlasSize defines atlas texture width and height, use 0 for default size
+// WARNING: font.glyphCount is the glyphs cache capacity, only first RaylibGetFontCacheInfo().glyphCount
+// glyphs are filled, remaining ones are empty (zero-initialized, no image data)
+RaylibFont RaylibLoadFontDynamic(const char *fileName, int fontSize, int atlasSize)
+{
+    RaylibFont font = { 0 };
+
+#if defined(RAYLIB_SUPPORT_FILEFORMAT_TTF)
+    if (RaylibIsFileExtension(fileName, ".ttf") || RaylibIsFileExtension(fileName, ".otf"))
+    {
+        int dataSize = 0;
+        unsigned char *fileData = RaylibLoadFileData(fileName, &dataSize);
+
+        // NOTE: File data ownership is transferred to font, released on RaylibUnloadFont()
+        if (fileData != NULL) font = LoadFontDynamicData(fileData, dataSize, fontSize, atlasSize);
+        else font = RaylibGetFontDefault();
+    }
+    else
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "FONT: [%s] Dynamic fonts require TTF/OTF data -> Using default font", fileName);
+        font = RaylibGetFontDefault();
+    }
+#else
+    font = RaylibGetFontDefault();
+#endif
+
+    return font;
+}
+
+// Load dynamic font from TTF memory buffer, fileType refers to extension: i.e. '.ttf'
+// NOTE: Font data is copied, it is required for glyphs rasterization after loading
+RaylibFont RaylibLoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int atlasSize)
+{
+    RaylibFont font = { 0 };
+
+#if defined(RAYLIB_SUPPORT_FILEFORMAT_TTF)
+    char fileExtLower[16] = { 0 };
+    RaylibTextToLowerBuffer(fileExtLower, 16, fileType);
+
+    if ((fileData != NULL) && (dataSize > 0) && (RaylibTextIsEqual(fileExtLower, ".ttf") || RaylibTextIsEqual(fileExtLower, ".otf")))
+    {
+        unsigned char *fileDataCopy = (unsigned char *)RL_MALLOC(dataSize);
+        memcpy(fileDataCopy, fileData, dataSize);
+
+        font = LoadFontDynamicData(fileDataCopy, dataSize, fontSize, atlasSize);
+    }
+    else font = RaylibGetFontDefault();
+#else
+    font = RaylibGetFontDefault();
+#endif
+
+    return font;
+}
+
+// Check if a font is dynamic (glyphs rasterized on demand)
+bool RaylibIsFontDynamic(RaylibFont font)
+{
+    return ((font.glyphLookup != NULL) && (font.glyphLookup->cache != NULL));
+}
+
+// Get dynamic font glyphs cache info (usage and hit/miss/eviction counters)
+RaylibFontCacheInfo RaylibGetFontCacheInfo(RaylibFont font)
+{
+    RaylibFontCacheInfo info = { 0 };
+
+#if defined(RAYLIB_SUPPORT_FILEFORMAT_TTF)
+    if (RaylibIsFontDynamic(font))
+    {
+        FontCache *cache = font.glyphLookup->cache;
+
+        info.glyphCount = cache->slotCount;
+        info.glyphCapacity = cache->slotCapacity;
+        info.hits = cache->hits;
+        info.misses = cache->misses;
+        info.evictions = cache->evictions;
+    }
+#endif
+
+    return info;
+}
+
+// Update font glyph lookup table, required if font.glyphs codepoints are modified after loading
+// WARNING: Lookup table is replaced, font copies sharing previous table (i.e. default font) are not valid anymore
+void RaylibUpdateFontGlyphLookup(RaylibFont *font)
+{
+    if (RaylibIsFontDynamic(*font))
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "FONT: Dynamic fonts glyph lookup table is managed by glyphs cache");
+        return;
+    }
+
+    UnloadGlyphLookup(font->glyphLookup);
+    font->glyphLookup = LoadGlyphLookup(font->glyphs, font->glyphCount);
+}
+
 // Check if a font is valid (font data loaded)
 // WARNING: GPU texture not checked
 bool RaylibIsFontValid(RaylibFont font)
@@ -646,81 +849,14 @@ RaylibGlyphInfo *RaylibLoadFontData(const unsigned char *fileData, int dataSize,
 
             chars = (RaylibGlyphInfo *)RL_CALLOC(codepointCount, sizeof(RaylibGlyphInfo));
 
-            // NOTE: Using simple packaging, one char after another
+            // Glyphs are independent, they are rasterized by worker threads
+            // NOTE: Every glyph is written by a single thread, result is the same as serial loading
+            FontGlyphsJob job = { &fontInfo, codepoints, chars, fontSize, type, scaleFactor, ascent };
+            ParallelFor(codepointCount, RAYLIB_FONT_LOADING_BATCH_GLYPHS, LoadFontGlyphs, &job);
+
             for (int i = 0; i < codepointCount; i++)
             {
-                int chw = 0, chh = 0;   // Character width and height (on generation)
-                int ch = codepoints[i];  // Character value to get info for
-                chars[i].value = ch;
-
-                //  Render a unicode codepoint to a bitmap
-                //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
-                //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
-                //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
-
-                // Check if a glyph is available in the font
-                // WARNING: if (index == 0), glyph not found, it could fallback to default .notdef glyph (if defined in font)
-                int index = stbtt_FindGlyphIndex(&fontInfo, ch);
-
-                if (index > 0)
-                {
-                    switch (type)
-                    {
-                        case RAYLIB_FONT_DEFAULT:
-                        case RAYLIB_FONT_BITMAP: chars[i].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY); break;
-                        case RAYLIB_FONT_SDF: if (ch != 32) chars[i].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY); break;
-                        default: break;
-                    }
-
-                    if (chars[i].image.data != NULL)    // Glyph data has been found in the font
-                    {
-                        stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                        chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-                        if (chh > fontSize) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "FONT: Character [0x%08x] size is bigger than expected font size", ch);
-
-                        // Load characters images
-                        chars[i].image.width = chw;
-                        chars[i].image.height = chh;
-                        chars[i].image.mipmaps = 1;
-                        chars[i].image.format = RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-
-                        chars[i].offsetY += (int)((float)ascent*scaleFactor);
-                    }
-
-                    // NOTE: We create an empty image for space character,
-                    // it could be further required for atlas packing
-                    if (ch == 32)
-                    {
-                        stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                        chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-                        RaylibImage imSpace = {
-                            .data = RL_CALLOC(chars[i].advanceX*fontSize, 2),
-                            .width = chars[i].advanceX,
-                            .height = fontSize,
-                            .mipmaps = 1,
-                            .format = RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
-                        };
-
-                        chars[i].image = imSpace;
-                    }
-
-                    if (type == RAYLIB_FONT_BITMAP)
-                    {
-                        // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
-                        // NOTE: For optimum results, bitmap font should be generated at base pixel size
-                        for (int p = 0; p < chw*chh; p++)
-                        {
-                            if (((unsigned char *)chars[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
-                            else ((unsigned char *)chars[i].image.data)[p] = 255;
-                        }
-                    }
-                }
-                else
-                {
-                    // TODO: Use some fallback glyph for codepoints not found in the font
-                }
+                if (chars[i].image.height > fontSize) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "FONT: Character [0x%08x] size is bigger than expected font size", chars[i].value);
             }
         }
         else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "FONT: Failed to process TTF font data");
@@ -953,6 +1089,7 @@ void RaylibUnloadFont(RaylibFont font)
         RaylibUnloadFontData(font.glyphs, font.glyphCount);
         if (isGpuReady) RaylibUnloadTexture(font.texture);
         RL_FREE(font.recs);
+        UnloadGlyphLookup(font.glyphLookup);
 
         RAYLIB_TRACELOGD("FONT: Unloaded font data from RAM and VRAM");
     }
@@ -969,6 +1106,14 @@ bool RaylibExportFontAsCode(RaylibFont font, const char *fileName)
 
     #define MAX_FONT_DATA_SIZE      1024*1024       // 1 MB
 
+    // Dynamic fonts glyphs slots are filled in order, only cached glyphs are exported
+    int glyphCount = RaylibIsFontDynamic(font)? RaylibGetFontCacheInfo(font).glyphCount : font.glyphCount;
+    if (glyphCount <= 0)
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "FONT: [%s] Failed to export font as code, no glyphs available", fileName);
+        return false;
+    }
+
     // Get file name from path
     char fileNamePascal[256] = { 0 };
     strncpy(fileNamePascal, RaylibTextToPascal(RaylibGetFileNameWithoutExt(fileName)), 256 - 1);
@@ -1035,8 +1180,8 @@ bool RaylibExportFontAsCode(RaylibFont font, const char *fileName)
 
     // Save font recs data
     byteCount += sprintf(txtData + byteCount, "// RaylibFont characters rectangles data\n");
-    byteCount += sprintf(txtData + byteCount, "static RaylibRectangle fontRecs_%s[%i] = {\n", fileNamePascal, font.glyphCount);
-    for (int i = 0; i < font.glyphCount; i++)
+    byteCount += sprintf(txtData + byteCount, "static RaylibRectangle fontRecs_%s[%i] = {\n", fileNamePascal, glyphCount);
+    for (int i = 0; i < glyphCount; i++)
     {
         byteCount += sprintf(txtData + byteCount, "    { %1.0f, %1.0f, %1.0f , %1.0f },\n", font.recs[i].x, font.recs[i].y, font.recs[i].width, font.recs[i].height);
     }
@@ -1047,8 +1192,8 @@ bool RaylibExportFontAsCode(RaylibFont font, const char *fileName)
     // it could be generated from image and recs
     byteCount += sprintf(txtData + byteCount, "// RaylibFont glyphs info data\n");
     byteCount += sprintf(txtData + byteCount, "// NOTE: No glyphs.image data provided\n");
-    byteCount += sprintf(txtData + byteCount, "static RaylibGlyphInfo fontGlyphs_%s[%i] = {\n", fileNamePascal, font.glyphCount);
-    for (int i = 0; i < font.glyphCount; i++)
+    byteCount += sprintf(txtData + byteCount, "static RaylibGlyphInfo fontGlyphs_%s[%i] = {\n", fileNamePascal, glyphCount);
+    for (int i = 0; i < glyphCount; i++)
     {
         byteCount += sprintf(txtData + byteCount, "    { %i, %i, %i, %i, { 0 }},\n", font.glyphs[i].value, font.glyphs[i].offsetX, font.glyphs[i].offsetY, font.glyphs[i].advanceX);
     }
@@ -1059,7 +1204,7 @@ bool RaylibExportFontAsCode(RaylibFont font, const char *fileName)
     byteCount += sprintf(txtData + byteCount, "static RaylibFont LoadFont_%s(void)\n{\n", fileNamePascal);
     byteCount += sprintf(txtData + byteCount, "    RaylibFont font = { 0 };\n\n");
     byteCount += sprintf(txtData + byteCount, "    font.baseSize = %i;\n", font.baseSize);
-    byteCount += sprintf(txtData + byteCount, "    font.glyphCount = %i;\n", font.glyphCount);
+    byteCount += sprintf(txtData + byteCount, "    font.glyphCount = %i;\n", glyphCount);
     byteCount += sprintf(txtData + byteCount, "    font.glyphPadding = %i;\n\n", font.glyphPadding);
     byteCount += sprintf(txtData + byteCount, "    // Custom font loading\n");
 #if defined(SUPPORT_COMPRESSED_FONT_ATLAS)
@@ -1253,6 +1398,169 @@ void RaylibDrawTextCodepoints(RaylibFont font, const int *codepoints, int codepo
     }
 }
 
+// Load text layout, glyphs positioned once for fast measuring and drawing
+// NOTE: Layout keeps same glyphs positions and size as RaylibDrawTextEx() and RaylibMeasureTextEx(),
+// using provided line spacing instead of the global one
+RaylibTextLayout RaylibLoadTextLayout(RaylibFont font, const char *text, float fontSize, float spacing, int lineSpacing)
+{
+    RaylibTextLayout layout = { 0 };
+
+    if (font.texture.id == 0) font = RaylibGetFontDefault();  // Security check in case of not valid font
+
+    layout.font = font;
+
+    if ((text == NULL) || (text[0] == '\0') || (font.glyphs == NULL)) return layout;
+
+    int size = RaylibTextLength(text);    // Total size in bytes of the text, upper bound for glyphs count
+
+    layout.quads = (float *)RL_MALLOC(size*8*sizeof(float));
+    layout.codepoints = (int *)RL_MALLOC(size*sizeof(int));
+
+    float textOffsetY = 0.0f;       // Offset between lines (on linebreak '\n')
+    float textOffsetX = 0.0f;       // Offset X to next character to draw
+    float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+    float padding = (float)font.glyphPadding;
+
+    // Text size measurement, same as RaylibMeasureTextEx()
+    int tempByteCounter = 0;        // Used to count longer text line num chars
+    int byteCounter = 0;
+    float textWidth = 0.0f;
+    float tempTextWidth = 0.0f;     // Used to count longer text line width
+    float textHeight = fontSize;
+
+    for (int i = 0; i < size;)
+    {
+        byteCounter++;
+
+        // Get next codepoint from byte string and glyph index in font
+        int codepointByteCount = 0;
+        int codepoint = RaylibGetCodepointNext(&text[i], &codepointByteCount);
+        int index = RaylibGetGlyphIndex(font, codepoint);
+
+        if (codepoint == '\n')
+        {
+            textOffsetY += (fontSize + lineSpacing);
+            textOffsetX = 0.0f;
+
+            if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+            byteCounter = 0;
+            textWidth = 0;
+            textHeight += (fontSize + lineSpacing);
+        }
+        else
+        {
+            RaylibGlyphInfo *glyph = &font.glyphs[index];
+            RaylibRectangle rec = font.recs[index];
+
+            if ((codepoint != ' ') && (codepoint != '\t'))
+            {
+                // Glyph quad, same as RaylibDrawTextCodepoint() (considering glyphs padding)
+                float *quad = &layout.quads[layout.glyphCount*8];
+                quad[0] = textOffsetX + glyph->offsetX*scaleFactor - padding*scaleFactor;
+                quad[1] = textOffsetY + glyph->offsetY*scaleFactor - padding*scaleFactor;
+                quad[2] = (rec.width + 2.0f*padding)*scaleFactor;
+                quad[3] = (rec.height + 2.0f*padding)*scaleFactor;
+                SetTextLayoutTexcoords(quad, rec, padding, font.texture);
+
+                layout.codepoints[layout.glyphCount] = codepoint;
+                layout.glyphCount++;
+            }
+
+            if (glyph->advanceX == 0) textOffsetX += ((float)rec.width*scaleFactor + spacing);
+            else textOffsetX += ((float)glyph->advanceX*scaleFactor + spacing);
+
+            if (glyph->advanceX > 0) textWidth += glyph->advanceX;
+            else textWidth += (rec.width + glyph->offsetX);
+        }
+
+        if (tempByteCounter < byteCounter) tempByteCounter = byteCounter;
+
+        i += codepointByteCount;   // Move text bytes counter to next codepoint
+    }
+
+    if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+
+    layout.size.x = tempTextWidth*scaleFactor + (float)((tempByteCounter - 1)*spacing);
+    layout.size.y = textHeight;
+
+    return layout;
+}
+
+// Unload text layout data
+void RaylibUnloadTextLayout(RaylibTextLayout layout)
+{
+    RL_FREE(layout.quads);
+    RL_FREE(layout.codepoints);
+}
+
+// Draw text layout
+// NOTE: Glyph quads are submitted in a single batch, dynamic fonts glyphs are looked up
+// to keep them cached and update their texcoords
+void RaylibDrawTextLayout(RaylibTextLayout layout, RaylibVector2 position, RaylibColor tint)
+{
+    RaylibFont font = layout.font;
+
+    if ((layout.glyphCount == 0) || (font.texture.id == 0)) return;
+
+    if (RaylibIsFontDynamic(font))
+    {
+        RaylibFontCacheInfo cacheInfo = RaylibGetFontCacheInfo(font);
+        unsigned int evictions = cacheInfo.evictions;
+
+        for (int i = 0; i < layout.glyphCount; i++)
+        {
+            int index = RaylibGetGlyphIndex(font, layout.codepoints[i]);
+            SetTextLayoutTexcoords(&layout.quads[i*8], font.recs[index], (float)font.glyphPadding, font.texture);
+        }
+
+        // Layout glyphs do not fit in cache, they are drawn one by one as they are rasterized
+        cacheInfo = RaylibGetFontCacheInfo(font);
+
+        if (cacheInfo.evictions != evictions)
+        {
+            for (int i = 0; i < layout.glyphCount; i++)
+            {
+                float *quad = &layout.quads[i*8];
+                int index = RaylibGetGlyphIndex(font, layout.codepoints[i]);
+
+                RaylibRectangle srcRec = { font.recs[index].x - (float)font.glyphPadding, font.recs[index].y - (float)font.glyphPadding,
+                                     font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
+                RaylibRectangle dstRec = { position.x + quad[0], position.y + quad[1], quad[2], quad[3] };
+
+                RaylibDrawTexturePro(font.texture, srcRec, dstRec, (RaylibVector2){ 0, 0 }, 0.0f, tint);
+            }
+
+            return;
+        }
+    }
+
+    rlSetTexture(font.texture.id);
+    rlBegin(RL_QUADS);
+
+        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+        rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+        for (int i = 0; i < layout.glyphCount; i++)
+        {
+            const float *quad = &layout.quads[i*8];
+            float x = position.x + quad[0];
+            float y = position.y + quad[1];
+
+            // Same vertex order as RaylibDrawTexturePro(): top-left, bottom-left, bottom-right, top-right
+            rlTexCoord2f(quad[4], quad[5]);
+            rlVertex2f(x, y);
+            rlTexCoord2f(quad[4], quad[7]);
+            rlVertex2f(x, y + quad[3]);
+            rlTexCoord2f(quad[6], quad[7]);
+            rlVertex2f(x + quad[2], y + quad[3]);
+            rlTexCoord2f(quad[6], quad[5]);
+            rlVertex2f(x + quad[2], y);
+        }
+
+    rlEnd();
+    rlSetTexture(0);
+}
+
 // Set vertical line spacing when drawing with line-breaks
 void RaylibSetTextLineSpacing(int spacing)
 {
@@ -1340,6 +1648,56 @@ int RaylibGetGlyphIndex(RaylibFont font, int codepoint)
 {
     int index = 0;
 
+    // Fonts loaded by raylib provide a lookup table, avoiding the glyphs linear search
+    if (font.glyphLookup != NULL)
+    {
+        RaylibGlyphLookup *lookup = font.glyphLookup;
+        index = -1;
+
+        if ((codepoint >= 0) && (codepoint < RAYLIB_GLYPH_LOOKUP_DENSE_SIZE)) index = lookup->dense[codepoint];
+        else if (lookup->hashCapacity > 0)
+        {
+            unsigned int mask = lookup->hashCapacity - 1;
+            unsigned int slot = ((unsigned int)codepoint*2654435761u) & mask;
+
+            while (lookup->hashCodepoints[slot] != -1)
+            {
+                if (lookup->hashCodepoints[slot] == codepoint) { index = lookup->hashIndices[slot]; break; }
+                slot = (slot + 1) & mask;
+            }
+        }
+
+#if defined(RAYLIB_SUPPORT_FILEFORMAT_TTF)
+        // Dynamic fonts rasterize glyphs not cached, cached glyphs move to front of recently used list
+        if (lookup->cache != NULL)
+        {
+            FontCache *cache = lookup->cache;
+
+            if (index == -1) return LoadFontCacheGlyph(font, codepoint);
+            if (index == FONT_CACHE_GLYPH_MISSING) return RaylibGetGlyphIndex(font, 63);
+
+            cache->hits++;
+
+            if (index != cache->lruHead)
+            {
+                cache->lruNext[cache->lruPrev[index]] = cache->lruNext[index];
+                if (cache->lruNext[index] != -1) cache->lruPrev[cache->lruNext[index]] = cache->lruPrev[index];
+                else cache->lruTail = cache->lruPrev[index];
+
+                cache->lruPrev[index] = -1;
+                cache->lruNext[index] = cache->lruHead;
+                cache->lruPrev[cache->lruHead] = index;
+                cache->lruHead = index;
+            }
+
+            return index;
+        }
+#endif
+        if (index == -1) index = lookup->fallbackIndex;
+
+        return index;
+    }
+
 #define SUPPORT_UNORDERED_CHARSET
 #if defined(SUPPORT_UNORDERED_CHARSET)
     int fallbackIndex = 0;      // Get index of fallback glyph '?'
@@ -1417,27 +1775,36 @@ const char *RaylibTextFormat(const char *text, ...)
     static int index = 0;
 
     char *currentBuffer = buffers[index];
-    memset(currentBuffer, 0, RAYLIB_MAX_TEXT_BUFFER_LENGTH);   // Clear buffer before using
 
+    // NOTE: Buffer is not cleared before using, vsnprintf() always writes the string end
     va_list args;
     va_start(args, text);
-    int requiredByteCount = vsnprintf(currentBuffer, RAYLIB_MAX_TEXT_BUFFER_LENGTH, text, args);
+    FormatTextBuffer(currentBuffer, RAYLIB_MAX_TEXT_BUFFER_LENGTH, text, args);
     va_end(args);
 
-    // If requiredByteCount is larger than the RAYLIB_MAX_TEXT_BUFFER_LENGTH, then overflow occured
-    if (requiredByteCount >= RAYLIB_MAX_TEXT_BUFFER_LENGTH)
-    {
-        // Inserting "..." at the end of the string to mark as truncated
-        char *truncBuffer = buffers[index] + RAYLIB_MAX_TEXT_BUFFER_LENGTH - 4; // Adding 4 bytes = "...\0"
-        sprintf(truncBuffer, "...");
-    }
-
     index += 1;     // Move to next buffer for next function call
     if (index >= MAX_TEXTFORMAT_BUFFERS) index = 0;
 
     return currentBuffer;
 }
 
+// Formatting of text with variables to 'embed' into provided buffer, returns bytes written
+// NOTE: Thread-safe alternative to RaylibTextFormat(), text is truncated with "..." if it does not fit
+int RaylibTextFormatBuffer(char *buffer, int bufferSize, const char *text, ...)
+{
+    int bytes = 0;
+
+    if ((buffer != NULL) && (bufferSize > 0))
+    {
+        va_list args;
+        va_start(args, text);
+        bytes = FormatTextBuffer(buffer, bufferSize, text, args);
+        va_end(args);
+    }
+
+    return bytes;
+}
+
 // Get integer value from text
 // NOTE: This function replaces atoi() [stdlib.h]
 int RaylibTextToInteger(const char *text)
@@ -1529,7 +1896,16 @@ bool RaylibTextIsEqual(const char *text1, const char *text2)
 const char *RaylibTextSubtext(const char *text, int position, int length)
 {
     static char buffer[RAYLIB_MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, RAYLIB_MAX_TEXT_BUFFER_LENGTH);
+
+    RaylibTextSubtextBuffer(buffer, RAYLIB_MAX_TEXT_BUFFER_LENGTH, text, position, length);
+
+    return buffer;
+}
+
+// Get a piece of a text string into provided buffer, returns bytes copied
+int RaylibTextSubtextBuffer(char *buffer, int bufferSize, const char *text, int position, int length)
+{
+    if ((buffer == NULL) || (bufferSize <= 0)) return 0;
 
     int textLength = RaylibTextLength(text);
 
@@ -1539,7 +1915,8 @@ const char *RaylibTextSubtext(const char *text, int position, int length)
         length = 0;
     }
 
-    if (length >= textLength) length = textLength;
+    if (length > (textLength - position)) length = textLength - position;
+    if (length > (bufferSize - 1)) length = bufferSize - 1;
 
     // NOTE: Alternative: memcpy(buffer, text + position, length)
 
@@ -1551,7 +1928,7 @@ const char *RaylibTextSubtext(const char *text, int position, int length)
 
     *(buffer + length) = '\0';
 
-    return buffer;
+    return length;
 }
 
 // Replace text string
@@ -1623,11 +2000,21 @@ char *RaylibTextInsert(const char *text, const char *insert, int position)
 }
 
 // Join text strings with delimiter
-// REQUIRES: memset(), memcpy()
 const char *RaylibTextJoin(const char **textList, int count, const char *delimiter)
 {
     static char buffer[RAYLIB_MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, RAYLIB_MAX_TEXT_BUFFER_LENGTH);
+
+    RaylibTextJoinBuffer(buffer, RAYLIB_MAX_TEXT_BUFFER_LENGTH, textList, count, delimiter);
+
+    return buffer;
+}
+
+// Join text strings with delimiter into provided buffer, returns bytes written
+// REQUIRES: memcpy()
+int RaylibTextJoinBuffer(char *buffer, int bufferSize, const char **textList, int count, const char *delimiter)
+{
+    if ((buffer == NULL) || (bufferSize <= 0)) return 0;
+
     char *textPtr = buffer;
 
     int totalLength = 0;
@@ -1637,14 +2024,14 @@ const char *RaylibTextJoin(const char **textList, int count, const char *delimit
     {
         int textLength = RaylibTextLength(textList[i]);
 
-        // Make sure joined text could fit inside RAYLIB_MAX_TEXT_BUFFER_LENGTH
-        if ((totalLength + textLength) < RAYLIB_MAX_TEXT_BUFFER_LENGTH)
+        // Make sure joined text could fit inside buffer
+        if ((totalLength + textLength) < bufferSize)
         {
             memcpy(textPtr, textList[i], textLength);
             totalLength += textLength;
             textPtr += textLength;
 
-            if ((delimiterLen > 0) && (i < (count - 1)))
+            if ((delimiterLen > 0) && (i < (count - 1)) && ((totalLength + delimiterLen) < bufferSize))
             {
                 memcpy(textPtr, delimiter, delimiterLen);
                 totalLength += delimiterLen;
@@ -1653,11 +2040,12 @@ const char *RaylibTextJoin(const char **textList, int count, const char *delimit
         }
     }
 
-    return buffer;
+    *textPtr = '\0';
+
+    return totalLength;
 }
 
 // Split string into multiple strings
-// REQUIRES: memset()
 const char **RaylibTextSplit(const char *text, char delimiter, int *count)
 {
     // NOTE: Current implementation returns a copy of the provided string with '\0' (string end delimiter)
@@ -1668,8 +2056,20 @@ const char **RaylibTextSplit(const char *text, char delimiter, int *count)
 
     static const char *result[RAYLIB_MAX_TEXTSPLIT_COUNT] = { NULL };
     static char buffer[RAYLIB_MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, RAYLIB_MAX_TEXT_BUFFER_LENGTH);
 
+    *count = RaylibTextSplitBuffer(buffer, RAYLIB_MAX_TEXT_BUFFER_LENGTH, result, RAYLIB_MAX_TEXTSPLIT_COUNT, text, delimiter);
+
+    return result;
+}
+
+// Split string into multiple strings using provided buffers, returns substrings count
+// NOTE: Text is copied into buffer with '\0' inserted on every delimiter, substrings
+// pointers (into buffer) are returned in result, up to maxCount substrings
+int RaylibTextSplitBuffer(char *buffer, int bufferSize, const char **result, int maxCount, const char *text, char delimiter)
+{
+    if ((buffer == NULL) || (bufferSize <= 0) || (result == NULL) || (maxCount <= 0)) return 0;
+
+    buffer[0] = '\0';
     result[0] = buffer;
     int counter = 0;
 
@@ -1678,7 +2078,8 @@ const char **RaylibTextSplit(const char *text, char delimiter, int *count)
         counter = 1;
 
         // Count how many substrings we have on text and point to every one
-        for (int i = 0; i < RAYLIB_MAX_TEXT_BUFFER_LENGTH; i++)
+        int i = 0;
+        for (; i < (bufferSize - 1); i++)
         {
             buffer[i] = text[i];
             if (buffer[i] == '\0') break;
@@ -1688,13 +2089,18 @@ const char **RaylibTextSplit(const char *text, char delimiter, int *count)
                 result[counter] = buffer + i + 1;
                 counter++;
 
-                if (counter == RAYLIB_MAX_TEXTSPLIT_COUNT) break;
+                if (counter == maxCount)
+                {
+                    buffer[i + 1] = '\0';  // Last substring is left empty, same as static version
+                    break;
+                }
             }
         }
+
+        if (i == (bufferSize - 1)) buffer[i] = '\0';   // Text truncated, make sure last substring is valid
     }
 
-    *count = counter;
-    return result;
+    return counter;
 }
 
 // Append text at specific position and move cursor
@@ -1725,37 +2131,65 @@ int RaylibTextFindIndex(const char *text, const char *find)
 const char *RaylibTextToUpper(const char *text)
 {
     static char buffer[RAYLIB_MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, RAYLIB_MAX_TEXT_BUFFER_LENGTH);
 
-    if (text != NULL)
-    {
-        for (int i = 0; (i < RAYLIB_MAX_TEXT_BUFFER_LENGTH - 1) && (text[i] != '\0'); i++)
-        {
-            if ((text[i] >= 'a') && (text[i] <= 'z')) buffer[i] = text[i] - 32;
-            else buffer[i] = text[i];
-        }
-    }
+    RaylibTextToUpperBuffer(buffer, RAYLIB_MAX_TEXT_BUFFER_LENGTH, text);
 
     return buffer;
 }
 
+// Get upper case version of provided string into provided buffer, returns bytes written
+// WARNING: Limited functionality, only basic characters set
+int RaylibTextToUpperBuffer(char *buffer, int bufferSize, const char *text)
+{
+    if ((buffer == NULL) || (bufferSize <= 0)) return 0;
+
+    int i = 0;
+
+    if (text != NULL)
+    {
+        for (; (i < bufferSize - 1) && (text[i] != '\0'); i++)
+        {
+            if ((text[i] >= 'a') && (text[i] <= 'z')) buffer[i] = text[i] - 32;
+            else buffer[i] = text[i];
+        }
+    }
+
+    buffer[i] = '\0';
+
+    return i;
+}
+
 // Get lower case version of provided string
 // WARNING: Limited functionality, only basic characters set
 const char *RaylibTextToLower(const char *text)
 {
     static char buffer[RAYLIB_MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, RAYLIB_MAX_TEXT_BUFFER_LENGTH);
+
+    RaylibTextToLowerBuffer(buffer, RAYLIB_MAX_TEXT_BUFFER_LENGTH, text);
+
+    return buffer;
+}
+
+// Get lower case version of provided string into provided buffer, returns bytes written
+// WARNING: Limited functionality, only basic characters set
+int RaylibTextToLowerBuffer(char *buffer, int bufferSize, const char *text)
+{
+    if ((buffer == NULL) || (bufferSize <= 0)) return 0;
+
+    int i = 0;
 
     if (text != NULL)
     {
-        for (int i = 0; (i < RAYLIB_MAX_TEXT_BUFFER_LENGTH - 1) && (text[i] != '\0'); i++)
+        for (; (i < bufferSize - 1) && (text[i] != '\0'); i++)
         {
             if ((text[i] >= 'A') && (text[i] <= 'Z')) buffer[i] = text[i] + 32;
             else buffer[i] = text[i];
         }
     }
 
-    return buffer;
+    buffer[i] = '\0';
+
+    return i;
 }
 
 // Get Pascal case notation version of provided string
@@ -1763,26 +2197,31 @@ const char *RaylibTextToLower(const char *text)
 const char *RaylibTextToPascal(const char *text)
 {
     static char buffer[RAYLIB_MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, RAYLIB_MAX_TEXT_BUFFER_LENGTH);
+    int i = 0;
 
-    if (text != NULL)
+    if ((text != NULL) && (text[0] != '\0'))
     {
         // Upper case first character
         if ((text[0] >= 'a') && (text[0] <= 'z')) buffer[0] = text[0] - 32;
         else buffer[0] = text[0];
 
         // Check for next separator to upper case another character
-        for (int i = 1, j = 1; (i < RAYLIB_MAX_TEXT_BUFFER_LENGTH - 1) && (text[j] != '\0'); i++, j++)
+        i = 1;
+        for (int j = 1; (i < RAYLIB_MAX_TEXT_BUFFER_LENGTH - 1) && (text[j] != '\0'); i++, j++)
         {
             if (text[j] != '_') buffer[i] = text[j];
             else
             {
                 j++;
-                if ((text[j] >= 'a') && (text[j] <= 'z')) buffer[i] = text[j] - 32;
+                if (text[j] == '\0') break;
+                else if ((text[j] >= 'a') && (text[j] <= 'z')) buffer[i] = text[j] - 32;
+                else buffer[i] = text[j];
             }
         }
     }
 
+    buffer[i] = '\0';      // NOTE: Buffer is not cleared before using, just ended
+
     return buffer;
 }
 
@@ -1791,12 +2230,12 @@ const char *RaylibTextToPascal(const char *text)
 const char *RaylibTextToSnake(const char *text)
 {
     static char buffer[RAYLIB_MAX_TEXT_BUFFER_LENGTH] = {0};
-    memset(buffer, 0, RAYLIB_MAX_TEXT_BUFFER_LENGTH);
+    int i = 0;
 
     if (text != NULL)
     {
         // Check for next separator to upper case another character
-        for (int i = 0, j = 0; (i < RAYLIB_MAX_TEXT_BUFFER_LENGTH - 1) && (text[j] != '\0'); i++, j++)
+        for (int j = 0; (i < RAYLIB_MAX_TEXT_BUFFER_LENGTH - 2) && (text[j] != '\0'); i++, j++)
         {
             if ((text[j] >= 'A') && (text[j] <= 'Z'))
             {
@@ -1811,6 +2250,8 @@ const char *RaylibTextToSnake(const char *text)
         }
     }
 
+    buffer[i] = '\0';      // NOTE: Buffer is not cleared before using, just ended
+
     return buffer;
 }
 
@@ -1819,26 +2260,31 @@ const char *RaylibTextToSnake(const char *text)
 const char *RaylibTextToCamel(const char *text)
 {
     static char buffer[RAYLIB_MAX_TEXT_BUFFER_LENGTH] = {0};
-    memset(buffer, 0, RAYLIB_MAX_TEXT_BUFFER_LENGTH);
+    int i = 0;
 
-    if (text != NULL)
+    if ((text != NULL) && (text[0] != '\0'))
     {
         // Lower case first character
         if ((text[0] >= 'A') && (text[0] <= 'Z')) buffer[0] = text[0] + 32;
         else buffer[0] = text[0];
 
         // Check for next separator to upper case another character
-        for (int i = 1, j = 1; (i < RAYLIB_MAX_TEXT_BUFFER_LENGTH - 1) && (text[j] != '\0'); i++, j++)
+        i = 1;
+        for (int j = 1; (i < RAYLIB_MAX_TEXT_BUFFER_LENGTH - 1) && (text[j] != '\0'); i++, j++)
         {
             if (text[j] != '_') buffer[i] = text[j];
             else
             {
                 j++;
-                if ((text[j] >= 'a') && (text[j] <= 'z')) buffer[i] = text[j] - 32;
+                if (text[j] == '\0') break;
+                else if ((text[j] >= 'a') && (text[j] <= 'z')) buffer[i] = text[j] - 32;
+                else buffer[i] = text[j];
             }
         }
     }
 
+    buffer[i] = '\0';      // NOTE: Buffer is not cleared before using, just ended
+
     return buffer;
 }
 
@@ -2135,6 +2581,607 @@ int RaylibGetCodepointPrevious(const char *text, int *codepointSize)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Load codepoint to glyph index lookup table
+// NOTE: Keeps RaylibGetGlyphIndex() behaviour on linear search: first glyph with a codepoint
+// is returned, last '?' glyph is used as fallback (first glyph if font has no '?')
+static RaylibGlyphLookup *LoadGlyphLookup(const RaylibGlyphInfo *glyphs, int glyphCount)
+{
+    if ((glyphs == NULL) || (glyphCount <= 0)) return NULL;
+
+    // Count codepoints out of dense range to size hash table (load factor <= 0.5)
+    int sparseCount = 0;
+    for (int i = 0; i < glyphCount; i++) if ((glyphs[i].value < 0) || (glyphs[i].value >= RAYLIB_GLYPH_LOOKUP_DENSE_SIZE)) sparseCount++;
+
+    unsigned int hashCapacity = 0;
+    if (sparseCount > 0)
+    {
+        hashCapacity = 16;
+        while (hashCapacity < (unsigned int)sparseCount*2) hashCapacity *= 2;
+    }
+
+    // Lookup table and hash arrays are allocated in a single block
+    RaylibGlyphLookup *lookup = (RaylibGlyphLookup *)RL_MALLOC(sizeof(RaylibGlyphLookup) + hashCapacity*2*sizeof(int));
+
+    // NOTE: Font is still usable without lookup table, RaylibGetGlyphIndex() falls back to linear search
+    if (lookup == NULL)
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "FONT: Failed to allocate glyph lookup table");
+        return NULL;
+    }
+
+    lookup->fallbackIndex = 0;
+    lookup->cache = NULL;
+    lookup->hashCapacity = hashCapacity;
+    lookup->hashCodepoints = (hashCapacity > 0)? (int *)(lookup + 1) : NULL;
+    lookup->hashIndices = (hashCapacity > 0)? lookup->hashCodepoints + hashCapacity : NULL;
+
+    for (int i = 0; i < RAYLIB_GLYPH_LOOKUP_DENSE_SIZE; i++) lookup->dense[i] = -1;
+    for (unsigned int i = 0; i < hashCapacity; i++) lookup->hashCodepoints[i] = -1;
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        int codepoint = glyphs[i].value;
+
+        if (codepoint == 63) lookup->fallbackIndex = i;
+
+        if ((codepoint >= 0) && (codepoint < RAYLIB_GLYPH_LOOKUP_DENSE_SIZE))
+        {
+            if (lookup->dense[codepoint] == -1) lookup->dense[codepoint] = i;
+        }
+        else if (codepoint != -1)
+        {
+            unsigned int mask = hashCapacity - 1;
+            unsigned int slot = ((unsigned int)codepoint*2654435761u) & mask;
+
+            while ((lookup->hashCodepoints[slot] != -1) && (lookup->hashCodepoints[slot] != codepoint)) slot = (slot + 1) & mask;
+
+            if (lookup->hashCodepoints[slot] == -1)
+            {
+                lookup->hashCodepoints[slot] = codepoint;
+                lookup->hashIndices[slot] = i;
+            }
+        }
+    }
+
+    return lookup;
+}
+
+// Unload codepoint to glyph index lookup table
+static void UnloadGlyphLookup(RaylibGlyphLookup *lookup)
+{
+#if defined(RAYLIB_SUPPORT_FILEFORMAT_TTF)
+    if ((lookup != NULL) && (lookup->cache != NULL))
+    {
+        FontCache *cache = lookup->cache;
+
+        RL_FREE(cache->fileData);
+        RL_FREE(cache->cells);
+        RL_FREE(cache->lruPrev);
+        RL_FREE(cache->lruNext);
+        RL_FREE(cache->shelves);
+        RL_FREE(cache);
+    }
+#endif
+
+    RL_FREE(lookup);
+}
+
+// Set text layout glyph quad texcoords from glyph atlas rectangle
+// NOTE: Same texcoords as RaylibDrawTexturePro() for RaylibDrawTextCodepoint() source rectangle
+static void SetTextLayoutTexcoords(float *quad, RaylibRectangle rec, float padding, Texture2D texture)
+{
+    RaylibRectangle source = { rec.x - padding, rec.y - padding, rec.width + 2.0f*padding, rec.height + 2.0f*padding };
+    float width = (float)texture.width;
+    float height = (float)texture.height;
+
+    quad[4] = source.x/width;
+    quad[5] = source.y/height;
+    quad[6] = (source.x + source.width)/width;
+    quad[7] = (source.y + source.height)/height;
+}
+
+// Format text into buffer, returns bytes written
+// NOTE: If text does not fit, "..." is inserted at the end of the buffer to mark it as truncated
+static int FormatTextBuffer(char *buffer, int bufferSize, const char *text, va_list args)
+{
+    int requiredByteCount = vsnprintf(buffer, bufferSize, text, args);
+    int bytes = requiredByteCount;
+
+    if (requiredByteCount < 0)
+    {
+        buffer[0] = '\0';      // Encoding error
+        bytes = 0;
+    }
+    else if (requiredByteCount >= bufferSize)
+    {
+        bytes = bufferSize - 1;
+
+        // Inserting "..." at the end of the string to mark as truncated
+        if (bufferSize >= 4) memcpy(buffer + bufferSize - 4, "...", 4);   // Adding 4 bytes = "...\0"
+    }
+
+    return bytes;
+}
+
+#if defined(RAYLIB_SUPPORT_FILEFORMAT_TTF)
+// Get glyphs rasterization scratch memory
+// NOTE: Memory is released on next ResetFontScratch(), stb_truetype free calls are ignored
+static void *LoadFontScratchMemory(FontScratch *scratch, size_t size)
+{
+    void *ptr = NULL;
+
+    size = (size + 15) & ~(size_t)15;     // Keep 16 bytes alignment
+    scratch->peak += size;
+
+    if ((scratch->used + size) <= scratch->capacity)
+    {
+        ptr = scratch->buffer + scratch->used;
+        scratch->used += size;
+    }
+    else
+    {
+        // Overflow allocation, linked to the list for release on reset
+        void **block = (void **)RL_MALLOC(16 + size);
+
+        if (block != NULL)
+        {
+            block[0] = scratch->overflow;
+            scratch->overflow = block;
+            ptr = (unsigned char *)block + 16;
+        }
+    }
+
+    return ptr;
+}
+
+// Reset glyphs rasterization scratch memory, growing buffer if required
+static void ResetFontScratch(FontScratch *scratch)
+{
+    while (scratch->overflow != NULL)
+    {
+        void **block = (void **)scratch->overflow;
+        scratch->overflow = block[0];
+        RL_FREE(block);
+    }
+
+    if (scratch->peak > scratch->capacity)
+    {
+        RL_FREE(scratch->buffer);
+        scratch->capacity = scratch->peak + scratch->peak/2;
+        scratch->buffer = (unsigned char *)RL_MALLOC(scratch->capacity);
+        if (scratch->buffer == NULL) scratch->capacity = 0;
+    }
+
+    scratch->used = 0;
+    scratch->peak = 0;
+}
+
+// Rasterize a range of glyphs (FontGlyphsJob)
+// NOTE: Every range uses its own font info copy and scratch memory, glyphs images are copied out of scratch memory
+static void LoadFontGlyphs(void *userData, int start, int end)
+{
+    const FontGlyphsJob *job = (const FontGlyphsJob *)userData;
+    RaylibGlyphInfo *chars = job->glyphs;
+    float scaleFactor = job->scaleFactor;
+    int fontSize = job->fontSize;
+
+    FontScratch scratch = { 0 };
+    stbtt_fontinfo fontInfo = *job->fontInfo;
+    fontInfo.userdata = &scratch;
+
+    for (int i = start; i < end; i++)
+    {
+        int chw = 0, chh = 0;   // Character width and height (on generation)
+        int ch = job->codepoints[i];  // Character value to get info for
+        chars[i].value = ch;
+
+        // Check if a glyph is available in the font
+        // WARNING: if (index == 0), glyph not found, it could fallback to default .notdef glyph (if defined in font)
+        int index = stbtt_FindGlyphIndex(&fontInfo, ch);
+
+        if (index > 0)
+        {
+            unsigned char *bitmap = NULL;
+
+            switch (job->type)
+            {
+                case RAYLIB_FONT_DEFAULT:
+                case RAYLIB_FONT_BITMAP: bitmap = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY); break;
+                case RAYLIB_FONT_SDF: if (ch != 32) bitmap = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY); break;
+                default: break;
+            }
+
+            if ((bitmap != NULL) && (ch != 32))    // Glyph data has been found in the font
+            {
+                stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
+                chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
+
+                // Load characters images
+                chars[i].image.data = RL_MALLOC(chw*chh);
+                memcpy(chars[i].image.data, bitmap, chw*chh);
+                chars[i].image.width = chw;
+                chars[i].image.height = chh;
+                chars[i].image.mipmaps = 1;
+                chars[i].image.format = RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+
+                chars[i].offsetY += (int)((float)job->ascent*scaleFactor);
+
+                if (job->type == RAYLIB_FONT_BITMAP)
+                {
+                    // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
+                    // NOTE: For optimum results, bitmap font should be generated at base pixel size
+                    for (int p = 0; p < chw*chh; p++)
+                    {
+                        if (((unsigned char *)chars[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
+                        else ((unsigned char *)chars[i].image.data)[p] = 255;
+                    }
+                }
+            }
+
+            // NOTE: We create an empty image for space character,
+            // it could be further required for atlas packing
+            if (ch == 32)
+            {
+                if (bitmap != NULL) chars[i].offsetY += (int)((float)job->ascent*scaleFactor);
+
+                stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
+                chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
+
+                RaylibImage imSpace = {
+                    .data = RL_CALLOC(chars[i].advanceX*fontSize, 2),
+                    .width = chars[i].advanceX,
+                    .height = fontSize,
+                    .mipmaps = 1,
+                    .format = RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+                };
+
+                chars[i].image = imSpace;
+            }
+        }
+        else
+        {
+            // TODO: Use some fallback glyph for codepoints not found in the font
+        }
+
+        ResetFontScratch(&scratch);
+    }
+
+    RL_FREE(scratch.buffer);
+}
+
+// Load dynamic font taking ownership of TTF file data
+static RaylibFont LoadFontDynamicData(unsigned char *fileData, int dataSize, int fontSize, int atlasSize)
+{
+    RaylibFont font = { 0 };
+    stbtt_fontinfo fontInfo = { 0 };
+
+    if ((fontSize <= 0) || !stbtt_InitFont(&fontInfo, fileData, 0))
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "FONT: Failed to process TTF font data -> Using default font");
+        RL_FREE(fileData);
+
+        return RaylibGetFontDefault();
+    }
+
+    if (atlasSize <= 0) atlasSize = RAYLIB_FONT_DYNAMIC_ATLAS_SIZE;
+    int padding = FONT_TTF_DEFAULT_CHARS_PADDING;
+
+    // Glyphs slots are sized for half-width glyphs filling the atlas, cache evicts glyphs when slots or atlas are full
+    int slotCapacity = (atlasSize/(fontSize/2 + 2*padding + 1))*(atlasSize/(fontSize + 2*padding + 1));
+    if (slotCapacity < 1) slotCapacity = 1;
+
+    // Hash table holds up to slotCapacity glyphs and slotCapacity missing codepoints (load factor <= 0.5)
+    unsigned int hashCapacity = 16;
+    while (hashCapacity < (unsigned int)slotCapacity*4) hashCapacity *= 2;
+
+    font.baseSize = fontSize;
+    font.glyphCount = slotCapacity;
+    font.glyphPadding = padding;
+    font.glyphs = (RaylibGlyphInfo *)RL_CALLOC(slotCapacity, sizeof(RaylibGlyphInfo));
+    font.recs = (RaylibRectangle *)RL_CALLOC(slotCapacity, sizeof(RaylibRectangle));
+
+    // Lookup table and hash arrays are allocated in a single block, lookup maps codepoints to cache slots
+    RaylibGlyphLookup *lookup = (RaylibGlyphLookup *)RL_MALLOC(sizeof(RaylibGlyphLookup) + hashCapacity*2*sizeof(int));
+    lookup->fallbackIndex = 0;
+    lookup->hashCapacity = hashCapacity;
+    lookup->hashCodepoints = (int *)(lookup + 1);
+    lookup->hashIndices = lookup->hashCodepoints + hashCapacity;
+
+    for (int i = 0; i < RAYLIB_GLYPH_LOOKUP_DENSE_SIZE; i++) lookup->dense[i] = -1;
+    for (unsigned int i = 0; i < hashCapacity; i++) lookup->hashCodepoints[i] = -1;
+
+    FontCache *cache = (FontCache *)RL_CALLOC(1, sizeof(FontCache));
+    cache->fileData = fileData;
+    cache->dataSize = dataSize;
+    cache->fontInfo = fontInfo;
+    cache->atlasSize = atlasSize;
+    cache->slotCapacity = slotCapacity;
+    cache->cells = (RaylibRectangle *)RL_CALLOC(slotCapacity, sizeof(RaylibRectangle));
+    cache->lruPrev = (int *)RL_MALLOC(slotCapacity*sizeof(int));
+    cache->lruNext = (int *)RL_MALLOC(slotCapacity*sizeof(int));
+    cache->lruHead = -1;
+    cache->lruTail = -1;
+    cache->shelves = (FontCacheShelf *)RL_CALLOC(atlasSize, sizeof(FontCacheShelf));
+
+    lookup->cache = cache;
+    font.glyphLookup = lookup;
+
+    if (isGpuReady)
+    {
+        // Atlas starts empty, using same GRAY_ALPHA format as atlas generated on static fonts loading
+        RaylibImage atlas = { 0 };
+        atlas.data = RL_MALLOC(atlasSize*atlasSize*2);
+        atlas.width = atlasSize;
+        atlas.height = atlasSize;
+        atlas.mipmaps = 1;
+        atlas.format = RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+
+        for (int i = 0; i < atlasSize*atlasSize; i++)
+        {
+            ((unsigned char *)atlas.data)[i*2] = 255;
+            ((unsigned char *)atlas.data)[i*2 + 1] = 0;
+        }
+
+        font.texture = RaylibLoadTextureFromImage(atlas);
+        RaylibUnloadImage(atlas);
+    }
+
+    RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "FONT: Dynamic font loaded successfully (%i pixel size | %ix%i atlas | %i glyphs cached max)", fontSize, atlasSize, atlasSize, slotCapacity);
+
+    return font;
+}
+
+// Rasterize glyph into dynamic font cache, returns glyph index
+// NOTE: Codepoints not available in font fallback to '?' glyph
+static int LoadFontCacheGlyph(RaylibFont font, int codepoint)
+{
+    FontCache *cache = font.glyphLookup->cache;
+    int padding = font.glyphPadding;
+
+    if ((codepoint != 63) && ((codepoint < 0) || (stbtt_FindGlyphIndex(&cache->fontInfo, codepoint) == 0))) return SetFontCacheMissing(font, codepoint);
+
+    RaylibGlyphInfo *glyph = RaylibLoadFontData(cache->fileData, cache->dataSize, font.baseSize, &codepoint, 1, RAYLIB_FONT_DEFAULT);
+    if (glyph == NULL) return 0;
+
+    cache->misses++;
+
+    int width = glyph->image.width;
+    int height = glyph->image.height;
+    int cellWidth = width + 2*padding;
+    int cellHeight = height + 2*padding;
+    if (cellWidth < 1) cellWidth = 1;
+    if (cellHeight < 1) cellHeight = 1;
+
+    if ((cellWidth > cache->atlasSize) || (cellHeight > cache->atlasSize))
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "FONT: Character [0x%08x] does not fit dynamic font atlas", codepoint);
+        RaylibUnloadFontData(glyph, 1);
+
+        return (codepoint != 63)? SetFontCacheMissing(font, codepoint) : 0;
+    }
+
+    // Get a slot and an atlas cell for the glyph, in order of preference:
+    // new slot with new cell, least recently used glyph with a cell big enough, new cell for least recently used slot
+    int index = -1;
+    RaylibRectangle cell = { 0 };
+
+    if ((cache->slotCount < cache->slotCapacity) && PackFontCacheCell(cache, cellWidth, cellHeight, &cell))
+    {
+        index = cache->slotCount;
+        cache->slotCount++;
+    }
+    else
+    {
+        for (int i = cache->lruTail; i != -1; i = cache->lruPrev[i])
+        {
+            if ((cache->cells[i].width >= cellWidth) && (cache->cells[i].height >= cellHeight))
+            {
+                index = i;
+                break;
+            }
+        }
+
+        if (index != -1)
+        {
+            EvictFontCacheGlyph(font, index);
+            cell = cache->cells[index];
+        }
+        else if ((cache->slotCount == cache->slotCapacity) && (cache->lruTail != -1))
+        {
+            index = cache->lruTail;
+            EvictFontCacheGlyph(font, index);
+
+            if (!PackFontCacheCell(cache, cellWidth, cellHeight, &cell)) index = -1;
+        }
+
+        // Atlas too fragmented, start over with an empty atlas
+        if (index == -1)
+        {
+            ResetFontCache(font);
+            PackFontCacheCell(cache, cellWidth, cellHeight, &cell);
+
+            index = cache->slotCount;
+            cache->slotCount++;
+        }
+    }
+
+    // Glyph image uses GRAY_ALPHA format as static fonts, required by RaylibImageDrawText()
+    unsigned char *pixels = (unsigned char *)RL_MALLOC(width*height*2);
+
+    for (int i = 0; i < width*height; i++)
+    {
+        pixels[i*2] = 255;
+        pixels[i*2 + 1] = ((unsigned char *)glyph->image.data)[i];
+    }
+
+    RaylibUnloadImage(glyph->image);
+    glyph->image.data = pixels;
+    glyph->image.format = RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+
+    font.glyphs[index] = *glyph;
+    font.recs[index] = (RaylibRectangle){ cell.x + padding, cell.y + padding, (float)width, (float)height };
+    cache->cells[index] = cell;
+    RL_FREE(glyph);
+
+    if (isGpuReady)
+    {
+        // Whole cell is updated, clearing padding and previous glyph pixels
+        int cellPixelsWidth = (int)cell.width;
+        int cellPixelsHeight = (int)cell.height;
+        unsigned char *cellPixels = (unsigned char *)RL_MALLOC(cellPixelsWidth*cellPixelsHeight*2);
+
+        for (int i = 0; i < cellPixelsWidth*cellPixelsHeight; i++)
+        {
+            cellPixels[i*2] = 255;
+            cellPixels[i*2 + 1] = 0;
+        }
+
+        for (int y = 0; y < height; y++) memcpy(cellPixels + ((y + padding)*cellPixelsWidth + padding)*2, pixels + y*width*2, width*2);
+
+        RaylibUpdateTextureRec(font.texture, cell, cellPixels);
+        RL_FREE(cellPixels);
+    }
+
+    // Register glyph as most recently used
+    cache->lruPrev[index] = -1;
+    cache->lruNext[index] = cache->lruHead;
+    if (cache->lruHead != -1) cache->lruPrev[cache->lruHead] = index;
+    else cache->lruTail = index;
+    cache->lruHead = index;
+
+    SetFontCacheIndex(font.glyphLookup, codepoint, index);
+
+    return index;
+}
+
+// Set dynamic font codepoint glyph index in lookup table, -1 to remove it
+// NOTE: Hash table entries are removed with backward shift deletion, keeping linear probing chains valid
+static void SetFontCacheIndex(RaylibGlyphLookup *lookup, int codepoint, int index)
+{
+    if ((codepoint >= 0) && (codepoint < RAYLIB_GLYPH_LOOKUP_DENSE_SIZE))
+    {
+        lookup->dense[codepoint] = index;
+        return;
+    }
+
+    unsigned int mask = lookup->hashCapacity - 1;
+    unsigned int slot = ((unsigned int)codepoint*2654435761u) & mask;
+
+    while ((lookup->hashCodepoints[slot] != -1) && (lookup->hashCodepoints[slot] != codepoint)) slot = (slot + 1) & mask;
+
+    if (index != -1)
+    {
+        lookup->hashCodepoints[slot] = codepoint;
+        lookup->hashIndices[slot] = index;
+    }
+    else if (lookup->hashCodepoints[slot] == codepoint)
+    {
+        unsigned int next = slot;
+
+        while (true)
+        {
+            next = (next + 1) & mask;
+            if (lookup->hashCodepoints[next] == -1) break;
+
+            // Move entry to the empty slot when it is not in its probing chain between its home slot and current position
+            unsigned int home = ((unsigned int)lookup->hashCodepoints[next]*2654435761u) & mask;
+
+            if (((next - home) & mask) >= ((next - slot) & mask))
+            {
+                lookup->hashCodepoints[slot] = lookup->hashCodepoints[next];
+                lookup->hashIndices[slot] = lookup->hashIndices[next];
+                slot = next;
+            }
+        }
+
+        lookup->hashCodepoints[slot] = -1;
+    }
+}
+
+// Cache dynamic font codepoint as missing, returns fallback glyph index
+// NOTE: Missing codepoints are not checked again on lookups, hash table entries are limited to slots capacity,
+// missing codepoints out of dense range are checked on every lookup once limit is reached
+static int SetFontCacheMissing(RaylibFont font, int codepoint)
+{
+    FontCache *cache = font.glyphLookup->cache;
+
+    if ((codepoint >= 0) && (codepoint < RAYLIB_GLYPH_LOOKUP_DENSE_SIZE)) SetFontCacheIndex(font.glyphLookup, codepoint, FONT_CACHE_GLYPH_MISSING);
+    else if ((codepoint >= 0) && (cache->missingCount < cache->slotCapacity))
+    {
+        SetFontCacheIndex(font.glyphLookup, codepoint, FONT_CACHE_GLYPH_MISSING);
+        cache->missingCount++;
+    }
+
+    return RaylibGetGlyphIndex(font, 63);
+}
+
+// Pack a new cell in dynamic font atlas shelves
+// NOTE: Best fitting shelf is used, a new shelf is opened if best one wastes more than half its height
+static bool PackFontCacheCell(FontCache *cache, int width, int height, RaylibRectangle *cell)
+{
+    int best = -1;
+
+    for (int i = 0; i < cache->shelfCount; i++)
+    {
+        FontCacheShelf *shelf = &cache->shelves[i];
+
+        if ((shelf->height >= height) && ((shelf->width + width) <= cache->atlasSize))
+        {
+            if ((best == -1) || (shelf->height < cache->shelves[best].height)) best = i;
+        }
+    }
+
+    int top = (cache->shelfCount > 0)? (cache->shelves[cache->shelfCount - 1].y + cache->shelves[cache->shelfCount - 1].height) : 0;
+
+    if (((best == -1) || (cache->shelves[best].height > 2*height)) && ((top + height) <= cache->atlasSize) && (cache->shelfCount < cache->atlasSize))
+    {
+        best = cache->shelfCount;
+        cache->shelves[best].y = top;
+        cache->shelves[best].height = height;
+        cache->shelves[best].width = 0;
+        cache->shelfCount++;
+    }
+
+    if (best == -1) return false;
+
+    *cell = (RaylibRectangle){ (float)cache->shelves[best].width, (float)cache->shelves[best].y, (float)width, (float)height };
+    cache->shelves[best].width += width;
+
+    return true;
+}
+
+// Evict glyph from dynamic font cache, keeping its slot and atlas cell
+// NOTE: Pending batched draws could use the glyph atlas cell, batch is drawn before cell is updated
+static void EvictFontCacheGlyph(RaylibFont font, int index)
+{
+    FontCache *cache = font.glyphLookup->cache;
+
+    if (isGpuReady) rlDrawRenderBatchActive();
+
+    SetFontCacheIndex(font.glyphLookup, font.glyphs[index].value, -1);
+    RaylibUnloadImage(font.glyphs[index].image);
+    font.glyphs[index] = (RaylibGlyphInfo){ 0 };
+
+    if (cache->lruPrev[index] != -1) cache->lruNext[cache->lruPrev[index]] = cache->lruNext[index];
+    else cache->lruHead = cache->lruNext[index];
+    if (cache->lruNext[index] != -1) cache->lruPrev[cache->lruNext[index]] = cache->lruPrev[index];
+    else cache->lruTail = cache->lruPrev[index];
+
+    cache->evictions++;
+}
+
+// Evict all glyphs from dynamic font cache, clearing atlas shelves
+static void ResetFontCache(RaylibFont font)
+{
+    FontCache *cache = font.glyphLookup->cache;
+
+    while (cache->lruTail != -1) EvictFontCacheGlyph(font, cache->lruTail);
+
+    cache->slotCount = 0;
+    cache->shelfCount = 0;
+}
+#endif
+
 #if defined(RAYLIB_SUPPORT_FILEFORMAT_FNT) || defined(SUPPORT_FILEFORMAT_BDF)
 // Read a line from memory
 // REQUIRES: memcpy()
@@ -2306,6 +3353,8 @@ static RaylibFont LoadBMFont(const char *fileName)
     RaylibUnloadImage(fullFont);
     RaylibUnloadFileText(fileText);
 
+    font.glyphLookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
+
     if (isGpuReady && (font.texture.id == 0))
     {
         RaylibUnloadFont(font);
@@ -78,6 +78,14 @@
 #include <math.h>               // Required for: fabsf() [Used in RaylibDrawTextureRec()]
 #include <stdio.h>              // Required for: sprintf() [Used in RaylibExportImageAsCode()]
 
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>      // Required for: __m128i, _mm_mullo_epi16(), _mm_cvtepi32_ps() [Used in BlendPixelsRGBA8(), AccumulateValuesU8()]
+    #define IMAGE_SIMD_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>       // Required for: float32x4_t, vmovl_u8(), vmlaq_f32() [Used in AccumulateValuesU8()]
+    #define IMAGE_SIMD_NEON
+#endif
+
 // Support only desired texture formats on stb_image
 #if !defined(RAYLIB_SUPPORT_FILEFORMAT_BMP)
     #define STBI_NO_BMP
@@ -232,14 +240,88 @@
     #define PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD  50    // Threshold over 255 to set alpha as 0
 #endif
 
+#ifndef RAYLIB_IMAGE_RESIZE_BATCH_PIXELS
+    #define RAYLIB_IMAGE_RESIZE_BATCH_PIXELS  65536    // Minimum output pixels per worker thread on image resizing
+#endif
+
+#ifndef IMAGE_DRAW_ROW_PIXELS
+    #define IMAGE_DRAW_ROW_PIXELS  256     // Source pixels converted per chunk on image drawing
+#endif
+
+#ifndef RAYLIB_IMAGE_FILTER_BATCH_PIXELS
+    #define RAYLIB_IMAGE_FILTER_BATCH_PIXELS  16384    // Minimum pixels per worker thread on image filtering
+#endif
+
 #ifndef GAUSSIAN_BLUR_ITERATIONS
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
 
+#ifndef IMAGE_FORMAT_BLOCK_PIXELS
+    #define IMAGE_FORMAT_BLOCK_PIXELS  256     // Pixels converted per block through intermediate buffer on image formatting
+#endif
+
+#ifndef PALETTE_CACHE_BITS
+    #define PALETTE_CACHE_BITS          16     // Nearest palette color cache size (as power of two) on palette indexing
+#endif
+
+#define PALETTE_CACHE_SIZE  (1 << PALETTE_CACHE_BITS)
+
+// Scale 8 bit value to [0..max] range rounded to nearest, using exact division by 255 (valid up to 65534)
+#define PIXEL_SCALE_8BIT(value, max)    ((((value)*(max) + 127) + (((value)*(max) + 127) >> 8) + 1) >> 8)
+
+// Grayscale equivalent of 8 bit RGB values, weights (0.299, 0.587, 0.114) in 1.15 fixed point
+#define PIXEL_GRAY_8BIT(r, g, b)        (((r)*9798 + (g)*19235 + (b)*3735) >> 15)
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Nearest-neighbor resize job data, shared by worker threads
+typedef struct ResizeNNJob {
+    const unsigned char *input;     // Input pixels
+    unsigned char *output;          // Output pixels
+    int width;                      // Input width
+    int newWidth;                   // Output width
+    int xRatio;                     // Horizontal ratio (16.16 fixed point)
+    int yRatio;                     // Vertical ratio (16.16 fixed point)
+    int bytesPerPixel;              // Pixel size in bytes
+} ResizeNNJob;
+
+// Box blur job data, shared by worker threads
+typedef struct BlurJob {
+    RaylibColor *pixels;            // Pixels, horizontal pass input and vertical pass output
+    float *blurred;                 // Horizontally blurred pixels (4 float channels per pixel)
+    int width;                      // Image width
+    int height;                     // Image height
+    int blurSize;                   // Blur window radius
+} BlurJob;
+
+// Kernel convolution job data, shared by worker threads
+typedef struct ConvolutionJob {
+    const unsigned char *input;     // Input pixels (RGBA8)
+    unsigned char *output;          // Output pixels (RGBA8)
+    int width;                      // Image width
+    int height;                     // Image height
+    const float *kernel;            // Square kernel (kernelWidth*kernelWidth), NULL if separable
+    const float *columnKernel;      // Separable kernel, vertical factor (kernelWidth)
+    const float *rowKernel;         // Separable kernel, horizontal factor (kernelWidth)
+    int kernelWidth;                // Kernel width
+} ConvolutionJob;
+
+// Color histogram bin, used on palette quantization
+typedef struct ColorBin {
+    unsigned int key;               // Bin color, 5 bit per channel (RGBA)
+    unsigned int count;             // Pixels in bin, 0 if bin is empty
+    unsigned long long sum[4];      // Pixels channels sum (RGBA)
+} ColorBin;
+
+// Color box, range of histogram bins split by median-cut quantization
+typedef struct ColorBox {
+    int start;                      // First bin
+    int end;                        // Last bin (not included)
+    unsigned long long count;       // Pixels in box
+    int channel;                    // Widest channel
+    int range;                      // Widest channel range (5 bit values)
+} ColorBox;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -256,7 +338,29 @@ extern void LoadFontDefault(void);          // [Module: text] Loads default font
 //----------------------------------------------------------------------------------
 static float HalfToFloat(unsigned short x);
 static unsigned short FloatToHalf(float x);
-static RaylibVector4 *LoadImageDataNormalized(RaylibImage image);       // Load pixel data from image as RaylibVector4 array (float normalized)
+static bool ResizePixelsLinear(const unsigned char *input, int width, int height, unsigned char *output, int newWidth, int newHeight, int channels); // Resize 8bit per channel pixels, split over worker threads, returns false on failure
+static void ResizePixelSplits(void *userData, int start, int end);     // Resize a range of splits (STBIR_RESIZE)
+static void ResizePixelRowsNN(void *userData, int start, int end);     // Resize a range of output rows (ResizeNNJob)
+static void BlurPixelRows(void *userData, int start, int end);         // Box blur a range of rows horizontally (BlurJob)
+static void BlurPixelColumns(void *userData, int start, int end);      // Box blur a range of columns vertically (BlurJob)
+static bool GetKernelFactors(const float *kernel, int kernelWidth, float *columnKernel, float *rowKernel); // Get separable kernel factors, false if kernel is not rank 1
+static void ConvolvePixelRows(void *userData, int start, int end);     // Convolve a range of output rows (ConvolutionJob)
+static void AccumulateValuesU8(float *acc, const unsigned char *values, float weight, int count);  // Accumulate weighted 8 bit values: acc[i] += values[i]*weight
+static void AccumulateValuesF32(float *acc, const float *values, float weight, int count);         // Accumulate weighted float values: acc[i] += values[i]*weight
+static void StoreValuesU8(unsigned char *values, const float *acc, int count);                     // Store float values as 8 bit values, clamped to [0..255]
+static const unsigned char *LoadPixelsRGBA8(const unsigned char *pixels, int format, int count, unsigned char *buffer); // Get pixels as RGBA8, converted into buffer if required
+static const unsigned char *LoadPixelsColors(const unsigned char *pixels, int format, int count, unsigned char *buffer); // Get pixels as RGBA8 colors, same values as RaylibLoadImageColors()
+static void BlendPixelsRGBA8(unsigned char *dst, const unsigned char *src, int count, RaylibColor tint);   // Blend tinted RGBA8 pixels over RGBA8 pixels
+static void DrawPixelsR32G32B32A32(float *dst, const unsigned char *src, int srcFormat, int count, RaylibColor tint, bool blend); // Draw pixels over R32G32B32A32 pixels
+static void ConvertPixels(const unsigned char *src, int srcFormat, unsigned char *dst, int dstFormat, int count); // Convert pixels between uncompressed formats, in place if destination is not bigger
+static bool ConvertPixelsDirect(const unsigned char *src, int srcFormat, unsigned char *dst, int dstFormat, int count); // Convert pixels with a direct kernel, false if formats pair has no kernel
+static void DecodePixelsRGBA8(const unsigned char *src, int format, unsigned char *rgba, int count);   // Decode 8 bit per channel (or lower) pixels into RGBA8
+static void EncodePixelsRGBA8(const unsigned char *rgba, unsigned char *dst, int format, int count);   // Encode RGBA8 pixels into 8 bit per channel (or lower) format
+static void DecodePixelsRGBA32F(const unsigned char *src, int format, float *rgba, int count);        // Decode pixels into RGBA32F (float normalized)
+static void EncodePixelsRGBA32F(const float *rgba, unsigned char *dst, int format, int count);        // Encode RGBA32F (float normalized) pixels into format
+static int GetImageUniqueColors(RaylibImage image, RaylibColor *palette, int maxPaletteSize);      // Get image unique colors (transparent pixels ignored), up to maxPaletteSize, returns colors count
+static int QuantizeImageColors(RaylibImage image, RaylibColor *palette, int paletteSize);            // Quantize image colors (median-cut) into palette, returns colors count
+static void UpdateColorBox(ColorBox *box, const ColorBin *bins);                                     // Update color box pixels count and widest channel range
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -1260,199 +1364,47 @@ void RaylibImageFormat(RaylibImage *image, int newFormat)
     {
         if ((image->format < RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB))
         {
-            RaylibVector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
-
-            RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
-            image->data = NULL;
-            image->format = newFormat;
+            // Get pixel count of all mipmap levels, levels are stored consecutively
+            // so all of them are converted at once, original mipmaps are kept
+            int width = image->width;
+            int height = image->height;
+            size_t pixelCount = 0;
 
-            switch (image->format)
+            for (int i = 0; i < image->mipmaps; i++)
             {
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
-                    }
-
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*2; i += 2, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
-                    }
-
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
-
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*63.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
-
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
-                    }
-
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                    }
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
-
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*31.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
-                        a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
-
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
-                    }
-
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
-
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*15.0f));
-                        g = (unsigned char)(round(pixels[i].y*15.0f));
-                        b = (unsigned char)(round(pixels[i].z*15.0f));
-                        a = (unsigned char)(round(pixels[i].w*15.0f));
-
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
-                    }
+                pixelCount += (size_t)width*height;
 
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                        ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
-                    }
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    // WARNING: RaylibImage is converted to GRAYSCALE equivalent 32bit
-
-                    image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
-                    }
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
+                width /= 2;
+                height /= 2;
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                    }
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                        ((float *)image->data)[i + 3] = pixels[k].w;
-                    }
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    // WARNING: RaylibImage is converted to GRAYSCALE equivalent 16bit
-
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                // Security check for NPOT textures
+                if (width < 1) width = 1;
+                if (height < 1) height = 1;
+            }
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf((float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f));
-                    }
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned short));
+            int srcBytesPerPixel = RaylibGetPixelDataSize(1, 1, image->format);
+            int dstBytesPerPixel = RaylibGetPixelDataSize(1, 1, newFormat);
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                    }
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned short));
+            // NOTE: Conversion is done in place when destination pixels are not bigger than source pixels
+            unsigned char *data = (dstBytesPerPixel <= srcBytesPerPixel)? (unsigned char *)image->data : (unsigned char *)RL_MALLOC(pixelCount*dstBytesPerPixel);
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                        ((unsigned short *)image->data)[i + 3] = FloatToHalf(pixels[k].w);
-                    }
-                } break;
-                default: break;
+            if (data == NULL)
+            {
+                RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Failed to allocate memory for format conversion");
+                return;
             }
 
-            RL_FREE(pixels);
-            pixels = NULL;
+            ConvertPixels((unsigned char *)image->data, image->format, data, newFormat, (int)pixelCount);
 
-            // In case original image had mipmaps, generate mipmaps for formatted image
-            // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
-            if (image->mipmaps > 1)
+            if (data != image->data) RL_FREE(image->data);
+            else if (dstBytesPerPixel < srcBytesPerPixel)
             {
-                image->mipmaps = 1;
-            #if defined(RAYLIB_SUPPORT_IMAGE_MANIPULATION)
-                if (image->data != NULL) RaylibImageMipmaps(image);
-            #endif
+                void *shrunk = RL_REALLOC(data, pixelCount*dstBytesPerPixel);
+                if (shrunk != NULL) data = (unsigned char *)shrunk;
             }
+
+            image->data = data;
+            image->format = newFormat;
         }
         else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Data format is compressed, can not be converted");
     }
@@ -1713,25 +1665,38 @@ void RaylibImageResizeNN(RaylibImage *image,int newWidth,int newHeight)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    RaylibColor *pixels = RaylibLoadImageColors(*image);
-    RaylibColor *output = (RaylibColor *)RL_MALLOC(newWidth*newHeight*sizeof(RaylibColor));
+    if (image->format < RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        // Pixels are copied as they are, no need to convert them
+        void *output = RL_MALLOC(RaylibGetPixelDataSize(newWidth, newHeight, image->format));
 
-    // EDIT: added +1 to account for an early rounding problem
-    int xRatio = (int)((image->width << 16)/newWidth) + 1;
-    int yRatio = (int)((image->height << 16)/newHeight) + 1;
+        RaylibImageResizeNNInto(*image, output, newWidth, newHeight);
 
-    int x2, y2;
-    for (int y = 0; y < newHeight; y++)
-    {
-        for (int x = 0; x < newWidth; x++)
-        {
-            x2 = ((x*xRatio) >> 16);
-            y2 = ((y*yRatio) >> 16);
+        RL_FREE(image->data);
+
+        image->data = output;
+        image->width = newWidth;
+        image->height = newHeight;
 
-            output[(y*newWidth) + x] = pixels[(y2*image->width) + x2] ;
+        // In case original image had mipmaps, generate mipmaps for resized image
+        if (image->mipmaps > 1)
+        {
+            image->mipmaps = 1;
+        #if defined(RAYLIB_SUPPORT_IMAGE_MANIPULATION)
+            RaylibImageMipmaps(image);
+        #endif
         }
+        return;
     }
 
+    RaylibColor *pixels = RaylibLoadImageColors(*image);
+    RaylibColor *output = (RaylibColor *)RL_MALLOC(newWidth*newHeight*sizeof(RaylibColor));
+
+    // EDIT: added +1 to account for an early rounding problem
+    ResizeNNJob job = { (const unsigned char *)pixels, (unsigned char *)output, image->width, newWidth,
+        (int)((image->width << 16)/newWidth) + 1, (int)((image->height << 16)/newHeight) + 1, sizeof(RaylibColor) };
+    ParallelFor(newHeight, RAYLIB_IMAGE_RESIZE_BATCH_PIXELS/newWidth + 1, ResizePixelRowsNN, &job);
+
     int format = image->format;
 
     RL_FREE(image->data);
@@ -1746,6 +1711,25 @@ void RaylibImageResizeNN(RaylibImage *image,int newWidth,int newHeight)
     RaylibUnloadImageColors(pixels);
 }
 
+// Resize image into provided buffer using Nearest-Neighbor scaling algorithm
+// NOTE: output must hold RaylibGetPixelDataSize(newWidth, newHeight, image.format) bytes, only base level is resized
+void RaylibImageResizeNNInto(RaylibImage image, void *output, int newWidth, int newHeight)
+{
+    // Security check to avoid program crash
+    if ((image.data == NULL) || (image.width == 0) || (image.height == 0) || (output == NULL)) return;
+
+    if (image.format >= RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Compressed data formats can not be resized into buffer");
+        return;
+    }
+
+    // EDIT: added +1 to account for an early rounding problem
+    ResizeNNJob job = { (const unsigned char *)image.data, (unsigned char *)output, image.width, newWidth,
+        (int)((image.width << 16)/newWidth) + 1, (int)((image.height << 16)/newHeight) + 1, RaylibGetPixelDataSize(1, 1, image.format) };
+    ParallelFor(newHeight, RAYLIB_IMAGE_RESIZE_BATCH_PIXELS/newWidth + 1, ResizePixelRowsNN, &job);
+}
+
 // Resize and image to new size
 // NOTE: Uses stb default scaling filters (both bicubic):
 // STBIR_DEFAULT_FILTER_UPSAMPLE    STBIR_FILTER_CATMULLROM
@@ -1765,13 +1749,11 @@ void RaylibImageResize(RaylibImage *image, int newWidth, int newHeight)
         int bytesPerPixel = RaylibGetPixelDataSize(1, 1, image->format);
         unsigned char *output = (unsigned char *)RL_MALLOC(newWidth*newHeight*bytesPerPixel);
 
-        switch (image->format)
+        if (!ResizePixelsLinear((unsigned char *)image->data, image->width, image->height, output, newWidth, newHeight, bytesPerPixel))
         {
-            case RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)1); break;
-            case RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)2); break;
-            case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)3); break;
-            case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)4); break;
-            default: break;
+            RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Failed to resize image data");
+            RL_FREE(output);
+            return;
         }
 
         RL_FREE(image->data);
@@ -1786,7 +1768,13 @@ void RaylibImageResize(RaylibImage *image, int newWidth, int newHeight)
         RaylibColor *output = (RaylibColor *)RL_MALLOC(newWidth*newHeight*sizeof(RaylibColor));
 
         // NOTE: RaylibColor data is cast to (unsigned char *), there shouldn't been any problem...
-        stbir_resize_uint8_linear((unsigned char *)pixels, image->width, image->height, 0, (unsigned char *)output, newWidth, newHeight, 0, (stbir_pixel_layout)4);
+        if (!ResizePixelsLinear((unsigned char *)pixels, image->width, image->height, (unsigned char *)output, newWidth, newHeight, 4))
+        {
+            RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Failed to resize image data");
+            RaylibUnloadImageColors(pixels);
+            RL_FREE(output);
+            return;
+        }
 
         int format = image->format;
 
@@ -1802,6 +1790,45 @@ void RaylibImageResize(RaylibImage *image, int newWidth, int newHeight)
     }
 }
 
+// Resize image into provided buffer
+// NOTE: output must hold RaylibGetPixelDataSize(newWidth, newHeight, image.format) bytes, only base level is resized
+// 8 bit per channel formats are resized directly into output, no intermediate buffer is allocated
+void RaylibImageResizeInto(RaylibImage image, void *output, int newWidth, int newHeight)
+{
+    // Security check to avoid program crash
+    if ((image.data == NULL) || (image.width == 0) || (image.height == 0) || (output == NULL)) return;
+
+    if (image.format >= RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Compressed data formats can not be resized into buffer");
+        return;
+    }
+
+    if ((image.format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ||
+        (image.format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
+        (image.format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8) ||
+        (image.format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    {
+        if (!ResizePixelsLinear((unsigned char *)image.data, image.width, image.height, (unsigned char *)output, newWidth, newHeight, RaylibGetPixelDataSize(1, 1, image.format)))
+        {
+            RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Failed to resize image data");
+        }
+    }
+    else
+    {
+        RaylibImage resized = image;
+        resized.mipmaps = 1;
+        resized.data = RL_MALLOC(RaylibGetPixelDataSize(image.width, image.height, image.format));
+        memcpy(resized.data, image.data, RaylibGetPixelDataSize(image.width, image.height, image.format));
+
+        RaylibImageResize(&resized, newWidth, newHeight);
+
+        // Output is left unchanged if resize failed
+        if ((resized.width == newWidth) && (resized.height == newHeight)) memcpy(output, resized.data, RaylibGetPixelDataSize(newWidth, newHeight, image.format));
+        RL_FREE(resized.data);
+    }
+}
+
 // Resize canvas and fill with color
 // NOTE: Resize offset is relative to the top-left corner of the original image
 void RaylibImageResizeCanvas(RaylibImage *image, int newWidth, int newHeight, int offsetX, int offsetY, RaylibColor fill)
@@ -2095,137 +2122,48 @@ void RaylibImageBlurGaussian(RaylibImage *image, int blurSize)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    if (blurSize < 0) blurSize = 0;
+
     RaylibImageAlphaPremultiply(image);
 
     RaylibColor *pixels = RaylibLoadImageColors(*image);
 
-    // Loop switches between pixelsCopy1 and pixelsCopy2
-    RaylibVector4 *pixelsCopy1 = RL_MALLOC((image->height)*(image->width)*sizeof(RaylibVector4));
-    RaylibVector4 *pixelsCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(RaylibVector4));
+    // Horizontal pass output, vertical pass writes back to pixels
+    float *blurred = RL_MALLOC((image->height)*(image->width)*4*sizeof(float));
 
-    for (int i = 0; i < (image->height*image->width); i++)
-    {
-        pixelsCopy1[i].x = pixels[i].r;
-        pixelsCopy1[i].y = pixels[i].g;
-        pixelsCopy1[i].z = pixels[i].b;
-        pixelsCopy1[i].w = pixels[i].a;
-    }
+    BlurJob job = { pixels, blurred, image->width, image->height, blurSize };
 
     // Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
     for (int j = 0; j < GAUSSIAN_BLUR_ITERATIONS; j++)
     {
-        // Horizontal motion blur
-        for (int row = 0; row < image->height; row++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
-
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy1[row*image->width + i].x;
-                avgG += pixelsCopy1[row*image->width + i].y;
-                avgB += pixelsCopy1[row*image->width + i].z;
-                avgAlpha += pixelsCopy1[row*image->width + i].w;
-            }
-
-            for (int x = 0; x < image->width; x++)
-            {
-                if (x-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy1[row*image->width + x-blurSize-1].x;
-                    avgG -= pixelsCopy1[row*image->width + x-blurSize-1].y;
-                    avgB -= pixelsCopy1[row*image->width + x-blurSize-1].z;
-                    avgAlpha -= pixelsCopy1[row*image->width + x-blurSize-1].w;
-                    convolutionSize--;
-                }
-
-                if (x+blurSize < image->width)
-                {
-                    avgR += pixelsCopy1[row*image->width + x+blurSize].x;
-                    avgG += pixelsCopy1[row*image->width + x+blurSize].y;
-                    avgB += pixelsCopy1[row*image->width + x+blurSize].z;
-                    avgAlpha += pixelsCopy1[row*image->width + x+blurSize].w;
-                    convolutionSize++;
-                }
+        // Horizontal motion blur, split in bands of rows
+        ParallelFor(image->height, RAYLIB_IMAGE_FILTER_BATCH_PIXELS/image->width, BlurPixelRows, &job);
 
-                pixelsCopy2[row*image->width + x].x = avgR/convolutionSize;
-                pixelsCopy2[row*image->width + x].y = avgG/convolutionSize;
-                pixelsCopy2[row*image->width + x].z = avgB/convolutionSize;
-                pixelsCopy2[row*image->width + x].w = avgAlpha/convolutionSize;
-            }
-        }
-
-        // Vertical motion blur
-        for (int col = 0; col < image->width; col++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
-
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy2[i*image->width + col].x;
-                avgG += pixelsCopy2[i*image->width + col].y;
-                avgB += pixelsCopy2[i*image->width + col].z;
-                avgAlpha += pixelsCopy2[i*image->width + col].w;
-            }
-
-            for (int y = 0; y < image->height; y++)
-            {
-                if (y-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy2[(y-blurSize-1)*image->width + col].x;
-                    avgG -= pixelsCopy2[(y-blurSize-1)*image->width + col].y;
-                    avgB -= pixelsCopy2[(y-blurSize-1)*image->width + col].z;
-                    avgAlpha -= pixelsCopy2[(y-blurSize-1)*image->width + col].w;
-                    convolutionSize--;
-                }
-                if (y+blurSize < image->height)
-                {
-                    avgR += pixelsCopy2[(y+blurSize)*image->width + col].x;
-                    avgG += pixelsCopy2[(y+blurSize)*image->width + col].y;
-                    avgB += pixelsCopy2[(y+blurSize)*image->width + col].z;
-                    avgAlpha += pixelsCopy2[(y+blurSize)*image->width + col].w;
-                    convolutionSize++;
-                }
-
-                pixelsCopy1[y*image->width + col].x = (unsigned char) (avgR/convolutionSize);
-                pixelsCopy1[y*image->width + col].y = (unsigned char) (avgG/convolutionSize);
-                pixelsCopy1[y*image->width + col].z = (unsigned char) (avgB/convolutionSize);
-                pixelsCopy1[y*image->width + col].w = (unsigned char) (avgAlpha/convolutionSize);
-            }
-        }
+        // Vertical motion blur, split in bands of columns
+        ParallelFor(image->width, RAYLIB_IMAGE_FILTER_BATCH_PIXELS/image->height, BlurPixelColumns, &job);
     }
 
     // Reverse premultiply
     for (int i = 0; i < (image->width)*(image->height); i++)
     {
-        if (pixelsCopy1[i].w == 0.0f)
+        if (pixels[i].a == 0)
         {
             pixels[i].r = 0;
             pixels[i].g = 0;
             pixels[i].b = 0;
-            pixels[i].a = 0;
         }
-        else if (pixelsCopy1[i].w <= 255.0f)
+        else
         {
-            float alpha = (float)pixelsCopy1[i].w/255.0f;
-            pixels[i].r = (unsigned char)((float)pixelsCopy1[i].x/alpha);
-            pixels[i].g = (unsigned char)((float)pixelsCopy1[i].y/alpha);
-            pixels[i].b = (unsigned char)((float)pixelsCopy1[i].z/alpha);
-            pixels[i].a = (unsigned char) pixelsCopy1[i].w;
+            float alpha = (float)pixels[i].a/255.0f;
+            pixels[i].r = (unsigned char)((float)pixels[i].r/alpha);
+            pixels[i].g = (unsigned char)((float)pixels[i].g/alpha);
+            pixels[i].b = (unsigned char)((float)pixels[i].b/alpha);
         }
     }
 
     int format = image->format;
     RL_FREE(image->data);
-    RL_FREE(pixelsCopy1);
-    RL_FREE(pixelsCopy2);
+    RL_FREE(blurred);
 
     image->data = pixels;
     image->format = RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
@@ -2234,7 +2172,9 @@ void RaylibImageBlurGaussian(RaylibImage *image, int blurSize)
 }
 
 // Apply custom square convolution kernel to image
-// NOTE: The convolution kernel matrix is expected to be square
+// NOTE 1: The convolution kernel matrix is expected to be square
+// NOTE 2: Separable (rank 1) kernels are detected and applied as two 1D passes
+// NOTE 3: Pixels outside image are considered zero, results are clamped to [0..255]
 void RaylibImageKernelConvolution(RaylibImage *image, const float *kernel, int kernelSize)
 {
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || kernel == NULL) return;
@@ -2248,117 +2188,31 @@ void RaylibImageKernelConvolution(RaylibImage *image, const float *kernel, int k
     }
 
     RaylibColor *pixels = RaylibLoadImageColors(*image);
+    RaylibColor *output = RL_MALLOC((image->height)*(image->width)*sizeof(RaylibColor));
+    float *factors = RL_MALLOC(2*kernelWidth*sizeof(float));
 
-    RaylibVector4 *imageCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(RaylibVector4));
-    RaylibVector4 *temp = RL_MALLOC(kernelSize*sizeof(RaylibVector4));
-
-    for (int i = 0; i < kernelSize; i++)
-    {
-        temp[i].x = 0.0f;
-        temp[i].y = 0.0f;
-        temp[i].z = 0.0f;
-        temp[i].w = 0.0f;
-    }
-
-    float rRes = 0.0f;
-    float gRes = 0.0f;
-    float bRes = 0.0f;
-    float aRes = 0.0f;
-
-    int startRange = 0, endRange = 0;
-
-    if (kernelWidth%2 == 0)
-    {
-        startRange = -kernelWidth/2;
-        endRange = kernelWidth/2;
-    }
-    else
-    {
-        startRange = -kernelWidth/2;
-        endRange = kernelWidth/2 + 1;
-    }
+    ConvolutionJob job = { 0 };
+    job.input = (const unsigned char *)pixels;
+    job.output = (unsigned char *)output;
+    job.width = image->width;
+    job.height = image->height;
+    job.kernelWidth = kernelWidth;
 
-    for (int x = 0; x < image->height; x++)
+    if (GetKernelFactors(kernel, kernelWidth, factors, factors + kernelWidth))
     {
-        for (int y = 0; y < image->width; y++)
-        {
-            for (int xk = startRange; xk < endRange; xk++)
-            {
-                for (int yk = startRange; yk < endRange; yk++)
-                {
-                    int xkabs = xk + kernelWidth/2;
-                    int ykabs = yk + kernelWidth/2;
-                    unsigned int imgindex = image->width*(x + xk) + (y + yk);
-
-                    if (imgindex >= (unsigned int)(image->width*image->height))
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].y = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].z = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].w = 0.0f;
-                    }
-                    else
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = ((float)pixels[imgindex].r)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].y = ((float)pixels[imgindex].g)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].z = ((float)pixels[imgindex].b)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].w = ((float)pixels[imgindex].a)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                    }
-                }
-            }
-
-            for (int i = 0; i < kernelSize; i++)
-            {
-                rRes += temp[i].x;
-                gRes += temp[i].y;
-                bRes += temp[i].z;
-                aRes += temp[i].w;
-            }
-
-            if (rRes < 0.0f) rRes = 0.0f;
-            if (gRes < 0.0f) gRes = 0.0f;
-            if (bRes < 0.0f) bRes = 0.0f;
-
-            if (rRes > 1.0f) rRes = 1.0f;
-            if (gRes > 1.0f) gRes = 1.0f;
-            if (bRes > 1.0f) bRes = 1.0f;
-
-            imageCopy2[image->width*x + y].x = rRes;
-            imageCopy2[image->width*x + y].y = gRes;
-            imageCopy2[image->width*x + y].z = bRes;
-            imageCopy2[image->width*x + y].w = aRes;
-
-            rRes = 0.0f;
-            gRes = 0.0f;
-            bRes = 0.0f;
-            aRes = 0.0f;
-
-            for (int i = 0; i < kernelSize; i++)
-            {
-                temp[i].x = 0.0f;
-                temp[i].y = 0.0f;
-                temp[i].z = 0.0f;
-                temp[i].w = 0.0f;
-            }
-        }
+        job.columnKernel = factors;
+        job.rowKernel = factors + kernelWidth;
     }
+    else job.kernel = kernel;
 
-    for (int i = 0; i < (image->width*image->height); i++)
-    {
-        float alpha = (float)imageCopy2[i].w;
-
-        pixels[i].r = (unsigned char)((imageCopy2[i].x)*255.0f);
-        pixels[i].g = (unsigned char)((imageCopy2[i].y)*255.0f);
-        pixels[i].b = (unsigned char)((imageCopy2[i].z)*255.0f);
-        pixels[i].a = (unsigned char)((alpha)*255.0f);
-    }
+    ParallelFor(image->height, RAYLIB_IMAGE_FILTER_BATCH_PIXELS/image->width, ConvolvePixelRows, &job);
 
     int format = image->format;
     RL_FREE(image->data);
-    RL_FREE(imageCopy2);
-    RL_FREE(temp);
+    RL_FREE(pixels);
+    RL_FREE(factors);
 
-    image->data = pixels;
+    image->data = output;
     image->format = RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
     RaylibImageFormat(image, format);
 }
@@ -2397,19 +2251,31 @@ void RaylibImageMipmaps(RaylibImage *image)
     {
         void *temp = RL_REALLOC(image->data, mipSize);
 
-        if (temp != NULL) image->data = temp;      // Assign new pointer (new size) to store mipmaps data
-        else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Mipmaps required memory could not be allocated");
+        if (temp == NULL)
+        {
+            RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Mipmaps required memory could not be allocated");
+            return;
+        }
+
+        image->data = temp;      // Assign new pointer (new size) to store mipmaps data
 
         // Pointer to allocated memory point where store next mipmap level data
+        // NOTE: Every level is resized from the previous one, straight into the mipmaps chain
         unsigned char *nextmip = image->data;
+        RaylibImage prevmip = { 0 };
 
         mipWidth = image->width;
         mipHeight = image->height;
         mipSize = RaylibGetPixelDataSize(mipWidth, mipHeight, image->format);
-        RaylibImage imCopy = RaylibImageCopy(*image);
 
         for (int i = 1; i < mipCount; i++)
         {
+            prevmip.data = nextmip;
+            prevmip.width = mipWidth;
+            prevmip.height = mipHeight;
+            prevmip.mipmaps = 1;
+            prevmip.format = image->format;
+
             nextmip += mipSize;
 
             mipWidth /= 2;
@@ -2425,13 +2291,9 @@ void RaylibImageMipmaps(RaylibImage *image)
 
             RAYLIB_TRACELOGD("IMAGE: Generating mipmap level: %i (%i x %i) - size: %i - offset: 0x%x", i, mipWidth, mipHeight, mipSize, nextmip);
 
-            RaylibImageResize(&imCopy, mipWidth, mipHeight); // Uses internally Mitchell cubic downscale filter
-
-            memcpy(nextmip, imCopy.data, mipSize);
+            RaylibImageResizeInto(prevmip, nextmip, mipWidth, mipHeight); // Uses internally Mitchell cubic downscale filter
         }
 
-        RaylibUnloadImage(imCopy);
-
         image->mipmaps = mipCount;
     }
     else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Mipmaps already available");
@@ -2549,28 +2411,61 @@ void RaylibImageDither(RaylibImage *image, int rBpp, int gBpp, int bBpp, int aBp
     }
 }
 
-// Flip image vertically
-void RaylibImageFlipVertical(RaylibImage *image)
+// Dither image data to palette colors (Floyd-Steinberg dithering), image is converted to RGBA8
+// NOTE: Palette is limited to 256 colors, see RaylibLoadImagePaletteIndices() for transparent pixels,
+// palette can be loaded with RaylibLoadImagePaletteQuantized(), mipmaps are not kept
+void RaylibImageDitherPalette(RaylibImage *image, const RaylibColor *palette, int colorCount)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    if (image->mipmaps > 1) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibImage manipulation only applied to base mipmap level");
-    if (image->format >= RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibImage manipulation not supported for compressed formats");
-    else
+    if (image->format >= RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB)
     {
-        int bytesPerPixel = RaylibGetPixelDataSize(1, 1, image->format);
-        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Compressed data formats can not be dithered");
+        return;
+    }
 
-        for (int i = (image->height - 1), offsetSize = 0; i >= 0; i--)
-        {
-            memcpy(flippedData + offsetSize, ((unsigned char *)image->data) + i*image->width*bytesPerPixel, image->width*bytesPerPixel);
-            offsetSize += image->width*bytesPerPixel;
-        }
+    unsigned char *indices = RaylibLoadImagePaletteIndices(*image, palette, colorCount, true);
+    if (indices == NULL) return;
 
-        RL_FREE(image->data);
-        image->data = flippedData;
-    }
+    RaylibColor *pixels = (RaylibColor *)RL_MALLOC(image->width*image->height*sizeof(RaylibColor));
+
+    if (pixels != NULL)
+    {
+        for (int i = 0; i < image->width*image->height; i++) pixels[i] = palette[indices[i]];
+
+        RL_FREE(image->data);
+        image->data = pixels;
+        image->format = RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        image->mipmaps = 1;
+    }
+    else RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Failed to allocate dithered image data");
+
+    RL_FREE(indices);
+}
+
+// Flip image vertically
+void RaylibImageFlipVertical(RaylibImage *image)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->mipmaps > 1) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibImage manipulation only applied to base mipmap level");
+    if (image->format >= RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "RaylibImage manipulation not supported for compressed formats");
+    else
+    {
+        int bytesPerPixel = RaylibGetPixelDataSize(1, 1, image->format);
+        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
+
+        for (int i = (image->height - 1), offsetSize = 0; i >= 0; i--)
+        {
+            memcpy(flippedData + offsetSize, ((unsigned char *)image->data) + i*image->width*bytesPerPixel, image->width*bytesPerPixel);
+            offsetSize += image->width*bytesPerPixel;
+        }
+
+        RL_FREE(image->data);
+        image->data = flippedData;
+    }
 }
 
 // Flip image horizontally
@@ -3083,56 +2978,181 @@ RaylibColor *RaylibLoadImageColors(RaylibImage image)
 // NOTE: Memory allocated should be freed using RaylibUnloadImagePalette()
 RaylibColor *RaylibLoadImagePalette(RaylibImage image, int maxPaletteSize, int *colorCount)
 {
-    #define COLOR_EQUAL(col1, col2) ((col1.r == col2.r)&&(col1.g == col2.g)&&(col1.b == col2.b)&&(col1.a == col2.a))
-
     int palCount = 0;
     RaylibColor *palette = NULL;
-    RaylibColor *pixels = RaylibLoadImageColors(image);
 
-    if (pixels != NULL)
+    if (image.format >= RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Palette retrieval not supported for compressed image formats");
+    else if ((image.data != NULL) && (maxPaletteSize > 0))
     {
         palette = (RaylibColor *)RL_MALLOC(maxPaletteSize*sizeof(RaylibColor));
 
         for (int i = 0; i < maxPaletteSize; i++) palette[i] = RAYLIB_BLANK;   // Set all colors to RAYLIB_BLANK
 
-        for (int i = 0; i < image.width*image.height; i++)
+        palCount = GetImageUniqueColors(image, palette, maxPaletteSize);
+
+        // We reached the limit of colors supported by palette
+        if (palCount >= maxPaletteSize) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Palette is greater than %i colors", maxPaletteSize);
+    }
+
+    *colorCount = palCount;
+
+    return palette;
+}
+
+// Load quantized colors palette from image (median-cut), up to paletteSize colors
+// NOTE: Images with no more than paletteSize colors get their exact palette, same as RaylibLoadImagePalette(),
+// transparent pixels are ignored. Memory allocated should be freed using RaylibUnloadImagePalette()
+RaylibColor *RaylibLoadImagePaletteQuantized(RaylibImage image, int paletteSize, int *colorCount)
+{
+    int palCount = 0;
+    RaylibColor *palette = NULL;
+
+    if (image.format >= RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Palette retrieval not supported for compressed image formats");
+    else if ((image.data != NULL) && (paletteSize > 0))
+    {
+        palette = (RaylibColor *)RL_MALLOC((paletteSize + 1)*sizeof(RaylibColor));
+
+        for (int i = 0; i <= paletteSize; i++) palette[i] = RAYLIB_BLANK;
+
+        palCount = GetImageUniqueColors(image, palette, paletteSize + 1);
+
+        if (palCount > paletteSize)
+        {
+            for (int i = 0; i <= paletteSize; i++) palette[i] = RAYLIB_BLANK;
+
+            palCount = QuantizeImageColors(image, palette, paletteSize);
+        }
+    }
+
+    *colorCount = palCount;
+
+    return palette;
+}
+
+// Load palette indices for image pixels (one byte per pixel), mapped to nearest palette color
+// NOTE: Palette is limited to 256 colors, dithering (Floyd-Steinberg) spreads color error to neighbour pixels,
+// fully transparent pixels get the first transparent palette entry index or, if there is none, the nearest color
+// Output is meant for indexed images writers and RaylibImageDitherPalette(), GIF recording does not use it (msf_gif
+// quantizes frames to its own palette). Memory allocated should be freed using RaylibUnloadImagePaletteIndices()
+unsigned char *RaylibLoadImagePaletteIndices(RaylibImage image, const RaylibColor *palette, int colorCount, bool dither)
+{
+    unsigned char *indices = NULL;
+
+    if (image.format >= RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Palette indexing not supported for compressed image formats");
+    else if ((image.data != NULL) && (image.width > 0) && (image.height > 0) && (palette != NULL) && (colorCount > 0))
+    {
+        if (colorCount > 256)
+        {
+            RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Palette indexing supports up to 256 colors, %i colors provided", colorCount);
+            colorCount = 256;
+        }
+
+        indices = (unsigned char *)RL_MALLOC(image.width*image.height*sizeof(unsigned char));
+
+        // Transparent pixels map to the first fully transparent palette entry, if any
+        // NOTE: Palette loaders ignore transparent pixels, a RAYLIB_BLANK entry can be appended to keep them
+        int transparentIndex = -1;
+        for (int i = 0; (i < colorCount) && (transparentIndex < 0); i++) if (palette[i].a == 0) transparentIndex = i;
+
+        // Nearest palette color cache, direct mapped by packed pixel color hash, 0xffff means empty slot
+        // NOTE: Nearest color is always searched for the actual pixel color, so exact palette colors keep their index
+        unsigned int *cacheColors = (unsigned int *)RL_MALLOC(PALETTE_CACHE_SIZE*sizeof(unsigned int));
+        unsigned short *cacheIndices = (unsigned short *)RL_MALLOC(PALETTE_CACHE_SIZE*sizeof(unsigned short));
+        memset(cacheIndices, 0xff, PALETTE_CACHE_SIZE*sizeof(unsigned short));
+
+        unsigned char *row = (unsigned char *)RL_MALLOC(image.width*4*sizeof(unsigned char));
+        int *errors = dither? (int *)RL_CALLOC((image.width + 2)*3*2, sizeof(int)) : NULL;  // Current and next row RGB errors (scaled by 16)
+        int bytesPerPixel = RaylibGetPixelDataSize(1, 1, image.format);
+
+        for (int y = 0; y < image.height; y++)
         {
-            if (pixels[i].a > 0)
+            const unsigned char *pixels = LoadPixelsColors((unsigned char *)image.data + (size_t)y*image.width*bytesPerPixel, image.format, image.width, row);
+            int *error = NULL;
+            int *nextError = NULL;
+
+            if (dither)
+            {
+                error = errors + ((y & 1)? (image.width + 2)*3 : 0);
+                nextError = errors + ((y & 1)? 0 : (image.width + 2)*3);
+                memset(nextError, 0, (image.width + 2)*3*sizeof(int));
+            }
+
+            for (int x = 0; x < image.width; x++)
             {
-                bool colorInPalette = false;
+                int color[4] = { pixels[x*4], pixels[x*4 + 1], pixels[x*4 + 2], pixels[x*4 + 3] };
+
+                if (dither)
+                {
+                    for (int c = 0; c < 3; c++)
+                    {
+                        color[c] += error[(x + 1)*3 + c]/16;
 
-                // Check if the color is already on palette
-                for (int j = 0; j < maxPaletteSize; j++)
+                        if (color[c] < 0) color[c] = 0;
+                        else if (color[c] > 255) color[c] = 255;
+                    }
+                }
+
+                unsigned char index = 0;
+
+                if ((color[3] == 0) && (transparentIndex >= 0))
+                {
+                    // Transparent pixels do not spread color error
+                    indices[y*image.width + x] = (unsigned char)transparentIndex;
+                    continue;
+                }
+
+                unsigned int packed = (unsigned int)color[0] | (unsigned int)color[1] << 8 | (unsigned int)color[2] << 16 | (unsigned int)color[3] << 24;
+                unsigned int slot = (packed*0x9e3779b1u) >> (32 - PALETTE_CACHE_BITS);
+
+                if ((cacheIndices[slot] != 0xffff) && (cacheColors[slot] == packed)) index = (unsigned char)cacheIndices[slot];
+                else
                 {
-                    if (COLOR_EQUAL(pixels[i], palette[j]))
+                    // Search nearest palette color, exact matches stop the search
+                    int minDistance = 0x7fffffff;
+
+                    for (int i = 0; (i < colorCount) && (minDistance > 0); i++)
                     {
-                        colorInPalette = true;
-                        break;
+                        int dr = color[0] - palette[i].r;
+                        int dg = color[1] - palette[i].g;
+                        int db = color[2] - palette[i].b;
+                        int da = color[3] - palette[i].a;
+                        int distance = dr*dr + dg*dg + db*db + da*da;
+
+                        if (distance < minDistance)
+                        {
+                            minDistance = distance;
+                            index = (unsigned char)i;
+                        }
                     }
+
+                    cacheColors[slot] = packed;
+                    cacheIndices[slot] = index;
                 }
 
-                // Store color if not on the palette
-                if (!colorInPalette)
+                indices[y*image.width + x] = index;
+
+                if (dither)
                 {
-                    palette[palCount] = pixels[i];      // Add pixels[i] to palette
-                    palCount++;
+                    int colorError[3] = { color[0] - palette[index].r, color[1] - palette[index].g, color[2] - palette[index].b };
 
-                    // We reached the limit of colors supported by palette
-                    if (palCount >= maxPaletteSize)
+                    for (int c = 0; c < 3; c++)
                     {
-                        i = image.width*image.height;   // Finish palette get
-                        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Palette is greater than %i colors", maxPaletteSize);
+                        error[(x + 2)*3 + c] += colorError[c]*7;
+                        nextError[x*3 + c] += colorError[c]*3;
+                        nextError[(x + 1)*3 + c] += colorError[c]*5;
+                        nextError[(x + 2)*3 + c] += colorError[c];
                     }
                 }
             }
         }
 
-        RaylibUnloadImageColors(pixels);
+        RL_FREE(errors);
+        RL_FREE(row);
+        RL_FREE(cacheIndices);
+        RL_FREE(cacheColors);
     }
 
-    *colorCount = palCount;
-
-    return palette;
+    return indices;
 }
 
 // Unload color data loaded with RaylibLoadImageColors()
@@ -3147,6 +3167,12 @@ void RaylibUnloadImagePalette(RaylibColor *colors)
     RL_FREE(colors);
 }
 
+// Unload palette indices loaded with RaylibLoadImagePaletteIndices()
+void RaylibUnloadImagePaletteIndices(unsigned char *indices)
+{
+    RL_FREE(indices);
+}
+
 // Get image alpha border rectangle
 // NOTE: Threshold is defined as a percentage: 0.0f -> 1.0f
 RaylibRectangle RaylibGetImageAlphaBorder(RaylibImage image, float threshold)
@@ -3975,10 +4001,11 @@ void RaylibImageDraw(RaylibImage *dst, RaylibImage src, RaylibRectangle srcRec,
         //    [x] Optimize RaylibColorAlphaBlend() for faster operations (maybe avoiding divs?)
         //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
         //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
+        //    [x] Consider fast path: RGBA8 destination -> convert source rows and blend 4 pixels at once
         //    [-] RaylibGetPixelColor(): Get RaylibVector4 instead of RaylibColor, easier for RaylibColorAlphaBlend()
-        //    [ ] Support f32bit channels drawing
+        //    [x] Support f32bit channels drawing (R32G32B32A32 destination)
 
-        // TODO: Support RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32 and PIXELFORMAT_UNCOMPRESSED_R1616B16A16
+        // TODO: Support PIXELFORMAT_UNCOMPRESSED_R1616B16A16 destination with half-float precision
 
         RaylibColor colSrc, colDst, blend;
         bool blendRequired = true;
@@ -4003,6 +4030,8 @@ void RaylibImageDraw(RaylibImage *dst, RaylibImage src, RaylibRectangle srcRec,
         unsigned char *pSrcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
         unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
 
+        unsigned char rowBuffer[IMAGE_DRAW_ROW_PIXELS*4] = { 0 };   // Source pixels converted to RGBA8
+
         for (int y = 0; y < (int)srcRec.height; y++)
         {
             unsigned char *pSrc = pSrcBase;
@@ -4010,6 +4039,24 @@ void RaylibImageDraw(RaylibImage *dst, RaylibImage src, RaylibRectangle srcRec,
 
             // Fast path: Avoid moving pixel by pixel if no blend required and same format
             if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
+            else if (dst->format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+            {
+                // Fast path: Convert source row in chunks to RGBA8 and blend/copy them directly
+                for (int x = 0; x < (int)srcRec.width; x += IMAGE_DRAW_ROW_PIXELS)
+                {
+                    int count = (int)srcRec.width - x;
+                    if (count > IMAGE_DRAW_ROW_PIXELS) count = IMAGE_DRAW_ROW_PIXELS;
+
+                    const unsigned char *pixels = LoadPixelsRGBA8(pSrc + x*bytesPerPixelSrc, srcPtr->format, count, rowBuffer);
+
+                    if (blendRequired) BlendPixelsRGBA8(pDst + x*4, pixels, count, tint);
+                    else memcpy(pDst + x*4, pixels, count*4);
+                }
+            }
+            else if (dst->format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)
+            {
+                DrawPixelsR32G32B32A32((float *)pDst, pSrc, srcPtr->format, (int)srcRec.width, tint, blendRequired);
+            }
             else
             {
                 for (int x = 0; x < (int)srcRec.width; x++)
@@ -5378,171 +5425,1387 @@ int RaylibGetPixelDataSize(int width, int height, int format)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
-// Convert half-float (stored as unsigned short) to float
-// REF: https://stackoverflow.com/questions/1659440/32-bit-to-16-bit-floating-point-conversion/60047308#60047308
-static float HalfToFloat(unsigned short x)
+// Resize 8bit per channel pixels (1 to 4 channels), output is split in bands over worker threads
+// NOTE: Uses stb default scaling filters, same output as stbir_resize_uint8_linear()
+// Returns false if stb samplers could not be built, output is not written in that case
+static bool ResizePixelsLinear(const unsigned char *input, int width, int height, unsigned char *output, int newWidth, int newHeight, int channels)
 {
-    float result = 0.0f;
+    STBIR_RESIZE resize = { 0 };
+    stbir_resize_init(&resize, input, width, height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)channels, STBIR_TYPE_UINT8);
 
-    const unsigned int e = (x & 0x7C00) >> 10; // Exponent
-    const unsigned int m = (x & 0x03FF) << 13; // Mantissa
-    const float fm = (float)m;
-    const unsigned int v = (*(unsigned int*)&fm) >> 23; // Evil log2 bit hack to count leading zeros in denormalized format
-    const unsigned int r = (x & 0x8000) << 16 | (e != 0)*((e + 112) << 23 | m) | ((e == 0)&(m != 0))*((v - 37) << 23 | ((m << (150 - v)) & 0x007FE000)); // sign : normalized : denormalized
+    int splits = (newWidth*newHeight)/RAYLIB_IMAGE_RESIZE_BATCH_PIXELS;
+    if (splits > GetWorkerThreadCount()) splits = GetWorkerThreadCount();
 
-    result = *(float *)&r;
+    if (splits > 1)
+    {
+        splits = stbir_build_samplers_with_splits(&resize, splits);
+        if (splits == 0) return false;      // Samplers allocation failed, nothing to free
 
-    return result;
+        ParallelFor(splits, 1, ResizePixelSplits, &resize);
+        stbir_free_samplers(&resize);
+
+        return true;
+    }
+    else return (stbir_resize_extended(&resize) != 0);
 }
 
-// Convert float to half-float (stored as unsigned short)
-static unsigned short FloatToHalf(float x)
+// Resize a range of splits (STBIR_RESIZE)
+static void ResizePixelSplits(void *userData, int start, int end)
 {
-    unsigned short result = 0;
+    stbir_resize_extended_split((STBIR_RESIZE *)userData, start, end - start);
+}
 
-    const unsigned int b = (*(unsigned int*) & x) + 0x00001000; // Round-to-nearest-even: add last bit after truncated mantissa
-    const unsigned int e = (b & 0x7F800000) >> 23; // Exponent
-    const unsigned int m = b & 0x007FFFFF; // Mantissa; in line below: 0x007FF000 = 0x00800000-0x00001000 = decimal indicator flag - initial rounding
+// Resize a range of output rows (ResizeNNJob)
+static void ResizePixelRowsNN(void *userData, int start, int end)
+{
+    const ResizeNNJob *job = (const ResizeNNJob *)userData;
+    const int bpp = job->bytesPerPixel;
 
-    result = (b & 0x80000000) >> 16 | (e > 112)*((((e - 112) << 10) & 0x7C00) | m >> 13) | ((e < 113) & (e > 101))*((((0x007FF000 + m) >> (125 - e)) + 1) >> 1) | (e > 143)*0x7FFF; // sign : normalized : denormalized : saturate
+    for (int y = start; y < end; y++)
+    {
+        const unsigned char *inputRow = job->input + (size_t)((y*job->yRatio) >> 16)*job->width*bpp;
+        unsigned char *outputRow = job->output + (size_t)y*job->newWidth*bpp;
 
-    return result;
+        if (bpp == 4)
+        {
+            for (int x = 0; x < job->newWidth; x++) memcpy(outputRow + x*4, inputRow + ((x*job->xRatio) >> 16)*4, 4);
+        }
+        else
+        {
+            for (int x = 0; x < job->newWidth; x++) memcpy(outputRow + x*bpp, inputRow + ((x*job->xRatio) >> 16)*bpp, bpp);
+        }
+    }
 }
 
-// Get pixel data from image as RaylibVector4 array (float normalized)
-static RaylibVector4 *LoadImageDataNormalized(RaylibImage image)
+// Box blur a range of rows horizontally (BlurJob), pixels -> blurred
+// NOTE: Window is shrunk on image borders, sums are kept in float in the same order as the reference loop
+static void BlurPixelRows(void *userData, int start, int end)
 {
-    RaylibVector4 *pixels = (RaylibVector4 *)RL_MALLOC(image.width*image.height*sizeof(RaylibVector4));
+    const BlurJob *job = (const BlurJob *)userData;
+    const int width = job->width;
+    const int blurSize = job->blurSize;
+    const int initSize = (blurSize < width)? blurSize : width;
 
-    if (image.format >= RAYLIB_PIXELFORMAT_COMPRESSED_DXT1_RGB) RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
-    else
+    float *row = RL_MALLOC(width*4*sizeof(float));
+
+    for (int y = start; y < end; y++)
     {
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        float *blurred = job->blurred + (size_t)y*width*4;
+        int convolutionSize = initSize;
+
+        memset(row, 0, width*4*sizeof(float));
+        AccumulateValuesU8(row, (const unsigned char *)(job->pixels + (size_t)y*width), 1.0f, width*4);
+
+#if defined(IMAGE_SIMD_SSE2)
+        __m128 sum = _mm_setzero_ps();
+
+        for (int i = 0; i < initSize; i++) sum = _mm_add_ps(sum, _mm_loadu_ps(row + i*4));
+
+        for (int x = 0; x < width; x++)
         {
-            switch (image.format)
+            if (x - blurSize - 1 >= 0)
             {
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].w = 1.0f;
+                sum = _mm_sub_ps(sum, _mm_loadu_ps(row + (x - blurSize - 1)*4));
+                convolutionSize--;
+            }
 
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+            if (x + blurSize < width)
+            {
+                sum = _mm_add_ps(sum, _mm_loadu_ps(row + (x + blurSize)*4));
+                convolutionSize++;
+            }
 
-                    k += 2;
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+            _mm_storeu_ps(blurred + x*4, _mm_div_ps(sum, _mm_set1_ps((float)convolutionSize)));
+        }
+#else
+        float sum[4] = { 0 };
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
-                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
-                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+        for (int i = 0; i < initSize; i++)
+        {
+            for (int c = 0; c < 4; c++) sum[c] += row[i*4 + c];
+        }
 
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+        for (int x = 0; x < width; x++)
+        {
+            if (x - blurSize - 1 >= 0)
+            {
+                for (int c = 0; c < 4; c++) sum[c] -= row[(x - blurSize - 1)*4 + c];
+                convolutionSize--;
+            }
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
-                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
-                    pixels[i].w = 1.0f;
+            if (x + blurSize < width)
+            {
+                for (int c = 0; c < 4; c++) sum[c] += row[(x + blurSize)*4 + c];
+                convolutionSize++;
+            }
 
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+            for (int c = 0; c < 4; c++) blurred[x*4 + c] = sum[c]/convolutionSize;
+        }
+#endif
+    }
 
-                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
-                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
-                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
-                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+    RL_FREE(row);
+}
 
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+// Box blur a range of columns vertically (BlurJob), blurred -> pixels (truncated to 8 bit)
+// NOTE: Columns are processed row by row to keep memory access sequential
+static void BlurPixelColumns(void *userData, int start, int end)
+{
+    const BlurJob *job = (const BlurJob *)userData;
+    const int stride = job->width*4;
+    const int count = (end - start)*4;
+    const int blurSize = job->blurSize;
+    const int initSize = (blurSize < job->height)? blurSize : job->height;
 
-                    k += 4;
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = 1.0f;
+    const float *blurred = job->blurred + start*4;
+    unsigned char *pixels = (unsigned char *)(job->pixels + start);
 
-                    k += 3;
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
+    float *sum = RL_CALLOC(count*2, sizeof(float));
+    float *average = sum + count;
+    int convolutionSize = initSize;
 
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = 1.0f;
+    for (int i = 0; i < initSize; i++) AccumulateValuesF32(sum, blurred + (size_t)i*stride, 1.0f, count);
 
-                    k += 3;
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = ((float *)image.data)[k + 3];
+    for (int y = 0; y < job->height; y++)
+    {
+        if (y - blurSize - 1 >= 0)
+        {
+            AccumulateValuesF32(sum, blurred + (size_t)(y - blurSize - 1)*stride, -1.0f, count);
+            convolutionSize--;
+        }
 
-                    k += 4;
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
-                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
-                    pixels[i].w = 1.0f;
+        if (y + blurSize < job->height)
+        {
+            AccumulateValuesF32(sum, blurred + (size_t)(y + blurSize)*stride, 1.0f, count);
+            convolutionSize++;
+        }
 
-                    k += 3;
-                } break;
-                case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
-                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
-                    pixels[i].w = HalfToFloat(((unsigned short *)image.data)[k + 3]);
+        for (int i = 0; i < count; i++) average[i] = sum[i]/convolutionSize;
 
-                    k += 4;
-                } break;
-                default: break;
-            }
+        StoreValuesU8(pixels + (size_t)y*stride, average, count);
+    }
+
+    RL_FREE(sum);
+}
+
+// Get separable kernel factors: kernel[i*kernelWidth + j] = columnKernel[i]*rowKernel[j]
+// NOTE: Factors are taken from the row and column of the largest kernel value and validated
+// against every kernel value, returns false if kernel is not rank 1 (within float tolerance)
+static bool GetKernelFactors(const float *kernel, int kernelWidth, float *columnKernel, float *rowKernel)
+{
+    int pivot = 0;
+    float maxValue = 0.0f;
+
+    for (int i = 0; i < kernelWidth*kernelWidth; i++)
+    {
+        if (fabsf(kernel[i]) > maxValue)
+        {
+            maxValue = fabsf(kernel[i]);
+            pivot = i;
         }
     }
 
-    return pixels;
+    if (maxValue == 0.0f) return false;
+
+    int pivotRow = pivot/kernelWidth;
+    int pivotColumn = pivot%kernelWidth;
+
+    for (int j = 0; j < kernelWidth; j++) rowKernel[j] = kernel[pivotRow*kernelWidth + j];
+    for (int i = 0; i < kernelWidth; i++) columnKernel[i] = kernel[i*kernelWidth + pivotColumn]/kernel[pivot];
+
+    for (int i = 0; i < kernelWidth; i++)
+    {
+        for (int j = 0; j < kernelWidth; j++)
+        {
+            if (fabsf(columnKernel[i]*rowKernel[j] - kernel[i*kernelWidth + j]) > maxValue*1e-5f) return false;
+        }
+    }
+
+    return true;
+}
+
+// Convolve a range of output rows (ConvolutionJob)
+// NOTE: Kernel tap i is applied at offset (i - kernelWidth/2), rows are accumulated in float
+// over a zero padded row buffer, so taps outside image contribute nothing
+static void ConvolvePixelRows(void *userData, int start, int end)
+{
+    const ConvolutionJob *job = (const ConvolutionJob *)userData;
+    const int kernelWidth = job->kernelWidth;
+    const int kernelStart = -kernelWidth/2;
+    const int values = job->width*4;
+    const int padding = kernelWidth*4;
+
+    float *acc = RL_MALLOC(values*sizeof(float));
+    float *row = RL_CALLOC(values + 2*padding, sizeof(float));
+
+    for (int y = start; y < end; y++)
+    {
+        memset(acc, 0, values*sizeof(float));
+
+        if (job->kernel == NULL)
+        {
+            // Vertical pass: weighted sum of 8 bit rows into padded float row
+            memset(row + padding, 0, values*sizeof(float));
+
+            for (int i = 0; i < kernelWidth; i++)
+            {
+                int srcY = y + kernelStart + i;
+
+                if ((srcY >= 0) && (srcY < job->height) && (job->columnKernel[i] != 0.0f))
+                {
+                    AccumulateValuesU8(row + padding, job->input + (size_t)srcY*values, job->columnKernel[i], values);
+                }
+            }
+
+            // Horizontal pass: weighted sum of shifted float row
+            for (int j = 0; j < kernelWidth; j++)
+            {
+                if (job->rowKernel[j] != 0.0f) AccumulateValuesF32(acc, row + padding + (kernelStart + j)*4, job->rowKernel[j], values);
+            }
+        }
+        else
+        {
+            for (int i = 0; i < kernelWidth; i++)
+            {
+                int srcY = y + kernelStart + i;
+                if ((srcY < 0) || (srcY >= job->height)) continue;
+
+                memset(row + padding, 0, values*sizeof(float));
+                AccumulateValuesU8(row + padding, job->input + (size_t)srcY*values, 1.0f, values);
+
+                for (int j = 0; j < kernelWidth; j++)
+                {
+                    float weight = job->kernel[i*kernelWidth + j];
+                    if (weight != 0.0f) AccumulateValuesF32(acc, row + padding + (kernelStart + j)*4, weight, values);
+                }
+            }
+        }
+
+        StoreValuesU8(job->output + (size_t)y*values, acc, values);
+    }
+
+    RL_FREE(acc);
+    RL_FREE(row);
+}
+
+// Accumulate weighted 8 bit values: acc[i] += values[i]*weight
+static void AccumulateValuesU8(float *acc, const unsigned char *values, float weight, int count)
+{
+    int i = 0;
+
+#if defined(IMAGE_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 w = _mm_set1_ps(weight);
+
+    for (; (i + 16) <= count; i += 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(values + i));
+        __m128i lo = _mm_unpacklo_epi8(v, zero);
+        __m128i hi = _mm_unpackhi_epi8(v, zero);
+
+        _mm_storeu_ps(acc + i, _mm_add_ps(_mm_loadu_ps(acc + i), _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), w)));
+        _mm_storeu_ps(acc + i + 4, _mm_add_ps(_mm_loadu_ps(acc + i + 4), _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), w)));
+        _mm_storeu_ps(acc + i + 8, _mm_add_ps(_mm_loadu_ps(acc + i + 8), _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), w)));
+        _mm_storeu_ps(acc + i + 12, _mm_add_ps(_mm_loadu_ps(acc + i + 12), _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), w)));
+    }
+#elif defined(IMAGE_SIMD_NEON)
+    const float32x4_t w = vdupq_n_f32(weight);
+
+    for (; (i + 16) <= count; i += 16)
+    {
+        uint8x16_t v = vld1q_u8(values + i);
+        uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+        uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+
+        vst1q_f32(acc + i, vmlaq_f32(vld1q_f32(acc + i), vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))), w));
+        vst1q_f32(acc + i + 4, vmlaq_f32(vld1q_f32(acc + i + 4), vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo))), w));
+        vst1q_f32(acc + i + 8, vmlaq_f32(vld1q_f32(acc + i + 8), vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))), w));
+        vst1q_f32(acc + i + 12, vmlaq_f32(vld1q_f32(acc + i + 12), vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi))), w));
+    }
+#endif
+
+    for (; i < count; i++) acc[i] += (float)values[i]*weight;
+}
+
+// Accumulate weighted float values: acc[i] += values[i]*weight
+static void AccumulateValuesF32(float *acc, const float *values, float weight, int count)
+{
+    int i = 0;
+
+#if defined(IMAGE_SIMD_SSE2)
+    const __m128 w = _mm_set1_ps(weight);
+
+    for (; (i + 4) <= count; i += 4) _mm_storeu_ps(acc + i, _mm_add_ps(_mm_loadu_ps(acc + i), _mm_mul_ps(_mm_loadu_ps(values + i), w)));
+#elif defined(IMAGE_SIMD_NEON)
+    const float32x4_t w = vdupq_n_f32(weight);
+
+    for (; (i + 4) <= count; i += 4) vst1q_f32(acc + i, vmlaq_f32(vld1q_f32(acc + i), vld1q_f32(values + i), w));
+#endif
+
+    for (; i < count; i++) acc[i] += values[i]*weight;
+}
+
+// Store float values as 8 bit values, clamped to [0..255] and truncated
+static void StoreValuesU8(unsigned char *values, const float *acc, int count)
+{
+    int i = 0;
+
+#if defined(IMAGE_SIMD_SSE2)
+    const __m128 minValue = _mm_setzero_ps();
+    const __m128 maxValue = _mm_set1_ps(255.0f);
+
+    for (; (i + 16) <= count; i += 16)
+    {
+        __m128i v0 = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(acc + i), minValue), maxValue));
+        __m128i v1 = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(acc + i + 4), minValue), maxValue));
+        __m128i v2 = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(acc + i + 8), minValue), maxValue));
+        __m128i v3 = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(acc + i + 12), minValue), maxValue));
+
+        _mm_storeu_si128((__m128i *)(values + i), _mm_packus_epi16(_mm_packs_epi32(v0, v1), _mm_packs_epi32(v2, v3)));
+    }
+#elif defined(IMAGE_SIMD_NEON)
+    const float32x4_t minValue = vdupq_n_f32(0.0f);
+    const float32x4_t maxValue = vdupq_n_f32(255.0f);
+
+    for (; (i + 8) <= count; i += 8)
+    {
+        uint32x4_t v0 = vcvtq_u32_f32(vminq_f32(vmaxq_f32(vld1q_f32(acc + i), minValue), maxValue));
+        uint32x4_t v1 = vcvtq_u32_f32(vminq_f32(vmaxq_f32(vld1q_f32(acc + i + 4), minValue), maxValue));
+
+        vst1_u8(values + i, vmovn_u16(vcombine_u16(vmovn_u32(v0), vmovn_u32(v1))));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float value = acc[i];
+
+        if (value < 0.0f) value = 0.0f;
+        else if (value > 255.0f) value = 255.0f;
+
+        values[i] = (unsigned char)value;
+    }
+}
+
+// Get pixels as RGBA8
+// NOTE: RGBA8 pixels are returned as is, otherwise buffer (count*4 bytes) is filled and returned
+static const unsigned char *LoadPixelsRGBA8(const unsigned char *pixels, int format, int count, unsigned char *buffer)
+{
+    if (format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) return pixels;
+
+    ConvertPixels(pixels, format, buffer, RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, count);
+
+    return buffer;
+}
+
+// Get pixels as RGBA8 colors, same values as RaylibLoadImageColors()
+// NOTE: 5/6 bit channels are expanded multiplying by (255/31) and (255/63) and single channel float formats
+// are loaded into red, as RaylibLoadImageColors() does, ConvertPixels() scales to full range and gray instead
+static const unsigned char *LoadPixelsColors(const unsigned char *pixels, int format, int count, unsigned char *buffer)
+{
+    const unsigned short *src = (const unsigned short *)pixels;
+
+    switch (format)
+    {
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                buffer[i*4] = (unsigned char)((src[i] >> 11)*(255/31));
+                buffer[i*4 + 1] = (unsigned char)(((src[i] >> 5) & 0b0000000000111111)*(255/63));
+                buffer[i*4 + 2] = (unsigned char)((src[i] & 0b0000000000011111)*(255/31));
+                buffer[i*4 + 3] = 255;
+            }
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                buffer[i*4] = (unsigned char)((src[i] >> 11)*(255/31));
+                buffer[i*4 + 1] = (unsigned char)(((src[i] >> 6) & 0b0000000000011111)*(255/31));
+                buffer[i*4 + 2] = (unsigned char)(((src[i] >> 1) & 0b0000000000011111)*(255/31));
+                buffer[i*4 + 3] = (src[i] & 0b0000000000000001)? 255 : 0;
+            }
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32:
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R16:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                float value = (format == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32)? ((const float *)pixels)[i] : HalfToFloat(src[i]);
+
+                buffer[i*4] = (unsigned char)(value*255.0f);
+                buffer[i*4 + 1] = 0;
+                buffer[i*4 + 2] = 0;
+                buffer[i*4 + 3] = 255;
+            }
+        } break;
+        default: return LoadPixelsRGBA8(pixels, format, count, buffer);
+    }
+
+    return buffer;
+}
+
+// Blend tinted RGBA8 pixels over RGBA8 pixels
+// NOTE: Output matches RaylibColorAlphaBlend() per pixel exactly, SSE2 path processes 4 pixels at once
+// using float math where every intermediate value is an integer below 2^24 (exactly representable)
+static void BlendPixelsRGBA8(unsigned char *dst, const unsigned char *src, int count, RaylibColor tint)
+{
+    int i = 0;
+
+#if defined(IMAGE_SIMD_SSE2)
+    const bool tinted = ((tint.r & tint.g & tint.b & tint.a) != 255);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i tintFactor = _mm_setr_epi16(tint.r + 1, tint.g + 1, tint.b + 1, tint.a + 1, tint.r + 1, tint.g + 1, tint.b + 1, tint.a + 1);
+    const __m128i alphaMask = _mm_set1_epi32((int)0xff000000);
+    const __m128i channelMask = _mm_set1_epi32(0xff);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(256.0f);
+    const __m128 invScale = _mm_set1_ps(1.0f/256.0f);
+
+    for (; (i + 4) <= count; i += 4)
+    {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + i*4));
+
+        // Apply tint: c = (c*(tint + 1)) >> 8
+        if (tinted)
+        {
+            __m128i lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), tintFactor), 8);
+            __m128i hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), tintFactor), 8);
+            s = _mm_packus_epi16(lo, hi);
+        }
+
+        __m128i srcAlpha = _mm_and_si128(s, alphaMask);
+        __m128i opaque = _mm_cmpeq_epi32(srcAlpha, alphaMask);
+        __m128i transparent = _mm_cmpeq_epi32(srcAlpha, zero);
+
+        if (_mm_movemask_ps(_mm_castsi128_ps(transparent)) == 0xf) continue;
+
+        __m128i d = _mm_loadu_si128((const __m128i *)(dst + i*4));
+        __m128i result = s;
+
+        if (_mm_movemask_ps(_mm_castsi128_ps(opaque)) != 0xf)
+        {
+            __m128 alpha = _mm_add_ps(_mm_cvtepi32_ps(_mm_srli_epi32(s, 24)), one);
+            __m128 dstWeight = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(d, 24)), _mm_sub_ps(scale, alpha));
+            __m128 srcWeight = _mm_mul_ps(alpha, scale);
+            __m128i outAlpha = _mm_cvttps_epi32(_mm_mul_ps(_mm_add_ps(srcWeight, dstWeight), invScale));
+            __m128 divisor = _mm_mul_ps(_mm_cvtepi32_ps(outAlpha), scale);
+
+            __m128i blend = _mm_slli_epi32(outAlpha, 24);
+
+            for (int c = 0; c < 3; c++)
+            {
+                __m128 srcChannel = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(s, c*8), channelMask));
+                __m128 dstChannel = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(d, c*8), channelMask));
+                __m128 sum = _mm_add_ps(_mm_mul_ps(srcChannel, srcWeight), _mm_mul_ps(dstChannel, dstWeight));
+
+                // Integer division result, corrected in case division rounding crossed an integer
+                __m128 q = _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_div_ps(sum, divisor)));
+                q = _mm_sub_ps(q, _mm_and_ps(_mm_cmpgt_ps(_mm_mul_ps(q, divisor), sum), one));
+                q = _mm_add_ps(q, _mm_and_ps(_mm_cmple_ps(_mm_mul_ps(_mm_add_ps(q, one), divisor), sum), one));
+
+                // NOTE: Result is wrapped to 8 bit, same as unsigned char cast on RaylibColorAlphaBlend()
+                blend = _mm_or_si128(blend, _mm_slli_epi32(_mm_and_si128(_mm_cvttps_epi32(q), channelMask), c*8));
+            }
+
+            result = _mm_or_si128(_mm_and_si128(opaque, s), _mm_andnot_si128(opaque, blend));
+        }
+
+        result = _mm_or_si128(_mm_and_si128(transparent, d), _mm_andnot_si128(transparent, result));
+        _mm_storeu_si128((__m128i *)(dst + i*4), result);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        RaylibColor colSrc, colDst;
+        memcpy(&colSrc, src + i*4, 4);
+        memcpy(&colDst, dst + i*4, 4);
+
+        RaylibColor blend = RaylibColorAlphaBlend(colDst, colSrc, tint);
+        memcpy(dst + i*4, &blend, 4);
+    }
+}
+
+// Draw pixels over R32G32B32A32 pixels, blending in float precision
+// NOTE: Float sources keep full precision, other formats go through RaylibGetPixelColor()
+static void DrawPixelsR32G32B32A32(float *dst, const unsigned char *src, int srcFormat, int count, RaylibColor tint, bool blend)
+{
+    const RaylibVector4 ftint = { tint.r/255.0f, tint.g/255.0f, tint.b/255.0f, tint.a/255.0f };
+    const int bytesPerPixel = RaylibGetPixelDataSize(1, 1, srcFormat);
+    const float *values = (const float *)src;
+
+    for (int i = 0; i < count; i++, dst += 4)
+    {
+        RaylibVector4 fsrc = { 0.0f, 0.0f, 0.0f, 1.0f };
+
+        switch (srcFormat)
+        {
+            case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: fsrc = (RaylibVector4){ values[i*4], values[i*4 + 1], values[i*4 + 2], values[i*4 + 3] }; break;
+            case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32G32B32: fsrc = (RaylibVector4){ values[i*3], values[i*3 + 1], values[i*3 + 2], 1.0f }; break;
+            case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32: fsrc = (RaylibVector4){ values[i], values[i], values[i], 1.0f }; break;
+            default:
+            {
+                RaylibColor color = RaylibGetPixelColor((void *)(src + i*bytesPerPixel), srcFormat);
+                fsrc = (RaylibVector4){ color.r/255.0f, color.g/255.0f, color.b/255.0f, color.a/255.0f };
+            } break;
+        }
+
+        if (blend)
+        {
+            fsrc.x *= ftint.x;
+            fsrc.y *= ftint.y;
+            fsrc.z *= ftint.z;
+            fsrc.w *= ftint.w;
+
+            if (fsrc.w <= 0.0f) continue;
+            else if (fsrc.w < 1.0f)
+            {
+                float dstWeight = dst[3]*(1.0f - fsrc.w);
+                float outAlpha = fsrc.w + dstWeight;
+
+                // NOTE: outAlpha > 0.0f, source alpha is positive
+                fsrc.x = (fsrc.x*fsrc.w + dst[0]*dstWeight)/outAlpha;
+                fsrc.y = (fsrc.y*fsrc.w + dst[1]*dstWeight)/outAlpha;
+                fsrc.z = (fsrc.z*fsrc.w + dst[2]*dstWeight)/outAlpha;
+                fsrc.w = outAlpha;
+            }
+        }
+
+        dst[0] = fsrc.x;
+        dst[1] = fsrc.y;
+        dst[2] = fsrc.z;
+        dst[3] = fsrc.w;
+    }
+}
+
+// Convert pixels between uncompressed formats, in place if destination pixels are not bigger than source pixels
+// NOTE: Common formats pairs use direct kernels, any other pair is decoded to RGBA8 (or RGBA32F if any of
+// the formats is float based) and encoded again in blocks, no full image temporary buffer is required
+static void ConvertPixels(const unsigned char *src, int srcFormat, unsigned char *dst, int dstFormat, int count)
+{
+    if (ConvertPixelsDirect(src, srcFormat, dst, dstFormat, count)) return;
+
+    const int srcBytesPerPixel = RaylibGetPixelDataSize(1, 1, srcFormat);
+    const int dstBytesPerPixel = RaylibGetPixelDataSize(1, 1, dstFormat);
+    const bool floatFormat = ((srcFormat >= RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32) || (dstFormat >= RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32));
+
+    for (int i = 0; i < count; i += IMAGE_FORMAT_BLOCK_PIXELS)
+    {
+        int blockCount = ((count - i) < IMAGE_FORMAT_BLOCK_PIXELS)? (count - i) : IMAGE_FORMAT_BLOCK_PIXELS;
+        const unsigned char *srcBlock = src + (size_t)i*srcBytesPerPixel;
+        unsigned char *dstBlock = dst + (size_t)i*dstBytesPerPixel;
+
+        if (floatFormat)
+        {
+            float block[IMAGE_FORMAT_BLOCK_PIXELS*4];
+
+            DecodePixelsRGBA32F(srcBlock, srcFormat, block, blockCount);
+            EncodePixelsRGBA32F(block, dstBlock, dstFormat, blockCount);
+        }
+        else
+        {
+            unsigned char block[IMAGE_FORMAT_BLOCK_PIXELS*4];
+
+            DecodePixelsRGBA8(srcBlock, srcFormat, block, blockCount);
+            EncodePixelsRGBA8(block, dstBlock, dstFormat, blockCount);
+        }
+    }
+}
+
+// Convert pixels with a direct kernel, false if formats pair has no kernel
+// NOTE: Kernels write every pixel after reading it, so they are safe in place when destination pixels are not bigger
+static bool ConvertPixelsDirect(const unsigned char *src, int srcFormat, unsigned char *dst, int dstFormat, int count)
+{
+    int i = 0;
+
+    if ((srcFormat == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (dstFormat == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8))
+    {
+    #if defined(IMAGE_SIMD_NEON)
+        for (; (i + 16) <= count; i += 16)
+        {
+            uint8x16x4_t rgba = vld4q_u8(src + i*4);
+            uint8x16x3_t rgb = { { rgba.val[0], rgba.val[1], rgba.val[2] } };
+
+            vst3q_u8(dst + i*3, rgb);
+        }
+    #endif
+        // Process 4 pixels as 32 bit words (little endian), 16 bytes packed into 12 bytes
+        for (; (i + 4) <= count; i += 4)
+        {
+            unsigned int p[4] = { 0 };
+            memcpy(p, src + i*4, 16);
+
+            unsigned int packed[3] = { (p[0] & 0xffffff) | (p[1] << 24), ((p[1] >> 8) & 0xffff) | (p[2] << 16), ((p[2] >> 16) & 0xff) | (p[3] << 8) };
+            memcpy(dst + i*3, packed, 12);
+        }
+
+        for (; i < count; i++)
+        {
+            dst[i*3] = src[i*4];
+            dst[i*3 + 1] = src[i*4 + 1];
+            dst[i*3 + 2] = src[i*4 + 2];
+        }
+    }
+    else if ((srcFormat == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8) && (dstFormat == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    {
+    #if defined(IMAGE_SIMD_NEON)
+        for (; (i + 16) <= count; i += 16)
+        {
+            uint8x16x3_t rgb = vld3q_u8(src + i*3);
+            uint8x16x4_t rgba = { { rgb.val[0], rgb.val[1], rgb.val[2], vdupq_n_u8(255) } };
+
+            vst4q_u8(dst + i*4, rgba);
+        }
+    #endif
+        // Process 4 pixels as 32 bit words (little endian), 12 bytes unpacked into 16 bytes
+        for (; (i + 4) <= count; i += 4)
+        {
+            unsigned int p[3] = { 0 };
+            memcpy(p, src + i*3, 12);
+
+            unsigned int unpacked[4] = { p[0] | 0xff000000, (p[0] >> 24) | (p[1] << 8) | 0xff000000, (p[1] >> 16) | (p[2] << 16) | 0xff000000, (p[2] >> 8) | 0xff000000 };
+            memcpy(dst + i*4, unpacked, 16);
+        }
+
+        for (; i < count; i++)
+        {
+            dst[i*4] = src[i*3];
+            dst[i*4 + 1] = src[i*3 + 1];
+            dst[i*4 + 2] = src[i*3 + 2];
+            dst[i*4 + 3] = 255;
+        }
+    }
+    else if ((srcFormat == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (dstFormat == RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE))
+    {
+    #if defined(IMAGE_SIMD_SSE2)
+        // Red and blue, green and alpha channels are split in 16 bit lanes and multiplied-added by weights
+        const __m128i mask = _mm_set1_epi32(0x00ff00ff);
+        const __m128i redBlueWeights = _mm_set1_epi32((3735 << 16) | 9798);
+        const __m128i greenWeights = _mm_set1_epi32(19235);
+
+        for (; (i + 16) <= count; i += 16)
+        {
+            __m128i gray[4];
+
+            for (int k = 0; k < 4; k++)
+            {
+                __m128i v = _mm_loadu_si128((const __m128i *)(src + (i + k*4)*4));
+                __m128i sum = _mm_add_epi32(_mm_madd_epi16(_mm_and_si128(v, mask), redBlueWeights), _mm_madd_epi16(_mm_and_si128(_mm_srli_epi32(v, 8), mask), greenWeights));
+
+                gray[k] = _mm_srli_epi32(sum, 15);
+            }
+
+            _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(_mm_packs_epi32(gray[0], gray[1]), _mm_packs_epi32(gray[2], gray[3])));
+        }
+    #elif defined(IMAGE_SIMD_NEON)
+        for (; (i + 8) <= count; i += 8)
+        {
+            uint8x8x4_t v = vld4_u8(src + i*4);
+
+            uint32x4_t lo = vmull_n_u16(vget_low_u16(vmovl_u8(v.val[0])), 9798);
+            uint32x4_t hi = vmull_n_u16(vget_high_u16(vmovl_u8(v.val[0])), 9798);
+            lo = vmlal_n_u16(lo, vget_low_u16(vmovl_u8(v.val[1])), 19235);
+            hi = vmlal_n_u16(hi, vget_high_u16(vmovl_u8(v.val[1])), 19235);
+            lo = vmlal_n_u16(lo, vget_low_u16(vmovl_u8(v.val[2])), 3735);
+            hi = vmlal_n_u16(hi, vget_high_u16(vmovl_u8(v.val[2])), 3735);
+
+            vst1_u8(dst + i, vmovn_u16(vcombine_u16(vshrn_n_u32(lo, 15), vshrn_n_u32(hi, 15))));
+        }
+    #endif
+        for (; i < count; i++) dst[i] = (unsigned char)PIXEL_GRAY_8BIT(src[i*4], src[i*4 + 1], src[i*4 + 2]);
+    }
+    else if ((srcFormat == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) &&
+             ((dstFormat == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G6B5) || (dstFormat == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4)))
+    {
+        const bool rgb565 = (dstFormat == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G6B5);
+        unsigned short *pixels = (unsigned short *)dst;
+
+    #if defined(IMAGE_SIMD_SSE2)
+        // Channels are scaled in 32 bit lanes (one pixel per lane), values fit in 16 bits so _mm_mullo_epi16() is enough
+        const __m128i mask = _mm_set1_epi32(0xff);
+        const __m128i one = _mm_set1_epi32(1);
+        const __m128i bias = _mm_set1_epi32(127);
+        const __m128i redScale = _mm_set1_epi32(rgb565? 31 : 15);
+        const __m128i greenScale = _mm_set1_epi32(rgb565? 63 : 15);
+
+        for (; (i + 8) <= count; i += 8)
+        {
+            __m128i packed[2];
+
+            for (int k = 0; k < 2; k++)
+            {
+                __m128i v = _mm_loadu_si128((const __m128i *)(src + (i + k*4)*4));
+                __m128i channels[4];
+
+                for (int c = 0; c < 4; c++)
+                {
+                    __m128i x = _mm_add_epi32(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi32(v, c*8), mask), (c == 1)? greenScale : redScale), bias);
+                    channels[c] = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(x, _mm_srli_epi32(x, 8)), one), 8);
+                }
+
+                if (rgb565) packed[k] = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(channels[0], 11), _mm_slli_epi32(channels[1], 5)), channels[2]);
+                else packed[k] = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(channels[0], 12), _mm_slli_epi32(channels[1], 8)), _mm_or_si128(_mm_slli_epi32(channels[2], 4), channels[3]));
+
+                // Sign extend 16 bit values, so signed saturation on packing keeps them unchanged
+                packed[k] = _mm_srai_epi32(_mm_slli_epi32(packed[k], 16), 16);
+            }
+
+            _mm_storeu_si128((__m128i *)(pixels + i), _mm_packs_epi32(packed[0], packed[1]));
+        }
+    #elif defined(IMAGE_SIMD_NEON)
+        const uint16x8_t one = vdupq_n_u16(1);
+        const uint16x8_t bias = vdupq_n_u16(127);
+        const unsigned short redScale = rgb565? 31 : 15;
+        const unsigned short greenScale = rgb565? 63 : 15;
+
+        for (; (i + 8) <= count; i += 8)
+        {
+            uint8x8x4_t v = vld4_u8(src + i*4);
+            uint16x8_t channels[4];
+
+            for (int c = 0; c < 4; c++)
+            {
+                uint16x8_t x = vmlaq_n_u16(bias, vmovl_u8(v.val[c]), (c == 1)? greenScale : redScale);
+                channels[c] = vshrq_n_u16(vaddq_u16(vaddq_u16(x, vshrq_n_u16(x, 8)), one), 8);
+            }
+
+            if (rgb565) vst1q_u16(pixels + i, vorrq_u16(vorrq_u16(vshlq_n_u16(channels[0], 11), vshlq_n_u16(channels[1], 5)), channels[2]));
+            else vst1q_u16(pixels + i, vorrq_u16(vorrq_u16(vshlq_n_u16(channels[0], 12), vshlq_n_u16(channels[1], 8)), vorrq_u16(vshlq_n_u16(channels[2], 4), channels[3])));
+        }
+    #endif
+        for (; i < count; i++)
+        {
+            const unsigned char *pixel = src + i*4;
+
+            if (rgb565) pixels[i] = (unsigned short)(PIXEL_SCALE_8BIT(pixel[0], 31) << 11 | PIXEL_SCALE_8BIT(pixel[1], 63) << 5 | PIXEL_SCALE_8BIT(pixel[2], 31));
+            else pixels[i] = (unsigned short)(PIXEL_SCALE_8BIT(pixel[0], 15) << 12 | PIXEL_SCALE_8BIT(pixel[1], 15) << 8 | PIXEL_SCALE_8BIT(pixel[2], 15) << 4 | PIXEL_SCALE_8BIT(pixel[3], 15));
+        }
+    }
+    else if ((srcFormat == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (dstFormat == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32))
+    {
+        float *values = (float *)dst;
+
+    #if defined(IMAGE_SIMD_SSE2)
+        const __m128i zero = _mm_setzero_si128();
+        const __m128 scale = _mm_set1_ps(255.0f);
+
+        for (; (i + 4) <= count; i += 4)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i *)(src + i*4));
+            __m128i lo = _mm_unpacklo_epi8(v, zero);
+            __m128i hi = _mm_unpackhi_epi8(v, zero);
+
+            _mm_storeu_ps(values + i*4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale));
+            _mm_storeu_ps(values + i*4 + 4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale));
+            _mm_storeu_ps(values + i*4 + 8, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale));
+            _mm_storeu_ps(values + i*4 + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale));
+        }
+    #elif defined(IMAGE_SIMD_NEON) && defined(__aarch64__)
+        const float32x4_t scale = vdupq_n_f32(255.0f);
+
+        for (; (i + 4) <= count; i += 4)
+        {
+            uint8x16_t v = vld1q_u8(src + i*4);
+            uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+            uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+
+            vst1q_f32(values + i*4, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))), scale));
+            vst1q_f32(values + i*4 + 4, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo))), scale));
+            vst1q_f32(values + i*4 + 8, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))), scale));
+            vst1q_f32(values + i*4 + 12, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi))), scale));
+        }
+    #endif
+        for (i *= 4; i < count*4; i++) values[i] = (float)src[i]/255.0f;
+    }
+    else if ((srcFormat == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32) && (dstFormat == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    {
+        const float *values = (const float *)src;
+
+    #if defined(IMAGE_SIMD_SSE2)
+        const __m128 minValue = _mm_setzero_ps();
+        const __m128 maxValue = _mm_set1_ps(255.0f);
+
+        for (; (i + 4) <= count; i += 4)
+        {
+            __m128i v0 = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(values + i*4), maxValue), minValue), maxValue));
+            __m128i v1 = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(values + i*4 + 4), maxValue), minValue), maxValue));
+            __m128i v2 = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(values + i*4 + 8), maxValue), minValue), maxValue));
+            __m128i v3 = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(values + i*4 + 12), maxValue), minValue), maxValue));
+
+            _mm_storeu_si128((__m128i *)(dst + i*4), _mm_packus_epi16(_mm_packs_epi32(v0, v1), _mm_packs_epi32(v2, v3)));
+        }
+    #elif defined(IMAGE_SIMD_NEON)
+        const float32x4_t minValue = vdupq_n_f32(0.0f);
+        const float32x4_t maxValue = vdupq_n_f32(255.0f);
+
+        for (; (i + 2) <= count; i += 2)
+        {
+            uint32x4_t v0 = vcvtq_u32_f32(vminq_f32(vmaxq_f32(vmulq_f32(vld1q_f32(values + i*4), maxValue), minValue), maxValue));
+            uint32x4_t v1 = vcvtq_u32_f32(vminq_f32(vmaxq_f32(vmulq_f32(vld1q_f32(values + i*4 + 4), maxValue), minValue), maxValue));
+
+            vst1_u8(dst + i*4, vmovn_u16(vcombine_u16(vmovn_u32(v0), vmovn_u32(v1))));
+        }
+    #endif
+        for (i *= 4; i < count*4; i++)
+        {
+            float value = values[i]*255.0f;
+            dst[i] = (unsigned char)((value > 0.0f)? ((value < 255.0f)? value : 255.0f) : 0.0f);
+        }
+    }
+    else if ((srcFormat == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (dstFormat == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16))
+    {
+        // Only 256 different values, half-float conversion is done through a lookup table
+        unsigned short halfValues[256] = { 0 };
+        for (int k = 0; k < 256; k++) halfValues[k] = FloatToHalf((float)k/255.0f);
+
+        unsigned short *values = (unsigned short *)dst;
+        for (i *= 4; i < count*4; i++) values[i] = halfValues[src[i]];
+    }
+    else if ((srcFormat == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16) && (dstFormat == RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    {
+        const unsigned short *values = (const unsigned short *)src;
+
+    #if defined(IMAGE_SIMD_SSE2)
+        // Half-float to float conversion: exponent and mantissa are shifted into float position and rebased
+        // with a multiply (handling denormals), infinity and NaN are kept as big values, same as HalfToFloat()
+        // REF: https://gist.github.com/rygorous/2156668
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i expMantMask = _mm_set1_epi32(0x7fff);
+        const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23));
+        const __m128 minValue = _mm_setzero_ps();
+        const __m128 maxValue = _mm_set1_ps(255.0f);
+
+        for (; (i + 4) <= count; i += 4)
+        {
+            __m128i converted[4];
+
+            for (int k = 0; k < 2; k++)
+            {
+                __m128i v = _mm_loadu_si128((const __m128i *)(values + i*4 + k*8));
+                __m128i halves[2] = { _mm_unpacklo_epi16(v, zero), _mm_unpackhi_epi16(v, zero) };
+
+                for (int h = 0; h < 2; h++)
+                {
+                    __m128i expMant = _mm_and_si128(halves[h], expMantMask);
+                    __m128i sign = _mm_slli_epi32(_mm_xor_si128(halves[h], expMant), 16);
+                    __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(expMant, 13)), magic);
+                    __m128 value = _mm_or_ps(scaled, _mm_castsi128_ps(sign));
+
+                    converted[k*2 + h] = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(value, maxValue), minValue), maxValue));
+                }
+            }
+
+            _mm_storeu_si128((__m128i *)(dst + i*4), _mm_packus_epi16(_mm_packs_epi32(converted[0], converted[1]), _mm_packs_epi32(converted[2], converted[3])));
+        }
+    #elif defined(IMAGE_SIMD_NEON) && defined(__aarch64__)
+        const float32x4_t minValue = vdupq_n_f32(0.0f);
+        const float32x4_t maxValue = vdupq_n_f32(255.0f);
+
+        for (; (i + 2) <= count; i += 2)
+        {
+            float32x4_t v0 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(values + i*4)));
+            float32x4_t v1 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(values + i*4 + 4)));
+
+            uint32x4_t c0 = vcvtq_u32_f32(vminq_f32(vmaxq_f32(vmulq_f32(v0, maxValue), minValue), maxValue));
+            uint32x4_t c1 = vcvtq_u32_f32(vminq_f32(vmaxq_f32(vmulq_f32(v1, maxValue), minValue), maxValue));
+
+            vst1_u8(dst + i*4, vmovn_u16(vcombine_u16(vmovn_u32(c0), vmovn_u32(c1))));
+        }
+    #endif
+        for (i *= 4; i < count*4; i++)
+        {
+            float value = HalfToFloat(values[i])*255.0f;
+            dst[i] = (unsigned char)((value > 0.0f)? ((value < 255.0f)? value : 255.0f) : 0.0f);
+        }
+    }
+    else return false;
+
+    return true;
+}
+
+// Decode 8 bit per channel (or lower) pixels into RGBA8
+// NOTE: Lower than 8 bit channels are expanded truncating, same as RaylibGetPixelColor()
+static void DecodePixelsRGBA8(const unsigned char *src, int format, unsigned char *rgba, int count)
+{
+    const unsigned short *pixels = (const unsigned short *)src;
+
+    switch (format)
+    {
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                rgba[i*4] = src[i];
+                rgba[i*4 + 1] = src[i];
+                rgba[i*4 + 2] = src[i];
+                rgba[i*4 + 3] = 255;
+            }
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                rgba[i*4] = src[i*2];
+                rgba[i*4 + 1] = src[i*2];
+                rgba[i*4 + 2] = src[i*2];
+                rgba[i*4 + 3] = src[i*2 + 1];
+            }
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                rgba[i*4] = (unsigned char)((pixels[i] >> 11)*255/31);
+                rgba[i*4 + 1] = (unsigned char)(((pixels[i] >> 5) & 0b0000000000111111)*255/63);
+                rgba[i*4 + 2] = (unsigned char)((pixels[i] & 0b0000000000011111)*255/31);
+                rgba[i*4 + 3] = 255;
+            }
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8: ConvertPixelsDirect(src, format, rgba, RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, count); break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                rgba[i*4] = (unsigned char)((pixels[i] >> 11)*255/31);
+                rgba[i*4 + 1] = (unsigned char)(((pixels[i] >> 6) & 0b0000000000011111)*255/31);
+                rgba[i*4 + 2] = (unsigned char)(((pixels[i] >> 1) & 0b0000000000011111)*255/31);
+                rgba[i*4 + 3] = (pixels[i] & 0b0000000000000001)? 255 : 0;
+            }
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                rgba[i*4] = (unsigned char)((pixels[i] >> 12)*255/15);
+                rgba[i*4 + 1] = (unsigned char)(((pixels[i] >> 8) & 0b0000000000001111)*255/15);
+                rgba[i*4 + 2] = (unsigned char)(((pixels[i] >> 4) & 0b0000000000001111)*255/15);
+                rgba[i*4 + 3] = (unsigned char)((pixels[i] & 0b0000000000001111)*255/15);
+            }
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: memcpy(rgba, src, count*4); break;
+        default: break;
+    }
+}
+
+// Encode RGBA8 pixels into 8 bit per channel (or lower) format
+// NOTE: Lower than 8 bit channels are rounded to nearest value
+static void EncodePixelsRGBA8(const unsigned char *rgba, unsigned char *dst, int format, int count)
+{
+    unsigned short *pixels = (unsigned short *)dst;
+
+    switch (format)
+    {
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: ConvertPixelsDirect(rgba, RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, dst, format, count); break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                dst[i*2] = (unsigned char)PIXEL_GRAY_8BIT(rgba[i*4], rgba[i*4 + 1], rgba[i*4 + 2]);
+                dst[i*2 + 1] = rgba[i*4 + 3];
+            }
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                const unsigned char *pixel = rgba + i*4;
+                pixels[i] = (unsigned short)(PIXEL_SCALE_8BIT(pixel[0], 31) << 11 | PIXEL_SCALE_8BIT(pixel[1], 31) << 6 | PIXEL_SCALE_8BIT(pixel[2], 31) << 1 | ((pixel[3] > PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)? 1 : 0));
+            }
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: memcpy(dst, rgba, count*4); break;
+        default: break;
+    }
+}
+
+// Decode pixels into RGBA32F (float normalized)
+// NOTE: Single channel float formats are decoded as grayscale
+static void DecodePixelsRGBA32F(const unsigned char *src, int format, float *rgba, int count)
+{
+    const float *values = (const float *)src;
+    const unsigned short *halfValues = (const unsigned short *)src;
+
+    switch (format)
+    {
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                rgba[i*4] = values[i];
+                rgba[i*4 + 1] = values[i];
+                rgba[i*4 + 2] = values[i];
+                rgba[i*4 + 3] = 1.0f;
+            }
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                rgba[i*4] = values[i*3];
+                rgba[i*4 + 1] = values[i*3 + 1];
+                rgba[i*4 + 2] = values[i*3 + 2];
+                rgba[i*4 + 3] = 1.0f;
+            }
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: memcpy(rgba, src, count*4*sizeof(float)); break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R16:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                float value = HalfToFloat(halfValues[i]);
+
+                rgba[i*4] = value;
+                rgba[i*4 + 1] = value;
+                rgba[i*4 + 2] = value;
+                rgba[i*4 + 3] = 1.0f;
+            }
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                rgba[i*4] = HalfToFloat(halfValues[i*3]);
+                rgba[i*4 + 1] = HalfToFloat(halfValues[i*3 + 1]);
+                rgba[i*4 + 2] = HalfToFloat(halfValues[i*3 + 2]);
+                rgba[i*4 + 3] = 1.0f;
+            }
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            for (int i = 0; i < count*4; i++) rgba[i] = HalfToFloat(halfValues[i]);
+        } break;
+        default:
+        {
+            // 8 bit per channel (or lower) formats are decoded through RGBA8, in chunks
+            const int bytesPerPixel = RaylibGetPixelDataSize(1, 1, format);
+            unsigned char chunk[64*4];
+
+            for (int i = 0; i < count; i += 64)
+            {
+                int chunkCount = ((count - i) < 64)? (count - i) : 64;
+
+                DecodePixelsRGBA8(src + i*bytesPerPixel, format, chunk, chunkCount);
+                ConvertPixelsDirect(chunk, RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, (unsigned char *)(rgba + i*4), RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, chunkCount);
+            }
+        } break;
+    }
+}
+
+// Encode RGBA32F (float normalized) pixels into format
+// NOTE: Single channel float formats are encoded as grayscale
+static void EncodePixelsRGBA32F(const float *rgba, unsigned char *dst, int format, int count)
+{
+    float *values = (float *)dst;
+    unsigned short *halfValues = (unsigned short *)dst;
+
+    switch (format)
+    {
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32:
+        {
+            for (int i = 0; i < count; i++) values[i] = rgba[i*4]*0.299f + rgba[i*4 + 1]*0.587f + rgba[i*4 + 2]*0.114f;
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                values[i*3] = rgba[i*4];
+                values[i*3 + 1] = rgba[i*4 + 1];
+                values[i*3 + 2] = rgba[i*4 + 2];
+            }
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: memcpy(dst, rgba, count*4*sizeof(float)); break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R16:
+        {
+            for (int i = 0; i < count; i++) halfValues[i] = FloatToHalf(rgba[i*4]*0.299f + rgba[i*4 + 1]*0.587f + rgba[i*4 + 2]*0.114f);
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                halfValues[i*3] = FloatToHalf(rgba[i*4]);
+                halfValues[i*3 + 1] = FloatToHalf(rgba[i*4 + 1]);
+                halfValues[i*3 + 2] = FloatToHalf(rgba[i*4 + 2]);
+            }
+        } break;
+        case RAYLIB_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            for (int i = 0; i < count*4; i++) halfValues[i] = FloatToHalf(rgba[i]);
+        } break;
+        default:
+        {
+            // 8 bit per channel (or lower) formats are encoded through RGBA8, in chunks
+            const int bytesPerPixel = RaylibGetPixelDataSize(1, 1, format);
+            unsigned char chunk[64*4];
+
+            for (int i = 0; i < count; i += 64)
+            {
+                int chunkCount = ((count - i) < 64)? (count - i) : 64;
+
+                ConvertPixelsDirect((const unsigned char *)(rgba + i*4), RAYLIB_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, chunk, RAYLIB_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, chunkCount);
+                EncodePixelsRGBA8(chunk, dst + i*bytesPerPixel, format, chunkCount);
+            }
+        } break;
+    }
+}
+
+// Get image unique colors (transparent pixels ignored) in order of appearance, up to maxPaletteSize colors, returns colors count
+// NOTE: Colors are checked against an open addressing hash table, pixels are read in blocks directly from image format
+static int GetImageUniqueColors(RaylibImage image, RaylibColor *palette, int maxPaletteSize)
+{
+    int palCount = 0;
+
+    // Hash table of packed colors, kept at most half full
+    // NOTE: Transparent colors are never stored, so 0 marks an empty slot
+    int hashBits = 6;
+    while ((1 << hashBits) < maxPaletteSize*2) hashBits++;
+
+    const unsigned int hashMask = (1u << hashBits) - 1;
+    unsigned int *hashTable = (unsigned int *)RL_CALLOC(hashMask + 1, sizeof(unsigned int));
+
+    const int bytesPerPixel = RaylibGetPixelDataSize(1, 1, image.format);
+    const int pixelCount = image.width*image.height;
+    unsigned char buffer[IMAGE_FORMAT_BLOCK_PIXELS*4];
+
+    for (int i = 0; (i < pixelCount) && (palCount < maxPaletteSize); i += IMAGE_FORMAT_BLOCK_PIXELS)
+    {
+        int count = ((pixelCount - i) < IMAGE_FORMAT_BLOCK_PIXELS)? (pixelCount - i) : IMAGE_FORMAT_BLOCK_PIXELS;
+        const unsigned char *pixels = LoadPixelsColors((unsigned char *)image.data + (size_t)i*bytesPerPixel, image.format, count, buffer);
+
+        for (int k = 0; k < count; k++)
+        {
+            if (pixels[k*4 + 3] == 0) continue;
+
+            unsigned int color = 0;
+            memcpy(&color, pixels + k*4, 4);
+
+            unsigned int slot = (color*0x9e3779b1u) >> (32 - hashBits);
+            while ((hashTable[slot] != 0) && (hashTable[slot] != color)) slot = (slot + 1) & hashMask;
+
+            if (hashTable[slot] == 0)
+            {
+                hashTable[slot] = color;
+                memcpy(palette + palCount, &color, 4);
+                palCount++;
+
+                if (palCount >= maxPaletteSize) break;
+            }
+        }
+    }
+
+    RL_FREE(hashTable);
+
+    return palCount;
+}
+
+// Quantize image colors (transparent pixels ignored) into palette, up to paletteSize colors, returns colors count
+// NOTE: Colors are grouped in a 5 bit per channel histogram, median-cut splits the most populated and widest
+// boxes on their widest channel until paletteSize boxes, palette colors are the boxes mean colors
+static int QuantizeImageColors(RaylibImage image, RaylibColor *palette, int paletteSize)
+{
+    // Histogram hash table, grown when half full
+    int capacityBits = 12;
+    int capacity = 1 << capacityBits;
+    int binCount = 0;
+    ColorBin *bins = (ColorBin *)RL_CALLOC(capacity, sizeof(ColorBin));
+
+    const int bytesPerPixel = RaylibGetPixelDataSize(1, 1, image.format);
+    const int pixelCount = image.width*image.height;
+    unsigned char buffer[IMAGE_FORMAT_BLOCK_PIXELS*4];
+
+    for (int i = 0; i < pixelCount; i += IMAGE_FORMAT_BLOCK_PIXELS)
+    {
+        int count = ((pixelCount - i) < IMAGE_FORMAT_BLOCK_PIXELS)? (pixelCount - i) : IMAGE_FORMAT_BLOCK_PIXELS;
+        const unsigned char *pixels = LoadPixelsColors((unsigned char *)image.data + (size_t)i*bytesPerPixel, image.format, count, buffer);
+
+        for (int k = 0; k < count; k++)
+        {
+            const unsigned char *pixel = pixels + k*4;
+            if (pixel[3] == 0) continue;
+
+            if (binCount*2 >= capacity)
+            {
+                ColorBin *newBins = (ColorBin *)RL_CALLOC(capacity*2, sizeof(ColorBin));
+
+                for (int j = 0; j < capacity; j++)
+                {
+                    if (bins[j].count == 0) continue;
+
+                    unsigned int slot = (bins[j].key*0x9e3779b1u) >> (32 - (capacityBits + 1));
+                    while (newBins[slot].count != 0) slot = (slot + 1) & (capacity*2 - 1);
+                    newBins[slot] = bins[j];
+                }
+
+                RL_FREE(bins);
+                bins = newBins;
+                capacity *= 2;
+                capacityBits++;
+            }
+
+            unsigned int key = (pixel[0] >> 3) | (pixel[1] >> 3) << 5 | (pixel[2] >> 3) << 10 | (pixel[3] >> 3) << 15;
+            unsigned int slot = (key*0x9e3779b1u) >> (32 - capacityBits);
+            while ((bins[slot].count != 0) && (bins[slot].key != key)) slot = (slot + 1) & (capacity - 1);
+
+            if (bins[slot].count == 0)
+            {
+                bins[slot].key = key;
+                binCount++;
+            }
+
+            bins[slot].count++;
+            for (int c = 0; c < 4; c++) bins[slot].sum[c] += pixel[c];
+        }
+    }
+
+    // Compact used bins at the start of the array, temporary array is required for sorting
+    int used = 0;
+    for (int i = 0; i < capacity; i++) if (bins[i].count != 0) bins[used++] = bins[i];
+
+    ColorBin *sorted = (ColorBin *)RL_MALLOC((used > 0)? used*sizeof(ColorBin) : sizeof(ColorBin));
+    ColorBox *boxes = (ColorBox *)RL_MALLOC(paletteSize*sizeof(ColorBox));
+    int boxCount = 0;
+
+    if (used > 0)
+    {
+        boxes[0] = (ColorBox){ 0, used, 0, 0, 0 };
+        UpdateColorBox(&boxes[0], bins);
+        boxCount = 1;
+    }
+
+    while (boxCount < paletteSize)
+    {
+        // Choose box to split: most populated and widest
+        int split = -1;
+        unsigned long long maxPriority = 0;
+
+        for (int i = 0; i < boxCount; i++)
+        {
+            unsigned long long priority = boxes[i].count*boxes[i].range;
+
+            if ((boxes[i].end - boxes[i].start > 1) && (priority > maxPriority))
+            {
+                maxPriority = priority;
+                split = i;
+            }
+        }
+
+        if (split == -1) break;     // No more boxes can be split
+
+        // Sort box bins on the widest channel (counting sort, 32 values per channel)
+        ColorBox *box = &boxes[split];
+        int shift = box->channel*5;
+        int offsets[33] = { 0 };
+
+        for (int i = box->start; i < box->end; i++) offsets[((bins[i].key >> shift) & 31) + 1]++;
+        for (int v = 0; v < 32; v++) offsets[v + 1] += offsets[v];
+        for (int i = box->start; i < box->end; i++) sorted[offsets[(bins[i].key >> shift) & 31]++] = bins[i];
+        memcpy(bins + box->start, sorted, (box->end - box->start)*sizeof(ColorBin));
+
+        // Split at median pixel, both halves keep at least one bin
+        unsigned long long half = box->count/2;
+        unsigned long long accum = 0;
+        int median = box->start;
+
+        while ((median < (box->end - 2)) && ((accum + bins[median].count) <= half)) accum += bins[median++].count;
+        median++;
+
+        boxes[boxCount] = (ColorBox){ median, box->end, 0, 0, 0 };
+        box->end = median;
+
+        UpdateColorBox(box, bins);
+        UpdateColorBox(&boxes[boxCount], bins);
+        boxCount++;
+    }
+
+    // Palette colors are boxes mean colors
+    for (int i = 0; i < boxCount; i++)
+    {
+        unsigned long long sum[4] = { 0 };
+
+        for (int j = boxes[i].start; j < boxes[i].end; j++)
+        {
+            for (int c = 0; c < 4; c++) sum[c] += bins[j].sum[c];
+        }
+
+        palette[i].r = (unsigned char)((sum[0] + boxes[i].count/2)/boxes[i].count);
+        palette[i].g = (unsigned char)((sum[1] + boxes[i].count/2)/boxes[i].count);
+        palette[i].b = (unsigned char)((sum[2] + boxes[i].count/2)/boxes[i].count);
+        palette[i].a = (unsigned char)((sum[3] + boxes[i].count/2)/boxes[i].count);
+    }
+
+    RL_FREE(boxes);
+    RL_FREE(sorted);
+    RL_FREE(bins);
+
+    return boxCount;
+}
+
+// Update color box pixels count and widest channel range
+static void UpdateColorBox(ColorBox *box, const ColorBin *bins)
+{
+    int minValue[4] = { 31, 31, 31, 31 };
+    int maxValue[4] = { 0 };
+
+    box->count = 0;
+
+    for (int i = box->start; i < box->end; i++)
+    {
+        box->count += bins[i].count;
+
+        for (int c = 0; c < 4; c++)
+        {
+            int value = (bins[i].key >> (c*5)) & 31;
+
+            if (value < minValue[c]) minValue[c] = value;
+            if (value > maxValue[c]) maxValue[c] = value;
+        }
+    }
+
+    box->channel = 0;
+    box->range = 0;
+
+    for (int c = 0; c < 4; c++)
+    {
+        if ((maxValue[c] - minValue[c]) > box->range)
+        {
+            box->range = maxValue[c] - minValue[c];
+            box->channel = c;
+        }
+    }
+}
+
+// Convert half-float (stored as unsigned short) to float
+// REF: https://stackoverflow.com/questions/1659440/32-bit-to-16-bit-floating-point-conversion/60047308#60047308
+static float HalfToFloat(unsigned short x)
+{
+    float result = 0.0f;
+
+    const unsigned int e = (x & 0x7C00) >> 10; // Exponent
+    const unsigned int m = (x & 0x03FF) << 13; // Mantissa
+    const float fm = (float)m;
+    const unsigned int v = (*(unsigned int*)&fm) >> 23; // Evil log2 bit hack to count leading zeros in denormalized format
+    const unsigned int r = (x & 0x8000) << 16 | (e != 0)*((e + 112) << 23 | m) | ((e == 0)&(m != 0))*((v - 37) << 23 | ((m << (150 - v)) & 0x007FE000)); // sign : normalized : denormalized
+
+    result = *(float *)&r;
+
+    return result;
+}
+
+// Convert float to half-float (stored as unsigned short)
+static unsigned short FloatToHalf(float x)
+{
+    unsigned short result = 0;
+
+    const unsigned int b = (*(unsigned int*) & x) + 0x00001000; // Round-to-nearest-even: add last bit after truncated mantissa
+    const unsigned int e = (b & 0x7F800000) >> 23; // Exponent
+    const unsigned int m = b & 0x007FFFFF; // Mantissa; in line below: 0x007FF000 = 0x00800000-0x00001000 = decimal indicator flag - initial rounding
+
+    result = (b & 0x80000000) >> 16 | (e > 112)*((((e - 112) << 10) & 0x7C00) | m >> 13) | ((e < 113) & (e > 101))*((((0x007FF000 + m) >> (125 - e)) + 1) >> 1) | (e > 143)*0x7FFF; // sign : normalized : denormalized : saturate
+
+    return result;
 }
 
 #endif      // RAYLIB_SUPPORT_MODULE_RTEXTURES
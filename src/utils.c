@@ -7,6 +7,11 @@
 *           Show RaylibTraceLog() output messages
 *           NOTE: By default RAYLIB_LOG_DEBUG traces not shown
 *
+*       #define RAYLIB_SUPPORT_WORKER_THREADS
+*           Use a pool of worker threads to split heavy per-element loops, see ParallelFor(),
+*           and a background thread to process tasks in order, see QueueBackgroundTask()
+*           NOTE: If not defined (or not available on platform) ranges and tasks are processed on calling thread
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -49,12 +54,114 @@
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
 
+#if defined(RAYLIB_SUPPORT_WORKER_THREADS) && !defined(RAYLIB_PLATFORM_WEB)
+    #define WORKER_THREADS_AVAILABLE
+    #if defined(_WIN32)
+        #define WIN32_LEAN_AND_MEAN
+        #define NOGDI
+        #define NOUSER
+        #define NOMINMAX
+        #include <windows.h>            // Required for: CreateThread(), SRWLOCK, CONDITION_VARIABLE, GetSystemInfo()
+    #else
+        #include <pthread.h>            // Required for: pthread_create(), pthread_mutex_t, pthread_cond_t
+        #include <unistd.h>             // Required for: sysconf()
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
 #ifndef RAYLIB_MAX_TRACELOG_MSG_LENGTH
     #define RAYLIB_MAX_TRACELOG_MSG_LENGTH     256         // Max length of one trace-log message
 #endif
+#ifndef RAYLIB_MAX_WORKER_THREADS
+    #define RAYLIB_MAX_WORKER_THREADS            8         // Max number of threads used by ParallelFor(), including caller
+#endif
+
+#define BACKGROUND_QUEUE_CAPACITY               16         // Background tasks queue initial capacity, grown when full
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    #if defined(_WIN32)
+        #define WORKER_MUTEX                SRWLOCK
+        #define WORKER_COND                 CONDITION_VARIABLE
+        #define WORKER_THREAD               HANDLE
+        #define WORKER_MUTEX_INITIALIZER    SRWLOCK_INIT
+        #define WORKER_MUTEX_INIT(m)        InitializeSRWLock(m)
+        #define WORKER_MUTEX_DESTROY(m)     (void)(m)
+        #define WORKER_MUTEX_LOCK(m)        AcquireSRWLockExclusive(m)
+        #define WORKER_MUTEX_UNLOCK(m)      ReleaseSRWLockExclusive(m)
+        #define WORKER_COND_INIT(c)         InitializeConditionVariable(c)
+        #define WORKER_COND_DESTROY(c)      (void)(c)
+        #define WORKER_COND_WAIT(c, m)      SleepConditionVariableSRW(c, m, INFINITE, 0)
+        #define WORKER_COND_SIGNAL(c)       WakeConditionVariable(c)
+        #define WORKER_COND_BROADCAST(c)    WakeAllConditionVariable(c)
+        #define WORKER_ATOMIC_LOAD(p)       InterlockedCompareExchange((volatile LONG *)(p), 0, 0)
+        #define WORKER_ATOMIC_STORE(p, v)   InterlockedExchange((volatile LONG *)(p), (v))
+    #else
+        #define WORKER_MUTEX                pthread_mutex_t
+        #define WORKER_COND                 pthread_cond_t
+        #define WORKER_THREAD               pthread_t
+        #define WORKER_MUTEX_INITIALIZER    PTHREAD_MUTEX_INITIALIZER
+        #define WORKER_MUTEX_INIT(m)        pthread_mutex_init(m, NULL)
+        #define WORKER_MUTEX_DESTROY(m)     pthread_mutex_destroy(m)
+        #define WORKER_MUTEX_LOCK(m)        pthread_mutex_lock(m)
+        #define WORKER_MUTEX_UNLOCK(m)      pthread_mutex_unlock(m)
+        #define WORKER_COND_INIT(c)         pthread_cond_init(c, NULL)
+        #define WORKER_COND_DESTROY(c)      pthread_cond_destroy(c)
+        #define WORKER_COND_WAIT(c, m)      pthread_cond_wait(c, m)
+        #define WORKER_COND_SIGNAL(c)       pthread_cond_signal(c)
+        #define WORKER_COND_BROADCAST(c)    pthread_cond_broadcast(c)
+        #define WORKER_ATOMIC_LOAD(p)       __atomic_load_n((p), __ATOMIC_ACQUIRE)
+        #define WORKER_ATOMIC_STORE(p, v)   __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+    #endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+#if defined(WORKER_THREADS_AVAILABLE)
+// Worker threads pool, shared by all modules through ParallelFor()
+// NOTE: Only one range job runs at a time, concurrent or nested calls are processed on calling thread
+typedef struct WorkerPool {
+    WORKER_MUTEX mutex;                 // Pool state access mutex
+    WORKER_COND workCond;               // Signaled when a new job is available or pool is closing
+    WORKER_COND doneCond;               // Signaled when all ranges of current job have been processed
+    WORKER_THREAD threads[RAYLIB_MAX_WORKER_THREADS];   // Worker threads (calling thread not included)
+    int threadCount;                    // Number of worker threads created
+    bool ready;                         // Pool has been initialized
+    bool busy;                          // A job is currently being processed
+    bool quit;                          // Workers must exit
+
+    WorkerRangeFunc func;               // Current job: range processing function
+    void *userData;                     // Current job: user data
+    int count;                          // Current job: number of elements
+    int batchSize;                      // Current job: elements per range
+    int next;                           // Current job: next element to be dispatched
+    int pending;                        // Current job: ranges not yet completed
+} WorkerPool;
+
+// Background task, queued function call
+typedef struct BackgroundTask {
+    BackgroundTaskFunc func;            // Task function
+    void *userData;                     // Task user data
+} BackgroundTask;
+
+// Background tasks queue, processed in order by a single background thread
+// NOTE: Tasks are identified by a ticket, increased by one on every queued task (0 means no task)
+typedef struct BackgroundQueue {
+    WORKER_MUTEX mutex;                 // Queue state access mutex
+    WORKER_COND taskCond;               // Signaled when a new task is queued or thread is closing
+    WORKER_COND doneCond;               // Signaled when a task has been processed
+    WORKER_THREAD thread;               // Background thread
+    bool ready;                         // Background thread has been created
+    bool quit;                          // Background thread must exit (once queue is empty)
+
+    BackgroundTask *tasks;              // Tasks ring buffer, task ticket t is stored at t%capacity
+    int capacity;                       // Tasks ring buffer capacity
+    unsigned int queued;                // Last queued task ticket
+    unsigned int completed;             // Last processed task ticket
+} BackgroundQueue;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -70,12 +177,21 @@ static RaylibSaveFileTextCallback saveFileText = NULL;    // RaylibSaveFileText
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
 //----------------------------------------------------------------------------------
+// NOTE: Screenshots and GIF recordings are encoded and saved on a background thread,
+// trace log and save file data callbacks could be called from that thread, they must be thread-safe
 void RaylibSetTraceLogCallback(RaylibTraceLogCallback callback) { traceLog = callback; }              // Set custom trace log
 void RaylibSetLoadFileDataCallback(RaylibLoadFileDataCallback callback) { loadFileData = callback; }  // Set custom file data loader
 void RaylibSetSaveFileDataCallback(RaylibSaveFileDataCallback callback) { saveFileData = callback; }  // Set custom file data saver
 void RaylibSetLoadFileTextCallback(RaylibLoadFileTextCallback callback) { loadFileText = callback; }  // Set custom file text loader
 void RaylibSetSaveFileTextCallback(RaylibSaveFileTextCallback callback) { saveFileText = callback; }  // Set custom file text saver
 
+#if defined(WORKER_THREADS_AVAILABLE)
+static WorkerPool workerPool = { 0 };               // Worker threads pool, initialized on first ParallelFor() call
+static WORKER_MUTEX workerPoolInitMutex = WORKER_MUTEX_INITIALIZER;   // Worker threads pool and background thread init/close mutex
+static int workerThreadCount = 0;                   // Worker threads count including calling thread, 0 until pool is initialized (atomic)
+static BackgroundQueue backgroundQueue = { 0 };     // Background tasks queue, thread created on first QueueBackgroundTask() call
+#endif
+
 #if defined(RAYLIB_PLATFORM_ANDROID)
 static AAssetManager *assetManager = NULL;          // Android assets manager pointer
 static const char *internalDataPath = NULL;         // Android internal data path
@@ -94,6 +210,13 @@ static fpos_t android_seek(void *cookie, fpos_t offset, int whence);
 static int android_close(void *cookie);
 #endif
 
+#if defined(WORKER_THREADS_AVAILABLE)
+static void InitWorkerPool(void);               // Create worker threads, sized to the number of processors (init mutex must be locked)
+static bool ProcessWorkerRange(void);           // Dispatch and process one range of current job, returns false if no range left
+static bool InitBackgroundQueue(void);          // Create background thread, returns false if not possible (init mutex must be locked)
+static bool IsBackgroundQueueReady(void);       // Check if background thread has been created (init mutex is locked)
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utilities
 //----------------------------------------------------------------------------------
@@ -438,6 +561,245 @@ bool RaylibSaveFileText(const char *fileName, char *text)
     return success;
 }
 
+// Process elements [0, count) in ranges of at least minBatchSize elements, distributed over worker threads
+// NOTE: Calling thread also processes ranges and function returns once all of them are completed,
+// func must be thread-safe and not depend on the order ranges are processed
+void ParallelFor(int count, int minBatchSize, WorkerRangeFunc func, void *userData)
+{
+    if ((count <= 0) || (func == NULL)) return;
+    if (minBatchSize < 1) minBatchSize = 1;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    int threadCount = GetWorkerThreadCount();
+
+    // Not enough work to split, avoid threads synchronization cost
+    if ((threadCount > 1) && (count > minBatchSize))
+    {
+        // Split in a few ranges per thread to balance uneven workloads
+        int batchSize = count/(threadCount*4);
+        if (batchSize < minBatchSize) batchSize = minBatchSize;
+
+        WORKER_MUTEX_LOCK(&workerPool.mutex);
+
+        if (!workerPool.busy)
+        {
+            workerPool.busy = true;
+            workerPool.func = func;
+            workerPool.userData = userData;
+            workerPool.count = count;
+            workerPool.batchSize = batchSize;
+            workerPool.next = 0;
+            workerPool.pending = (count + batchSize - 1)/batchSize;
+            WORKER_COND_BROADCAST(&workerPool.workCond);
+            WORKER_MUTEX_UNLOCK(&workerPool.mutex);
+
+            while (ProcessWorkerRange()) { }
+
+            WORKER_MUTEX_LOCK(&workerPool.mutex);
+            while (workerPool.pending > 0) WORKER_COND_WAIT(&workerPool.doneCond, &workerPool.mutex);
+
+            workerPool.func = NULL;
+            workerPool.userData = NULL;
+            workerPool.count = 0;
+            workerPool.next = 0;
+            workerPool.busy = false;
+            WORKER_MUTEX_UNLOCK(&workerPool.mutex);
+
+            return;
+        }
+
+        // Pool already in use (nested or concurrent call), process on calling thread
+        WORKER_MUTEX_UNLOCK(&workerPool.mutex);
+    }
+#endif
+
+    func(userData, 0, count);
+}
+
+// Get number of threads used by ParallelFor(), including calling thread
+int GetWorkerThreadCount(void)
+{
+    int count = 1;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    // NOTE: Count is cached once pool is initialized, init mutex is only locked before
+    count = (int)WORKER_ATOMIC_LOAD(&workerThreadCount);
+
+    if (count == 0)
+    {
+        WORKER_MUTEX_LOCK(&workerPoolInitMutex);
+        if (!workerPool.ready) InitWorkerPool();
+        count = workerPool.threadCount + 1;
+        WORKER_MUTEX_UNLOCK(&workerPoolInitMutex);
+    }
+#endif
+
+    return count;
+}
+
+// Queue task to be processed in order on background thread, returns task ticket
+// NOTE: Tasks are processed one at a time in queue order, func must be thread-safe regarding calling thread,
+// if background thread is not available (or queue can not grow) the task is processed on calling thread before
+// returning (ticket 0), after previously queued tasks. WARNING: Not to be called from a background task
+unsigned int QueueBackgroundTask(BackgroundTaskFunc func, void *userData)
+{
+    if (func == NULL) return 0;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    WORKER_MUTEX_LOCK(&workerPoolInitMutex);
+    bool ready = backgroundQueue.ready || InitBackgroundQueue();
+    WORKER_MUTEX_UNLOCK(&workerPoolInitMutex);
+
+    if (ready)
+    {
+        WORKER_MUTEX_LOCK(&backgroundQueue.mutex);
+
+        // Queue full, grow ring buffer keeping tasks at ticket%capacity
+        if ((int)(backgroundQueue.queued - backgroundQueue.completed) >= backgroundQueue.capacity)
+        {
+            int capacity = backgroundQueue.capacity*2;
+            BackgroundTask *tasks = (BackgroundTask *)RL_MALLOC(capacity*sizeof(BackgroundTask));
+
+            if (tasks == NULL)
+            {
+                // Ring buffer could not grow, keep current one and process task on calling thread
+                // once queued tasks are done, so tasks are still processed in queue order
+                while (backgroundQueue.completed != backgroundQueue.queued) WORKER_COND_WAIT(&backgroundQueue.doneCond, &backgroundQueue.mutex);
+                WORKER_MUTEX_UNLOCK(&backgroundQueue.mutex);
+
+                RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "THREADS: Background queue could not grow, task processed on calling thread");
+                func(userData);
+
+                return 0;
+            }
+
+            for (unsigned int t = backgroundQueue.completed + 1; t != backgroundQueue.queued + 1; t++) tasks[t%capacity] = backgroundQueue.tasks[t%backgroundQueue.capacity];
+
+            RL_FREE(backgroundQueue.tasks);
+            backgroundQueue.tasks = tasks;
+            backgroundQueue.capacity = capacity;
+        }
+
+        backgroundQueue.queued++;
+        if (backgroundQueue.queued == 0) backgroundQueue.queued++;     // Ticket 0 is reserved (no task)
+
+        unsigned int ticket = backgroundQueue.queued;
+        backgroundQueue.tasks[ticket%backgroundQueue.capacity] = (BackgroundTask){ func, userData };
+
+        WORKER_COND_SIGNAL(&backgroundQueue.taskCond);
+        WORKER_MUTEX_UNLOCK(&backgroundQueue.mutex);
+
+        return ticket;
+    }
+#endif
+
+    func(userData);
+
+    return 0;
+}
+
+// Check if task (and all tasks queued before it) has been processed
+bool IsBackgroundTaskDone(unsigned int ticket)
+{
+    bool done = true;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    if ((ticket != 0) && IsBackgroundQueueReady())
+    {
+        WORKER_MUTEX_LOCK(&backgroundQueue.mutex);
+        done = ((int)(backgroundQueue.completed - ticket) >= 0);
+        WORKER_MUTEX_UNLOCK(&backgroundQueue.mutex);
+    }
+#endif
+
+    return done;
+}
+
+// Wait until task (and all tasks queued before it) has been processed
+void WaitBackgroundTask(unsigned int ticket)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    if ((ticket != 0) && IsBackgroundQueueReady())
+    {
+        WORKER_MUTEX_LOCK(&backgroundQueue.mutex);
+        while ((int)(backgroundQueue.completed - ticket) < 0) WORKER_COND_WAIT(&backgroundQueue.doneCond, &backgroundQueue.mutex);
+        WORKER_MUTEX_UNLOCK(&backgroundQueue.mutex);
+    }
+#endif
+}
+
+// Close worker threads pool and background thread
+// NOTE: Queued background tasks are processed before closing,
+// pool and thread are initialized again on next ParallelFor() or QueueBackgroundTask() call
+void CloseWorkerThreads(void)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    WORKER_MUTEX_LOCK(&workerPoolInitMutex);
+
+    if (backgroundQueue.ready)
+    {
+        WORKER_MUTEX_LOCK(&backgroundQueue.mutex);
+        backgroundQueue.quit = true;
+        WORKER_COND_SIGNAL(&backgroundQueue.taskCond);
+        WORKER_MUTEX_UNLOCK(&backgroundQueue.mutex);
+
+    #if defined(_WIN32)
+        WaitForSingleObject(backgroundQueue.thread, INFINITE);
+        CloseHandle(backgroundQueue.thread);
+    #else
+        pthread_join(backgroundQueue.thread, NULL);
+    #endif
+
+        WORKER_COND_DESTROY(&backgroundQueue.doneCond);
+        WORKER_COND_DESTROY(&backgroundQueue.taskCond);
+        WORKER_MUTEX_DESTROY(&backgroundQueue.mutex);
+        RL_FREE(backgroundQueue.tasks);
+
+        // NOTE: Tickets keep increasing, tickets returned before closing are reported as done
+        unsigned int ticket = backgroundQueue.queued;
+        backgroundQueue = (BackgroundQueue){ 0 };
+        backgroundQueue.queued = ticket;
+        backgroundQueue.completed = ticket;
+
+        RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "THREADS: Background thread closed successfully");
+    }
+
+    if (!workerPool.ready)
+    {
+        WORKER_MUTEX_UNLOCK(&workerPoolInitMutex);
+        return;
+    }
+
+    WORKER_MUTEX_LOCK(&workerPool.mutex);
+    workerPool.quit = true;
+    WORKER_COND_BROADCAST(&workerPool.workCond);
+    WORKER_MUTEX_UNLOCK(&workerPool.mutex);
+
+    for (int i = 0; i < workerPool.threadCount; i++)
+    {
+    #if defined(_WIN32)
+        WaitForSingleObject(workerPool.threads[i], INFINITE);
+        CloseHandle(workerPool.threads[i]);
+    #else
+        pthread_join(workerPool.threads[i], NULL);
+    #endif
+    }
+
+    WORKER_COND_DESTROY(&workerPool.doneCond);
+    WORKER_COND_DESTROY(&workerPool.workCond);
+    WORKER_MUTEX_DESTROY(&workerPool.mutex);
+
+    workerPool.threadCount = 0;
+    workerPool.quit = false;
+    workerPool.ready = false;
+    WORKER_ATOMIC_STORE(&workerThreadCount, 0);
+
+    WORKER_MUTEX_UNLOCK(&workerPoolInitMutex);
+
+    RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "THREADS: Worker threads pool closed successfully");
+#endif
+}
+
 #if defined(RAYLIB_PLATFORM_ANDROID)
 // Initialize asset manager from android app
 void InitAssetManager(AAssetManager *manager, const char *dataPath)
@@ -508,3 +870,180 @@ static int android_close(void *cookie)
     return 0;
 }
 #endif  // RAYLIB_PLATFORM_ANDROID
+
+#if defined(WORKER_THREADS_AVAILABLE)
+// Dispatch and process one range of current job
+static bool ProcessWorkerRange(void)
+{
+    WORKER_MUTEX_LOCK(&workerPool.mutex);
+
+    if (workerPool.next >= workerPool.count)
+    {
+        WORKER_MUTEX_UNLOCK(&workerPool.mutex);
+        return false;
+    }
+
+    int start = workerPool.next;
+    int end = start + workerPool.batchSize;
+    if (end > workerPool.count) end = workerPool.count;
+    workerPool.next = end;
+
+    WorkerRangeFunc func = workerPool.func;
+    void *userData = workerPool.userData;
+    WORKER_MUTEX_UNLOCK(&workerPool.mutex);
+
+    func(userData, start, end);
+
+    WORKER_MUTEX_LOCK(&workerPool.mutex);
+    workerPool.pending--;
+    if (workerPool.pending == 0) WORKER_COND_SIGNAL(&workerPool.doneCond);
+    WORKER_MUTEX_UNLOCK(&workerPool.mutex);
+
+    return true;
+}
+
+// Worker thread main loop: wait for ranges to process until pool is closed
+#if defined(_WIN32)
+static DWORD WINAPI WorkerThreadMain(LPVOID arg)
+#else
+static void *WorkerThreadMain(void *arg)
+#endif
+{
+    (void)arg;
+
+    while (true)
+    {
+        WORKER_MUTEX_LOCK(&workerPool.mutex);
+        while (!workerPool.quit && (workerPool.next >= workerPool.count)) WORKER_COND_WAIT(&workerPool.workCond, &workerPool.mutex);
+        bool quit = workerPool.quit;
+        WORKER_MUTEX_UNLOCK(&workerPool.mutex);
+
+        if (quit) break;
+
+        while (ProcessWorkerRange()) { }
+    }
+
+    return 0;
+}
+
+// Create worker threads, one less than available processors (calling thread also works)
+static void InitWorkerPool(void)
+{
+    int processorCount = 1;
+
+#if defined(_WIN32)
+    SYSTEM_INFO info = { 0 };
+    GetSystemInfo(&info);
+    processorCount = (int)info.dwNumberOfProcessors;
+#else
+    processorCount = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    int threadCount = processorCount - 1;
+    if (threadCount > (RAYLIB_MAX_WORKER_THREADS - 1)) threadCount = RAYLIB_MAX_WORKER_THREADS - 1;
+    if (threadCount < 0) threadCount = 0;
+
+    WORKER_MUTEX_INIT(&workerPool.mutex);
+    WORKER_COND_INIT(&workerPool.workCond);
+    WORKER_COND_INIT(&workerPool.doneCond);
+
+    for (int i = 0; i < threadCount; i++)
+    {
+    #if defined(_WIN32)
+        workerPool.threads[workerPool.threadCount] = CreateThread(NULL, 0, WorkerThreadMain, NULL, 0, NULL);
+        if (workerPool.threads[workerPool.threadCount] == NULL) break;
+    #else
+        if (pthread_create(&workerPool.threads[workerPool.threadCount], NULL, WorkerThreadMain, NULL) != 0) break;
+    #endif
+        workerPool.threadCount++;
+    }
+
+    workerPool.ready = true;
+    WORKER_ATOMIC_STORE(&workerThreadCount, workerPool.threadCount + 1);
+
+    RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "THREADS: Worker threads pool initialized successfully (%i threads)", workerPool.threadCount);
+}
+
+// Background thread main loop: process queued tasks in order until thread is closed and queue is empty
+#if defined(_WIN32)
+static DWORD WINAPI BackgroundThreadMain(LPVOID arg)
+#else
+static void *BackgroundThreadMain(void *arg)
+#endif
+{
+    (void)arg;
+
+    WORKER_MUTEX_LOCK(&backgroundQueue.mutex);
+
+    while (true)
+    {
+        while (!backgroundQueue.quit && (backgroundQueue.completed == backgroundQueue.queued)) WORKER_COND_WAIT(&backgroundQueue.taskCond, &backgroundQueue.mutex);
+
+        if (backgroundQueue.completed == backgroundQueue.queued) break;     // Closing, all tasks processed
+
+        unsigned int ticket = backgroundQueue.completed + 1;
+        if (ticket == 0) ticket++;
+        BackgroundTask task = backgroundQueue.tasks[ticket%backgroundQueue.capacity];
+        WORKER_MUTEX_UNLOCK(&backgroundQueue.mutex);
+
+        task.func(task.userData);
+
+        WORKER_MUTEX_LOCK(&backgroundQueue.mutex);
+        backgroundQueue.completed = ticket;
+        WORKER_COND_BROADCAST(&backgroundQueue.doneCond);
+    }
+
+    WORKER_MUTEX_UNLOCK(&backgroundQueue.mutex);
+
+    return 0;
+}
+
+// Check if background thread has been created
+// NOTE: Ready state is written under init mutex (background queue init and close)
+static bool IsBackgroundQueueReady(void)
+{
+    WORKER_MUTEX_LOCK(&workerPoolInitMutex);
+    bool ready = backgroundQueue.ready;
+    WORKER_MUTEX_UNLOCK(&workerPoolInitMutex);
+
+    return ready;
+}
+
+// Create background thread, returns false if not possible
+static bool InitBackgroundQueue(void)
+{
+    WORKER_MUTEX_INIT(&backgroundQueue.mutex);
+    WORKER_COND_INIT(&backgroundQueue.taskCond);
+    WORKER_COND_INIT(&backgroundQueue.doneCond);
+
+    backgroundQueue.capacity = BACKGROUND_QUEUE_CAPACITY;
+    backgroundQueue.tasks = (BackgroundTask *)RL_MALLOC(backgroundQueue.capacity*sizeof(BackgroundTask));
+    backgroundQueue.quit = false;
+    backgroundQueue.ready = false;
+
+    // NOTE: Thread is only created if tasks ring buffer could be allocated
+    if (backgroundQueue.tasks != NULL)
+    {
+#if defined(_WIN32)
+        backgroundQueue.thread = CreateThread(NULL, 0, BackgroundThreadMain, NULL, 0, NULL);
+        backgroundQueue.ready = (backgroundQueue.thread != NULL);
+#else
+        backgroundQueue.ready = (pthread_create(&backgroundQueue.thread, NULL, BackgroundThreadMain, NULL) == 0);
+#endif
+    }
+
+    if (backgroundQueue.ready) RAYLIB_TRACELOG(RAYLIB_LOG_INFO, "THREADS: Background thread initialized successfully");
+    else
+    {
+        RL_FREE(backgroundQueue.tasks);
+        backgroundQueue.tasks = NULL;
+        WORKER_COND_DESTROY(&backgroundQueue.doneCond);
+        WORKER_COND_DESTROY(&backgroundQueue.taskCond);
+        WORKER_MUTEX_DESTROY(&backgroundQueue.mutex);
+
+        RAYLIB_TRACELOG(RAYLIB_LOG_WARNING, "THREADS: Background thread could not be created, tasks processed on calling thread");
+    }
+
+    return backgroundQueue.ready;
+}
+#endif  // WORKER_THREADS_AVAILABLE
@@ -55,7 +55,11 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Range processing function used by ParallelFor(), processes elements [start, end)
+typedef void (*WorkerRangeFunc)(void *userData, int start, int end);
+
+// Task function used by QueueBackgroundTask(), processed on background thread
+typedef void (*BackgroundTaskFunc)(void *userData);
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -69,6 +73,14 @@
 extern "C" {            // Prevents name mangling of functions
 #endif
 
+// Worker threads functions
+void ParallelFor(int count, int minBatchSize, WorkerRangeFunc func, void *userData);   // Process elements [0, count) in ranges distributed over worker threads
+int GetWorkerThreadCount(void);                                                         // Get number of threads used by ParallelFor(), including calling thread
+unsigned int QueueBackgroundTask(BackgroundTaskFunc func, void *userData);              // Queue task to be processed in order on background thread, returns task ticket
+bool IsBackgroundTaskDone(unsigned int ticket);                                         // Check if task (and all tasks queued before it) has been processed
+void WaitBackgroundTask(unsigned int ticket);                                           // Wait until task (and all tasks queued before it) has been processed
+void CloseWorkerThreads(void);                                                          // Close worker threads pool and background thread (queued tasks are processed)
+
 #if defined(RAYLIB_PLATFORM_ANDROID)
 void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initialize asset manager from android app
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!